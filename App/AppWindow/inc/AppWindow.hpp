@@ -45,6 +45,12 @@
 
 #include "Window.hpp"
 #include "InputListener.hpp"
+#include "RenderGraph.hpp"
+#include "DynamicResolutionController.hpp"
+#include "FrameCaptureWriter.hpp"
+#include "Clock.hpp"
+#include "FixedTimestep.hpp"
+#include "FramePipeline.hpp"
 
 class GraphicsEngine;
 class SwapChain;
@@ -53,6 +59,11 @@ class IndexBuffer;
 class VertexShader;
 class PixelShader;
 class ConstantBuffer;
+class PipelineState;
+class ShaderProgram;
+class GpuFrameTimer;
+class DynamicResolutionTarget;
+class FrameCapture;
 class InputSystem;
 class Point;
 
@@ -91,11 +102,29 @@ public:
     /// </summary>
     AppWindow();
 
+    /*--------------------------------------------------------------
+		Types and Type Aliases
+    --------------------------------------------------------------*/
+
+	/// <summary>
+	/// What the render thread needs of a simulated frame.
+	/// </summary>
+	struct FramePacket
+	{
+		unsigned int width = 0;
+		unsigned int height = 0;
+		float rot_x = 0.0f;
+		float rot_y = 0.0f;
+		float scale_cube = 1.0f;
+		unsigned int time_ms = 0;
+		bool toggle_recording = false;
+	};
+
     /*--------------------------------------------------------------
 		Public Methods
     --------------------------------------------------------------*/
 
-	void updateQuadPosition();
+	void updateQuadPosition(const FramePacket& f_packet);
 
     /// <summary>
     /// Destructor for the AppWindow class.
@@ -146,6 +175,25 @@ public:
 
 private:
 
+    /*--------------------------------------------------------------
+        Private Methods
+    --------------------------------------------------------------*/
+
+	/// <summary>
+	/// Starts recording to capture.y4m, or stops and writes the frames still in flight.
+	/// </summary>
+	void toggleRecording();
+
+	/// <summary>
+	/// Draws and presents a frame; runs on the render thread.
+	/// </summary>
+	void render(FramePacket& f_packet);
+
+	/// <summary>
+	/// Advances the cube by one fixed step of f_step seconds.
+	/// </summary>
+	void simulate(float f_step);
+
     /*--------------------------------------------------------------
         Private Data Members
     --------------------------------------------------------------*/
@@ -157,22 +205,32 @@ private:
     SwapChain* m_swap_chain_p;
 
 	/// <summary>
-	/// A pointer to the VertexBuffer instance associated with the AppWindow.
+	/// A pointer to the VertexBuffer holding the cube positions (input slot 0).
 	/// </summary>
 	VertexBuffer* m_vertex_buffer_p;
 
+	/// <summary>
+	/// A pointer to the VertexBuffer holding the cube colors (input slot 1).
+	/// </summary>
+	VertexBuffer* m_color_buffer_p;
+
 	/// <summary>
 	/// A pointer to the IndexBuffer instance associated with the AppWindow.
 	/// </summary>
 	IndexBuffer* m_index_buffer_p;
 
 	/// <summary>
-	/// A pointer to the VertexShader instance associated with the AppWindow.
+	/// A pointer to the ShaderProgram whose variants draw the cube.
+	/// </summary>
+	ShaderProgram* m_shader_program_p;
+
+	/// <summary>
+	/// A pointer to the VertexShader of the active variant (owned by m_shader_program_p).
 	/// </summary>
 	VertexShader* m_vertex_shader_p;
 
 	/// <summary>
-	/// A pointer to the PixelShader instance associated with the AppWindow.
+	/// A pointer to the PixelShader of the active variant (owned by m_shader_program_p).
 	/// </summary>
 	PixelShader* m_pixel_shader_p;
 
@@ -180,16 +238,75 @@ private:
 	/// A pointer to the ConstantBuffer instance associated with the AppWindow.
 	/// </summary>
 	ConstantBuffer* m_constant_buffer_p;
+
+	/// <summary>
+	/// A pointer to the PipelineState used to draw the cube (owned by the GraphicsEngine).
+	/// </summary>
+	PipelineState* m_pipeline_state_p;
+
+	/// <summary>
+	/// Render graph describing the frame, rebuilt every update.
+	/// </summary>
+	RenderGraph m_render_graph;
+
+	/// <summary>
+	/// Scene color rendered at the dynamic resolution, upscaled into the back buffer.
+	/// </summary>
+	DynamicResolutionTarget* m_scene_target_p;
+
+	/// <summary>
+	/// Measures the GPU time of a frame; feeds the resolution controller.
+	/// </summary>
+	GpuFrameTimer* m_gpu_timer_p;
+
+	/// <summary>
+	/// Picks the render scale from the measured GPU frame times.
+	/// </summary>
+	DynamicResolutionController m_resolution_controller;
+
+	/// <summary>
+	/// Reads the back buffer back while recording, toggled with R.
+	/// </summary>
+	FrameCapture* m_frame_capture_p;
+
+	/// <summary>
+	/// Encodes the recorded frames to capture.y4m on its own thread.
+	/// </summary>
+	FrameCaptureWriter m_capture_writer;
 	
-	long m_old_delta;
-	long m_new_delta;
-	float m_delta_time;
+	/// <summary>
+	/// Renders on its own thread while the next frame is simulated; the members above belong to that thread while it runs.
+	/// </summary>
+	FramePipeline<FramePacket> m_frame_pipeline;
+
+	/// <summary>
+	/// R was released; the render thread starts or stops the recording with the next frame.
+	/// </summary>
+	bool m_toggle_recording = false;
+
+	/// <summary>
+	/// Frame time on the monotonic clock; feeds the fixed timestep.
+	/// </summary>
+	Clock m_clock;
+
+	/// <summary>
+	/// Runs the cube simulation at 60 Hz whatever the frame rate.
+	/// </summary>
+	FixedTimestep m_timestep;
 
     float m_delta_pos;
 	float m_delta_scale;
 
-    float m_rot_x = 0.0f;
-    float m_rot_y = 0.0f;
+	// Simulated rotation, drawn blended between the last two steps
+	Interpolated<float> m_rot_x;
+	Interpolated<float> m_rot_y;
+
+	// Input of the frame, applied by the steps: key rotation speed in radians per second
+	// and mouse rotation not simulated yet in radians
+	float m_rot_speed_x = 0.0f;
+	float m_rot_speed_y = 0.0f;
+	float m_mouse_rot_x = 0.0f;
+	float m_mouse_rot_y = 0.0f;
 
 	float m_scale_cube = 1.0f;
 
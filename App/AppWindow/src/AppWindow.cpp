@@ -48,10 +48,30 @@
 #include "VertexShader.hpp"
 #include "PixelShader.hpp"
 #include "ConstantBuffer.hpp"
+#include "PipelineState.hpp"
+#include "ShaderProgram.hpp"
+#include "VertexFormat.hpp"
+#include "InputLayoutCache.hpp"
 #include "Vector3D.hpp"
 #include "Matrix4x4.hpp"
 #include "InputSystem.hpp"
+#include "GpuFrameTimer.hpp"
+#include "DynamicResolutionTarget.hpp"
+#include "FrameCapture.hpp"
+#include "JobSystem.hpp"
+#include "StartupTrace.hpp"
+#include "SubsystemBootstrap.hpp"
 #include <iostream>
+#include <cstddef>
+
+namespace
+{
+	// Per pixel of mouse movement; what scaling by the frame delta gave at 60 fps
+	constexpr float mouse_rotation_per_pixel = 1.0f / 60.0f;
+
+	// Radians per second while a rotation key is held
+	constexpr float key_rotation_speed = 3.14f;
+}
 
 struct vertex
 {
@@ -60,6 +80,30 @@ struct vertex
 	Vector3D color1;
 };
 
+using VertexPCC = VertexFormat<vertex,
+	VertexElement<VertexSemantic::Position, 0, Vector3D>,
+	VertexElement<VertexSemantic::Color, 0, Vector3D>,
+	VertexElement<VertexSemantic::Color, 1, Vector3D>>;
+
+static_assert(VertexPCC::offsetOf(1) == offsetof(vertex, color), "vertex::color offset mismatch");
+static_assert(VertexPCC::offsetOf(2) == offsetof(vertex, color1), "vertex::color1 offset mismatch");
+
+struct vertex_colors
+{
+	Vector3D color;
+	Vector3D color1;
+};
+
+// The cube is drawn from two streams so position-only passes fetch 12 of the 36 bytes per vertex
+using PositionStream = VertexFormat<Vector3D,
+	VertexElement<VertexSemantic::Position, 0, Vector3D>>;
+
+using ColorStream = VertexFormat<vertex_colors,
+	VertexElement<VertexSemantic::Color, 0, Vector3D>,
+	VertexElement<VertexSemantic::Color, 1, Vector3D>>;
+
+using VertexPCCStreams = VertexStreamFormat<PositionStream, ColorStream>;
+
 __declspec(align(16))
 struct constant
 {
@@ -70,29 +114,25 @@ struct constant
 };
 
 AppWindow::AppWindow()
-	: m_swap_chain_p(nullptr), m_vertex_buffer_p(nullptr), m_vertex_shader_p(nullptr), m_pixel_shader_p(nullptr), m_constant_buffer_p(nullptr), 
-	m_old_delta(0), m_new_delta(0), m_delta_time(0), m_delta_pos(0), m_delta_scale(0)
+	: m_swap_chain_p(nullptr), m_vertex_buffer_p(nullptr), m_color_buffer_p(nullptr), m_index_buffer_p(nullptr), m_shader_program_p(nullptr), m_vertex_shader_p(nullptr), m_pixel_shader_p(nullptr), m_constant_buffer_p(nullptr), m_pipeline_state_p(nullptr),
+	m_scene_target_p(nullptr), m_gpu_timer_p(nullptr), m_frame_capture_p(nullptr),
+	m_delta_pos(0), m_delta_scale(0)
 {
-	// Constructor
+	// At most 0.1 s of catch-up: on demand frames can be seconds apart, do not let the first input after a pause jump
+	FixedTimestepSettings timestep_settings;
+	timestep_settings.step_seconds = 1.0 / 60.0;
+	timestep_settings.max_steps = 6;
+	m_timestep.setSettings(timestep_settings);
 }
 
-void AppWindow::updateQuadPosition()
+void AppWindow::updateQuadPosition(const FramePacket& f_packet)
 {
 	constant cc;
-	cc.m_time = ::GetTickCount64();
-
-	m_delta_pos += m_delta_time / 10.0f;
-
-	if (m_delta_pos > 1.0f)
-	{
-		m_delta_pos = 0;
-	}
+	cc.m_time = f_packet.time_ms;
 
 	Matrix4x4 temp;
 
 	//cc.m_world.setTranslation(Vector3D::lerp(Vector3D(-1.5f,-1.5f,0), Vector3D(1.5f,1.5f,0), m_delta_pos));
-	
-	m_delta_scale += m_delta_time / 0.55f;
 
 	//cc.m_world.setScale(Vector3D::lerp(Vector3D(0.5f,0.5f,0), Vector3D(1.0f, 1.0f,0), (sin(m_delta_scale)+1.0f)/2.0f));
 
@@ -100,14 +140,14 @@ void AppWindow::updateQuadPosition()
 
 	//cc.m_world *= temp;
 
-	cc.m_world.setScale(Vector3D(m_scale_cube, m_scale_cube, m_scale_cube));
+	cc.m_world.setScale(Vector3D(f_packet.scale_cube, f_packet.scale_cube, f_packet.scale_cube));
 
 	temp.setIdentity();
-	temp.setRotationX(m_rot_x);
+	temp.setRotationX(f_packet.rot_x);
 	cc.m_world *= temp;
 
 	temp.setIdentity();
-	temp.setRotationY(m_rot_y);
+	temp.setRotationY(f_packet.rot_y);
 	cc.m_world *= temp;
 
 	temp.setIdentity();
@@ -117,8 +157,8 @@ void AppWindow::updateQuadPosition()
 	cc.m_view.setIdentity();
 	cc.m_proj.setOrthoLH
 	(
-		(this->getClientWindowRect().right - this->getClientWindowRect().left) / 300.0f,
-		(this->getClientWindowRect().bottom - this->getClientWindowRect().top) / 300.0f,
+		f_packet.width / 300.0f,
+		f_packet.height / 300.0f,
 		-4.0f,
 		4.0f
 	);
@@ -133,125 +173,369 @@ AppWindow::~AppWindow()
 
 void AppWindow::onCreate()
 {
+	StartupTrace::Scope trace("AppWindow::onCreate");
 	InputSystem::get()->addListener(this);
-	GraphicsEngine::get()->init();
-	m_swap_chain_p = GraphicsEngine::get()->createSwapChain();
+	JobSystem::get()->init();
 
 	RECT rectClient = this->getClientWindowRect();
 	LONG rcWidth = rectClient.right - rectClient.left;
 	LONG rcHeight = rectClient.bottom - rectClient.top;
 
-	if (!m_swap_chain_p->init(this->m_hwnd, rcWidth, rcHeight, GraphicsEngine::get()))
+	// Every step needs the device; past it shaders, buffers and the swap chain are independent
+	SubsystemBootstrap bootstrap;
+	bootstrap.add("GraphicsEngine", {}, SubsystemThread::Any, []()
 	{
-		std::cout << "Swap chain initialization failed" << std::endl;
-	}
+		return GraphicsEngine::get()->init();
+	});
+
+	// DXGI sends messages to the window of the swap chain, so it is created on the thread owning the window
+	bootstrap.add("SwapChain", { "GraphicsEngine" }, SubsystemThread::Main, [this, rcWidth, rcHeight]()
+	{
+		m_swap_chain_p = GraphicsEngine::get()->createSwapChain();
+		return m_swap_chain_p->init(this->m_hwnd, rcWidth, rcHeight, GraphicsEngine::get());
+	});
 
-	vertex vertex_list[] =
+	bootstrap.add("Shaders", { "GraphicsEngine" }, SubsystemThread::Any, [this]()
 	{
-		//X - Y - Z
-		//FRONT FACE
-		{Vector3D(-0.5f,-0.5f,-0.5f),    Vector3D(1,0,0),  Vector3D(0.2f,0,0) },
-		{Vector3D(-0.5f,0.5f,-0.5f),    Vector3D(1,1,0), Vector3D(0.2f,0.2f,0) },
-		{ Vector3D(0.5f,0.5f,-0.5f),   Vector3D(1,1,0),  Vector3D(0.2f,0.2f,0) },
-		{ Vector3D(0.5f,-0.5f,-0.5f),     Vector3D(1,0,0), Vector3D(0.2f,0,0) },
-
-		//BACK FACE
-		{ Vector3D(0.5f,-0.5f,0.5f),    Vector3D(0,1,0), Vector3D(0,0.2f,0) },
-		{ Vector3D(0.5f,0.5f,0.5f),    Vector3D(0,1,1), Vector3D(0,0.2f,0.2f) },
-		{ Vector3D(-0.5f,0.5f,0.5f),   Vector3D(0,1,1),  Vector3D(0,0.2f,0.2f) },
-		{ Vector3D(-0.5f,-0.5f,0.5f),     Vector3D(0,1,0), Vector3D(0,0.2f,0) }
-	};
-
-	m_vertex_buffer_p = GraphicsEngine::get()->createVertexBuffer();
-
-	unsigned int index_list[] = 
+		m_shader_program_p = GraphicsEngine::get()->createShaderProgram(L"VertexShader.hlsl", "vsmain", L"PixelShader.hlsl", "psmain");
+		if (!m_shader_program_p)
+		{
+			return false;
+		}
+		m_shader_program_p->declareKeyword("ANIMATED_COLOR");
+
+		const ShaderProgram::Variant* variant = m_shader_program_p->getVariant(m_shader_program_p->makeKey({ "ANIMATED_COLOR" }));
+		if (!variant)
+		{
+			return false;
+		}
+		m_vertex_shader_p = variant->vertex_shader;
+		m_pixel_shader_p = variant->pixel_shader;
+		return true;
+	});
+
+	bootstrap.add("Geometry", { "GraphicsEngine" }, SubsystemThread::Any, [this]()
 	{
-		// FRONT SIDE
-		0, 1, 2, // first triangle
-		2, 3, 0, // second triangle
-		// BACK SIDE
-		4, 5, 6,
-		6, 7, 4,
-		// TOP SIDE
-		1, 6, 5,
-		5, 2, 1,
-		// BOTTOM SIDE
-		7, 0, 3,
-		3, 4, 7,
-		// RIGHT SIDE
-		3, 2, 5,
-		5, 4, 3,
-		// LEFT SIDE
-		7, 6, 1,
-		1, 0, 7
-	};
-
-	m_index_buffer_p = GraphicsEngine::get()->createIndexBuffer();
-	m_index_buffer_p->load(index_list, ARRAYSIZE(index_list), GraphicsEngine::get());
-
-	void* shader_byte_code = nullptr;
-	size_t shader_size = 0;
-	GraphicsEngine::get()->compileVertexShader(L"VertexShader.hlsl", "vsmain", &shader_byte_code, &shader_size);
-	
-	m_vertex_shader_p = GraphicsEngine::get()->createVertexShader(shader_byte_code, shader_size);
-	m_vertex_buffer_p->load(vertex_list, sizeof(vertex), ARRAYSIZE(vertex_list), shader_byte_code, shader_size, GraphicsEngine::get());
-
-	GraphicsEngine::get()->releaseCompiledShader();
-
-	GraphicsEngine::get()->compilePixelShader(L"PixelShader.hlsl", "psmain", &shader_byte_code, &shader_size);
-	m_pixel_shader_p = GraphicsEngine::get()->createPixelShader(shader_byte_code, shader_size);
-	GraphicsEngine::get()->releaseCompiledShader();
+		vertex vertex_list[] =
+		{
+			//X - Y - Z
+			//FRONT FACE
+			{Vector3D(-0.5f,-0.5f,-0.5f),    Vector3D(1,0,0),  Vector3D(0.2f,0,0) },
+			{Vector3D(-0.5f,0.5f,-0.5f),    Vector3D(1,1,0), Vector3D(0.2f,0.2f,0) },
+			{ Vector3D(0.5f,0.5f,-0.5f),   Vector3D(1,1,0),  Vector3D(0.2f,0.2f,0) },
+			{ Vector3D(0.5f,-0.5f,-0.5f),     Vector3D(1,0,0), Vector3D(0.2f,0,0) },
+
+			//BACK FACE
+			{ Vector3D(0.5f,-0.5f,0.5f),    Vector3D(0,1,0), Vector3D(0,0.2f,0) },
+			{ Vector3D(0.5f,0.5f,0.5f),    Vector3D(0,1,1), Vector3D(0,0.2f,0.2f) },
+			{ Vector3D(-0.5f,0.5f,0.5f),   Vector3D(0,1,1),  Vector3D(0,0.2f,0.2f) },
+			{ Vector3D(-0.5f,-0.5f,0.5f),     Vector3D(0,1,0), Vector3D(0,0.2f,0) }
+		};
+
+		unsigned int index_list[] = 
+		{
+			// FRONT SIDE
+			0, 1, 2, // first triangle
+			2, 3, 0, // second triangle
+			// BACK SIDE
+			4, 5, 6,
+			6, 7, 4,
+			// TOP SIDE
+			1, 6, 5,
+			5, 2, 1,
+			// BOTTOM SIDE
+			7, 0, 3,
+			3, 4, 7,
+			// RIGHT SIDE
+			3, 2, 5,
+			5, 4, 3,
+			// LEFT SIDE
+			7, 6, 1,
+			1, 0, 7
+		};
+
+		m_index_buffer_p = GraphicsEngine::get()->createIndexBuffer();
+		if (!m_index_buffer_p->load(index_list, ARRAYSIZE(index_list), GraphicsEngine::get()))
+		{
+			return false;
+		}
+
+		Vector3D position_list[ARRAYSIZE(vertex_list)];
+		vertex_colors color_list[ARRAYSIZE(vertex_list)];
+		copyVertexStream<VertexPCC, PositionStream>(vertex_list, ARRAYSIZE(vertex_list), position_list);
+		copyVertexStream<VertexPCC, ColorStream>(vertex_list, ARRAYSIZE(vertex_list), color_list);
+
+		m_vertex_buffer_p = GraphicsEngine::get()->createVertexBuffer();
+		m_color_buffer_p = GraphicsEngine::get()->createVertexBuffer();
+		return m_vertex_buffer_p->load<PositionStream>(position_list, ARRAYSIZE(position_list), GraphicsEngine::get()) &&
+			m_color_buffer_p->load<ColorStream>(color_list, ARRAYSIZE(color_list), GraphicsEngine::get());
+	});
+
+	bootstrap.add("PipelineState", { "Shaders" }, SubsystemThread::Any, [this]()
+	{
+		const ShaderProgram::Variant* variant = m_shader_program_p->getVariant(m_shader_program_p->makeKey({ "ANIMATED_COLOR" }));
+		ID3D11InputLayout* input_layout = InputLayoutCache::get()->getInputLayout<VertexPCCStreams>(variant->vertex_byte_code.data(),
+			variant->vertex_byte_code.size(), GraphicsEngine::get());
+
+		PipelineStateDesc pipeline_desc;
+		pipeline_desc.vertex_shader = m_vertex_shader_p;
+		pipeline_desc.pixel_shader = m_pixel_shader_p;
+		pipeline_desc.input_layout = input_layout;
+		pipeline_desc.topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+		m_pipeline_state_p = GraphicsEngine::get()->createPipelineState(pipeline_desc);
+		return m_pipeline_state_p != nullptr;
+	});
+
+	bootstrap.add("FrameResources", { "GraphicsEngine" }, SubsystemThread::Any, [this, rcWidth, rcHeight]()
+	{
+		constant cc;
+		cc.m_time = 0;
+
+		m_constant_buffer_p = GraphicsEngine::get()->createConstantBuffer();
+		if (!m_constant_buffer_p->load(&cc, sizeof(constant), GraphicsEngine::get()))
+		{
+			return false;
+		}
+
+		m_scene_target_p = GraphicsEngine::get()->createDynamicResolutionTarget(rcWidth, rcHeight);
+		m_gpu_timer_p = GraphicsEngine::get()->createGpuFrameTimer();
+		m_frame_capture_p = GraphicsEngine::get()->createFrameCapture(3);
+		return true;
+	});
+
+	const bool started = bootstrap.run();
+	const SubsystemBootstrap::Statistics& statistics = bootstrap.getStatistics();
+	std::cout << "Subsystems initialized in " << statistics.wall_ms << " ms, " << statistics.serial_ms << " ms in sequence" << std::endl;
+	if (!started)
+	{
+		// Nothing is rendered with missing resources: the window closes and onDestroy() releases what was created
+		std::cout << "Startup failed at " << bootstrap.getFirstFailure() << std::endl;
+		::PostMessage(m_hwnd, WM_CLOSE, 0, 0);
+		return;
+	}
 
-	constant cc;
-	cc.m_time = 0;
+	// Redraw on input only; the animated cube color keeps frames coming until paused with P
+	setRenderMode(WindowRenderMode::OnDemand);
+	setAnimating(true);
+	setBackgroundFrameRate(10);
+
+	// Double buffered: frame N+1 is simulated while frame N renders, at most one frame apart
+	FramePipelineSettings pipeline_settings;
+	pipeline_settings.packet_count = 2;
+	if (!m_frame_pipeline.start(pipeline_settings, [this](FramePacket& f_packet) { render(f_packet); }))
+	{
+		std::cout << "Render thread start failed" << std::endl;
+		::PostMessage(m_hwnd, WM_CLOSE, 0, 0);
+	}
+}
+
+void AppWindow::simulate(float f_step)
+{
+	m_rot_x.store();
+	m_rot_y.store();
+	m_rot_x.current += m_rot_speed_x * f_step + m_mouse_rot_x;
+	m_rot_y.current += m_rot_speed_y * f_step + m_mouse_rot_y;
+	m_mouse_rot_x = 0.0f;
+	m_mouse_rot_y = 0.0f;
 
-	m_constant_buffer_p = GraphicsEngine::get()->createConstantBuffer();
-	m_constant_buffer_p->load(&cc, sizeof(constant), GraphicsEngine::get());
+	m_delta_pos += f_step / 10.0f;
+
+	if (m_delta_pos > 1.0f)
+	{
+		m_delta_pos = 0;
+	}
+
+	m_delta_scale += f_step / 0.55f;
 }
 
 void AppWindow::onUpdate()
 {
+	// Held keys are reported again every update
+	m_rot_speed_x = 0.0f;
+	m_rot_speed_y = 0.0f;
 	InputSystem::get()->update();
 
-	GraphicsEngine::get()->getImmediateDeviceContext()->clearRenderTargetColor(this->m_swap_chain_p,
-		0.2, 0, 0.4f, 1);
+	const float step = static_cast<float>(m_timestep.getStepSeconds());
+	for (unsigned int steps = m_timestep.advance(m_clock.tick()); steps; --steps)
+	{
+		simulate(step);
+	}
 
-	RECT rc = this->getClientWindowRect();
-	GraphicsEngine::get()->getImmediateDeviceContext()->setViewportSize(rc.right - rc.left, rc.bottom - rc.top);
-	
-	updateQuadPosition();
+	// Waits only while the render thread is still on the frame before the last one
+	if (FramePacket* packet = m_frame_pipeline.beginFrame())
+	{
+		RECT rc = this->getClientWindowRect();
+		packet->width = rc.right - rc.left;
+		packet->height = rc.bottom - rc.top;
+		packet->rot_x = m_rot_x.get(m_timestep.getAlpha());
+		packet->rot_y = m_rot_y.get(m_timestep.getAlpha());
+		packet->scale_cube = m_scale_cube;
+		packet->time_ms = static_cast<unsigned int>(m_clock.getElapsedNanoseconds() / 1000000);
+		packet->toggle_recording = m_toggle_recording;
+		m_toggle_recording = false;
+		m_frame_pipeline.submitFrame();
+	}
 
-	GraphicsEngine::get()->getImmediateDeviceContext()->setConstantBuffer(m_vertex_shader_p, m_constant_buffer_p);
-	GraphicsEngine::get()->getImmediateDeviceContext()->setConstantBuffer(m_pixel_shader_p, m_constant_buffer_p);
+	// The cube is drawn up to a step behind the simulation, keep drawing until it has caught up
+	if (m_rot_x.previous != m_rot_x.current || m_rot_y.previous != m_rot_y.current)
+	{
+		invalidate();
+	}
+}
+
+void AppWindow::render(FramePacket& f_packet)
+{
+	if (f_packet.toggle_recording)
+	{
+		toggleRecording();
+	}
+
+	DeviceContext* device_context = GraphicsEngine::get()->getImmediateDeviceContext();
 
-	GraphicsEngine::get()->getImmediateDeviceContext()->setVertexShader(m_vertex_shader_p);
+	RenderGraphTextureDesc back_buffer_desc;
+	back_buffer_desc.width = f_packet.width;
+	back_buffer_desc.height = f_packet.height;
+	back_buffer_desc.format = RenderGraphFormat::RGBA8;
 
-	GraphicsEngine::get()->getImmediateDeviceContext()->setPixelShader(m_pixel_shader_p);
+	// The CPU delta is pinned to the refresh rate by vsync, only the GPU time tells how much headroom is left
+	float gpu_frame_ms = 0.0f;
+	if (m_gpu_timer_p && m_gpu_timer_p->getFrameTime(device_context, gpu_frame_ms))
+	{
+		m_resolution_controller.update(gpu_frame_ms);
+	}
+	if (m_gpu_timer_p) m_gpu_timer_p->begin(device_context);
 
-	GraphicsEngine::get()->getImmediateDeviceContext()->setVertexBuffer(m_vertex_buffer_p);
-	
-	GraphicsEngine::get()->getImmediateDeviceContext()->setIndexBuffer(m_index_buffer_p);
+	m_render_graph.reset();
+	RenderGraphHandle back_buffer = m_render_graph.importTexture("BackBuffer", back_buffer_desc, m_swap_chain_p);
 
-	GraphicsEngine::get()->getImmediateDeviceContext()->drawIndexedTriangleList(m_index_buffer_p->getSizeIndexList(), 0, 0);
+	RenderGraphHandle scene_color = back_buffer;
+	if (m_scene_target_p && m_scene_target_p->resize(back_buffer_desc.width, back_buffer_desc.height))
+	{
+		RenderGraphTextureDesc scene_desc = back_buffer_desc;
+		m_resolution_controller.getRenderSize(back_buffer_desc.width, back_buffer_desc.height, scene_desc.width, scene_desc.height);
+		scene_color = m_render_graph.importTexture("SceneColor", scene_desc, m_scene_target_p);
+	}
+
+	m_render_graph.addPass("Scene",
+		[&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.write(scene_color);
+		},
+		[this, &f_packet, scene_color, back_buffer](RenderGraphContext& f_context)
+		{
+			const RenderGraphTextureDesc& desc = f_context.getDesc(scene_color);
+			DeviceContext* device_context = GraphicsEngine::get()->getImmediateDeviceContext();
+
+			if (scene_color != back_buffer)
+			{
+				const FLOAT clear_color[4] = { 0.2f, 0.0f, 0.4f, 1.0f };
+				static_cast<DynamicResolutionTarget*>(f_context.getTexture(scene_color))->begin(device_context, desc.width, desc.height, clear_color);
+			}
+			else
+			{
+				device_context->clearRenderTargetColor(static_cast<SwapChain*>(f_context.getTexture(back_buffer)), 0.2, 0, 0.4f, 1);
+				device_context->setViewportSize(desc.width, desc.height);
+			}
+
+			updateQuadPosition(f_packet);
+
+			device_context->setConstantBuffer(m_vertex_shader_p, m_constant_buffer_p);
+			device_context->setConstantBuffer(m_pixel_shader_p, m_constant_buffer_p);
+
+			device_context->setPipelineState(m_pipeline_state_p);
+
+			VertexBuffer* streams[] = { m_vertex_buffer_p, m_color_buffer_p };
+			device_context->setVertexBuffers(streams, ARRAYSIZE(streams));
+
+			device_context->setIndexBuffer(m_index_buffer_p);
+
+			device_context->drawIndexedTriangleList(m_index_buffer_p->getSizeIndexList(), 0, 0);
+		});
+
+	if (scene_color != back_buffer)
+	{
+		m_render_graph.addPass("Upscale",
+			[&](RenderGraphBuilder& f_builder)
+			{
+				f_builder.read(scene_color);
+				f_builder.write(back_buffer);
+			},
+			[scene_color, back_buffer](RenderGraphContext& f_context)
+			{
+				static_cast<DynamicResolutionTarget*>(f_context.getTexture(scene_color))->upscale(
+					GraphicsEngine::get()->getImmediateDeviceContext(), static_cast<SwapChain*>(f_context.getTexture(back_buffer)));
+			});
+	}
+
+	// The frame has no transient targets yet, so no backend is needed
+	m_render_graph.compile(nullptr);
+	m_render_graph.execute(nullptr);
 
 	//GraphicsEngine::get()->getImmediateDeviceContext()->drawTriangleStrip(m_vertex_buffer_p->getSizeVertexList(), 0);
+	if (m_gpu_timer_p) m_gpu_timer_p->end(device_context);
+	if (m_capture_writer.isOpen())
+	{
+		// Before present: the back buffer content is undefined once presented
+		m_frame_capture_p->capture(device_context, m_swap_chain_p, &m_capture_writer);
+	}
 	m_swap_chain_p->present(true);
+	GraphicsEngine::get()->endFrame();
+
+	// Written once, from here so the first frame is timed where it is presented
+	if (StartupTrace::get()->markFirstFrame())
+	{
+		StartupTrace::get()->printSummary(std::cout, 10);
+		if (!StartupTrace::get()->writeChromeTrace("startup_trace.json"))
+		{
+			std::cout << "Cannot write startup_trace.json" << std::endl;
+		}
+	}
+}
+
+void AppWindow::toggleRecording()
+{
+	DeviceContext* device_context = GraphicsEngine::get()->getImmediateDeviceContext();
+	if (m_capture_writer.isOpen())
+	{
+		m_frame_capture_p->flush(device_context, &m_capture_writer);
+		m_capture_writer.close();
+
+		const FrameCaptureWriter::Statistics statistics = m_capture_writer.getStatistics();
+		std::cout << "Recorded " << statistics.written_frames << " frames to " << m_capture_writer.getSettings().path <<
+			", dropped " << statistics.dropped_frames + m_frame_capture_p->getStatistics().dropped_frames << std::endl;
+		return;
+	}
 
-	m_old_delta = m_new_delta;
-	m_new_delta = ::GetTickCount64();
-	m_delta_time = (m_old_delta) ? ((m_new_delta - m_old_delta) / 1000.0f) : 0;
+	RECT rc = this->getClientWindowRect();
+	FrameCaptureSettings settings;
+	settings.path = "capture.y4m";
+	settings.width = rc.right - rc.left;
+	settings.height = rc.bottom - rc.top;
+	if (!m_frame_capture_p || !m_capture_writer.open(settings))
+	{
+		std::cout << "Cannot record to " << settings.path << std::endl;
+	}
 }
 
 void AppWindow::onDestroy()
 {
+	// Renders the frames already submitted; the resources below are this thread's again afterwards
+	m_frame_pipeline.stop();
 	Window::onDestroy();
-	m_vertex_buffer_p->release();
-	m_index_buffer_p->release();
-	m_constant_buffer_p->release();
-	m_swap_chain_p->release();
-	m_vertex_shader_p->release();
-	m_pixel_shader_p->release();
+
+	// A failed startup leaves some of them unset
+	if (m_vertex_buffer_p) m_vertex_buffer_p->release();
+	if (m_color_buffer_p) m_color_buffer_p->release();
+	if (m_index_buffer_p) m_index_buffer_p->release();
+	if (m_constant_buffer_p) m_constant_buffer_p->release();
+	if (m_scene_target_p) m_scene_target_p->release();
+	if (m_gpu_timer_p) m_gpu_timer_p->release();
+	if (m_capture_writer.isOpen()) toggleRecording();
+	if (m_frame_capture_p) m_frame_capture_p->release();
+	if (m_swap_chain_p) m_swap_chain_p->release();
+	if (m_shader_program_p) m_shader_program_p->release();
 	GraphicsEngine::get()->release();
+	JobSystem::get()->shutdown();
 }
 
 void AppWindow::onFocus()
@@ -266,33 +550,45 @@ void AppWindow::onLostFocus()
 
 void AppWindow::onKeyDown(int key)
 {
+	// Held keys keep rotating the cube, so keep drawing until they are released
+	invalidate();
+
 	if (key == 'W')
 	{
-		m_rot_x += 3.14f * m_delta_time;
+		m_rot_speed_x += key_rotation_speed;
 	}
 	else if (key == 'S')
 	{
-		m_rot_x -= 3.14f * m_delta_time;
+		m_rot_speed_x -= key_rotation_speed;
 	}
 	else if (key == 'A')
 	{
-		m_rot_y += 3.14f * m_delta_time;
+		m_rot_speed_y += key_rotation_speed;
 	}
 	else if (key == 'D')
 	{
-		m_rot_y -= 3.14f * m_delta_time;
+		m_rot_speed_y -= key_rotation_speed;
 	}
 }
 
 void AppWindow::onKeyUp(int key)
 {
-
+	if (key == 'P')
+	{
+		setAnimating(!isAnimating());
+	}
+	else if (key == 'R')
+	{
+		m_toggle_recording = true;
+		invalidate();
+	}
 }
 
 void AppWindow::onMouseMove(const Point& deltaMousePos)
 {
-	m_rot_x -= deltaMousePos.y * m_delta_time;
-	m_rot_y -= deltaMousePos.x * m_delta_time;
+	invalidate();
+	m_mouse_rot_x -= deltaMousePos.y * mouse_rotation_per_pixel;
+	m_mouse_rot_y -= deltaMousePos.x * mouse_rotation_per_pixel;
 }
 
 void AppWindow::onLeftMouseDown(const Point& mousePos)
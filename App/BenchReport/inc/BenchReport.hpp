@@ -0,0 +1,90 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Shared reporting of the headless checks and benchmarks
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Report checks and timings the same way in every headless tool.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the BenchReport class.
+/// @par Revision History:
+///      $Source: BenchReport.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/25 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+
+#ifndef _BENCH_REPORT_HPP_
+#define _BENCH_REPORT_HPP_
+
+#include <chrono>
+
+/**
+ * @class BenchReport
+ * @brief Prints the checks of a headless tool and turns them into its exit code.
+ *
+ * Every check prints one line, "ok" or "FAILED", and failures are counted
+ * for the whole process; finish() prints the summary and returns what main()
+ * returns, 1 if any check failed.
+ *
+ * Example usage:
+ * @code
+ * BenchReport::check(queue.process(0, copy) == 3, "a budget of 0 processes everything");
+ * const auto start = std::chrono::steady_clock::now();
+ * run();
+ * std::cout << BenchReport::elapsedMs(start) << " ms\n";
+ * return BenchReport::finish();
+ * @endcode
+ */
+class BenchReport
+{
+public:
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	static void check(bool f_condition, const char* f_what);
+
+	static unsigned int getFailureCount();
+
+	/// <summary>
+	/// Prints how many checks failed, or that all passed.
+	/// </summary>
+	/// <returns>The exit code of the tool: 0 if every check passed, 1 otherwise.</returns>
+	static int finish();
+
+	/// <summary>
+	/// Milliseconds since f_start on the steady clock.
+	/// </summary>
+	static double elapsedMs(std::chrono::steady_clock::time_point f_start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - f_start).count();
+	}
+};
+
+#endif // !_BENCH_REPORT_HPP_
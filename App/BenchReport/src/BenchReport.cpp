@@ -0,0 +1,71 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Shared reporting of the headless checks and benchmarks
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Report checks and timings the same way in every headless tool.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the BenchReport class.
+/// @par Revision History:
+///      $Source: BenchReport.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/25 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+
+#include "BenchReport.hpp"
+#include <atomic>
+#include <iostream>
+
+namespace
+{
+	std::atomic<unsigned int> g_failures{ 0 };
+}
+
+void BenchReport::check(bool f_condition, const char* f_what)
+{
+	std::cout << (f_condition ? "  ok      " : "  FAILED  ") << f_what << "\n";
+	if (!f_condition) g_failures.fetch_add(1, std::memory_order_relaxed);
+}
+
+unsigned int BenchReport::getFailureCount()
+{
+	return g_failures.load(std::memory_order_relaxed);
+}
+
+int BenchReport::finish()
+{
+	const unsigned int failures = getFailureCount();
+	if (failures)
+	{
+		std::cout << failures << " checks failed\n";
+		return 1;
+	}
+	std::cout << "All checks passed\n";
+	return 0;
+}
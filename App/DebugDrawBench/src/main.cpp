@@ -0,0 +1,234 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Debug line throughput benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Check and time debug line collection without a GPU.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Entry point of the DebugDrawBench tool.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/26 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "DebugDraw.hpp"
+#include "BenchReport.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	DebugColor producerColor(unsigned int f_producer)
+	{
+		return DebugColor::make(static_cast<unsigned char>(f_producer), 0, 255);
+	}
+
+	/// <summary>
+	/// Writes f_count segments with line(), the i-th one from (i, 0, 0) to (i, 1, 0).
+	/// </summary>
+	void writeLines(size_t f_first, size_t f_count, DebugColor f_color)
+	{
+		DebugDraw* debug_draw = DebugDraw::get();
+		for (size_t i = f_first; i < f_first + f_count; ++i)
+		{
+			const float x = static_cast<float>(i);
+			debug_draw->line(Vector3D(x, 0.0f, 0.0f), Vector3D(x, 1.0f, 0.0f), f_color);
+		}
+	}
+
+	/// <summary>
+	/// Writes f_count segments with lines(), in batches of 256 segments.
+	/// </summary>
+	void writeBatches(size_t f_count, DebugColor f_color)
+	{
+		DebugDrawVertex batch[512];
+		for (size_t i = 0; i < 512; ++i)
+		{
+			batch[i] = { { static_cast<float>(i / 2), static_cast<float>(i % 2), 0.0f }, f_color };
+		}
+		for (size_t written = 0; written < f_count; written += 256)
+		{
+			DebugDraw::get()->lines(batch, std::min<size_t>(256, f_count - written) * 2);
+		}
+	}
+
+	/// <summary>
+	/// Runs f_frames frames of the writer and returns the fastest, so the chunks are already allocated.
+	/// </summary>
+	template <typename Writer>
+	double bestFrameMs(unsigned int f_frames, Writer f_writer)
+	{
+		double best = 1e30;
+		for (unsigned int frame = 0; frame < f_frames; ++frame)
+		{
+			const Clock::time_point start = Clock::now();
+			f_writer();
+			best = std::min(best, BenchReport::elapsedMs(start));
+			DebugDraw::get()->collect();
+		}
+		return best;
+	}
+
+	void checkCollect(size_t f_segments)
+	{
+		std::cout << "Collection\n";
+		DebugDraw* debug_draw = DebugDraw::get();
+		debug_draw->collect();
+
+		writeLines(0, f_segments, producerColor(0));
+		debug_draw->box(Vector3D(0.0f, 0.0f, 0.0f), Vector3D(1.0f, 1.0f, 1.0f), producerColor(1), DebugDrawLayer::Overlay);
+		debug_draw->text(Vector3D(0.0f, 2.0f, 0.0f), "marker", producerColor(2));
+		debug_draw->collect();
+
+		BenchReport::check(debug_draw->getStatistics().line_count[0] == f_segments, "every line() reaches the World layer");
+		BenchReport::check(debug_draw->getStatistics().line_count[1] == 12 + 2, "the box and the text cross reach the Overlay layer");
+		BenchReport::check(debug_draw->getTextMarkers().size() == 1 && ::strcmp(debug_draw->getTextMarkers()[0].text, "marker") == 0, "the text marker is collected");
+
+		std::vector<DebugDrawVertex> vertices(f_segments * 2);
+		BenchReport::check(debug_draw->copyVertices(DebugDrawLayer::World, 0, vertices.size(), vertices.data()) == vertices.size(), "copyVertices() copies every vertex");
+		bool in_order = true;
+		for (size_t i = 0; i < f_segments && in_order; ++i)
+		{
+			in_order = vertices[i * 2].position[0] == static_cast<float>(i) && vertices[i * 2 + 1].position[1] == 1.0f;
+		}
+		BenchReport::check(in_order, "one thread's segments come back in call order");
+
+		DebugDrawVertex window[3];
+		BenchReport::check(debug_draw->getSpans(DebugDrawLayer::World).size() > 1, "a large frame spans several chunks");
+		const size_t middle = debug_draw->getSpans(DebugDrawLayer::World)[0].count;
+		BenchReport::check(debug_draw->copyVertices(DebugDrawLayer::World, middle - 1, 3, window) == 3 &&
+			::memcmp(window, vertices.data() + middle - 1, sizeof(window)) == 0, "copyVertices() copies a range across two chunks");
+		BenchReport::check(debug_draw->copyVertices(DebugDrawLayer::World, vertices.size() - 1, 10, window) == 1, "copyVertices() stops at the last vertex");
+
+		debug_draw->collect();
+		BenchReport::check(debug_draw->getVertexCount(DebugDrawLayer::World) == 0 && debug_draw->getTextMarkers().empty(), "a frame without calls collects nothing");
+	}
+
+	void checkProducers(unsigned int f_producers, size_t f_segments)
+	{
+		std::cout << f_producers << " producers\n";
+		DebugDraw* debug_draw = DebugDraw::get();
+		const size_t per_producer = f_segments / f_producers;
+
+		std::vector<std::thread> producers;
+		for (unsigned int producer = 0; producer < f_producers; ++producer)
+		{
+			producers.emplace_back([producer, per_producer]() { writeLines(producer * per_producer, per_producer, producerColor(producer)); });
+		}
+		for (std::thread& producer : producers) producer.join();
+		debug_draw->collect();
+
+		std::vector<DebugDrawVertex> vertices(debug_draw->getVertexCount(DebugDrawLayer::World));
+		debug_draw->copyVertices(DebugDrawLayer::World, 0, vertices.size(), vertices.data());
+		std::vector<size_t> counts(f_producers, 0);
+		bool matched = true;
+		for (size_t i = 0; i < vertices.size(); i += 2)
+		{
+			const unsigned int producer = vertices[i].color.rgba & 0xff;
+			matched = matched && producer < f_producers && vertices[i].color.rgba == vertices[i + 1].color.rgba &&
+				static_cast<size_t>(vertices[i].position[0]) / per_producer == producer;
+			if (producer < f_producers) counts[producer]++;
+		}
+		BenchReport::check(vertices.size() == per_producer * f_producers * 2, "every producer's segments are collected");
+		BenchReport::check(matched && std::all_of(counts.begin(), counts.end(), [per_producer](size_t f_count) { return f_count == per_producer; }),
+			"no segment is torn or lost between producers");
+		BenchReport::check(debug_draw->getStatistics().thread_count <= f_producers + 1, "exited threads' buffers are reused");
+	}
+
+	void timeProducers(unsigned int f_producers, size_t f_segments, unsigned int f_frames)
+	{
+		const size_t per_producer = f_segments / f_producers;
+		std::vector<DebugDrawVertex> vertex_buffer(f_segments * 2);
+		double best_write = 1e30;
+		double best_copy = 1e30;
+		for (unsigned int frame = 0; frame < f_frames; ++frame)
+		{
+			// Every producer writes its share in parallel, as systems on worker threads would
+			const Clock::time_point start = Clock::now();
+			std::vector<std::thread> producers;
+			for (unsigned int producer = 0; producer < f_producers; ++producer)
+			{
+				producers.emplace_back([producer, per_producer]() { writeLines(producer * per_producer, per_producer, producerColor(producer)); });
+			}
+			for (std::thread& producer : producers) producer.join();
+			best_write = std::min(best_write, BenchReport::elapsedMs(start));
+
+			const Clock::time_point copy_start = Clock::now();
+			DebugDraw::get()->collect();
+			DebugDraw::get()->copyVertices(DebugDrawLayer::World, 0, vertex_buffer.size(), vertex_buffer.data());
+			best_copy = std::min(best_copy, BenchReport::elapsedMs(copy_start));
+		}
+		std::cout << "  line() from " << f_producers << " threads: " << best_write << " ms per " << f_segments <<
+			" segments, thread start included; collect() + copy: " << best_copy << " ms\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const size_t segments = argc > 1 ? static_cast<size_t>(std::max(1, std::atoi(argv[1]))) : 1000000;
+	const unsigned int producers = argc > 2 ? static_cast<unsigned int>(std::max(1, std::atoi(argv[2]))) : 4;
+	const unsigned int frames = 5;
+
+	checkCollect(segments);
+	checkProducers(producers, segments);
+
+	std::cout << "Timing, best of " << frames << " frames\n";
+	DebugDraw* debug_draw = DebugDraw::get();
+	const double line_ms = bestFrameMs(frames, [segments]() { writeLines(0, segments, producerColor(0)); });
+	std::cout << "  line() from 1 thread: " << line_ms << " ms per " << segments << " segments\n";
+	const double batch_ms = bestFrameMs(frames, [segments]() { writeBatches(segments, producerColor(0)); });
+	std::cout << "  lines() from 1 thread: " << batch_ms << " ms per " << segments << " segments\n";
+
+	writeLines(0, segments, producerColor(0));
+	debug_draw->collect();
+	std::vector<DebugDrawVertex> vertex_buffer(segments * 2);
+	Clock::time_point start = Clock::now();
+	debug_draw->copyVertices(DebugDrawLayer::World, 0, vertex_buffer.size(), vertex_buffer.data());
+	const double copy_ms = BenchReport::elapsedMs(start);
+
+	// The floor: one memcpy of the same bytes
+	std::vector<DebugDrawVertex> source(vertex_buffer);
+	start = Clock::now();
+	::memcpy(vertex_buffer.data(), source.data(), vertex_buffer.size() * sizeof(DebugDrawVertex));
+	const double memcpy_ms = BenchReport::elapsedMs(start);
+	std::cout << "  copyVertices(): " << copy_ms << " ms for " << vertex_buffer.size() * sizeof(DebugDrawVertex) / (1024 * 1024) <<
+		" MiB, memcpy of the same: " << memcpy_ms << " ms\n";
+
+	timeProducers(producers, segments, frames);
+	std::cout << "  target: 1 ms per 1000000 segments, " << std::thread::hardware_concurrency() << " hardware threads\n";
+
+	return BenchReport::finish();
+}
@@ -0,0 +1,133 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Offline check of the dynamic resolution controller
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Usage: DynamicResolutionReplay [trace [target_ms [fixed_fraction]]]
+//  - The trace holds one frame time in milliseconds per line, measured at
+//    full resolution; lines starting with '#' are skipped. Without a trace
+//    a synthetic one with load steps and noise is replayed.
+//  - A frame at scale s is modelled as trace * (fixed + (1 - fixed) * s^2):
+//    the fixed fraction does not shrink with the resolution.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Replays frame times through the dynamic resolution controller.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "DynamicResolutionController.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	std::vector<float> loadTrace(const char* f_file_name)
+	{
+		std::vector<float> trace;
+		std::ifstream file(f_file_name);
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (line.empty() || line[0] == '#')
+			{
+				continue;
+			}
+			const float frame_ms = std::strtof(line.c_str(), nullptr);
+			if (frame_ms > 0.0f)
+			{
+				trace.push_back(frame_ms);
+			}
+		}
+		return trace;
+	}
+
+	std::vector<float> makeSyntheticTrace()
+	{
+		// Light scene, a heavy effect, a medium scene, then light again; with deterministic noise
+		const float levels[] = { 11.0f, 26.0f, 19.0f, 10.0f };
+		std::vector<float> trace;
+		unsigned int seed = 12345;
+		for (float level : levels)
+		{
+			for (int frame = 0; frame < 300; ++frame)
+			{
+				seed = seed * 1664525u + 1013904223u;
+				const float noise = ((seed >> 8) & 0xffff) / 65535.0f - 0.5f;
+				trace.push_back(level * (1.0f + 0.15f * noise));
+			}
+		}
+		return trace;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const bool synthetic = argc < 2 || std::string(argv[1]) == "-";
+	const std::vector<float> trace = synthetic ? makeSyntheticTrace() : loadTrace(argv[1]);
+	if (trace.empty())
+	{
+		std::cerr << "No frame times in " << argv[1] << "\n";
+		return 1;
+	}
+
+	DynamicResolutionSettings settings;
+	if (argc > 2) settings.target_frame_ms = static_cast<float>(std::atof(argv[2]));
+	const float fixed_fraction = argc > 3 ? static_cast<float>(std::atof(argv[3])) : 0.2f;
+
+	DynamicResolutionController controller;
+	controller.setSettings(settings);
+
+	unsigned int over_budget_full = 0, over_budget_scaled = 0;
+	double scale_sum = 0.0;
+	float scale_min = settings.max_scale;
+	for (float full_ms : trace)
+	{
+		const float scale = controller.getScale();
+		const float frame_ms = full_ms * (fixed_fraction + (1.0f - fixed_fraction) * scale * scale);
+		if (full_ms > settings.target_frame_ms) over_budget_full++;
+		if (frame_ms > settings.target_frame_ms) over_budget_scaled++;
+		scale_sum += scale;
+		scale_min = std::min(scale_min, scale);
+		controller.update(frame_ms);
+	}
+
+	const DynamicResolutionController::Statistics& statistics = controller.getStatistics();
+	std::cout << "Frames:                    " << trace.size() << (synthetic ? " (synthetic)" : "") << "\n";
+	std::cout << "Budget:                    " << settings.target_frame_ms << " ms\n";
+	std::cout << "Over budget, full res:     " << over_budget_full << "\n";
+	std::cout << "Over budget, dynamic res:  " << over_budget_scaled << "\n";
+	std::cout << "Scale (mean/min):          " << scale_sum / trace.size() << " / " << scale_min << "\n";
+	std::cout << "Scale changes:             " << statistics.scale_changes << "\n";
+	return 0;
+}
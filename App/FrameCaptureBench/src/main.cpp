@@ -0,0 +1,130 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Frame capture benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure the cost and the drops of recording frames.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Records an animated CPU framebuffer through the FrameCaptureWriter.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/18 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "FrameCaptureWriter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	/// <summary>
+	/// Draws a scrolling gradient with a bouncing square, so consecutive frames differ everywhere.
+	/// </summary>
+	void renderFrame(unsigned int f_frame, unsigned int f_width, unsigned int f_height, std::vector<unsigned char>& f_pixels)
+	{
+		const unsigned int square = f_height / 4;
+		const unsigned int square_x = (f_frame * 7) % (f_width - square);
+		const unsigned int square_y = (f_frame * 5) % (f_height - square);
+		for (unsigned int y = 0; y < f_height; ++y)
+		{
+			unsigned char* row = f_pixels.data() + static_cast<size_t>(y) * f_width * 4;
+			for (unsigned int x = 0; x < f_width; ++x)
+			{
+				const bool inside = x - square_x < square && y - square_y < square;
+				row[x * 4 + 0] = inside ? 255 : static_cast<unsigned char>(x + f_frame * 3);
+				row[x * 4 + 1] = inside ? 255 : static_cast<unsigned char>(y * 255 / f_height);
+				row[x * 4 + 2] = inside ? 64 : static_cast<unsigned char>((x ^ y) + f_frame);
+				row[x * 4 + 3] = 255;
+			}
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	FrameCaptureSettings settings;
+	settings.path = argc > 1 ? argv[1] : "capture_bench.y4m";
+	const unsigned int frame_count = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 300;
+	const unsigned int frame_rate = argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : 60;
+	settings.width = 1280;
+	settings.height = 720;
+	settings.frame_rate = frame_rate ? frame_rate : 60;
+	settings.format = settings.path.size() > 4 && settings.path.compare(settings.path.size() - 4, 4, ".y4m") == 0 ?
+		FrameCaptureFormat::Y4M : FrameCaptureFormat::ImageSequence;
+
+	FrameCaptureWriter writer;
+	if (!writer.open(settings))
+	{
+		std::cerr << "Cannot open " << settings.path << "\n";
+		return 1;
+	}
+
+	// frame_rate 0 renders as fast as possible, to show the drops once the writer falls behind
+	std::vector<unsigned char> pixels(static_cast<size_t>(settings.width) * settings.height * 4);
+	const std::chrono::steady_clock::duration frame_period = frame_rate ?
+		std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / frame_rate)) :
+		std::chrono::steady_clock::duration::zero();
+	std::chrono::steady_clock::time_point next_frame = std::chrono::steady_clock::now();
+	const std::chrono::steady_clock::time_point start = next_frame;
+	double submit_ms_sum = 0.0, submit_ms_max = 0.0;
+
+	for (unsigned int frame = 0; frame < frame_count; ++frame)
+	{
+		renderFrame(frame, settings.width, settings.height, pixels);
+
+		const std::chrono::steady_clock::time_point submit_start = std::chrono::steady_clock::now();
+		writer.submit(pixels.data(), settings.width * 4, FramePixelLayout::RGBA8);
+		const double submit_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - submit_start).count();
+		submit_ms_sum += submit_ms;
+		submit_ms_max = std::max(submit_ms_max, submit_ms);
+
+		next_frame += frame_period;
+		std::this_thread::sleep_until(next_frame);
+	}
+	const double render_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	writer.close();
+
+	const FrameCaptureWriter::Statistics statistics = writer.getStatistics();
+	const double written = statistics.written_frames ? static_cast<double>(statistics.written_frames) : 1.0;
+	std::cout << "Output:                " << settings.path << " (" << settings.width << "x" << settings.height << ")\n";
+	std::cout << "Frames rendered:       " << frame_count << " in " << render_s << " s\n";
+	std::cout << "Frames written:        " << statistics.written_frames << "\n";
+	std::cout << "Frames dropped:        " << statistics.dropped_frames << "\n";
+	std::cout << "Frames failed:         " << statistics.failed_frames << "\n";
+	std::cout << "submit() mean/max:     " << submit_ms_sum / std::max(1u, frame_count) << " / " << submit_ms_max << " ms\n";
+	std::cout << "Convert per frame:     " << statistics.convert_ms / written << " ms (worker)\n";
+	std::cout << "Write per frame:       " << statistics.write_ms / written << " ms (worker)\n";
+	std::cout << "Bytes written:         " << statistics.bytes_written << "\n";
+	return 0;
+}
@@ -0,0 +1,105 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Frame pacing benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure frame interval jitter and CPU cost of the frame limiter.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Paces a simulated frame loop with each FramePacer mode and reports the jitter.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/08 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "FramePacer.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace
+{
+	/// <summary>
+	/// Busy work standing in for a frame: the CPU is used, not yielded.
+	/// </summary>
+	void simulateFrame(double f_ms)
+	{
+		const long long end = FramePacer::now() + static_cast<long long>(f_ms * 1e6);
+		while (FramePacer::now() < end)
+		{
+		}
+	}
+
+	void runMode(const char* f_name, FramePacerMode f_mode, double f_fps, unsigned int f_frames, double f_work_ms)
+	{
+		FramePacerSettings settings;
+		settings.target_fps = f_fps;
+		settings.mode = f_mode;
+		FramePacer pacer;
+		pacer.setSettings(settings);
+
+		// Same work sequence for every mode: a base cost with noise and an occasional spike
+		std::mt19937 random(3);
+		std::uniform_real_distribution<double> noise(0.8, 1.2);
+		for (unsigned int frame = 0; frame < f_frames; ++frame)
+		{
+			simulateFrame(f_work_ms * noise(random) * (random() % 100 == 0 ? 3.0 : 1.0));
+			pacer.wait();
+		}
+
+		const FramePacer::Statistics& statistics = pacer.getStatistics();
+		const double waited_ms = statistics.sleep_ms + statistics.spin_ms;
+		std::cout << std::left << std::setw(8) << f_name << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(10) << statistics.mean_interval_ms
+			<< std::setw(10) << statistics.interval_stddev_ms
+			<< std::setw(10) << pacer.getIntervalPercentile(99.0)
+			<< std::setw(10) << statistics.max_interval_ms
+			<< std::setw(12) << std::setprecision(1) << statistics.mean_lateness_us
+			<< std::setw(12) << statistics.max_lateness_us
+			<< std::setw(10) << statistics.missed_deadlines
+			<< std::setw(10) << (waited_ms > 0.0 ? 100.0 * statistics.spin_ms / waited_ms : 0.0)
+			<< std::setw(10) << statistics.spin_margin_us << "\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const double fps = argc > 1 ? std::atof(argv[1]) : 144.0;
+	const unsigned int frames = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 600;
+	const double work_ms = argc > 3 ? std::atof(argv[3]) : 3.0;
+
+	std::cout << "Target " << fps << " fps (" << 1000.0 / fps << " ms), " << frames << " frames of about " << work_ms << " ms work\n";
+	std::cout << std::left << std::setw(8) << "mode" << std::right << std::setw(10) << "mean ms" << std::setw(10) << "stddev ms"
+		<< std::setw(10) << "p99 ms" << std::setw(10) << "max ms" << std::setw(12) << "late us" << std::setw(12) << "late max us"
+		<< std::setw(10) << "missed" << std::setw(10) << "spin %" << std::setw(10) << "margin us" << "\n";
+	runMode("hybrid", FramePacerMode::Hybrid, fps, frames, work_ms);
+	runMode("sleep", FramePacerMode::Sleep, fps, frames, work_ms);
+	runMode("spin", FramePacerMode::Spin, fps, frames, work_ms);
+	return 0;
+}
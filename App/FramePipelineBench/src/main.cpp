@@ -0,0 +1,143 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Render thread handoff benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure the overlap of simulation and rendering on a render thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Runs frames through a FramePipeline in each handoff configuration.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/14 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "FramePipeline.hpp"
+#include "Clock.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace
+{
+	struct BenchPacket
+	{
+		unsigned long long frame = 0;
+		double render_ms = 0.0;
+		std::vector<float> transforms;     // Stands in for the draw data copied out of the simulation
+	};
+
+	/// <summary>
+	/// Busy work standing in for simulating or rendering a frame.
+	/// </summary>
+	void work(double f_ms)
+	{
+		const long long end = Clock::now() + static_cast<long long>(f_ms * 1e6);
+		while (Clock::now() < end)
+		{
+		}
+	}
+
+	void runConfiguration(const char* f_name, const FramePipelineSettings& f_settings, unsigned int f_frames, double f_sim_ms, double f_render_ms)
+	{
+		unsigned long long rendered = 0;
+		unsigned long long order_errors = 0;
+		unsigned long long last_frame = 0;
+		FramePipeline<BenchPacket> pipeline;
+		pipeline.start(f_settings, [&](BenchPacket& f_packet)
+		{
+			// Queue mode must render every frame in order, Latest mode only in increasing order
+			const bool in_order = f_settings.mode == FrameHandoffMode::Queue ? f_packet.frame == last_frame + 1 : f_packet.frame > last_frame;
+			if (!in_order || f_packet.transforms.empty() || f_packet.transforms.back() != static_cast<float>(f_packet.frame))
+			{
+				order_errors++;
+			}
+			last_frame = f_packet.frame;
+			work(f_packet.render_ms);
+			rendered++;
+		});
+
+		// Same cost sequence for every configuration, with an occasional slow frame on either side
+		std::mt19937 random(7);
+		std::uniform_real_distribution<double> noise(0.7, 1.3);
+		const long long start = Clock::now();
+		for (unsigned int frame = 1; frame <= f_frames; ++frame)
+		{
+			work(f_sim_ms * noise(random) * (random() % 50 == 0 ? 3.0 : 1.0));
+			const double render_ms = f_render_ms * noise(random) * (random() % 50 == 0 ? 3.0 : 1.0);
+
+			BenchPacket* packet = pipeline.beginFrame();
+			packet->frame = frame;
+			packet->render_ms = render_ms;
+			packet->transforms.assign(256, static_cast<float>(frame));
+			pipeline.submitFrame();
+		}
+		pipeline.stop();
+		const double total_ms = static_cast<double>(Clock::now() - start) * 1e-6;
+
+		const FrameHandoff::Statistics statistics = pipeline.getStatistics();
+		std::cout << std::left << std::setw(10) << f_name << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(10) << total_ms / f_frames
+			<< std::setw(10) << statistics.producer_wait_ms / f_frames
+			<< std::setw(10) << statistics.consumer_wait_ms / f_frames
+			<< std::setw(10) << statistics.mean_latency_ms
+			<< std::setw(10) << statistics.max_latency_ms
+			<< std::setw(10) << rendered
+			<< std::setw(10) << statistics.dropped_frames
+			<< std::setw(10) << order_errors << "\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int frames = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 600;
+	const double sim_ms = argc > 2 ? std::atof(argv[2]) : 4.0;
+	const double render_ms = argc > 3 ? std::atof(argv[3]) : 4.0;
+
+	std::cout << frames << " frames, about " << sim_ms << " ms simulation and " << render_ms << " ms rendering each; "
+		<< std::thread::hardware_concurrency() << " hardware threads\n";
+	std::cout << std::left << std::setw(10) << "handoff" << std::right << std::setw(10) << "frame ms" << std::setw(10) << "sim wait"
+		<< std::setw(10) << "rnd wait" << std::setw(10) << "lat ms" << std::setw(10) << "lat max" << std::setw(10) << "rendered"
+		<< std::setw(10) << "dropped" << std::setw(10) << "errors" << "\n";
+
+	FramePipelineSettings settings;
+	settings.threaded = false;
+	runConfiguration("inline", settings, frames, sim_ms, render_ms);
+
+	settings.threaded = true;
+	settings.packet_count = 2;
+	runConfiguration("double", settings, frames, sim_ms, render_ms);
+
+	settings.packet_count = 3;
+	runConfiguration("triple", settings, frames, sim_ms, render_ms);
+
+	settings.mode = FrameHandoffMode::Latest;
+	runConfiguration("latest", settings, frames, sim_ms, render_ms);
+	return 0;
+}
@@ -0,0 +1,258 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Job system scaling benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure how the job system scales from one thread to every core.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Runs transform, culling and job overhead workloads on 1 to N threads.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/17 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "JobSystem.hpp"
+#include "BenchReport.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct ObjectState
+	{
+		float position[3];
+		float rotation[3];
+		float scale;
+		float radius;
+	};
+
+	struct Plane
+	{
+		float normal[3];
+		float distance;
+	};
+
+	/// <summary>
+	/// World matrix from position, Euler angles and scale, as a transform update would build it.
+	/// </summary>
+	void buildWorld(const ObjectState& f_state, float* f_world)
+	{
+		const float sx = std::sin(f_state.rotation[0]), cx = std::cos(f_state.rotation[0]);
+		const float sy = std::sin(f_state.rotation[1]), cy = std::cos(f_state.rotation[1]);
+		const float sz = std::sin(f_state.rotation[2]), cz = std::cos(f_state.rotation[2]);
+		const float s = f_state.scale;
+		f_world[0] = s * (cy * cz);                 f_world[1] = s * (cy * sz);                 f_world[2] = s * -sy;       f_world[3] = 0.0f;
+		f_world[4] = s * (sx * sy * cz - cx * sz);  f_world[5] = s * (sx * sy * sz + cx * cz);  f_world[6] = s * sx * cy;  f_world[7] = 0.0f;
+		f_world[8] = s * (cx * sy * cz + sx * sz);  f_world[9] = s * (cx * sy * sz - sx * cz);  f_world[10] = s * cx * cy; f_world[11] = 0.0f;
+		f_world[12] = f_state.position[0];          f_world[13] = f_state.position[1];          f_world[14] = f_state.position[2]; f_world[15] = 1.0f;
+	}
+
+	bool isVisible(const ObjectState& f_state, const Plane* f_planes)
+	{
+		for (unsigned int i = 0; i < 6; ++i)
+		{
+			const Plane& plane = f_planes[i];
+			const float distance = plane.normal[0] * f_state.position[0] + plane.normal[1] * f_state.position[1] +
+				plane.normal[2] * f_state.position[2] + plane.distance;
+			if (distance < -f_state.radius * f_state.scale)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	struct Result
+	{
+		double transforms_ms = 0.0;
+		double culling_ms = 0.0;
+		double jobs_us = 0.0;            // Per job
+		double graph_ms = 0.0;
+		bool valid = true;
+		unsigned long long stolen = 0;
+	};
+
+	template<typename Function>
+	double bestOf(unsigned int f_repeats, const Function& f_function)
+	{
+		double best = 1e30;
+		for (unsigned int i = 0; i < f_repeats; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			f_function();
+			best = std::min(best, BenchReport::elapsedMs(start));
+		}
+		return best;
+	}
+
+	Result runThreads(unsigned int f_threads, const std::vector<ObjectState>& f_objects, const Plane* f_planes, unsigned int f_expected_visible)
+	{
+		JobSystem* jobs = JobSystem::get();
+		jobs->init(f_threads);
+		const unsigned int count = static_cast<unsigned int>(f_objects.size());
+		std::vector<float> worlds(static_cast<size_t>(count) * 16);
+		Result result;
+
+		result.transforms_ms = bestOf(5, [&]()
+		{
+			jobs->parallelFor(count, [&](unsigned int f_begin, unsigned int f_end)
+			{
+				for (unsigned int i = f_begin; i < f_end; ++i)
+				{
+					buildWorld(f_objects[i], &worlds[static_cast<size_t>(i) * 16]);
+				}
+			});
+		});
+		float world[16];
+		buildWorld(f_objects[count / 3], world);
+		result.valid = result.valid && std::equal(world, world + 16, &worlds[static_cast<size_t>(count / 3) * 16]);
+
+		std::atomic<unsigned int> visible(0);
+		result.culling_ms = bestOf(5, [&]()
+		{
+			visible.store(0);
+			jobs->parallelFor(count, [&](unsigned int f_begin, unsigned int f_end)
+			{
+				unsigned int local = 0;
+				for (unsigned int i = f_begin; i < f_end; ++i)
+				{
+					local += isVisible(f_objects[i], f_planes) ? 1 : 0;
+				}
+				visible.fetch_add(local, std::memory_order_relaxed);
+			});
+		});
+		result.valid = result.valid && visible.load() == f_expected_visible;
+
+		// Job overhead: many empty jobs, spawned from the main thread in batches the rings can hold
+		constexpr unsigned int job_count = 100000;
+		std::atomic<unsigned int> ran(0);
+		const double jobs_ms = bestOf(3, [&]()
+		{
+			for (unsigned int batch = 0; batch < job_count; batch += 2048)
+			{
+				JobCounter counter;
+				for (unsigned int i = batch; i < std::min(job_count, batch + 2048); ++i)
+				{
+					jobs->run(counter, [&ran]() { ran.fetch_add(1, std::memory_order_relaxed); });
+				}
+				jobs->wait(counter);
+			}
+		});
+		result.jobs_us = jobs_ms * 1000.0 / job_count;
+		result.valid = result.valid && ran.load() == job_count * 3;
+
+		// Dependencies: 64 cull chunks, then one continuation per chunk, then a final merge
+		result.graph_ms = bestOf(5, [&]()
+		{
+			constexpr unsigned int chunk_count = 64;
+			const unsigned int chunk_size = (count + chunk_count - 1) / chunk_count;
+			std::vector<unsigned int> chunk_visible(chunk_count, 0);
+			unsigned int total = 0;
+			JobCounter culled;
+			JobCounter counted;
+			JobCounter merged;
+			for (unsigned int chunk = 0; chunk < chunk_count; ++chunk)
+			{
+				jobs->run(culled, [&, chunk]()
+				{
+					const unsigned int end = std::min(count, (chunk + 1) * chunk_size);
+					for (unsigned int i = chunk * chunk_size; i < end; ++i)
+					{
+						chunk_visible[chunk] += isVisible(f_objects[i], f_planes) ? 1 : 0;
+					}
+				});
+			}
+			jobs->runAfter(culled, counted, [&]()
+			{
+				for (unsigned int chunk = 0; chunk < chunk_count; ++chunk) total += chunk_visible[chunk];
+			});
+			jobs->runAfter(counted, merged, [&]() { total += 0; });
+			jobs->wait(merged);
+			result.valid = result.valid && total == f_expected_visible;
+		});
+
+		result.stolen = jobs->getStatistics().stolen_jobs;
+		jobs->shutdown();
+		return result;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned int max_threads = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : hardware_threads;
+	const unsigned int object_count = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 1000000;
+
+	std::vector<ObjectState> objects(object_count);
+	unsigned int seed = 1;
+	auto next = [&seed]() { seed = seed * 1664525u + 1013904223u; return static_cast<float>(seed >> 8) / 16777216.0f; };
+	for (ObjectState& object : objects)
+	{
+		for (float& value : object.position) value = next() * 200.0f - 100.0f;
+		for (float& value : object.rotation) value = next() * 6.2831853f;
+		object.scale = 0.5f + next();
+		object.radius = 1.0f + next() * 4.0f;
+	}
+	const Plane planes[6] =
+	{
+		{ { 1.0f, 0.0f, 0.0f }, 50.0f }, { { -1.0f, 0.0f, 0.0f }, 50.0f },
+		{ { 0.0f, 1.0f, 0.0f }, 40.0f }, { { 0.0f, -1.0f, 0.0f }, 40.0f },
+		{ { 0.0f, 0.0f, 1.0f }, 0.0f },  { { 0.0f, 0.0f, -1.0f }, 80.0f }
+	};
+	unsigned int expected_visible = 0;
+	for (const ObjectState& object : objects)
+	{
+		expected_visible += isVisible(object, planes) ? 1 : 0;
+	}
+
+	std::cout << object_count << " objects, " << hardware_threads << " hardware threads\n";
+	std::cout << std::left << std::setw(8) << "threads" << std::right << std::setw(12) << "xform ms" << std::setw(9) << "speedup"
+		<< std::setw(12) << "cull ms" << std::setw(9) << "speedup" << std::setw(12) << "graph ms" << std::setw(12) << "us/job"
+		<< std::setw(10) << "stolen" << std::setw(8) << "valid" << "\n";
+
+	Result single;
+	for (unsigned int threads = 1; threads <= std::max(1u, max_threads); ++threads)
+	{
+		const Result result = runThreads(threads, objects, planes, expected_visible);
+		if (threads == 1) single = result;
+		std::cout << std::left << std::setw(8) << threads << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(12) << result.transforms_ms << std::setw(8) << std::setprecision(2) << single.transforms_ms / result.transforms_ms << "x"
+			<< std::setw(12) << std::setprecision(3) << result.culling_ms << std::setw(8) << std::setprecision(2) << single.culling_ms / result.culling_ms << "x"
+			<< std::setw(12) << std::setprecision(3) << result.graph_ms << std::setw(12) << result.jobs_us
+			<< std::setw(10) << result.stolen << std::setw(8) << (result.valid ? "yes" : "NO") << "\n";
+	}
+	return 0;
+}
@@ -0,0 +1,151 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Clustered light culling benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure the cost of assigning lights to clusters.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Assigns random point and spot lights to the LightClusterGrid of a moving camera.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "LightClusterGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+	/// <summary>
+	/// Left-handed perspective projection for row vectors, like D3DXMatrixPerspectiveFovLH.
+	/// </summary>
+	void perspective(float f_fov_y, float f_aspect, float f_near, float f_far, float f_projection[4][4])
+	{
+		const float y_scale = 1.0f / std::tan(f_fov_y * 0.5f);
+		for (int row = 0; row < 4; ++row) for (int column = 0; column < 4; ++column) f_projection[row][column] = 0.0f;
+		f_projection[0][0] = y_scale / f_aspect;
+		f_projection[1][1] = y_scale;
+		f_projection[2][2] = f_far / (f_far - f_near);
+		f_projection[2][3] = 1.0f;
+		f_projection[3][2] = -f_near * f_far / (f_far - f_near);
+	}
+
+	/// <summary>
+	/// Camera at f_eye turned by f_yaw radians around the vertical axis.
+	/// </summary>
+	void yawView(const float f_eye[3], float f_yaw, float f_view[4][4])
+	{
+		const float c = std::cos(f_yaw), s = std::sin(f_yaw);
+		const float rotation[3][3] = { { c, 0.0f, s }, { 0.0f, 1.0f, 0.0f }, { -s, 0.0f, c } };
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int column = 0; column < 3; ++column)
+			{
+				f_view[row][column] = rotation[row][column];
+			}
+			f_view[row][3] = 0.0f;
+		}
+		for (int column = 0; column < 3; ++column)
+		{
+			f_view[3][column] = -(f_eye[0] * rotation[0][column] + f_eye[1] * rotation[1][column] + f_eye[2] * rotation[2][column]);
+		}
+		f_view[3][3] = 1.0f;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int light_count = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 1000;
+	const unsigned int frame_count = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 60;
+
+	// Lights scattered over a 400x40x400 level, one in four a spot light
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::vector<ClusterLight> lights(light_count);
+	for (ClusterLight& light : lights)
+	{
+		light.position[0] = -200.0f + unit(random) * 400.0f;
+		light.position[1] = unit(random) * 40.0f;
+		light.position[2] = -200.0f + unit(random) * 400.0f;
+		light.range = 2.0f + unit(random) * 10.0f;
+		light.color[0] = light.color[1] = light.color[2] = 1.0f;
+		if (unit(random) < 0.25f)
+		{
+			const float pitch = -0.5f - unit(random), yaw = unit(random) * 6.2832f;
+			light.direction[0] = std::cos(pitch) * std::cos(yaw);
+			light.direction[1] = std::sin(pitch);
+			light.direction[2] = std::cos(pitch) * std::sin(yaw);
+			light.cos_outer = std::cos(0.3f + unit(random) * 0.6f);
+			light.cos_inner = std::min(1.0f, light.cos_outer + 0.05f);
+		}
+	}
+
+	LightClusterGrid grid;
+	float projection[4][4];
+	perspective(1.0f, 16.0f / 9.0f, 0.1f, 500.0f, projection);
+	std::cout << "Clusters:              " << grid.getGridX() << "x" << grid.getGridY() << "x" << grid.getGridZ() << " = " << grid.getClusterCount() << "\n";
+	std::cout << "Lights:                " << light_count << "\n";
+
+	for (unsigned int thread_count : { 1u, 2u, 4u })
+	{
+		double build_ms = 0.0, max_build_ms = 0.0, visible_lights = 0.0, light_indices = 0.0;
+		unsigned int max_lights_per_cluster = 0;
+		for (unsigned int frame = 0; frame < frame_count; ++frame)
+		{
+			// Turn around on the spot while walking through the level
+			const float t = static_cast<float>(frame) / std::max(1u, frame_count);
+			const float eye[3] = { -150.0f + t * 300.0f, 1.8f, 0.0f };
+			float view[4][4];
+			yawView(eye, t * 6.2832f, view);
+
+			grid.setCamera(view, projection);
+			grid.build(lights.data(), light_count, thread_count);
+
+			const LightClusterGrid::Statistics& statistics = grid.getStatistics();
+			build_ms += statistics.build_ms;
+			max_build_ms = std::max(max_build_ms, static_cast<double>(statistics.build_ms));
+			visible_lights += statistics.visible_lights;
+			light_indices += statistics.light_indices;
+			max_lights_per_cluster = std::max(max_lights_per_cluster, statistics.max_lights_per_cluster);
+		}
+
+		const double frames = std::max(1u, frame_count);
+		std::cout << "Threads:               " << thread_count << "\n";
+		std::cout << "  Build mean/max:      " << build_ms / frames << " / " << max_build_ms << " ms\n";
+		std::cout << "  Lights in frustum:   " << visible_lights / frames << "\n";
+		std::cout << "  Light indices:       " << light_indices / frames << " (" << light_indices / frames / grid.getClusterCount() << " per cluster, max "
+			<< max_lights_per_cluster << ")\n";
+	}
+	return 0;
+}
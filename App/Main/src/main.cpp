@@ -38,11 +38,21 @@
 
 
 #include "AppWindow.hpp"
+#include "StartupTrace.hpp"
 
 int main()
 {
+	// The startup timeline starts here
+	StartupTrace::get();
+
 	AppWindow app;
-	if (app.init())
+	bool initialized = false;
+	{
+		// Creating the window runs AppWindow::onCreate
+		StartupTrace::Scope trace("Window::init");
+		initialized = app.init();
+	}
+	if (initialized)
 	{
 		while (app.isRunning())
 		{
@@ -0,0 +1,210 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Occlusion culling benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure the cost and the hit rate of software occlusion culling.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Rasterizes a synthetic city into the OcclusionCuller and culls props against it.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/25 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "OcclusionCuller.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+	const float box_positions[8 * 3] =
+	{
+		0, 0, 0,  1, 0, 0,  0, 1, 0,  1, 1, 0,
+		0, 0, 1,  1, 0, 1,  0, 1, 1,  1, 1, 1,
+	};
+
+	const unsigned int box_indices[36] =
+	{
+		0, 2, 1,  1, 2, 3,  4, 5, 6,  5, 7, 6,
+		0, 1, 4,  1, 5, 4,  2, 6, 3,  3, 6, 7,
+		0, 4, 2,  2, 4, 6,  1, 3, 5,  3, 7, 5,
+	};
+
+	/// <summary>
+	/// Left-handed view looking from the eye towards the target, row vectors.
+	/// </summary>
+	void lookAt(const float f_eye[3], const float f_target[3], float f_view[4][4])
+	{
+		float forward[3] = { f_target[0] - f_eye[0], f_target[1] - f_eye[1], f_target[2] - f_eye[2] };
+		const float forward_length = std::sqrt(forward[0] * forward[0] + forward[1] * forward[1] + forward[2] * forward[2]);
+		for (float& value : forward) value /= forward_length;
+		float right[3] = { forward[2], 0.0f, -forward[0] };
+		const float right_length = std::sqrt(right[0] * right[0] + right[2] * right[2]);
+		for (float& value : right) value /= right_length;
+		const float up[3] = { forward[1] * right[2] - forward[2] * right[1], forward[2] * right[0] - forward[0] * right[2],
+			forward[0] * right[1] - forward[1] * right[0] };
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			f_view[axis][0] = right[axis];
+			f_view[axis][1] = up[axis];
+			f_view[axis][2] = forward[axis];
+			f_view[axis][3] = 0.0f;
+		}
+		for (int column = 0; column < 3; ++column)
+		{
+			const float* axis = column == 0 ? right : column == 1 ? up : forward;
+			f_view[3][column] = -(axis[0] * f_eye[0] + axis[1] * f_eye[1] + axis[2] * f_eye[2]);
+		}
+		f_view[3][3] = 1.0f;
+	}
+
+	void perspective(float f_fov_y, float f_aspect, float f_near, float f_far, float f_projection[4][4])
+	{
+		const float y_scale = 1.0f / std::tan(f_fov_y * 0.5f);
+		for (int row = 0; row < 4; ++row) for (int column = 0; column < 4; ++column) f_projection[row][column] = 0.0f;
+		f_projection[0][0] = y_scale / f_aspect;
+		f_projection[1][1] = y_scale;
+		f_projection[2][2] = f_far / (f_far - f_near);
+		f_projection[2][3] = 1.0f;
+		f_projection[3][2] = -f_near * f_far / (f_far - f_near);
+	}
+
+	void multiply(const float f_a[4][4], const float f_b[4][4], float f_out[4][4])
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int column = 0; column < 4; ++column)
+			{
+				f_out[row][column] = f_a[row][0] * f_b[0][column] + f_a[row][1] * f_b[1][column] +
+					f_a[row][2] * f_b[2][column] + f_a[row][3] * f_b[3][column];
+			}
+		}
+	}
+
+	/// <summary>
+	/// Scale and translation taking the unit cube to the box.
+	/// </summary>
+	void boxTransform(const OcclusionBox& f_box, float f_world[4][4])
+	{
+		for (int row = 0; row < 4; ++row) for (int column = 0; column < 4; ++column) f_world[row][column] = 0.0f;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			f_world[axis][axis] = f_box.max[axis] - f_box.min[axis];
+			f_world[3][axis] = f_box.min[axis];
+		}
+		f_world[3][3] = 1.0f;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int prop_count = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 10000;
+	const unsigned int frame_count = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 60;
+
+	// A 12x12 grid of buildings 30 units apart, separated by 10 unit wide streets
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	std::vector<OcclusionBox> buildings;
+	for (int block_z = 0; block_z < 12; ++block_z)
+	{
+		for (int block_x = -6; block_x < 6; ++block_x)
+		{
+			const float x = block_x * 30.0f + 5.0f, z = block_z * 30.0f + 5.0f;
+			buildings.push_back({ { x, 0.0f, z }, { x + 20.0f, 10.0f + unit(random) * 40.0f, z + 20.0f } });
+		}
+	}
+
+	// Street furniture and parked cars, anywhere in the city
+	std::vector<OcclusionBox> props(prop_count);
+	for (OcclusionBox& prop : props)
+	{
+		const float x = -180.0f + unit(random) * 360.0f, z = unit(random) * 360.0f, size = 0.5f + unit(random) * 2.0f;
+		prop = { { x, 0.0f, z }, { x + size, size, z + size } };
+	}
+	std::vector<char> visible(props.size());
+
+	OcclusionCuller culler;
+	std::cout << "Depth buffer:          " << culler.getWidth() << "x" << culler.getHeight() << " (" << culler.getTileCount() << " tiles)\n";
+	std::cout << "Occluders / props:     " << buildings.size() << " / " << props.size() << "\n";
+
+	for (unsigned int thread_count : { 1u, 2u, 4u })
+	{
+		double rasterize_ms = 0.0, test_ms = 0.0, culled_rate = 0.0;
+		OcclusionCuller::Statistics statistics;
+		for (unsigned int frame = 0; frame < frame_count; ++frame)
+		{
+			// Walk down the middle street, looking ahead and slightly to the side
+			const float t = static_cast<float>(frame) / std::max(1u, frame_count);
+			const float eye[3] = { 0.0f, 1.8f, t * 300.0f };
+			const float target[3] = { std::sin(t * 6.0f) * 20.0f, 2.0f, eye[2] + 50.0f };
+			float view[4][4], projection[4][4], view_projection[4][4];
+			lookAt(eye, target, view);
+			perspective(1.0f, 16.0f / 9.0f, 0.1f, 1000.0f, projection);
+			multiply(view, projection, view_projection);
+
+			culler.beginFrame(view_projection);
+			for (const OcclusionBox& building : buildings)
+			{
+				float world[4][4];
+				boxTransform(building, world);
+				culler.addOccluder(box_positions, 8, box_indices, 36, world);
+			}
+			culler.rasterize(thread_count);
+			culler.cullBoxes(props.data(), static_cast<unsigned int>(props.size()), reinterpret_cast<bool*>(visible.data()));
+
+			statistics = culler.getStatistics();
+			rasterize_ms += statistics.rasterize_ms;
+			test_ms += statistics.test_ms;
+			culled_rate += statistics.getCulledRate();
+		}
+
+		const double frames = std::max(1u, frame_count);
+		std::cout << "Threads:               " << thread_count << "\n";
+		std::cout << "  Rasterize per frame: " << rasterize_ms / frames << " ms\n";
+		std::cout << "  Test per frame:      " << test_ms / frames << " ms (" << props.size() << " boxes)\n";
+		std::cout << "  Culled:              " << culled_rate / frames * 100.0 << " %\n";
+		std::cout << "  Triangles:           " << statistics.occluder_triangles << " submitted, " << statistics.rasterized_triangles << " rasterized, "
+			<< statistics.binned_triangles << " binned\n";
+	}
+
+	// Occluders that cover few pixels cost more than they save
+	unsigned int useful = 0, total_coverage = 0;
+	for (unsigned int occluder = 0; occluder < buildings.size(); ++occluder)
+	{
+		total_coverage += culler.getOccluderCoverage(occluder);
+		useful += culler.getOccluderCoverage(occluder) >= 64 ? 1 : 0;
+	}
+	std::cout << "Occluders over 64 px:  " << useful << " of " << buildings.size() << " (last frame, " << total_coverage << " px written)\n";
+	return 0;
+}
@@ -0,0 +1,107 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: CPU cost of the dynamic quad batch
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Usage: QuadBatchBench [quads [materials [frames]]]
+//  - The vertices are expanded into system memory standing in for the
+//    mapped vertex ring, so the tool runs without a GPU.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Times submit, sort and vertex expansion of a frame of quads.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "QuadBatch.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	double toMilliseconds(Clock::duration f_duration)
+	{
+		return std::chrono::duration<double, std::milli>(f_duration).count();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int quad_count = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 100000;
+	const unsigned int material_count = std::max(argc > 2 ? std::atoi(argv[2]) : 16, 1);
+	const unsigned int frame_count = std::max(argc > 3 ? std::atoi(argv[3]) : 200, 1);
+
+	QuadBatch batch;
+	std::vector<QuadVertex> vertices(static_cast<size_t>(quad_count) * 4);
+
+	double submit_total = 0.0, write_total = 0.0, frame_best = 1e9;
+	size_t draw_count = 0;
+	for (unsigned int frame = 0; frame < frame_count; ++frame)
+	{
+		const Clock::time_point start = Clock::now();
+
+		batch.clear();
+		for (unsigned int i = 0; i < quad_count; ++i)
+		{
+			// Sprites come in runs of one material, like a HUD or a particle system emits them
+			Quad quad;
+			quad.x = static_cast<float>(i & 1023);
+			quad.y = static_cast<float>(i >> 10);
+			quad.width = 8.0f;
+			quad.height = 8.0f;
+			quad.color.rgba = i * 2654435761u;
+			batch.submit((i / 64) % material_count, quad);
+		}
+
+		const Clock::time_point submitted = Clock::now();
+
+		draw_count = batch.sort().size();
+		batch.write(0, batch.getQuadCount(), vertices.data());
+
+		const Clock::time_point written = Clock::now();
+
+		// The first frame grows the buckets; steady state is what matters
+		if (frame == 0) continue;
+		submit_total += toMilliseconds(submitted - start);
+		write_total += toMilliseconds(written - submitted);
+		frame_best = std::min(frame_best, toMilliseconds(written - start));
+	}
+
+	const double measured = frame_count > 1 ? frame_count - 1 : 1;
+	std::cout << "Quads per frame:   " << quad_count << "\n";
+	std::cout << "Materials / draws: " << material_count << " / " << draw_count << "\n";
+	std::cout << "Submit:            " << submit_total / measured << " ms\n";
+	std::cout << "Sort + expand:     " << write_total / measured << " ms\n";
+	std::cout << "Frame (avg/best):  " << (submit_total + write_total) / measured << " / " << frame_best << " ms\n";
+	return 0;
+}
@@ -0,0 +1,166 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorised copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Headless render graph compilation report
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Usage: RenderGraphReport [width height]
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Compiles a deferred-style frame on the null backend and prints the memory saved.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/23 10:15:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "RenderGraph.hpp"
+#include "NullRenderGraphBackend.hpp"
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+	RenderGraphTextureDesc makeDesc(unsigned int f_width, unsigned int f_height, RenderGraphFormat f_format)
+	{
+		RenderGraphTextureDesc desc;
+		desc.width = f_width > 0 ? f_width : 1;
+		desc.height = f_height > 0 ? f_height : 1;
+		desc.format = f_format;
+		return desc;
+	}
+
+	void buildFrame(RenderGraph& f_graph, unsigned int f_width, unsigned int f_height)
+	{
+		const unsigned int w = f_width;
+		const unsigned int h = f_height;
+
+		static int back_buffer_token = 0;
+		const RenderGraphHandle back_buffer = f_graph.importTexture("BackBuffer",
+			makeDesc(w, h, RenderGraphFormat::RGBA8), &back_buffer_token);
+
+		RenderGraphHandle albedo, normal, depth;
+		f_graph.addPass("GBuffer", [&](RenderGraphBuilder& f_builder)
+		{
+			albedo = f_builder.create("Albedo", makeDesc(w, h, RenderGraphFormat::RGBA8));
+			normal = f_builder.create("Normal", makeDesc(w, h, RenderGraphFormat::RGBA16F));
+			depth = f_builder.create("Depth", makeDesc(w, h, RenderGraphFormat::D32F));
+		}, nullptr);
+
+		RenderGraphHandle occlusion;
+		f_graph.addPass("SSAO", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(normal);
+			f_builder.read(depth);
+			occlusion = f_builder.create("Occlusion", makeDesc(w / 2, h / 2, RenderGraphFormat::R32F));
+		}, nullptr);
+
+		RenderGraphHandle occlusion_blurred;
+		f_graph.addPass("SSAOBlur", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(occlusion);
+			occlusion_blurred = f_builder.create("OcclusionBlurred", makeDesc(w / 2, h / 2, RenderGraphFormat::R32F));
+		}, nullptr);
+
+		RenderGraphHandle hdr;
+		f_graph.addPass("Lighting", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(albedo);
+			f_builder.read(normal);
+			f_builder.read(depth);
+			f_builder.read(occlusion_blurred);
+			hdr = f_builder.create("HDR", makeDesc(w, h, RenderGraphFormat::RGBA16F));
+		}, nullptr);
+
+		RenderGraphHandle bright;
+		f_graph.addPass("BloomThreshold", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(hdr);
+			bright = f_builder.create("BloomHalf", makeDesc(w / 2, h / 2, RenderGraphFormat::RGBA16F));
+		}, nullptr);
+
+		RenderGraphHandle bloom_quarter;
+		f_graph.addPass("BloomDown", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(bright);
+			bloom_quarter = f_builder.create("BloomQuarter", makeDesc(w / 4, h / 4, RenderGraphFormat::RGBA16F));
+		}, nullptr);
+
+		RenderGraphHandle bloom;
+		f_graph.addPass("BloomUp", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(bloom_quarter);
+			bloom = f_builder.create("Bloom", makeDesc(w / 2, h / 2, RenderGraphFormat::RGBA16F));
+		}, nullptr);
+
+		RenderGraphHandle ldr;
+		f_graph.addPass("Tonemap", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(hdr);
+			f_builder.read(bloom);
+			ldr = f_builder.create("LDR", makeDesc(w, h, RenderGraphFormat::RGBA8));
+		}, nullptr);
+
+		// Nobody reads the visualisation, so the compiler culls it
+		f_graph.addPass("NormalsDebug", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(normal);
+			f_builder.create("NormalsView", makeDesc(w, h, RenderGraphFormat::RGBA8));
+		}, nullptr);
+
+		f_graph.addPass("FXAA", [&](RenderGraphBuilder& f_builder)
+		{
+			f_builder.read(ldr);
+			f_builder.write(back_buffer);
+		}, nullptr);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	unsigned int width = 1920;
+	unsigned int height = 1080;
+	if (argc >= 3)
+	{
+		width = static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10));
+		height = static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10));
+	}
+
+	NullRenderGraphBackend backend;
+	RenderGraph graph;
+	buildFrame(graph, width, height);
+
+	if (!graph.compile(&backend) || !graph.execute(&backend))
+	{
+		std::cerr << "Render graph compilation failed" << std::endl;
+		return 1;
+	}
+
+	std::cout << "Frame " << width << "x" << height << std::endl;
+	graph.printReport(std::cout);
+	std::cout << "Peak backend memory: " << backend.getPeakAllocatedBytes() << " bytes" << std::endl;
+	return 0;
+}
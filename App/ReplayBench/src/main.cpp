@@ -0,0 +1,248 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Command stream replay benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure decoding and driver cost of captured frames without the game.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Replays a captured command stream, or writes a synthetic one, and reports the frame times.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "CommandStream.hpp"
+#include "NullCommandBackend.hpp"
+#if defined(_WIN32)
+#include "D3D11CommandBackend.hpp"
+#endif
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	constexpr unsigned int topology_triangle_list = 4;   // D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST
+
+	/// <summary>
+	/// Writes a stream shaped like a level: static meshes in a few materials, per draw constants
+	/// and a ring of dynamic quads. The shaders are placeholders, so only the null backend can replay it.
+	/// </summary>
+	bool writeSyntheticStream(const char* f_file_name, unsigned int f_frames, unsigned int f_draws)
+	{
+		CommandStreamWriter writer;
+		if (!writer.open(f_file_name))
+		{
+			return false;
+		}
+
+		const unsigned int mesh_count = 64, material_count = 8, stride = 32, ring_vertices = 65536;
+		const unsigned int vertex_shader = 1, pixel_shader = 2, layout = 3, constants = 4, ring = 5, first_pipeline = 6;
+		const unsigned int first_mesh = first_pipeline + material_count;
+		std::mt19937 random(11);
+
+		std::vector<unsigned char> byte_code(2048);
+		for (unsigned char& byte : byte_code) byte = static_cast<unsigned char>(random());
+		writer.createShader(vertex_shader, CommandShaderStage::Vertex, byte_code.data(), static_cast<unsigned int>(byte_code.size()));
+		writer.createShader(pixel_shader, CommandShaderStage::Pixel, byte_code.data(), static_cast<unsigned int>(byte_code.size()));
+
+		CommandInputElement elements[3];
+		elements[0].semantic_name = "POSITION";
+		elements[0].format = 6;   // DXGI_FORMAT_R32G32B32_FLOAT
+		elements[1].semantic_name = "NORMAL";
+		elements[1].format = 6;
+		elements[1].aligned_byte_offset = 12;
+		elements[2].semantic_name = "TEXCOORD";
+		elements[2].format = 16;  // DXGI_FORMAT_R32G32_FLOAT
+		elements[2].aligned_byte_offset = 24;
+		writer.createInputLayout(layout, elements, 3, byte_code.data(), static_cast<unsigned int>(byte_code.size()));
+
+		std::vector<float> constant_data(64, 1.0f);
+		writer.createBuffer(constants, CommandBufferKind::Constant, 0, 256, constant_data.data());
+		writer.createBuffer(ring, CommandBufferKind::DynamicVertex, 20, 20 * ring_vertices, nullptr);
+
+		std::vector<unsigned char> state(1024);
+		for (unsigned int i = 0; i < material_count; ++i)
+		{
+			CommandPipelineDesc desc;
+			desc.vertex_shader = vertex_shader;
+			desc.pixel_shader = pixel_shader;
+			desc.input_layout = layout;
+			desc.topology = topology_triangle_list;
+			desc.rasterizer = state.data();
+			desc.rasterizer_size = 40;
+			desc.blend = state.data();
+			desc.blend_size = 264;
+			desc.depth_stencil = state.data();
+			desc.depth_stencil_size = 52;
+			desc.stencil_ref = i;
+			writer.createPipeline(first_pipeline + i, desc);
+		}
+
+		std::vector<unsigned int> index_counts(mesh_count);
+		for (unsigned int i = 0; i < mesh_count; ++i)
+		{
+			const unsigned int vertices = 200 + random() % 4000;
+			index_counts[i] = 3 * (vertices + random() % vertices);
+			std::vector<unsigned char> vertex_data(static_cast<size_t>(vertices) * stride);
+			std::vector<unsigned int> index_data(index_counts[i]);
+			for (unsigned int& index : index_data) index = random() % vertices;
+			writer.createBuffer(first_mesh + 2 * i, CommandBufferKind::Vertex, stride, vertices * stride, vertex_data.data());
+			writer.createBuffer(first_mesh + 2 * i + 1, CommandBufferKind::Index, 4, index_counts[i] * 4, index_data.data());
+		}
+
+		writer.setViewport(1920, 1080);
+		writer.beginFrames();
+
+		const float clear_color[4] = { 0.1f, 0.2f, 0.3f, 1.0f };
+		std::vector<unsigned char> quads(20 * 6 * 512);
+		unsigned int ring_vertex = ring_vertices;
+		for (unsigned int frame = 0; frame < f_frames; ++frame)
+		{
+			writer.clear(clear_color);
+			writer.setConstantBuffer(CommandShaderStage::Vertex, 0, constants);
+			for (unsigned int draw = 0; draw < f_draws; ++draw)
+			{
+				// Draws come sorted by material, as the renderer submits them
+				const unsigned int material = draw * material_count / f_draws;
+				if (draw == 0 || material != (draw - 1) * material_count / f_draws)
+				{
+					writer.setPipeline(first_pipeline + material);
+				}
+				const unsigned int mesh = random() % mesh_count;
+				const unsigned int ids[1] = { first_mesh + 2 * mesh };
+				const unsigned int strides[1] = { stride };
+				writer.setVertexBuffers(ids, strides, 1);
+				writer.setIndexBuffer(first_mesh + 2 * mesh + 1);
+				writer.updateBuffer(constants, 0, constant_data.data(), 256);
+				writer.drawIndexed(topology_triangle_list, index_counts[mesh], 0, 0);
+			}
+
+			// HUD quads through the dynamic ring
+			const unsigned int quad_vertices = static_cast<unsigned int>(quads.size() / 20);
+			if (ring_vertex + quad_vertices > ring_vertices) ring_vertex = 0;
+			writer.updateBuffer(ring, ring_vertex * 20, quads.data(), static_cast<unsigned int>(quads.size()));
+			const unsigned int ring_ids[1] = { ring };
+			const unsigned int ring_strides[1] = { 20 };
+			writer.setVertexBuffers(ring_ids, ring_strides, 1);
+			writer.setPipeline(first_pipeline);
+			writer.draw(topology_triangle_list, quad_vertices, ring_vertex);
+			ring_vertex += quad_vertices;
+
+			writer.endFrame();
+		}
+
+		return writer.close();
+	}
+
+	void printReplay(const CommandStreamReader& f_reader, unsigned int f_loops)
+	{
+		const CommandStreamReader::Statistics& statistics = f_reader.getStatistics();
+		const double frames = statistics.frames ? statistics.frames : 1.0;
+		std::cout << "Stream:            " << f_reader.getSize() / 1048576.0 << " MB, " << f_reader.getFrameCount() << " frames, setup "
+			<< f_reader.getSetupSize() / 1048576.0 << " MB\n";
+		std::cout << "Replayed:          " << statistics.frames << " frames (" << f_loops << " loops), " << statistics.commands << " commands, "
+			<< statistics.draws << " draws\n";
+		std::cout << "Setup:             " << statistics.setup_ms << " ms\n";
+		std::cout << "Frame mean/min/max: " << statistics.replay_ms / frames << " / " << statistics.min_frame_ms << " / "
+			<< statistics.max_frame_ms << " ms\n";
+		std::cout << "Per draw:          " << (statistics.draws ? 1000.0 * statistics.replay_ms / statistics.draws : 0.0) << " us\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc > 2 && std::strcmp(argv[1], "-synthetic") == 0)
+	{
+		const unsigned int frames = argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : 300;
+		const unsigned int draws = argc > 4 ? static_cast<unsigned int>(std::atoi(argv[4])) : 2000;
+		if (!writeSyntheticStream(argv[2], frames, draws))
+		{
+			std::cout << "Cannot write " << argv[2] << "\n";
+			return 1;
+		}
+		std::cout << "Wrote " << frames << " frames of " << draws << " draws to " << argv[2] << "\n";
+		return 0;
+	}
+
+	if (argc < 2)
+	{
+		std::cout << "Usage: ReplayBench <stream> [null|d3d11|warp] [loops]\n"
+			"       ReplayBench -synthetic <stream> [frames] [draws per frame]\n";
+		return 1;
+	}
+
+	const std::string backend_name = argc > 2 ? argv[2] : "null";
+	const unsigned int loops = argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : 1;
+
+	CommandStreamReader reader;
+	if (!reader.loadFile(argv[1]))
+	{
+		std::cout << "Cannot read " << argv[1] << "\n";
+		return 1;
+	}
+
+	if (backend_name == "null")
+	{
+		NullCommandBackend backend;
+		const bool replayed = reader.replay(&backend, loops);
+		printReplay(reader, loops);
+
+		const NullCommandBackend::Statistics& statistics = backend.getStatistics();
+		std::cout << "Resources:         " << statistics.created_resources << " created, " << statistics.released_resources << " released\n";
+		std::cout << "Uploaded:          " << statistics.uploaded_bytes / 1048576.0 << " MB\n";
+		std::cout << "State changes:     " << statistics.state_changes << "\n";
+		std::cout << "Errors:            " << statistics.errors << (statistics.errors ? " (first: " + backend.getFirstError() + ")" : "") << "\n";
+		return replayed && statistics.errors == 0 ? 0 : 1;
+	}
+
+#if defined(_WIN32)
+	if (backend_name == "d3d11" || backend_name == "warp")
+	{
+		D3D11CommandBackend backend;
+		if (!backend.init(backend_name == "warp", true))
+		{
+			std::cout << "Cannot create the " << backend_name << " device\n";
+			return 1;
+		}
+		const bool replayed = reader.replay(&backend, loops);
+		backend.finish();
+		printReplay(reader, loops);
+		std::cout << "Failures:          " << backend.getFailureCount() << "\n";
+		backend.release();
+		return replayed && backend.getFailureCount() == 0 ? 0 : 1;
+	}
+#endif
+
+	std::cout << "Unknown backend " << backend_name << "\n";
+	return 1;
+}
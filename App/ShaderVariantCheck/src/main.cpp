@@ -0,0 +1,160 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Headless check of shader permutation keys
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Verify keyword masks, defines and the variant cache without DirectX.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Entry point of the ShaderVariantCheck tool.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/25 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "ShaderKeywords.hpp"
+#include "BenchReport.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+namespace
+{
+	/// <summary>
+	/// Stands in for ShaderProgram::Variant; remembers the key it was compiled for.
+	/// </summary>
+	struct FakeVariant
+	{
+		ShaderVariantKey key = 0;
+	};
+
+	void checkKeywords()
+	{
+		std::cout << "Keywords\n";
+		ShaderKeywordSet keywords;
+		BenchReport::check(keywords.declare("ANIMATED_COLOR") == 0 && keywords.declare("FOG") == 1 && keywords.declare("SKINNED") == 2,
+			"declare() hands out bits in declaration order");
+		BenchReport::check(keywords.declare("FOG") == 1 && keywords.getCount() == 3, "declaring a keyword again returns its bit");
+		BenchReport::check(keywords.find("SKINNED") == 2 && keywords.find("SHADOWS") == -1, "find() returns -1 for undeclared keywords");
+		BenchReport::check(keywords.getMask() == 0x7, "the mask has one bit per declared keyword");
+
+		BenchReport::check(keywords.makeKey({ "FOG" }) == 0x2, "makeKey() sets the bit of each named keyword");
+		BenchReport::check(keywords.makeKey({ "SKINNED", "ANIMATED_COLOR" }) == keywords.makeKey({ "ANIMATED_COLOR", "SKINNED" }),
+			"makeKey() does not depend on the name order");
+		BenchReport::check(keywords.makeKey({ "FOG", "SHADOWS" }) == 0x2, "makeKey() ignores undeclared keywords");
+		BenchReport::check(keywords.makeKey({}) == 0, "no keyword is key 0");
+
+		BenchReport::check(keywords.sanitize(0xf0 | 0x5) == 0x5, "sanitize() clears the bits of undeclared keywords");
+		BenchReport::check(keywords.sanitize(~0ull) == keywords.getMask(), "sanitize() of every bit is the mask");
+
+		const std::vector<ShaderKeywordSet::Define> defines = keywords.getDefines(0x5 | 0x100);
+		BenchReport::check(defines.size() == 2 && defines[0].first == "ANIMATED_COLOR" && defines[1].first == "SKINNED",
+			"getDefines() lists the enabled keywords in declaration order");
+		BenchReport::check(defines.size() == 2 && defines[0].second == "1" && defines[1].second == "1", "every define has the value 1");
+		BenchReport::check(keywords.getDefines(0).empty(), "key 0 has no defines");
+
+		ShaderKeywordSet full;
+		bool all_declared = true;
+		for (unsigned int i = 0; i < ShaderKeywordSet::max_keywords; ++i)
+		{
+			all_declared = all_declared && full.declare("KEYWORD_" + std::to_string(i)) == static_cast<int>(i);
+		}
+		BenchReport::check(all_declared && full.getMask() == ~0ull, "64 keywords fill every bit of the key");
+		BenchReport::check(full.declare("ONE_TOO_MANY") == -1 && full.getCount() == ShaderKeywordSet::max_keywords, "a 65th keyword is refused");
+		const std::vector<ShaderKeywordSet::Define> last = full.getDefines(1ull << 63);
+		BenchReport::check(last.size() == 1 && last[0].first == "KEYWORD_63", "the top bit maps to the last keyword");
+	}
+
+	void checkCache()
+	{
+		std::cout << "Variant cache\n";
+		ShaderVariantCache<FakeVariant> cache;
+		unsigned int compiles = 0;
+
+		// Keys with bit 3 set fail to compile, as a broken permutation would
+		auto compile = [&compiles](ShaderVariantKey f_key)
+		{
+			compiles++;
+			std::unique_ptr<FakeVariant> variant;
+			if (!(f_key & 0x8))
+			{
+				variant.reset(new FakeVariant());
+				variant->key = f_key;
+			}
+			return variant;
+		};
+
+		BenchReport::check(cache.find(0x1) == nullptr, "find() does not compile");
+		FakeVariant* first = cache.getOrCompile(0x1, compile);
+		BenchReport::check(first && first->key == 0x1 && compiles == 1, "the first request compiles the variant");
+		BenchReport::check(cache.getOrCompile(0x1, compile) == first && compiles == 1, "later requests return it without compiling");
+		BenchReport::check(cache.find(0x1) == first, "find() returns a compiled variant");
+
+		BenchReport::check(cache.getOrCompile(0x9, compile) == nullptr && compiles == 2, "a failed compilation returns nullptr");
+		for (unsigned int i = 0; i < 100; ++i)
+		{
+			cache.getOrCompile(0x9, compile);
+		}
+		BenchReport::check(compiles == 2, "a failed variant is cached and not compiled again");
+		BenchReport::check(cache.find(0x9) == nullptr, "find() returns nullptr for a failed variant");
+		BenchReport::check(cache.getCompilationCount() == 2, "the compilation count includes failed variants");
+
+		cache.getOrCompile(0x2, compile);
+		unsigned int visited = 0;
+		bool only_compiled = true;
+		cache.forEach([&](ShaderVariantKey f_key, FakeVariant& f_variant)
+		{
+			visited++;
+			only_compiled = only_compiled && f_key == f_variant.key && !(f_key & 0x8);
+		});
+		BenchReport::check(visited == 2 && only_compiled, "forEach() visits only the variants that compiled");
+
+		cache.clear();
+		BenchReport::check(cache.find(0x1) == nullptr && cache.getOrCompile(0x1, compile) != nullptr && compiles == 4,
+			"clear() drops the variants, so they compile again");
+
+		// The draw path: resolve a key that is already compiled
+		constexpr unsigned int lookups = 1000000;
+		ShaderVariantKey checksum = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for (unsigned int i = 0; i < lookups; ++i)
+		{
+			checksum += cache.getOrCompile((i & 1) ? 0x1 : 0x2, compile)->key;
+		}
+		const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups;
+		BenchReport::check(checksum == 3ull * lookups / 2 && compiles == 5, "a million lookups of two keys compile nothing more");
+		std::cout << "Lookup of a compiled variant: " << ns << " ns\n";
+	}
+}
+
+int main()
+{
+	checkKeywords();
+	checkCache();
+	return BenchReport::finish();
+}
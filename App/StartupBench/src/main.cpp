@@ -0,0 +1,184 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Parallel startup benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure what declared dependencies save on the time to first frame.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Entry point of the StartupBench tool.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/23 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "SubsystemBootstrap.hpp"
+#include "StartupTrace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace
+{
+	/// <summary>
+	/// Stands in for an init step; sleeping models the time spent waiting on the driver or the disk.
+	/// </summary>
+	void work(unsigned int f_ms)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(f_ms));
+	}
+
+	/// <summary>
+	/// The steps of AppWindow::onCreate plus the subsystems a game adds, with durations typical of a cold start.
+	/// </summary>
+	void declareStartup(SubsystemBootstrap& f_bootstrap, const char* f_failing)
+	{
+		auto step = [f_failing](const char* f_name, unsigned int f_ms)
+		{
+			return [f_name, f_failing, f_ms]()
+			{
+				work(f_ms);
+				return !f_failing || std::string(f_failing) != f_name;
+			};
+		};
+
+		f_bootstrap.add("Window", {}, SubsystemThread::Main, step("Window", 8));
+		f_bootstrap.add("GraphicsEngine", {}, SubsystemThread::Any, [f_failing]()
+		{
+			// Hardware device creation failing first, as on a machine without a D3D11 GPU
+			{
+				StartupTrace::Scope scope("D3D11CreateDevice hardware");
+				work(12);
+			}
+			StartupTrace::Scope scope("D3D11CreateDevice warp");
+			work(18);
+			return !f_failing || std::string(f_failing) != "GraphicsEngine";
+		});
+		f_bootstrap.add("Audio", {}, SubsystemThread::Any, step("Audio", 20));
+		f_bootstrap.add("SwapChain", { "Window", "GraphicsEngine" }, SubsystemThread::Main, step("SwapChain", 6));
+		f_bootstrap.add("Shaders", { "GraphicsEngine" }, SubsystemThread::Any, step("Shaders", 40));
+		f_bootstrap.add("Geometry", { "GraphicsEngine" }, SubsystemThread::Any, step("Geometry", 10));
+		f_bootstrap.add("Textures", { "GraphicsEngine" }, SubsystemThread::Any, step("Textures", 30));
+		f_bootstrap.add("PipelineState", { "Shaders" }, SubsystemThread::Any, step("PipelineState", 3));
+		f_bootstrap.add("FrameResources", { "SwapChain" }, SubsystemThread::Any, step("FrameResources", 4));
+		f_bootstrap.add("RenderThread", { "PipelineState", "Geometry", "Textures", "FrameResources", "Audio" },
+			SubsystemThread::Main, step("RenderThread", 1));
+	}
+
+	struct Result
+	{
+		SubsystemBootstrap::Statistics statistics;
+		double first_frame_ms = 0.0;
+		bool succeeded = false;
+	};
+
+	Result runStartup(unsigned int f_threads, const char* f_failing, const char* f_trace_path)
+	{
+		StartupTrace::get()->reset();
+		JobSystem::get()->init(f_threads);
+
+		Result result;
+		{
+			SubsystemBootstrap bootstrap;
+			declareStartup(bootstrap, f_failing);
+			result.succeeded = bootstrap.run();
+			result.statistics = bootstrap.getStatistics();
+			if (f_failing)
+			{
+				// Everything downstream of the failure is skipped, the rest still runs
+				result.succeeded = !result.succeeded && bootstrap.getFirstFailure() && std::string(bootstrap.getFirstFailure()) == f_failing &&
+					bootstrap.getState("RenderThread") == SubsystemState::Skipped && bootstrap.getState("Audio") == SubsystemState::Succeeded;
+			}
+		}
+
+		// The first frame: record it, render, present
+		work(2);
+		StartupTrace::get()->markFirstFrame();
+		result.first_frame_ms = static_cast<double>(StartupTrace::get()->getTimeToFirstFrameNanoseconds()) * 1e-6;
+		if (f_trace_path && !StartupTrace::get()->writeChromeTrace(f_trace_path))
+		{
+			std::cout << "Cannot write " << f_trace_path << "\n";
+		}
+
+		JobSystem::get()->shutdown();
+		return result;
+	}
+
+	bool checkInvalidGraphs()
+	{
+		SubsystemBootstrap unknown;
+		unknown.add("A", { "Missing" }, SubsystemThread::Any, []() { return true; });
+		const bool unknown_rejected = !unknown.run() && std::string(unknown.getFirstFailure()) == "A";
+
+		bool ran = false;
+		SubsystemBootstrap cycle;
+		cycle.add("Root", {}, SubsystemThread::Any, [&ran]() { ran = true; return true; });
+		cycle.add("B", { "Root", "C" }, SubsystemThread::Any, []() { return true; });
+		cycle.add("C", { "B" }, SubsystemThread::Any, []() { return true; });
+		const bool cycle_rejected = !cycle.run() && std::string(cycle.getFirstFailure()) == "B" && !ran;
+
+		const bool duplicate_rejected = !cycle.add("C", {}, SubsystemThread::Any, nullptr);
+		return unknown_rejected && cycle_rejected && duplicate_rejected;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	StartupTrace::get();
+	const unsigned int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned int threads = argc > 1 ? std::max(1, std::atoi(argv[1])) : std::max(4u, hardware_threads);
+	const char* trace_path = argc > 2 ? argv[2] : "startup_trace.json";
+
+	std::cout << "Simulated startup, " << threads << " job threads\n";
+	std::cout << std::left << std::setw(12) << "mode" << std::right << std::setw(10) << "wall ms" << std::setw(11) << "serial ms"
+		<< std::setw(13) << "critical ms" << std::setw(12) << "concurrent" << std::setw(16) << "first frame ms" << std::setw(8) << "valid" << "\n";
+
+	auto print = [](const char* f_mode, const Result& f_result)
+	{
+		std::cout << std::left << std::setw(12) << f_mode << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(10) << f_result.statistics.wall_ms << std::setw(11) << f_result.statistics.serial_ms
+			<< std::setw(13) << f_result.statistics.critical_path_ms << std::setw(12) << f_result.statistics.max_concurrent
+			<< std::setw(16) << f_result.first_frame_ms << std::setw(8) << (f_result.succeeded ? "yes" : "NO") << "\n";
+	};
+
+	const Result sequential = runStartup(1, nullptr, nullptr);
+	print("sequential", sequential);
+	const Result failing = runStartup(threads, "Textures", nullptr);
+	print("failing", failing);
+	const Result parallel = runStartup(threads, nullptr, trace_path);
+	print("parallel", parallel);
+
+	std::cout << "Speedup " << std::setprecision(2) << sequential.first_frame_ms / parallel.first_frame_ms << "x, invalid graphs rejected: "
+		<< (checkInvalidGraphs() ? "yes" : "NO") << "\n\nParallel startup, timeline in " << trace_path << "\n";
+	StartupTrace::get()->printSummary(std::cout, 8);
+	return 0;
+}
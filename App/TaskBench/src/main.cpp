@@ -0,0 +1,215 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Coroutine task benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Check that tasks load without blocking the frame thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Loads files through I/O, worker and next frame awaits; measures await cost and frame allocations.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TaskScheduler.hpp"
+#include "BenchReport.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct LoadState
+	{
+		std::vector<std::string> paths;
+		std::vector<unsigned int> expected;
+		std::vector<unsigned int> loaded;
+		std::thread::id frame_thread;
+		std::atomic<unsigned int> wrong_thread{ 0 };
+		std::atomic<unsigned int> failed{ 0 };
+	};
+
+	unsigned int checksum(const unsigned char* f_data, size_t f_size)
+	{
+		// FNV-1a, enough work per byte to stand in for parsing
+		unsigned int hash = 2166136261u;
+		for (size_t i = 0; i < f_size; ++i)
+		{
+			hash = (hash ^ f_data[i]) * 16777619u;
+		}
+		return hash;
+	}
+
+	Task<unsigned int> readAndParse(TaskScheduler& f_scheduler, const std::string& f_path, LoadState& f_state)
+	{
+		std::vector<unsigned char> bytes;
+		if (!co_await f_scheduler.readFile(f_path, bytes))
+		{
+			f_state.failed++;
+			co_return 0;
+		}
+
+		co_await f_scheduler.resumeOnWorker();
+		co_return checksum(bytes.data(), bytes.size());
+	}
+
+	Task<void> loadAsset(TaskScheduler& f_scheduler, unsigned int f_index, LoadState& f_state)
+	{
+		const unsigned int hash = co_await readAndParse(f_scheduler, f_state.paths[f_index], f_state);
+
+		// Creating GPU resources would go here: back on the frame thread
+		co_await f_scheduler.nextFrame();
+		if (std::this_thread::get_id() != f_state.frame_thread)
+		{
+			f_state.wrong_thread++;
+		}
+		f_state.loaded[f_index] = hash;
+	}
+
+	Task<int> leaf(int f_value)
+	{
+		co_return f_value;
+	}
+
+	Task<long long> sumChain(int f_count)
+	{
+		long long sum = 0;
+		for (int i = 0; i < f_count; ++i)
+		{
+			sum += co_await leaf(i);
+		}
+		co_return sum;
+	}
+
+	Task<void> runChain(int f_count, long long& f_sum)
+	{
+		f_sum = co_await sumChain(f_count);
+	}
+
+	/// <summary>
+	/// One round of loading every file while the frame loop runs.
+	/// </summary>
+	void loadRound(const char* f_name, TaskScheduler& f_scheduler, LoadState& f_state, double f_frame_work_ms)
+	{
+		std::fill(f_state.loaded.begin(), f_state.loaded.end(), 0u);
+		const CoroutineFramePool::Statistics before = CoroutineFramePool::get()->getStatistics();
+		const auto start = std::chrono::steady_clock::now();
+		for (unsigned int i = 0; i < f_state.paths.size(); ++i)
+		{
+			f_scheduler.spawn(loadAsset(f_scheduler, i, f_state));
+		}
+
+		unsigned int frames = 0;
+		double max_run_frame_ms = 0.0;
+		while (f_scheduler.getLiveTaskCount() > 0)
+		{
+			const auto frame_start = std::chrono::steady_clock::now();
+			f_scheduler.runFrame();
+			max_run_frame_ms = std::max(max_run_frame_ms, BenchReport::elapsedMs(frame_start));
+
+			// The rest of the frame: the loads must not hold it up
+			const auto work_start = std::chrono::steady_clock::now();
+			while (BenchReport::elapsedMs(work_start) < f_frame_work_ms)
+			{
+			}
+			frames++;
+		}
+		const double total_ms = BenchReport::elapsedMs(start);
+		const CoroutineFramePool::Statistics after = CoroutineFramePool::get()->getStatistics();
+
+		const bool valid = f_state.loaded == f_state.expected && f_state.wrong_thread == 0 && f_state.failed == 0;
+		std::cout << std::left << std::setw(8) << f_name << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(10) << total_ms << std::setw(8) << frames << std::setw(14) << max_run_frame_ms
+			<< std::setw(12) << after.allocations - before.allocations << std::setw(12) << after.heap_allocations - before.heap_allocations
+			<< std::setw(8) << (valid ? "yes" : "NO") << "\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int threads = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 0;
+	const unsigned int file_count = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 64;
+	const unsigned int file_size = argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : 256 * 1024;
+
+	JobSystem::get()->init(threads);
+	TaskScheduler& scheduler = *TaskScheduler::get();
+	scheduler.init();
+
+	LoadState state;
+	state.frame_thread = std::this_thread::get_id();
+	const std::filesystem::path directory = std::filesystem::temp_directory_path();
+	std::vector<unsigned char> contents(file_size);
+	for (unsigned int i = 0; i < file_count; ++i)
+	{
+		for (unsigned int j = 0; j < file_size; ++j)
+		{
+			contents[j] = static_cast<unsigned char>((i * 131u + j * 7u) ^ (j >> 5));
+		}
+		const std::string path = (directory / ("TaskBench_" + std::to_string(i) + ".bin")).string();
+		std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(contents.data()), contents.size());
+		state.paths.push_back(path);
+		state.expected.push_back(checksum(contents.data(), contents.size()));
+	}
+	state.loaded.resize(file_count);
+
+	std::cout << file_count << " files of " << file_size / 1024 << " KiB, " << JobSystem::get()->getThreadCount() << " job threads\n";
+	std::cout << std::left << std::setw(8) << "round" << std::right << std::setw(10) << "total ms" << std::setw(8) << "frames"
+		<< std::setw(14) << "max frame ms" << std::setw(12) << "frames new" << std::setw(12) << "heap new" << std::setw(8) << "valid" << "\n";
+	loadRound("cold", scheduler, state, 1.0);
+	loadRound("warm", scheduler, state, 1.0);
+
+	// Cost of awaiting a task that completes at once: creating, running and freeing a pooled frame
+	constexpr int chain_length = 1000000;
+	long long sum = 0;
+	const CoroutineFramePool::Statistics before = CoroutineFramePool::get()->getStatistics();
+	const auto start = std::chrono::steady_clock::now();
+	scheduler.spawn(runChain(chain_length, sum));
+	const double chain_ms = BenchReport::elapsedMs(start);
+	const CoroutineFramePool::Statistics after = CoroutineFramePool::get()->getStatistics();
+	std::cout << "await of a ready task: " << std::setprecision(1) << chain_ms * 1e6 / chain_length << " ns, "
+		<< after.heap_allocations - before.heap_allocations << " heap allocations for " << after.allocations - before.allocations
+		<< " frames, sum " << (sum == static_cast<long long>(chain_length) * (chain_length - 1) / 2 ? "ok" : "WRONG") << "\n";
+
+	scheduler.shutdown();
+	JobSystem::get()->shutdown();
+	for (const std::string& path : state.paths)
+	{
+		std::remove(path.c_str());
+	}
+	return 0;
+}
@@ -0,0 +1,293 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Glyph atlas and text layout benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Check and time glyph rasterization, atlas eviction and cached layouts without a GPU.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Entry point of the TextBench tool.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/26 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TextLayoutCache.hpp"
+#include "BenchReport.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	/// <summary>
+	/// Inserts a square glyph filled with the low byte of its key.
+	/// </summary>
+	unsigned int insertSquare(GlyphAtlas& f_atlas, unsigned long long f_key, int f_size)
+	{
+		const std::vector<unsigned char> pixels(static_cast<size_t>(f_size * f_size), static_cast<unsigned char>(f_key));
+		return f_atlas.insert(f_key, pixels.data(), f_size, f_size, f_size, 0.0f, 0.0f);
+	}
+
+	bool holdsSquare(const GlyphAtlas& f_atlas, unsigned int f_handle, unsigned long long f_key)
+	{
+		if (f_handle == GlyphAtlas::invalid_handle) return false;
+		const GlyphAtlasRegion& region = f_atlas.getRegion(f_handle);
+		for (unsigned int y = region.y; y < region.y + region.height; ++y)
+		{
+			for (unsigned int x = region.x; x < region.x + region.width; ++x)
+			{
+				if (f_atlas.getPixels()[y * f_atlas.getWidth() + x] != static_cast<unsigned char>(f_key)) return false;
+			}
+		}
+		return true;
+	}
+
+	void checkAtlas()
+	{
+		std::cout << "GlyphAtlas\n";
+		GlyphAtlas atlas;
+		BenchReport::check(atlas.init(64, 64), "init() allocates the atlas");
+
+		// 12x12 glyphs with 1 texel of padding fit 4 to a shelf and 4 shelves in a 64x64 atlas
+		atlas.beginFrame();
+		std::vector<unsigned int> handles;
+		for (unsigned long long key = 1; key <= 16; ++key)
+		{
+			handles.push_back(insertSquare(atlas, key, 12));
+		}
+		BenchReport::check(std::none_of(handles.begin(), handles.end(), [](unsigned int f_handle) { return f_handle == GlyphAtlas::invalid_handle; }),
+			"glyphs are packed until the atlas is full");
+		bool copied = true;
+		for (unsigned long long key = 1; key <= 16; ++key)
+		{
+			copied = copied && holdsSquare(atlas, handles[key - 1], key) && atlas.find(key) == handles[key - 1];
+		}
+		BenchReport::check(copied, "every glyph's texels and handle can be found again");
+		BenchReport::check(!atlas.getDirtyRects().empty(), "inserts leave dirty rectangles for the upload");
+		atlas.clearDirtyRects();
+
+		BenchReport::check(insertSquare(atlas, 17, 12) == GlyphAtlas::invalid_handle && atlas.getStatistics().evictions == 0,
+			"glyphs used this frame are never evicted");
+
+		// Next frame: use the odd keys, so the even ones are the least recently used
+		atlas.beginFrame();
+		for (unsigned long long key = 1; key <= 16; key += 2)
+		{
+			atlas.touch(handles[key - 1], key);
+		}
+		const GlyphAtlasRegion evicted = atlas.getRegion(handles[1]);
+		const unsigned int handle = insertSquare(atlas, 17, 12);
+		BenchReport::check(handle != GlyphAtlas::invalid_handle && atlas.getStatistics().evictions == 1 && holdsSquare(atlas, handle, 17),
+			"a full atlas evicts one unused glyph for a new one");
+		BenchReport::check(atlas.getRegion(handle).x == evicted.x && atlas.getRegion(handle).y == evicted.y, "the new glyph takes the evicted slot");
+		BenchReport::check(atlas.find(2) == GlyphAtlas::invalid_handle && !atlas.touch(handles[1], 2), "the least recently used glyph is the one evicted");
+		bool kept = true;
+		for (unsigned long long key = 1; key <= 16; key += 2)
+		{
+			kept = kept && atlas.touch(handles[key - 1], key) && holdsSquare(atlas, handles[key - 1], key);
+		}
+		BenchReport::check(kept, "glyphs used this frame keep their handle and texels");
+		BenchReport::check(insertSquare(atlas, 18, 12) != GlyphAtlas::invalid_handle && atlas.getStatistics().evictions == 2 &&
+			atlas.find(4) == GlyphAtlas::invalid_handle, "the next insert evicts the next least recently used glyph");
+		BenchReport::check(insertSquare(atlas, 19, 0) != GlyphAtlas::invalid_handle && atlas.getStatistics().evictions == 2,
+			"a blank glyph takes no space");
+		BenchReport::check(insertSquare(atlas, 20, 100) == GlyphAtlas::invalid_handle, "a glyph larger than the atlas is refused");
+	}
+
+	void checkFont(const Font& f_font, float f_pixel_height)
+	{
+		std::cout << "Font\n";
+		GlyphBitmap bitmap;
+		const unsigned int a = f_font.getGlyphIndex('A');
+		BenchReport::check(a != 0 && f_font.getGlyphIndex(0x10ffff) == 0, "the cmap maps characters and falls back to the missing glyph");
+		BenchReport::check(f_font.getAdvance(a, f_pixel_height) > 0.0f, "glyphs have an advance");
+		BenchReport::check(f_font.rasterize(f_font.getGlyphIndex(' '), f_pixel_height, GlyphRasterMode::Coverage, bitmap) && bitmap.width == 0,
+			"the space rasterizes to an empty bitmap");
+
+		BenchReport::check(f_font.rasterize(a, f_pixel_height, GlyphRasterMode::Coverage, bitmap) && bitmap.width > 0 &&
+			bitmap.height <= static_cast<int>(f_pixel_height) + 2, "'A' rasterizes within the pixel height");
+		BenchReport::check(bitmap.pixels.front() < 128, "coverage is low in the corner of 'A'");
+		BenchReport::check(f_font.rasterize(f_font.getGlyphIndex('H'), f_pixel_height * 2.0f, GlyphRasterMode::Coverage, bitmap) &&
+			*std::max_element(bitmap.pixels.begin(), bitmap.pixels.end()) == 255, "coverage is full inside the stems of 'H'");
+
+		BenchReport::check(f_font.rasterize(a, f_pixel_height, GlyphRasterMode::SignedDistance, bitmap) && bitmap.pixels.front() == 0,
+			"the distance field is padded and saturates outside");
+
+		// Every printable ASCII glyph, both modes
+		const Clock::time_point start = Clock::now();
+		unsigned int count = 0;
+		for (unsigned int c = 33; c < 127; ++c, ++count)
+		{
+			f_font.rasterize(f_font.getGlyphIndex(c), f_pixel_height, GlyphRasterMode::Coverage, bitmap);
+		}
+		const double coverage_us = BenchReport::elapsedMs(start) * 1000.0 / count;
+		const Clock::time_point distance_start = Clock::now();
+		for (unsigned int c = 33; c < 127; ++c)
+		{
+			f_font.rasterize(f_font.getGlyphIndex(c), f_pixel_height, GlyphRasterMode::SignedDistance, bitmap);
+		}
+		const double distance_us = BenchReport::elapsedMs(distance_start) * 1000.0 / count;
+		std::cout << "  rasterize at " << f_pixel_height << " px: " << coverage_us << " us per coverage glyph, " <<
+			distance_us << " us per distance field glyph\n";
+	}
+
+	/// <summary>
+	/// Checks that every visible glyph of the layout is resident and points at its atlas region.
+	/// </summary>
+	bool isResident(TextLayoutCache& f_cache, const TextLayout& f_layout)
+	{
+		GlyphAtlas& atlas = f_cache.getAtlas();
+		for (const TextLayoutGlyph& glyph : f_layout.glyphs)
+		{
+			if (glyph.quad.width == 0.0f) continue;
+			if (!atlas.touch(glyph.atlas_handle, glyph.atlas_key)) return false;
+			const GlyphAtlasRegion& region = atlas.getRegion(glyph.atlas_handle);
+			if (glyph.quad.u0 != static_cast<float>(region.x) / atlas.getWidth()) return false;
+		}
+		return true;
+	}
+
+	void checkEviction(const Font& f_font)
+	{
+		std::cout << "Atlas eviction through the layout cache\n";
+		TextLayoutCache cache;
+		cache.init(128, 128, 64);
+		const unsigned int font = cache.addFont(&f_font);
+
+		// Each size needs its own glyphs; a few sizes overflow a 128x128 atlas
+		const char* text = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+		bool resident = true;
+		for (unsigned int frame = 0; frame < 8; ++frame)
+		{
+			cache.beginFrame();
+			const TextLayout* layout = cache.getLayout(font, text, ::strlen(text), 16.0f + frame * 4.0f, GlyphRasterMode::Coverage);
+			resident = resident && layout && isResident(cache, *layout);
+		}
+		BenchReport::check(cache.getAtlas().getStatistics().evictions > 0, "new sizes evict the glyphs of old ones");
+		BenchReport::check(resident, "every frame's layout is resident despite the evictions");
+
+		cache.beginFrame();
+		const TextLayout* first = cache.getLayout(font, text, ::strlen(text), 16.0f, GlyphRasterMode::Coverage);
+		BenchReport::check(cache.getStatistics().layout_hits == 1 && cache.getStatistics().glyphs_rasterized > 0 && isResident(cache, *first),
+			"a cached layout whose glyphs were evicted rasterizes them again");
+	}
+
+	void timeLayouts(const Font& f_font, unsigned int f_labels, float f_pixel_height)
+	{
+		std::cout << f_labels << " labels at " << f_pixel_height << " px\n";
+		std::vector<std::string> labels;
+		for (unsigned int i = 0; i < f_labels; ++i)
+		{
+			char label[64];
+			std::snprintf(label, sizeof(label), "Unit %u: %u/%u HP", i, (i * 37) % 500, 500u);
+			labels.push_back(label);
+		}
+
+		TextLayoutCache cache;
+		cache.init(1024, 1024, f_labels + 1024);
+		const unsigned int font = cache.addFont(&f_font);
+		QuadBatch batch;
+
+		double first_ms = 0.0;
+		double best_lookup_ms = 1e30;
+		double best_submit_ms = 1e30;
+		size_t glyphs = 0;
+		bool all_hits = true;
+		for (unsigned int frame = 0; frame < 6; ++frame)
+		{
+			cache.beginFrame();
+			batch.clear();
+			glyphs = 0;
+			std::vector<const TextLayout*> layouts(labels.size());
+
+			const Clock::time_point start = Clock::now();
+			for (size_t i = 0; i < labels.size(); ++i)
+			{
+				layouts[i] = cache.getLayout(font, labels[i].data(), labels[i].size(), f_pixel_height, GlyphRasterMode::Coverage);
+			}
+			const double lookup_ms = BenchReport::elapsedMs(start);
+
+			const Clock::time_point submit_start = Clock::now();
+			for (size_t i = 0; i < layouts.size(); ++i)
+			{
+				TextLayoutCache::submit(*layouts[i], 10.0f, static_cast<float>(i % 60) * f_pixel_height, QuadColor(), 0, batch);
+				glyphs += layouts[i]->glyphs.size();
+			}
+			batch.sort();
+			const double submit_ms = BenchReport::elapsedMs(submit_start);
+
+			if (frame == 0)
+			{
+				first_ms = lookup_ms;
+				continue;
+			}
+			all_hits = all_hits && cache.getStatistics().layout_hits == f_labels && cache.getStatistics().glyphs_rasterized == 0;
+			best_lookup_ms = std::min(best_lookup_ms, lookup_ms);
+			best_submit_ms = std::min(best_submit_ms, lookup_ms + submit_ms);
+		}
+
+		BenchReport::check(all_hits, "cached frames hit every layout and rasterize nothing");
+		BenchReport::check(batch.getDraws().size() == 1, "every label goes into one draw");
+		std::cout << "  " << glyphs << " glyphs, " << cache.getAtlas().getStatistics().glyph_count << " in the atlas\n";
+		std::cout << "  first frame: " << first_ms << " ms, cached: " << best_lookup_ms << " ms, cached with quad submission: " <<
+			best_submit_ms << " ms\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	checkAtlas();
+
+	if (argc < 2)
+	{
+		std::cout << "Usage: TextBench <font.ttf> [labels] [pixel height]; the font checks need a TrueType file\n";
+	}
+	else
+	{
+		Font font;
+		const unsigned int labels = argc > 2 ? static_cast<unsigned int>(std::max(1, std::atoi(argv[2]))) : 3000;
+		const float pixel_height = argc > 3 ? static_cast<float>(std::max(4.0, std::atof(argv[3]))) : 16.0f;
+		BenchReport::check(font.loadFile(argv[1]), "the font loads");
+		if (font.isLoaded())
+		{
+			checkFont(font, pixel_height);
+			checkEviction(font);
+			timeLayouts(font, labels, pixel_height);
+		}
+	}
+
+	return BenchReport::finish();
+}
@@ -0,0 +1,156 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Texture encoder benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure mip generation and block compression throughput and quality.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Builds mip chains and block compresses a synthetic image with the TextureEncoder.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/29 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TextureEncoder.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	/// <summary>
+	/// Gradients, hard edged shapes, noise and a soft alpha mask: smooth areas and edges for the block encoders.
+	/// </summary>
+	std::vector<unsigned char> createImage(unsigned int f_size)
+	{
+		std::vector<unsigned char> pixels(static_cast<size_t>(f_size) * f_size * 4);
+		std::mt19937 random(5);
+		std::uniform_int_distribution<int> noise(-12, 12);
+		for (unsigned int y = 0; y < f_size; ++y)
+		{
+			for (unsigned int x = 0; x < f_size; ++x)
+			{
+				const float u = static_cast<float>(x) / f_size, v = static_cast<float>(y) / f_size;
+				const bool checker = ((x / 64) ^ (y / 64)) & 1;
+				const float ring = std::sin(std::sqrt((u - 0.5f) * (u - 0.5f) + (v - 0.5f) * (v - 0.5f)) * 60.0f);
+				const int grain = noise(random);
+				unsigned char* pixel = pixels.data() + (static_cast<size_t>(y) * f_size + x) * 4;
+				pixel[0] = static_cast<unsigned char>(std::min(255, std::max(0, static_cast<int>(u * 255.0f) + grain)));
+				pixel[1] = static_cast<unsigned char>(std::min(255, std::max(0, static_cast<int>((ring * 0.5f + 0.5f) * 200.0f) + grain)));
+				pixel[2] = checker ? 220 : static_cast<unsigned char>(v * 128.0f);
+				pixel[3] = static_cast<unsigned char>(std::min(255.0f, std::max(0.0f, (1.0f - std::fabs(u - v) * 2.0f) * 300.0f)));
+			}
+		}
+		return pixels;
+	}
+
+	/// <summary>
+	/// Peak signal to noise ratio of the first mip over the channels the format keeps.
+	/// </summary>
+	double getPsnr(const TextureData& f_original, const TextureData& f_decoded, int f_first_channel, int f_channel_count)
+	{
+		const TextureMip& mip = f_original.getMip(0);
+		double squared_error = 0.0;
+		for (size_t i = 0; i < mip.size; i += 4)
+		{
+			for (int c = f_first_channel; c < f_first_channel + f_channel_count; ++c)
+			{
+				const double difference = static_cast<double>(f_original.getMipData(0)[i + c]) - f_decoded.getMipData(0)[i + c];
+				squared_error += difference * difference;
+			}
+		}
+		const double mean = squared_error / (static_cast<double>(mip.width) * mip.height * f_channel_count);
+		return mean > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mean) : 99.0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int size = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 1024;
+	const std::string dds_path = argc > 2 ? argv[2] : "";
+	const std::vector<unsigned char> image = createImage(size);
+	const double source_mb = static_cast<double>(size) * size * 4 / (1024.0 * 1024.0);
+
+	std::cout << "Image:                 " << size << "x" << size << " RGBA8 (" << source_mb << " MB)\n";
+
+	TextureData chain;
+	for (unsigned int thread_count : { 1u, 4u })
+	{
+		TextureEncoder encoder(thread_count);
+		encoder.buildMipChain(image.data(), size, size, true, 0, chain);
+		std::cout << "Mip chain, " << thread_count << " thread(s): " << encoder.getStatistics().mip_ms << " ms (" << chain.getMipCount() << " mips, sRGB)\n";
+	}
+
+	struct Target
+	{
+		const char* name;
+		TextureFormat format;
+		int first_channel;
+		int channel_count;
+	};
+	const Target targets[] =
+	{
+		{ "BC1", TextureFormat::BC1_SRGB, 0, 3 },
+		{ "BC3", TextureFormat::BC3_SRGB, 0, 4 },
+		{ "BC5", TextureFormat::BC5, 0, 2 },
+		{ "BC7", TextureFormat::BC7_SRGB, 0, 4 },
+	};
+
+	for (const Target& target : targets)
+	{
+		TextureData compressed, decoded;
+		for (unsigned int thread_count : { 1u, 4u })
+		{
+			TextureEncoder encoder(thread_count);
+			encoder.encode(chain, target.format, compressed);
+			const TextureEncoder::Statistics& statistics = encoder.getStatistics();
+			std::cout << target.name << ", " << thread_count << " thread(s):      " << statistics.encode_ms << " ms, "
+				<< source_mb * 4.0 / 3.0 / (statistics.encode_ms / 1000.0) << " MB/s, " << statistics.encoded_blocks << " blocks\n";
+		}
+
+		TextureEncoder encoder;
+		encoder.decode(compressed, decoded);
+		std::cout << "  Size:                " << compressed.getData().size() << " bytes, " << static_cast<double>(chain.getData().size()) / compressed.getData().size()
+			<< "x smaller than RGBA8\n";
+		std::cout << "  PSNR:                " << getPsnr(chain, decoded, target.first_channel, target.channel_count) << " dB\n";
+
+		if (!dds_path.empty())
+		{
+			const std::string file_name = dds_path + "_" + target.name + ".dds";
+			TextureData reloaded;
+			const bool round_trip = compressed.saveFile(file_name.c_str()) && reloaded.loadFile(file_name.c_str()) &&
+				reloaded.getData() == compressed.getData() && reloaded.getFormat() == compressed.getFormat();
+			std::cout << "  DDS:                 " << file_name << (round_trip ? " (reloaded)" : " (failed)") << "\n";
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,194 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Texture streaming benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure residency solving, budget adherence and convergence of mip streaming.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Streams the mips of a synthetic level with the TextureStreamer while a camera flies through it.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/01 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TextureStreamer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct SceneObject
+	{
+		float x = 0.0f;
+		float z = 0.0f;
+		float size = 1.0f;      // World size the whole texture covers
+		unsigned int texture = 0;
+	};
+
+	/// <summary>
+	/// Byte every mip of a texture is filled with, so the bench can tell whose data arrived.
+	/// </summary>
+	unsigned char getMipTag(unsigned int f_texture, unsigned int f_mip)
+	{
+		return static_cast<unsigned char>(f_texture * 31 + f_mip);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int texture_count = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 3000;
+	const unsigned long long budget_mb = argc > 2 ? static_cast<unsigned long long>(std::atoi(argv[2])) : 256;
+	const unsigned int frame_count = argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : 240;
+	const unsigned int io_threads = argc > 4 ? static_cast<unsigned int>(std::atoi(argv[4])) : 2;
+	const double disk_mb_per_s = 500.0;
+	const float projection_scale = 1.0f / std::tan(0.5f), viewport_height = 1080.0f, half_width = 0.9f;
+
+	TextureStreamerSettings settings;
+	settings.budget_bytes = budget_mb << 20;
+	settings.io_threads = io_threads;
+
+	// Simulated disk: a seek plus the transfer time, then the mip filled with its tag. Sleeps are
+	// coarse, so each I/O thread sleeps off the time it owes once it adds up to a millisecond.
+	TextureStreamer streamer;
+	streamer.start(settings, [&](unsigned int f_texture, unsigned int f_mip, std::vector<unsigned char>& f_data)
+	{
+		thread_local double owed_us = 0.0;
+		const unsigned long long bytes = streamer.getMipBytes(f_texture, f_mip);
+		owed_us += 100.0 + bytes / disk_mb_per_s / 1.048576;
+		if (owed_us >= 1000.0)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			std::this_thread::sleep_for(std::chrono::microseconds(static_cast<long long>(owed_us)));
+			owed_us -= std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		}
+		f_data.assign(static_cast<size_t>(bytes), getMipTag(f_texture, f_mip));
+		return true;
+	});
+
+	// A 1000 m long strip of props, most with 1K or 2K textures, a few with 4K ones
+	std::mt19937 random(7);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+	const unsigned int sizes[] = { 512, 1024, 1024, 2048, 2048, 4096 };
+	std::vector<SceneObject> objects(texture_count);
+	unsigned long long full_bytes = 0;
+	for (unsigned int i = 0; i < texture_count; ++i)
+	{
+		const unsigned int size = sizes[random() % 6];
+		const TextureFormat format = unit(random) < 0.5f ? TextureFormat::BC1_SRGB : TextureFormat::BC7_SRGB;
+		objects[i].texture = streamer.registerTexture(format, size, size);
+		objects[i].x = unit(random) * 1000.0f;
+		objects[i].z = -40.0f + unit(random) * 80.0f;
+		objects[i].size = 2.0f + unit(random) * 14.0f;
+		for (unsigned int mip = 0; mip < streamer.getMipCount(i); ++mip)
+		{
+			full_bytes += streamer.getMipBytes(i, mip);
+		}
+	}
+
+	// Mirror of the GPU side, updated from the changes only
+	std::vector<unsigned int> gpu_first_mip(texture_count);
+	for (unsigned int i = 0; i < texture_count; ++i)
+	{
+		gpu_first_mip[i] = streamer.getTailMip(i);
+	}
+
+	double update_ms = 0.0, max_update_ms = 0.0, wanted_mb = 0.0, missing_per_visible = 0.0;
+	unsigned long long peak_bytes = 0, over_budget_frames = 0, sharp_frames = 0, bad_changes = 0;
+	const auto frame_time = std::chrono::milliseconds(8);
+	for (unsigned int frame = 0; frame < frame_count; ++frame)
+	{
+		const auto frame_start = std::chrono::steady_clock::now();
+
+		// Fly along the strip for three quarters of the run, then hover to let the streamer settle
+		const float t = std::min(1.0f, static_cast<float>(frame) / (0.75f * frame_count));
+		const float eye_x = t * 800.0f;
+		for (const SceneObject& object : objects)
+		{
+			const float distance = object.x - eye_x;
+			if (distance > 0.5f && distance < 400.0f && std::fabs(object.z) < distance * half_width)
+			{
+				streamer.reportUsage(object.texture, TextureStreamer::getProjectedSize(object.size, distance, projection_scale, viewport_height));
+			}
+		}
+
+		for (const TextureResidencyChange& change : streamer.update())
+		{
+			bool valid = change.previous_first_mip == gpu_first_mip[change.texture];
+			if (change.first_mip < change.previous_first_mip)
+			{
+				valid = valid && change.mip_data.size() == change.previous_first_mip - change.first_mip;
+				for (unsigned int i = 0; valid && i < change.mip_data.size(); ++i)
+				{
+					valid = change.mip_data[i][0] == getMipTag(change.texture, change.first_mip + i);
+				}
+			}
+			bad_changes += valid ? 0 : 1;
+			gpu_first_mip[change.texture] = change.first_mip;
+		}
+
+		const TextureStreamer::Statistics& statistics = streamer.getStatistics();
+		const unsigned long long used = statistics.resident_bytes + statistics.pending_bytes;
+		peak_bytes = std::max(peak_bytes, used);
+		over_budget_frames += used > settings.budget_bytes ? 1 : 0;
+		sharp_frames += statistics.missing_mips == 0 ? 1 : 0;
+		update_ms += statistics.update_ms;
+		max_update_ms = std::max(max_update_ms, statistics.update_ms);
+		wanted_mb += statistics.wanted_bytes / 1048576.0;
+		missing_per_visible += statistics.visible_textures ? static_cast<double>(statistics.missing_mips) / statistics.visible_textures : 0.0;
+
+		std::this_thread::sleep_until(frame_start + frame_time);
+	}
+
+	for (unsigned int i = 0; i < texture_count; ++i)
+	{
+		bad_changes += gpu_first_mip[i] == streamer.getFirstResidentMip(i) ? 0 : 1;
+	}
+
+	const TextureStreamer::Statistics& statistics = streamer.getStatistics();
+	const double frames = std::max(1u, frame_count);
+	std::cout << "Textures:              " << texture_count << " (" << full_bytes / 1048576 << " MB with every mip)\n";
+	std::cout << "Budget:                " << budget_mb << " MB, " << io_threads << " I/O threads, " << disk_mb_per_s << " MB/s disk\n";
+	std::cout << "Update mean/max:       " << update_ms / frames << " / " << max_update_ms << " ms\n";
+	std::cout << "Peak resident+loading: " << peak_bytes / 1048576.0 << " MB, over budget in " << over_budget_frames << " frames\n";
+	std::cout << "Wanted without budget: " << wanted_mb / frames << " MB on average\n";
+	std::cout << "Missing mips:          " << missing_per_visible / frames << " per visible texture on average, "
+		<< statistics.missing_mips << " at the end\n";
+	std::cout << "Frames fully sharp:    " << 100.0 * sharp_frames / frames << " %\n";
+	std::cout << "Loads:                 " << statistics.loads_started << " started, " << statistics.loads_completed << " completed, "
+		<< statistics.loads_discarded << " discarded, " << statistics.loads_failed << " failed\n";
+	std::cout << "Evicted mips:          " << statistics.evicted_mips << "\n";
+	std::cout << "Residency mismatches:  " << bad_changes << "\n";
+	return bad_changes == 0 && over_budget_frames == 0 ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Staging ring and upload batching benchmark
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Check and time the upload queue without a GPU.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Entry point of the UploadQueueBench tool.
+/// @par Revision History:
+///      $Source: main.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/25 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "UploadQueue.hpp"
+#include "BenchReport.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	unsigned char pattern(unsigned int f_producer, unsigned int f_upload, size_t f_byte)
+	{
+		return static_cast<unsigned char>(f_producer * 131 + f_upload * 31 + f_byte * 7);
+	}
+
+	void checkRing()
+	{
+		std::cout << "UploadRing\n";
+		UploadRing ring(1024);
+		UploadRing::Allocation a, b, c, d;
+		BenchReport::check(ring.allocate(100, 16, &a) && a.offset == 0 && a.consumed == 100, "the first allocation starts at 0");
+		BenchReport::check(ring.allocate(100, 16, &b) && b.offset == 112 && b.consumed == 112, "alignment padding is charged to the allocation");
+		BenchReport::check(!ring.allocate(2000, 16, &c), "a range larger than the ring is refused");
+		BenchReport::check(ring.allocate(700, 16, &c) && c.offset == 224 && ring.getUsed() == 924, "allocations are contiguous");
+		BenchReport::check(!ring.allocate(200, 16, &d), "a full ring refuses the allocation");
+
+		ring.release(a);
+		ring.release(b);
+		BenchReport::check(ring.getUsed() == 712, "release() frees the oldest allocations");
+		BenchReport::check(ring.allocate(200, 16, &d) && d.offset == 0 && d.consumed == 1024 - 924 + 200,
+			"an allocation past the end wraps to 0 and is charged the skipped tail");
+		ring.release(c);
+		ring.release(d);
+		BenchReport::check(ring.getUsed() == 0, "releasing everything empties the ring");
+		BenchReport::check(ring.allocate(1024, 16, &a) && a.offset == 0, "an empty ring restarts at 0 and fits its whole capacity");
+	}
+
+	void checkQueue()
+	{
+		std::cout << "UploadQueue\n";
+		UploadQueue queue(4096);
+		std::vector<unsigned char> destination(16384, 0);
+		std::vector<unsigned char> data(16384);
+		for (size_t i = 0; i < data.size(); ++i) data[i] = static_cast<unsigned char>(i * 13);
+
+		std::vector<UploadToken> copied;
+		auto copy = [&](const UploadQueue::Upload& f_upload)
+		{
+			copied.push_back(f_upload.token);
+			std::copy(static_cast<const unsigned char*>(f_upload.data), static_cast<const unsigned char*>(f_upload.data) + f_upload.size,
+				static_cast<unsigned char*>(f_upload.destination) + f_upload.destination_offset);
+		};
+
+		BenchReport::check(queue.enqueue(destination.data(), 0, data.data(), 0) == invalid_upload_token, "an empty upload gets no token");
+		const UploadToken t1 = queue.enqueue(destination.data(), 0, data.data(), 1000);
+		const UploadToken t2 = queue.enqueue(destination.data(), 1000, data.data() + 1000, 1000);
+		const UploadToken t3 = queue.enqueue(destination.data(), 2000, data.data() + 2000, 1000);
+		BenchReport::check(t1 && t2 == t1 + 1 && t3 == t2 + 1, "tokens increase in submission order");
+		BenchReport::check(!queue.isComplete(t1), "nothing completes before process()");
+
+		BenchReport::check(queue.process(1500, copy) == 1 && queue.isComplete(t1) && !queue.isComplete(t2), "the budget cuts the batch");
+		BenchReport::check(queue.process(10, copy) == 1 && queue.isComplete(t2), "at least one upload goes through per process(), whatever the budget");
+		BenchReport::check(queue.process(0, copy) == 1 && queue.getCompletedToken() == t3, "a budget of 0 processes everything");
+		BenchReport::check(queue.process(0, copy) == 0, "an empty queue processes nothing");
+
+		// The ring holds 4096 bytes: the third upload and the one larger than the ring take the heap
+		const UploadToken t4 = queue.enqueue(destination.data(), 3000, data.data() + 3000, 2000);
+		queue.enqueue(destination.data(), 5000, data.data() + 5000, 2000);
+		queue.enqueue(destination.data(), 7000, data.data() + 7000, 2000);
+		const UploadToken t7 = queue.enqueue(destination.data(), 9000, data.data() + 9000, 7000);
+		const UploadQueue::Statistics full = queue.getStatistics();
+		BenchReport::check(full.overflow_count == 2 && full.pending_count == 4, "a full ring and an oversized upload overflow to the heap");
+		BenchReport::check(queue.process(0, copy) == 4 && queue.isComplete(t7) && queue.isComplete(t4), "overflowed uploads complete like the others");
+		BenchReport::check(queue.getStatistics().ring_used == 0, "the ring is empty once everything is processed");
+
+		BenchReport::check(std::is_sorted(copied.begin(), copied.end()) && copied.size() == 7, "the copy callback sees tokens in order");
+		BenchReport::check(std::equal(destination.begin(), destination.begin() + 16000, data.begin()), "every byte reached its destination");
+
+		// Wrap: steady uploads that do not divide the ring
+		bool wrapped_ok = true;
+		for (unsigned int i = 0; i < 100; ++i)
+		{
+			const size_t size = 700 + (i * 37) % 300;
+			const UploadToken token = queue.enqueue(destination.data(), 0, data.data() + i, size);
+			queue.enqueue(destination.data(), size, data.data() + i + size, 1200);
+			queue.process(0, copy);
+			wrapped_ok = wrapped_ok && queue.isComplete(token + 1) && std::equal(destination.begin(), destination.begin() + size + 1200, data.begin() + i);
+		}
+		BenchReport::check(wrapped_ok && queue.getStatistics().overflow_count == 2, "uploads wrapping around the ring stay intact without overflowing");
+	}
+
+	/// <summary>
+	/// Producers enqueue patterned uploads while the main thread processes them with a per-frame budget.
+	/// </summary>
+	void runProducers(unsigned int f_producers, unsigned int f_uploads, size_t f_upload_size, size_t f_ring_size, unsigned long long f_budget)
+	{
+		std::cout << f_producers << " producers, " << f_uploads << " uploads of " << f_upload_size << " bytes each, " <<
+			f_ring_size / 1024 << " KiB ring, " << f_budget / 1024 << " KiB per frame\n";
+
+		UploadQueue queue(f_ring_size);
+		std::vector<std::vector<unsigned char>> destinations(f_producers, std::vector<unsigned char>(f_uploads * f_upload_size, 0));
+		std::atomic<unsigned int> finished(0);
+
+		const auto start = std::chrono::steady_clock::now();
+		std::vector<std::thread> producers;
+		for (unsigned int producer = 0; producer < f_producers; ++producer)
+		{
+			producers.emplace_back([&, producer]()
+			{
+				std::vector<unsigned char> data(f_upload_size);
+				for (unsigned int upload = 0; upload < f_uploads; ++upload)
+				{
+					for (size_t i = 0; i < f_upload_size; ++i) data[i] = pattern(producer, upload, i);
+					queue.enqueue(destinations[producer].data(), static_cast<unsigned long long>(upload) * f_upload_size, data.data(), f_upload_size);
+				}
+				finished.fetch_add(1);
+			});
+		}
+
+		UploadToken last = invalid_upload_token;
+		bool ordered = true;
+		bool budget_kept = true;
+		unsigned int frames = 0;
+		auto copy = [&](const UploadQueue::Upload& f_upload)
+		{
+			ordered = ordered && f_upload.token > last;
+			last = f_upload.token;
+			std::copy(static_cast<const unsigned char*>(f_upload.data), static_cast<const unsigned char*>(f_upload.data) + f_upload.size,
+				static_cast<unsigned char*>(f_upload.destination) + f_upload.destination_offset);
+		};
+		const unsigned long long total = static_cast<unsigned long long>(f_producers) * f_uploads;
+		while (finished.load() < f_producers || queue.getCompletedToken() < total)
+		{
+			const size_t count = queue.process(f_budget, copy);
+			const UploadQueue::Statistics statistics = queue.getStatistics();
+			budget_kept = budget_kept && (count <= 1 || statistics.last_batch_bytes <= f_budget);
+			frames++;
+			if (!count) std::this_thread::yield();
+		}
+		for (std::thread& producer : producers) producer.join();
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		bool intact = true;
+		for (unsigned int producer = 0; producer < f_producers; ++producer)
+		{
+			for (unsigned int upload = 0; upload < f_uploads && intact; ++upload)
+			{
+				for (size_t i = 0; i < f_upload_size; ++i)
+				{
+					intact = intact && destinations[producer][upload * f_upload_size + i] == pattern(producer, upload, i);
+				}
+			}
+		}
+
+		const UploadQueue::Statistics statistics = queue.getStatistics();
+		BenchReport::check(ordered && last == total, "every token completed, in order");
+		BenchReport::check(budget_kept, "no batch of several uploads went over the budget");
+		BenchReport::check(intact, "every upload arrived intact");
+		BenchReport::check(statistics.ring_used == 0 && statistics.pending_count == 0, "the ring and the queue are empty at the end");
+		std::cout << "  " << frames << " process() calls, " << statistics.overflow_count << " overflows, " <<
+			static_cast<double>(statistics.uploaded_bytes) / (1024.0 * 1024.0) / (ms / 1000.0) << " MiB/s\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const unsigned int producers = argc > 1 ? std::max(1, std::atoi(argv[1])) : 4;
+	const unsigned int uploads = argc > 2 ? std::max(1, std::atoi(argv[2])) : 2000;
+
+	checkRing();
+	checkQueue();
+
+	// A ring smaller than what the producers have in flight forces overflows
+	runProducers(producers, uploads, 4096, 1024 * 1024, 256 * 1024);
+	runProducers(producers, uploads / 4, 65536, 128 * 1024, 64 * 1024);
+
+	return BenchReport::finish();
+}
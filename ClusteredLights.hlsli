@@ -0,0 +1,56 @@
+// Clustered point and spot lights, filled by LightClusterBuffer from a LightClusterGrid
+
+struct ClusterLight
+{
+    float3 position;
+    float range;
+    float3 direction;
+    float cos_outer; // -1 for point lights
+    float3 color;
+    float cos_inner;
+};
+
+cbuffer light_clusters : register(b1)
+{
+    uint3 m_cluster_grid;
+    uint m_cluster_logarithmic;
+    float2 m_cluster_tile_scale;
+    float m_cluster_depth_scale;
+    float m_cluster_depth_bias;
+};
+
+StructuredBuffer<ClusterLight> cluster_lights : register(t8);
+StructuredBuffer<uint2> light_clusters : register(t9); // Offset and count in light_indices
+StructuredBuffer<uint> light_indices : register(t10);
+
+// pixel is SV_POSITION.xy, view_depth the view space z of the shaded point
+uint getLightCluster(float2 pixel, float view_depth)
+{
+    uint2 tile = min(uint2(pixel * m_cluster_tile_scale), m_cluster_grid.xy - 1);
+    float depth = m_cluster_logarithmic ? log(max(view_depth, 1e-6f)) : view_depth;
+    uint slice = (uint)clamp(depth * m_cluster_depth_scale + m_cluster_depth_bias, 0.0f, (float)(m_cluster_grid.z - 1));
+    return (slice * m_cluster_grid.y + tile.y) * m_cluster_grid.x + tile.x;
+}
+
+// Diffuse light of the cluster's lights, positions and normal in world space
+float3 shadeClusterLights(float3 position, float3 normal, float2 pixel, float view_depth)
+{
+    uint2 cluster = light_clusters[getLightCluster(pixel, view_depth)];
+    float3 result = 0.0f;
+    for (uint i = 0; i < cluster.y; ++i)
+    {
+        ClusterLight light = cluster_lights[light_indices[cluster.x + i]];
+        float3 to_light = light.position - position;
+        float distance = length(to_light);
+        float3 direction = to_light / max(distance, 1e-4f);
+
+        float attenuation = saturate(1.0f - distance / light.range);
+        attenuation *= attenuation;
+        if (light.cos_outer > -1.0f)
+        {
+            attenuation *= smoothstep(light.cos_outer, max(light.cos_inner, light.cos_outer + 1e-4f), dot(-direction, light.direction));
+        }
+        result += light.color * saturate(dot(normal, direction)) * attenuation;
+    }
+    return result;
+}
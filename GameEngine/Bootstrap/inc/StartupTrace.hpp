@@ -0,0 +1,204 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Timeline of the engine startup
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Recording stops at the first frame, so scopes left in code that also
+//    runs later cost one atomic load and never grow the trace.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: See where the time to the first frame goes.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the StartupTrace class.
+/// @par Revision History:
+///      $Source: StartupTrace.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/23 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _STARTUP_TRACE_HPP_
+#define _STARTUP_TRACE_HPP_
+
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class StartupTrace
+ * @brief Records named spans from the start of the process up to the first presented frame.
+ *
+ * Times are relative to the first call of get(), so main() touches the trace
+ * before anything else. Spans may nest and come from any thread; each thread
+ * gets a small index in the order it first recorded something. Once
+ * markFirstFrame() is called the trace is closed and can be written as a
+ * Chrome trace (chrome://tracing, Perfetto) or summarized as text.
+ *
+ * Example usage:
+ * @code
+ * {
+ *     StartupTrace::Scope scope("GraphicsEngine::init");
+ *     GraphicsEngine::get()->init();
+ * }
+ * // ...
+ * if (StartupTrace::get()->markFirstFrame())
+ * {
+ *     StartupTrace::get()->writeChromeTrace("startup_trace.json");
+ * }
+ * @endcode
+ */
+class StartupTrace
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// A span, or an instant when begin_ns equals end_ns and instant is set.
+	/// </summary>
+	struct Event
+	{
+		std::string name;
+		long long begin_ns = 0;      // Since the origin of the trace
+		long long end_ns = -1;       // -1 while the span is open
+		unsigned int thread = 0;
+		bool instant = false;
+	};
+
+	/// <summary>
+	/// Records a span over its own lifetime.
+	/// </summary>
+	class Scope
+	{
+	public:
+		explicit Scope(const char* f_name) : m_event(StartupTrace::get()->begin(f_name)) {}
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+		~Scope() { StartupTrace::get()->end(m_event); }
+
+	private:
+		unsigned int m_event;
+	};
+
+	static constexpr unsigned int invalid_event = ~0u;
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	StartupTrace();
+	StartupTrace(const StartupTrace&) = delete;
+	StartupTrace& operator=(const StartupTrace&) = delete;
+	~StartupTrace();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Opens a span on the calling thread.
+	/// </summary>
+	/// <returns>The span to pass to end(), or invalid_event once the trace is closed.</returns>
+	unsigned int begin(const char* f_name);
+
+	/// <summary>
+	/// Closes a span returned by begin(); invalid_event is ignored.
+	/// </summary>
+	void end(unsigned int f_event);
+
+	/// <summary>
+	/// Records an instant, e.g. the window becoming visible.
+	/// </summary>
+	void mark(const char* f_name);
+
+	/// <summary>
+	/// Records the first frame and closes the trace; spans still open end here.
+	/// </summary>
+	/// <returns>True for the call that closed the trace, false afterwards.</returns>
+	bool markFirstFrame();
+
+	bool isClosed() const { return m_closed.load(std::memory_order_acquire); }
+
+	/// <summary>
+	/// Nanoseconds from the origin to markFirstFrame(), or -1 before it.
+	/// </summary>
+	long long getTimeToFirstFrameNanoseconds() const;
+
+	/// <summary>
+	/// Copy of the events in the order they were opened.
+	/// </summary>
+	std::vector<Event> getEvents() const;
+
+	/// <summary>
+	/// Writes the events in the Chrome trace event format.
+	/// </summary>
+	bool writeChromeTrace(const char* f_path) const;
+
+	/// <summary>
+	/// Prints the time to first frame and the spans, longest first.
+	/// </summary>
+	/// <param name="f_max_spans">Spans to print at most; 0 prints all.</param>
+	void printSummary(std::ostream& f_stream, size_t f_max_spans = 0) const;
+
+	/// <summary>
+	/// Drops the events and reopens the trace with the origin at the current time; no span may be open.
+	/// </summary>
+	void reset();
+
+	/// <summary>
+	/// Retrieves the trace of the process; the first call sets the origin.
+	/// </summary>
+	static StartupTrace* get();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	long long sinceOrigin() const;
+
+	/// <summary>
+	/// Small index of the calling thread, handed out on its first event.
+	/// </summary>
+	unsigned int getThreadIndex();
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	mutable std::mutex m_mutex;
+	std::vector<Event> m_events;
+	long long m_origin_ns;
+	long long m_first_frame_ns;
+	std::atomic<bool> m_closed;
+	std::atomic<unsigned int> m_thread_count;
+};
+
+#endif // !_STARTUP_TRACE_HPP_
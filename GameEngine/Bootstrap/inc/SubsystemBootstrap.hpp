@@ -0,0 +1,239 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Parallel initialization of dependent subsystems
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - run() blocks the calling thread until every subsystem is done; it runs
+//    the subsystems bound to the main thread itself in the meantime.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Start independent subsystems at the same time.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the SubsystemBootstrap class.
+/// @par Revision History:
+///      $Source: SubsystemBootstrap.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/23 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _SUBSYSTEM_BOOTSTRAP_HPP_
+#define _SUBSYSTEM_BOOTSTRAP_HPP_
+
+#include "JobSystem.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Thread a subsystem has to be initialized on.
+/// </summary>
+enum class SubsystemThread
+{
+	/// <summary>
+	/// Any job system worker, as soon as its dependencies are done.
+	/// </summary>
+	Any,
+
+	/// <summary>
+	/// The thread calling run(), for work tied to it such as the window or its swap chain.
+	/// </summary>
+	Main
+};
+
+/// <summary>
+/// Outcome of a subsystem after run().
+/// </summary>
+enum class SubsystemState
+{
+	Pending,
+	Succeeded,
+	Failed,
+
+	/// <summary>
+	/// Not initialized because a dependency failed or was skipped.
+	/// </summary>
+	Skipped
+};
+
+/**
+ * @class SubsystemBootstrap
+ * @brief Initializes subsystems in dependency order, running independent ones at the same time.
+ *
+ * Each subsystem is declared with the names of the subsystems it needs and an
+ * init function returning false on failure. run() starts every subsystem
+ * whose dependencies succeeded as a job, so compiling shaders can overlap
+ * creating buffers once the device exists. Subsystems bound to the main
+ * thread run on the caller of run() in between. When the job system has a
+ * single thread everything runs on the caller in declaration order.
+ *
+ * A failed subsystem skips everything depending on it, the others still run.
+ * Every init shows up as a span in the StartupTrace.
+ *
+ * Example usage:
+ * @code
+ * SubsystemBootstrap bootstrap;
+ * bootstrap.add("Device", {}, SubsystemThread::Any, [] { return GraphicsEngine::get()->init(); });
+ * bootstrap.add("SwapChain", { "Device" }, SubsystemThread::Main, [&] { return createSwapChain(); });
+ * bootstrap.add("Shaders", { "Device" }, SubsystemThread::Any, [&] { return compileShaders(); });
+ * if (!bootstrap.run())
+ * {
+ *     std::cout << "Startup failed at " << bootstrap.getFirstFailure() << std::endl;
+ * }
+ * @endcode
+ */
+class SubsystemBootstrap
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	using InitFunction = std::function<bool()>;
+
+	/// <summary>
+	/// Timing of the last run().
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int subsystems = 0;
+		unsigned int failed = 0;
+		unsigned int skipped = 0;
+		unsigned int max_concurrent = 0;      // Most init functions running at the same time
+		double wall_ms = 0.0;                 // run() from start to end
+		double serial_ms = 0.0;               // Sum of the init times, what running one after another costs
+		double critical_path_ms = 0.0;        // Longest chain of dependent init times, the lower bound of wall_ms
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	SubsystemBootstrap();
+	SubsystemBootstrap(const SubsystemBootstrap&) = delete;
+	SubsystemBootstrap& operator=(const SubsystemBootstrap&) = delete;
+	~SubsystemBootstrap();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Declares a subsystem; dependencies may be declared later, up to run().
+	/// </summary>
+	/// <returns>False if the name is empty or already taken.</returns>
+	bool add(const char* f_name, std::initializer_list<const char*> f_dependencies, SubsystemThread f_thread, InitFunction f_init);
+
+	/// <summary>
+	/// Initializes every subsystem and returns once all are done.
+	/// </summary>
+	/// <returns>
+	/// False if a subsystem failed or was skipped, or nothing ran because a dependency is unknown or circular.
+	/// </returns>
+	bool run();
+
+	SubsystemState getState(const char* f_name) const;
+
+	/// <summary>
+	/// Name of the first subsystem that failed, or with an unknown or circular dependency; nullptr if none.
+	/// </summary>
+	const char* getFirstFailure() const { return m_first_failure.empty() ? nullptr : m_first_failure.c_str(); }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Removes every subsystem so the bootstrap can be reused.
+	/// </summary>
+	void clear();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Subsystem
+	{
+		std::string name;
+		std::vector<std::string> dependency_names;
+		std::vector<unsigned int> dependencies;
+		std::vector<unsigned int> dependents;
+		SubsystemThread thread = SubsystemThread::Any;
+		InitFunction init;
+
+		// Dependencies not done yet; the one finishing the last starts the subsystem
+		std::atomic<unsigned int> remaining{ 0 };
+		SubsystemState state = SubsystemState::Pending;
+		long long begin_ns = 0;
+		long long end_ns = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Resolves the dependency names and checks for cycles; fills m_order topologically.
+	/// </summary>
+	bool resolve();
+
+	/// <summary>
+	/// Hands a subsystem whose dependencies are done to a worker or the main thread queue.
+	/// </summary>
+	void dispatch(unsigned int f_subsystem);
+
+	void execute(unsigned int f_subsystem);
+
+	void computeStatistics(long long f_begin_ns, long long f_end_ns);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<std::unique_ptr<Subsystem>> m_subsystems;
+	std::vector<unsigned int> m_order;
+	std::string m_first_failure;
+	Statistics m_statistics;
+
+	bool m_parallel;
+	JobCounter m_jobs;
+	std::atomic<unsigned int> m_running;
+	std::atomic<unsigned int> m_max_running;
+
+	// Subsystems for the main thread and the count of unfinished ones, guarded by m_mutex
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::deque<unsigned int> m_main_queue;
+	unsigned int m_outstanding;
+};
+
+#endif // !_SUBSYSTEM_BOOTSTRAP_HPP_
@@ -0,0 +1,291 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Timeline of the engine startup
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: See where the time to the first frame goes.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the StartupTrace class.
+/// @par Revision History:
+///      $Source: StartupTrace.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/23 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "StartupTrace.hpp"
+#include "Clock.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+
+namespace
+{
+	constexpr unsigned int unassigned_thread = ~0u;
+
+	thread_local unsigned int t_thread_index = unassigned_thread;
+
+	void writeJsonString(std::ostream& f_stream, const std::string& f_text)
+	{
+		f_stream << '"';
+		for (char character : f_text)
+		{
+			if (character == '"' || character == '\\')
+			{
+				f_stream << '\\' << character;
+			}
+			else if (static_cast<unsigned char>(character) < 0x20)
+			{
+				char escaped[8];
+				std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(character));
+				f_stream << escaped;
+			}
+			else
+			{
+				f_stream << character;
+			}
+		}
+		f_stream << '"';
+	}
+}
+
+StartupTrace::StartupTrace() : m_origin_ns(Clock::now()), m_first_frame_ns(-1), m_closed(false), m_thread_count(0)
+{
+	// The thread creating the trace is normally the main thread; give it index 0
+	getThreadIndex();
+}
+
+long long StartupTrace::sinceOrigin() const
+{
+	return Clock::now() - m_origin_ns;
+}
+
+unsigned int StartupTrace::getThreadIndex()
+{
+	if (t_thread_index == unassigned_thread)
+	{
+		t_thread_index = m_thread_count.fetch_add(1, std::memory_order_relaxed);
+	}
+	return t_thread_index;
+}
+
+unsigned int StartupTrace::begin(const char* f_name)
+{
+	if (m_closed.load(std::memory_order_acquire))
+	{
+		return invalid_event;
+	}
+
+	Event event;
+	event.name = f_name ? f_name : "";
+	event.thread = getThreadIndex();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_closed.load(std::memory_order_relaxed))
+	{
+		return invalid_event;
+	}
+	event.begin_ns = sinceOrigin();
+	m_events.push_back(std::move(event));
+	return static_cast<unsigned int>(m_events.size() - 1);
+}
+
+void StartupTrace::end(unsigned int f_event)
+{
+	if (f_event == invalid_event)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// Closing the trace already ended the spans left open
+	if (f_event < m_events.size() && m_events[f_event].end_ns < 0)
+	{
+		m_events[f_event].end_ns = sinceOrigin();
+	}
+}
+
+void StartupTrace::mark(const char* f_name)
+{
+	if (m_closed.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	Event event;
+	event.name = f_name ? f_name : "";
+	event.thread = getThreadIndex();
+	event.instant = true;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_closed.load(std::memory_order_relaxed))
+	{
+		event.begin_ns = sinceOrigin();
+		event.end_ns = event.begin_ns;
+		m_events.push_back(std::move(event));
+	}
+}
+
+bool StartupTrace::markFirstFrame()
+{
+	if (m_closed.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	const unsigned int thread = getThreadIndex();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_closed.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	m_first_frame_ns = sinceOrigin();
+	for (Event& event : m_events)
+	{
+		if (event.end_ns < 0)
+		{
+			event.end_ns = m_first_frame_ns;
+		}
+	}
+
+	Event event;
+	event.name = "First frame";
+	event.begin_ns = m_first_frame_ns;
+	event.end_ns = m_first_frame_ns;
+	event.thread = thread;
+	event.instant = true;
+	m_events.push_back(std::move(event));
+
+	m_closed.store(true, std::memory_order_release);
+	return true;
+}
+
+long long StartupTrace::getTimeToFirstFrameNanoseconds() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_first_frame_ns;
+}
+
+std::vector<StartupTrace::Event> StartupTrace::getEvents() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_events;
+}
+
+bool StartupTrace::writeChromeTrace(const char* f_path) const
+{
+	const std::vector<Event> events = getEvents();
+	const long long now_ns = sinceOrigin();
+
+	std::ofstream file(f_path, std::ios::binary | std::ios::trunc);
+	if (!file)
+	{
+		return false;
+	}
+
+	// Microseconds with three decimals keep the nanoseconds
+	file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	for (size_t i = 0; i < events.size(); ++i)
+	{
+		const Event& event = events[i];
+		file << (i ? ",\n" : "\n") << "{\"name\":";
+		writeJsonString(file, event.name);
+		file << ",\"pid\":1,\"tid\":" << event.thread << ",\"ts\":" << static_cast<double>(event.begin_ns) * 1e-3;
+		if (event.instant)
+		{
+			file << ",\"ph\":\"i\",\"s\":\"g\"}";
+		}
+		else
+		{
+			const long long end_ns = event.end_ns < 0 ? now_ns : event.end_ns;
+			file << ",\"ph\":\"X\",\"dur\":" << static_cast<double>(end_ns - event.begin_ns) * 1e-3 << "}";
+		}
+	}
+	file << "\n]}\n";
+	return static_cast<bool>(file.flush());
+}
+
+void StartupTrace::printSummary(std::ostream& f_stream, size_t f_max_spans) const
+{
+	std::vector<Event> events = getEvents();
+	const long long first_frame_ns = getTimeToFirstFrameNanoseconds();
+	const long long now_ns = sinceOrigin();
+
+	events.erase(std::remove_if(events.begin(), events.end(), [](const Event& f_event) { return f_event.instant; }), events.end());
+	for (Event& event : events)
+	{
+		if (event.end_ns < 0) event.end_ns = now_ns;
+	}
+	std::stable_sort(events.begin(), events.end(), [](const Event& f_a, const Event& f_b)
+	{
+		return f_a.end_ns - f_a.begin_ns > f_b.end_ns - f_b.begin_ns;
+	});
+	if (f_max_spans && events.size() > f_max_spans)
+	{
+		events.resize(f_max_spans);
+	}
+
+	const std::ios::fmtflags flags = f_stream.flags();
+	const std::streamsize precision = f_stream.precision();
+	f_stream << std::fixed << std::setprecision(3);
+	if (first_frame_ns >= 0)
+	{
+		f_stream << "Time to first frame: " << static_cast<double>(first_frame_ns) * 1e-6 << " ms\n";
+	}
+	f_stream << std::setw(12) << "start ms" << std::setw(12) << "ms" << std::setw(8) << "thread" << "  span\n";
+	for (const Event& event : events)
+	{
+		f_stream << std::setw(12) << static_cast<double>(event.begin_ns) * 1e-6 <<
+			std::setw(12) << static_cast<double>(event.end_ns - event.begin_ns) * 1e-6 <<
+			std::setw(8) << event.thread << "  " << event.name << '\n';
+	}
+	f_stream.flags(flags);
+	f_stream.precision(precision);
+}
+
+void StartupTrace::reset()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_events.clear();
+	m_origin_ns = Clock::now();
+	m_first_frame_ns = -1;
+	m_closed.store(false, std::memory_order_release);
+}
+
+StartupTrace* StartupTrace::get()
+{
+	static StartupTrace trace;
+	return &trace;
+}
+
+StartupTrace::~StartupTrace()
+{
+}
@@ -0,0 +1,327 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Parallel initialization of dependent subsystems
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Start independent subsystems at the same time.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the SubsystemBootstrap class.
+/// @par Revision History:
+///      $Source: SubsystemBootstrap.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/23 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "SubsystemBootstrap.hpp"
+#include "StartupTrace.hpp"
+#include "Clock.hpp"
+#include <algorithm>
+
+SubsystemBootstrap::SubsystemBootstrap() : m_parallel(false), m_running(0), m_max_running(0), m_outstanding(0)
+{
+}
+
+bool SubsystemBootstrap::add(const char* f_name, std::initializer_list<const char*> f_dependencies, SubsystemThread f_thread, InitFunction f_init)
+{
+	if (!f_name || !*f_name)
+	{
+		return false;
+	}
+	for (const std::unique_ptr<Subsystem>& subsystem : m_subsystems)
+	{
+		if (subsystem->name == f_name)
+		{
+			return false;
+		}
+	}
+
+	std::unique_ptr<Subsystem> subsystem(new Subsystem());
+	subsystem->name = f_name;
+	for (const char* dependency : f_dependencies)
+	{
+		subsystem->dependency_names.push_back(dependency ? dependency : "");
+	}
+	subsystem->thread = f_thread;
+	subsystem->init = std::move(f_init);
+	m_subsystems.push_back(std::move(subsystem));
+	return true;
+}
+
+bool SubsystemBootstrap::resolve()
+{
+	const unsigned int count = static_cast<unsigned int>(m_subsystems.size());
+	for (const std::unique_ptr<Subsystem>& subsystem : m_subsystems)
+	{
+		subsystem->dependencies.clear();
+		subsystem->dependents.clear();
+	}
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		Subsystem& subsystem = *m_subsystems[i];
+		for (const std::string& name : subsystem.dependency_names)
+		{
+			// A startup declares a handful of subsystems, a linear scan is enough
+			unsigned int dependency = 0;
+			while (dependency < count && m_subsystems[dependency]->name != name)
+			{
+				dependency++;
+			}
+			if (dependency == count)
+			{
+				m_first_failure = subsystem.name;
+				return false;
+			}
+			subsystem.dependencies.push_back(dependency);
+			m_subsystems[dependency]->dependents.push_back(i);
+		}
+	}
+
+	// Kahn's algorithm; whatever is left unordered sits on a cycle
+	std::vector<unsigned int> remaining(count);
+	m_order.clear();
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		remaining[i] = static_cast<unsigned int>(m_subsystems[i]->dependencies.size());
+		if (remaining[i] == 0)
+		{
+			m_order.push_back(i);
+		}
+	}
+	for (size_t next = 0; next < m_order.size(); ++next)
+	{
+		for (unsigned int dependent : m_subsystems[m_order[next]]->dependents)
+		{
+			if (--remaining[dependent] == 0)
+			{
+				m_order.push_back(dependent);
+			}
+		}
+	}
+	if (m_order.size() != count)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			if (remaining[i])
+			{
+				m_first_failure = m_subsystems[i]->name;
+				break;
+			}
+		}
+		return false;
+	}
+	return true;
+}
+
+bool SubsystemBootstrap::run()
+{
+	m_first_failure.clear();
+	m_statistics = Statistics();
+	m_statistics.subsystems = static_cast<unsigned int>(m_subsystems.size());
+	if (!resolve())
+	{
+		return false;
+	}
+
+	const long long begin_ns = Clock::now();
+	m_parallel = JobSystem::get()->getThreadCount() > 1;
+	m_running.store(0, std::memory_order_relaxed);
+	m_max_running.store(0, std::memory_order_relaxed);
+	for (const std::unique_ptr<Subsystem>& subsystem : m_subsystems)
+	{
+		subsystem->remaining.store(static_cast<unsigned int>(subsystem->dependencies.size()), std::memory_order_relaxed);
+		subsystem->state = SubsystemState::Pending;
+		subsystem->begin_ns = 0;
+		subsystem->end_ns = 0;
+	}
+
+	// Set before the first dispatch, the first job may finish right away
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_outstanding = static_cast<unsigned int>(m_subsystems.size());
+	}
+	for (unsigned int i = 0; i < m_subsystems.size(); ++i)
+	{
+		if (m_subsystems[i]->dependencies.empty())
+		{
+			dispatch(i);
+		}
+	}
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (m_outstanding)
+	{
+		if (m_main_queue.empty())
+		{
+			m_wake.wait(lock);
+			continue;
+		}
+
+		const unsigned int subsystem = m_main_queue.front();
+		m_main_queue.pop_front();
+		lock.unlock();
+		execute(subsystem);
+		lock.lock();
+	}
+	lock.unlock();
+
+	// The last job may still be returning from execute()
+	JobSystem::get()->wait(m_jobs);
+
+	computeStatistics(begin_ns, Clock::now());
+	return m_statistics.failed == 0 && m_statistics.skipped == 0;
+}
+
+void SubsystemBootstrap::dispatch(unsigned int f_subsystem)
+{
+	if (m_parallel && m_subsystems[f_subsystem]->thread == SubsystemThread::Any)
+	{
+		JobSystem::get()->run(m_jobs, [this, f_subsystem]() { execute(f_subsystem); });
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_main_queue.push_back(f_subsystem);
+	m_wake.notify_all();
+}
+
+void SubsystemBootstrap::execute(unsigned int f_subsystem)
+{
+	Subsystem& subsystem = *m_subsystems[f_subsystem];
+
+	bool ready = true;
+	for (unsigned int dependency : subsystem.dependencies)
+	{
+		ready = ready && m_subsystems[dependency]->state == SubsystemState::Succeeded;
+	}
+
+	if (ready)
+	{
+		const unsigned int running = m_running.fetch_add(1, std::memory_order_relaxed) + 1;
+		unsigned int max_running = m_max_running.load(std::memory_order_relaxed);
+		while (running > max_running && !m_max_running.compare_exchange_weak(max_running, running, std::memory_order_relaxed))
+		{
+		}
+
+		bool succeeded = true;
+		{
+			StartupTrace::Scope scope(subsystem.name.c_str());
+			subsystem.begin_ns = Clock::now();
+			if (subsystem.init)
+			{
+				succeeded = subsystem.init();
+			}
+			subsystem.end_ns = Clock::now();
+		}
+		m_running.fetch_sub(1, std::memory_order_relaxed);
+
+		subsystem.state = succeeded ? SubsystemState::Succeeded : SubsystemState::Failed;
+		if (!succeeded)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_first_failure.empty())
+			{
+				m_first_failure = subsystem.name;
+			}
+		}
+	}
+	else
+	{
+		subsystem.state = SubsystemState::Skipped;
+	}
+
+	// The decrement publishes the state above to whoever starts the dependent
+	for (unsigned int dependent : subsystem.dependents)
+	{
+		if (m_subsystems[dependent]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			dispatch(dependent);
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_outstanding--;
+	m_wake.notify_all();
+}
+
+void SubsystemBootstrap::computeStatistics(long long f_begin_ns, long long f_end_ns)
+{
+	// Finish time of the longest chain ending at each subsystem, in topological order
+	std::vector<long long> chain_ns(m_subsystems.size(), 0);
+	long long serial_ns = 0;
+	long long critical_ns = 0;
+	for (unsigned int index : m_order)
+	{
+		const Subsystem& subsystem = *m_subsystems[index];
+		switch (subsystem.state)
+		{
+		case SubsystemState::Failed: m_statistics.failed++; break;
+		case SubsystemState::Skipped: m_statistics.skipped++; break;
+		default: break;
+		}
+
+		const long long duration_ns = subsystem.end_ns - subsystem.begin_ns;
+		long long longest_dependency_ns = 0;
+		for (unsigned int dependency : subsystem.dependencies)
+		{
+			longest_dependency_ns = std::max(longest_dependency_ns, chain_ns[dependency]);
+		}
+		chain_ns[index] = longest_dependency_ns + duration_ns;
+		serial_ns += duration_ns;
+		critical_ns = std::max(critical_ns, chain_ns[index]);
+	}
+
+	m_statistics.max_concurrent = m_max_running.load(std::memory_order_relaxed);
+	m_statistics.wall_ms = static_cast<double>(f_end_ns - f_begin_ns) * 1e-6;
+	m_statistics.serial_ms = static_cast<double>(serial_ns) * 1e-6;
+	m_statistics.critical_path_ms = static_cast<double>(critical_ns) * 1e-6;
+}
+
+SubsystemState SubsystemBootstrap::getState(const char* f_name) const
+{
+	for (const std::unique_ptr<Subsystem>& subsystem : m_subsystems)
+	{
+		if (f_name && subsystem->name == f_name)
+		{
+			return subsystem->state;
+		}
+	}
+	return SubsystemState::Pending;
+}
+
+void SubsystemBootstrap::clear()
+{
+	m_subsystems.clear();
+	m_order.clear();
+	m_first_failure.clear();
+	m_statistics = Statistics();
+}
+
+SubsystemBootstrap::~SubsystemBootstrap()
+{
+}
@@ -0,0 +1,132 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Monotonic engine clock
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure frame time with nanosecond resolution.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the Clock class.
+/// @par Revision History:
+///      $Source: Clock.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _CLOCK_HPP_
+#define _CLOCK_HPP_
+
+/**
+ * @class Clock
+ * @brief Measures the time between frames on the monotonic high resolution clock of the OS.
+ *
+ * now() reads QueryPerformanceCounter on Windows and CLOCK_MONOTONIC on Linux,
+ * in nanoseconds, so it does not jump with the wall clock and resolves far
+ * below a frame. tick() is called once per frame and returns the time since
+ * the previous tick in seconds, scaled by the time scale and clamped so a
+ * breakpoint or a stalled frame does not arrive as one huge step.
+ *
+ * Example usage:
+ * @code
+ * Clock clock;
+ * while (running)
+ * {
+ *     const double delta = clock.tick();
+ *     update(delta);
+ * }
+ * @endcode
+ */
+class Clock
+{
+public:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	Clock();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Advances the clock to now.
+	/// </summary>
+	/// <returns>The scaled seconds since the previous tick, 0 for the first tick and while paused.</returns>
+	double tick();
+
+	/// <summary>
+	/// Forgets the previous tick, so the next one returns 0; the elapsed time is kept.
+	/// </summary>
+	void reset();
+
+	double getDeltaSeconds() const { return m_delta_seconds; }
+
+	/// <summary>
+	/// Sum of the scaled deltas, kept in nanoseconds so it does not lose precision over long sessions.
+	/// </summary>
+	double getElapsedSeconds() const { return static_cast<double>(m_elapsed_ns) * 1e-9; }
+
+	long long getElapsedNanoseconds() const { return m_elapsed_ns; }
+
+	/// <summary>
+	/// Multiplies every delta, e.g. 0.25 for slow motion.
+	/// </summary>
+	void setTimeScale(double f_scale) { m_time_scale = f_scale > 0.0 ? f_scale : 0.0; }
+
+	double getTimeScale() const { return m_time_scale; }
+
+	/// <summary>
+	/// Largest unscaled delta tick() returns; 0 disables the clamp.
+	/// </summary>
+	void setMaxDelta(double f_seconds) { m_max_delta_ns = f_seconds > 0.0 ? static_cast<long long>(f_seconds * 1e9) : 0; }
+
+	void setPaused(bool f_paused) { m_paused = f_paused; }
+
+	bool isPaused() const { return m_paused; }
+
+	/// <summary>
+	/// Monotonic time in nanoseconds since an unspecified point.
+	/// </summary>
+	static long long now();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	long long m_last_tick;           // 0 until the first tick
+	long long m_elapsed_ns;
+	long long m_max_delta_ns;
+	double m_delta_seconds;
+	double m_time_scale;
+	bool m_paused;
+};
+
+#endif // !_CLOCK_HPP_
@@ -0,0 +1,174 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Fixed timestep simulation with render interpolation
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Rendering blends the last two steps, so what is drawn trails the
+//    simulation by up to one step; that is the price of smooth motion.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Decouple the simulation rate from the frame rate.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the FixedTimestep class and the Interpolated template.
+/// @par Revision History:
+///      $Source: FixedTimestep.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _FIXED_TIMESTEP_HPP_
+#define _FIXED_TIMESTEP_HPP_
+
+struct FixedTimestepSettings
+{
+	double step_seconds = 1.0 / 60.0;
+
+	// Catch-up limit per frame. When the simulation cannot keep up, running more steps makes the
+	// next frame slower still; the time above the limit is dropped and the game slows down instead
+	unsigned int max_steps = 8;
+};
+
+/**
+ * @class FixedTimestep
+ * @brief Runs the simulation in steps of a fixed length, however long the frames are.
+ *
+ * The frame time is added to an accumulator and advance() returns how many
+ * whole steps fit into it; the remainder carries over to the next frame. Every
+ * step therefore sees the same delta, which keeps the simulation stable and
+ * independent of the frame rate. The part of a step left in the accumulator is
+ * getAlpha(): rendering blends the state before and after the last step with
+ * it (see Interpolated), so motion stays smooth when the frame rate and the
+ * step rate differ.
+ *
+ * Example usage:
+ * @code
+ * for (unsigned int steps = timestep.advance(clock.tick()); steps; --steps)
+ * {
+ *     position.store();
+ *     position.current += velocity * timestep.getStepSeconds();
+ * }
+ * draw(position.get(timestep.getAlpha()));
+ * @endcode
+ */
+class FixedTimestep
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since the last resetStatistics().
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long frames = 0;
+		unsigned long long steps = 0;
+		unsigned long long capped_frames = 0;      // Frames that hit max_steps
+		unsigned int max_steps_in_frame = 0;
+		double dropped_ms = 0.0;                   // Simulation time given up by the catch-up limit
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	FixedTimestep();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Applies new settings and empties the accumulator.
+	/// </summary>
+	void setSettings(const FixedTimestepSettings& f_settings);
+
+	const FixedTimestepSettings& getSettings() const { return m_settings; }
+
+	double getStepSeconds() const { return m_settings.step_seconds; }
+
+	/// <summary>
+	/// Adds the frame time to the accumulator.
+	/// </summary>
+	/// <returns>The number of steps to simulate this frame, at most max_steps.</returns>
+	unsigned int advance(double f_frame_seconds);
+
+	/// <summary>
+	/// How far the render time is past the last step, in steps: 0 to 1.
+	/// </summary>
+	float getAlpha() const { return m_alpha; }
+
+	/// <summary>
+	/// Empties the accumulator, e.g. after loading, so the stalled time is not simulated.
+	/// </summary>
+	void reset();
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	void resetStatistics() { m_statistics = Statistics(); }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	FixedTimestepSettings m_settings;
+	long long m_step_ns;
+	long long m_accumulator_ns;      // Not simulated yet; whole nanoseconds so max_steps steps fit exactly
+	float m_alpha;
+	Statistics m_statistics;
+};
+
+/**
+ * @brief A simulated value as it was before and after the last step.
+ *
+ * store() is called at the start of every step, before the step changes
+ * current; get() blends the two with the alpha of the FixedTimestep. T needs
+ * T + T, T - T and T * float.
+ */
+template<typename T>
+struct Interpolated
+{
+	T previous = T();
+	T current = T();
+
+	/// <summary>
+	/// Remembers the current value as the start of the next step.
+	/// </summary>
+	void store() { previous = current; }
+
+	/// <summary>
+	/// Sets both values, so a teleport is not interpolated.
+	/// </summary>
+	void set(const T& f_value) { previous = f_value; current = f_value; }
+
+	T get(float f_alpha) const { return previous + (current - previous) * f_alpha; }
+};
+
+#endif // !_FIXED_TIMESTEP_HPP_
@@ -0,0 +1,98 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Monotonic engine clock
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure frame time with nanosecond resolution.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the Clock class.
+/// @par Revision History:
+///      $Source: Clock.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "Clock.hpp"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+Clock::Clock() : m_last_tick(0), m_elapsed_ns(0), m_max_delta_ns(250000000), m_delta_seconds(0.0), m_time_scale(1.0), m_paused(false)
+{
+}
+
+double Clock::tick()
+{
+	const long long time = now();
+	long long delta = m_last_tick ? time - m_last_tick : 0;
+	m_last_tick = time;
+
+	if (m_max_delta_ns && delta > m_max_delta_ns)
+	{
+		delta = m_max_delta_ns;
+	}
+	if (m_paused)
+	{
+		delta = 0;
+	}
+
+	const long long scaled = m_time_scale == 1.0 ? delta : static_cast<long long>(static_cast<double>(delta) * m_time_scale);
+	m_elapsed_ns += scaled;
+	m_delta_seconds = static_cast<double>(scaled) * 1e-9;
+	return m_delta_seconds;
+}
+
+void Clock::reset()
+{
+	m_last_tick = 0;
+	m_delta_seconds = 0.0;
+}
+
+long long Clock::now()
+{
+#if defined(_WIN32)
+	static const long long frequency = []()
+	{
+		LARGE_INTEGER value;
+		::QueryPerformanceFrequency(&value);
+		return static_cast<long long>(value.QuadPart);
+	}();
+	LARGE_INTEGER counter;
+	::QueryPerformanceCounter(&counter);
+	// Split so the multiplication does not overflow after a few minutes of uptime
+	const long long ticks = counter.QuadPart;
+	return ticks / frequency * 1000000000ll + ticks % frequency * 1000000000ll / frequency;
+#else
+	timespec time;
+	::clock_gettime(CLOCK_MONOTONIC, &time);
+	return static_cast<long long>(time.tv_sec) * 1000000000ll + time.tv_nsec;
+#endif
+}
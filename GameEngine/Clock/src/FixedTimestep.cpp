@@ -0,0 +1,88 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Fixed timestep simulation with render interpolation
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Decouple the simulation rate from the frame rate.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the FixedTimestep class.
+/// @par Revision History:
+///      $Source: FixedTimestep.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "FixedTimestep.hpp"
+#include <algorithm>
+#include <cmath>
+
+FixedTimestep::FixedTimestep() : m_step_ns(0), m_accumulator_ns(0), m_alpha(0.0f)
+{
+	setSettings(FixedTimestepSettings());
+}
+
+void FixedTimestep::setSettings(const FixedTimestepSettings& f_settings)
+{
+	m_settings = f_settings;
+	if (!(m_settings.step_seconds > 0.0)) m_settings.step_seconds = FixedTimestepSettings().step_seconds;
+	if (m_settings.max_steps == 0) m_settings.max_steps = 1;
+	m_step_ns = std::max(1ll, std::llround(m_settings.step_seconds * 1e9));
+	reset();
+}
+
+unsigned int FixedTimestep::advance(double f_frame_seconds)
+{
+	m_statistics.frames++;
+	if (f_frame_seconds > 0.0)
+	{
+		m_accumulator_ns += std::llround(f_frame_seconds * 1e9);
+	}
+
+	// Spiral of death guard: never owe more than max_steps, whatever the frame took
+	const long long limit = m_step_ns * m_settings.max_steps;
+	if (m_accumulator_ns > limit)
+	{
+		m_statistics.capped_frames++;
+		m_statistics.dropped_ms += static_cast<double>(m_accumulator_ns - limit) * 1e-6;
+		m_accumulator_ns = limit;
+	}
+
+	const unsigned int steps = static_cast<unsigned int>(m_accumulator_ns / m_step_ns);
+	m_accumulator_ns -= steps * m_step_ns;
+
+	m_alpha = static_cast<float>(static_cast<double>(m_accumulator_ns) / static_cast<double>(m_step_ns));
+	m_statistics.steps += steps;
+	m_statistics.max_steps_in_frame = std::max(m_statistics.max_steps_in_frame, steps);
+	return steps;
+}
+
+void FixedTimestep::reset()
+{
+	m_accumulator_ns = 0;
+	m_alpha = 0.0f;
+}
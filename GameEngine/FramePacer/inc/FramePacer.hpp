@@ -0,0 +1,218 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: High-resolution frame limiter
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Deadlines advance by whole periods from the previous deadline, so a
+//    late frame does not push every later frame back.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Pace frames to a target rate without burning a core.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the FramePacer class.
+/// @par Revision History:
+///      $Source: FramePacer.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/08 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _FRAME_PACER_HPP_
+#define _FRAME_PACER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// How FramePacer::wait() waits for the deadline.
+/// </summary>
+enum class FramePacerMode
+{
+	/// <summary>
+	/// Sleep until shortly before the deadline, spin the rest.
+	/// </summary>
+	Hybrid,
+
+	/// <summary>
+	/// Sleep only: no CPU cost, accuracy of the OS timer.
+	/// </summary>
+	Sleep,
+
+	/// <summary>
+	/// Spin only: most accurate, one core busy.
+	/// </summary>
+	Spin
+};
+
+struct FramePacerSettings
+{
+	double target_fps = 60.0;           // 0 disables the limit
+	FramePacerMode mode = FramePacerMode::Hybrid;
+
+	// Time spun before each deadline in Hybrid mode; with adaptive_margin it is only the
+	// starting value and follows how late the sleeps of this machine wake up
+	double spin_margin_us = 1000.0;
+	bool adaptive_margin = true;
+};
+
+/**
+ * @class FramePacer
+ * @brief Holds frames to a target rate with a sleep-then-spin wait on a monotonic clock.
+ *
+ * wait() is called once per frame, after the frame is submitted. It sleeps on
+ * the high resolution timer of the OS (clock_nanosleep on Linux, a high
+ * resolution waitable timer on Windows) until a margin before the deadline
+ * and spins the rest, so frames start within microseconds of the deadline
+ * while the thread sleeps for most of the idle time. The margin adapts to
+ * how late sleeps actually wake up.
+ *
+ * The statistics measure the pacing: the intervals between frame starts and
+ * their jitter, how late each wait returned and how the waits split between
+ * sleeping and spinning.
+ *
+ * Example usage:
+ * @code
+ * FramePacer pacer;
+ * FramePacerSettings settings;
+ * settings.target_fps = 120.0;
+ * pacer.setSettings(settings);
+ * while (running)
+ * {
+ *     renderFrame();
+ *     pacer.wait();
+ * }
+ * @endcode
+ */
+class FramePacer
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since the last resetStatistics(); times in milliseconds unless named otherwise.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long frames = 0;         // Intervals measured
+		double mean_interval_ms = 0.0;
+		double interval_stddev_ms = 0.0;       // The jitter
+		double min_interval_ms = 0.0;
+		double max_interval_ms = 0.0;
+		double mean_lateness_us = 0.0;         // How long after the deadline wait() returned
+		double max_lateness_us = 0.0;
+		unsigned long long missed_deadlines = 0;   // Frames that were already late when wait() was called
+		double sleep_ms = 0.0;                 // Total time asleep
+		double spin_ms = 0.0;                  // Total time spinning
+		double spin_margin_us = 0.0;           // Current margin
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	FramePacer();
+	FramePacer(const FramePacer&) = delete;
+	FramePacer& operator=(const FramePacer&) = delete;
+	~FramePacer();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Applies new settings; the next wait() starts a new deadline sequence.
+	/// </summary>
+	void setSettings(const FramePacerSettings& f_settings);
+
+	const FramePacerSettings& getSettings() const { return m_settings; }
+
+	bool isLimited() const { return m_period_ns > 0; }
+
+	/// <summary>
+	/// Waits until the next frame is due. Returns at once when the frame is late or the rate is unlimited.
+	/// </summary>
+	void wait();
+
+	/// <summary>
+	/// Forgets the deadline, e.g. after a pause, so the next frames are not rushed to catch up.
+	/// </summary>
+	void reset();
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Interval between frame starts at the percentile, over the last 1024 frames.
+	/// </summary>
+	/// <param name="f_percentile">0 to 100.</param>
+	double getIntervalPercentile(double f_percentile) const;
+
+	void resetStatistics();
+
+	/// <summary>
+	/// Monotonic time in nanoseconds, the clock the deadlines are on (Clock::now()).
+	/// </summary>
+	static long long now();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Sleeps until about f_deadline; may wake up late, never knowingly early.
+	/// </summary>
+	void sleepUntil(long long f_deadline);
+
+	/// <summary>
+	/// Adds the interval that ended at f_frame_start to the statistics.
+	/// </summary>
+	void recordInterval(long long f_frame_start);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	FramePacerSettings m_settings;
+	long long m_period_ns;
+	long long m_deadline;            // 0 until the first wait()
+	long long m_last_frame_start;
+	double m_margin_ns;
+	double m_oversleep_mean_ns;      // Running estimates of how late sleeps wake up
+	double m_oversleep_deviation_ns;
+
+	Statistics m_statistics;
+	double m_interval_m2;            // Welford sum of squared deviations
+	double m_lateness_sum_us;
+	std::vector<float> m_recent_intervals;
+	size_t m_recent_next;
+
+	void* m_timer;                   // Windows waitable timer, unused elsewhere
+};
+
+#endif // !_FRAME_PACER_HPP_
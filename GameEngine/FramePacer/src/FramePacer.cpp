@@ -0,0 +1,261 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: High-resolution frame limiter
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Pace frames to a target rate without burning a core.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the FramePacer class.
+/// @par Revision History:
+///      $Source: FramePacer.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/08 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "FramePacer.hpp"
+#include "Clock.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#else
+#include <cerrno>
+#include <time.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FRAME_PACER_SSE2 1
+#endif
+
+namespace
+{
+	constexpr size_t recent_interval_count = 1024;
+	constexpr double min_margin_ns = 50000.0;
+	constexpr double margin_smoothing = 0.1;
+
+	void spinPause()
+	{
+#if FRAME_PACER_SSE2
+		_mm_pause();
+#else
+		std::this_thread::yield();
+#endif
+	}
+}
+
+FramePacer::FramePacer()
+	: m_period_ns(0), m_deadline(0), m_last_frame_start(0), m_margin_ns(0.0), m_oversleep_mean_ns(0.0), m_oversleep_deviation_ns(0.0),
+	m_interval_m2(0.0), m_lateness_sum_us(0.0), m_recent_next(0), m_timer(nullptr)
+{
+#if defined(_WIN32)
+	// Waits with 0.5 ms resolution instead of the 15.6 ms scheduler tick (Windows 10 1803 and later)
+	m_timer = ::CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+	m_recent_intervals.reserve(recent_interval_count);
+	setSettings(FramePacerSettings());
+	resetStatistics();
+}
+
+void FramePacer::setSettings(const FramePacerSettings& f_settings)
+{
+	m_settings = f_settings;
+	m_period_ns = f_settings.target_fps > 0.0 ? static_cast<long long>(1e9 / f_settings.target_fps) : 0;
+	m_margin_ns = std::max(min_margin_ns, f_settings.spin_margin_us * 1000.0);
+	m_oversleep_mean_ns = 0.0;
+	m_oversleep_deviation_ns = 0.0;
+	m_statistics.spin_margin_us = m_margin_ns / 1000.0;
+	reset();
+}
+
+void FramePacer::reset()
+{
+	m_deadline = 0;
+	m_last_frame_start = 0;
+}
+
+long long FramePacer::now()
+{
+	return Clock::now();
+}
+
+void FramePacer::sleepUntil(long long f_deadline)
+{
+#if defined(_WIN32)
+	const long long remaining = f_deadline - now();
+	if (remaining <= 0)
+	{
+		return;
+	}
+	if (m_timer)
+	{
+		LARGE_INTEGER due;
+		due.QuadPart = -(remaining / 100);   // Relative, in 100 ns units
+		if (::SetWaitableTimer(m_timer, &due, 0, NULL, NULL, FALSE))
+		{
+			::WaitForSingleObject(m_timer, INFINITE);
+			return;
+		}
+	}
+	::Sleep(static_cast<DWORD>(remaining / 1000000));
+#else
+	timespec time;
+	time.tv_sec = static_cast<time_t>(f_deadline / 1000000000ll);
+	time.tv_nsec = static_cast<long>(f_deadline % 1000000000ll);
+	while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR)
+	{
+	}
+#endif
+}
+
+void FramePacer::wait()
+{
+	const long long start = now();
+	if (m_period_ns == 0)
+	{
+		recordInterval(start);
+		return;
+	}
+
+	m_deadline = m_deadline ? m_deadline + m_period_ns : start + m_period_ns;
+	if (start >= m_deadline)
+	{
+		m_statistics.missed_deadlines++;
+		// More than a frame behind: start over instead of rushing the next frames
+		if (start - m_deadline > m_period_ns)
+		{
+			m_deadline = start;
+		}
+		recordInterval(start);
+		return;
+	}
+
+	long long time = start;
+	if (m_settings.mode != FramePacerMode::Spin)
+	{
+		const long long sleep_target = m_settings.mode == FramePacerMode::Sleep ? m_deadline : m_deadline - static_cast<long long>(m_margin_ns);
+		if (sleep_target > time)
+		{
+			sleepUntil(sleep_target);
+			const long long woke = now();
+			m_statistics.sleep_ms += (woke - time) / 1e6;
+
+			if (m_settings.mode == FramePacerMode::Hybrid && m_settings.adaptive_margin)
+			{
+				// Keep the margin a few deviations above the typical oversleep
+				const double oversleep = static_cast<double>(std::max(0ll, woke - sleep_target));
+				m_oversleep_mean_ns += margin_smoothing * (oversleep - m_oversleep_mean_ns);
+				m_oversleep_deviation_ns += margin_smoothing * (std::fabs(oversleep - m_oversleep_mean_ns) - m_oversleep_deviation_ns);
+				m_margin_ns = std::min(static_cast<double>(m_period_ns),
+					std::max(min_margin_ns, m_oversleep_mean_ns + 4.0 * m_oversleep_deviation_ns + min_margin_ns));
+				m_statistics.spin_margin_us = m_margin_ns / 1000.0;
+			}
+			time = woke;
+		}
+	}
+
+	const long long spin_start = time;
+	while (time < m_deadline)
+	{
+		spinPause();
+		time = now();
+	}
+	m_statistics.spin_ms += (time - spin_start) / 1e6;
+
+	const double lateness_us = (time - m_deadline) / 1000.0;
+	m_lateness_sum_us += lateness_us;
+	m_statistics.max_lateness_us = std::max(m_statistics.max_lateness_us, lateness_us);
+	recordInterval(time);
+	const unsigned long long waited = m_statistics.frames - m_statistics.missed_deadlines;
+	m_statistics.mean_lateness_us = waited ? m_lateness_sum_us / waited : 0.0;
+}
+
+void FramePacer::recordInterval(long long f_frame_start)
+{
+	const long long previous = m_last_frame_start;
+	m_last_frame_start = f_frame_start;
+	if (!previous)
+	{
+		return;
+	}
+
+	const double interval = (f_frame_start - previous) / 1e6;
+	Statistics& statistics = m_statistics;
+	statistics.frames++;
+	const double delta = interval - statistics.mean_interval_ms;
+	statistics.mean_interval_ms += delta / statistics.frames;
+	m_interval_m2 += delta * (interval - statistics.mean_interval_ms);
+	statistics.interval_stddev_ms = statistics.frames > 1 ? std::sqrt(m_interval_m2 / (statistics.frames - 1)) : 0.0;
+	statistics.min_interval_ms = statistics.frames == 1 ? interval : std::min(statistics.min_interval_ms, interval);
+	statistics.max_interval_ms = std::max(statistics.max_interval_ms, interval);
+
+	if (m_recent_intervals.size() < recent_interval_count)
+	{
+		m_recent_intervals.push_back(static_cast<float>(interval));
+	}
+	else
+	{
+		m_recent_intervals[m_recent_next] = static_cast<float>(interval);
+		m_recent_next = (m_recent_next + 1) % recent_interval_count;
+	}
+}
+
+double FramePacer::getIntervalPercentile(double f_percentile) const
+{
+	if (m_recent_intervals.empty())
+	{
+		return 0.0;
+	}
+	std::vector<float> sorted = m_recent_intervals;
+	const size_t rank = static_cast<size_t>(std::clamp(f_percentile, 0.0, 100.0) / 100.0 * (sorted.size() - 1) + 0.5);
+	std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+	return sorted[rank];
+}
+
+void FramePacer::resetStatistics()
+{
+	const double margin_us = m_margin_ns / 1000.0;
+	m_statistics = Statistics();
+	m_statistics.spin_margin_us = margin_us;
+	m_interval_m2 = 0.0;
+	m_lateness_sum_us = 0.0;
+	m_recent_intervals.clear();
+	m_recent_next = 0;
+}
+
+FramePacer::~FramePacer()
+{
+#if defined(_WIN32)
+	if (m_timer) ::CloseHandle(m_timer);
+#endif
+}
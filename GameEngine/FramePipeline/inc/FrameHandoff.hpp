@@ -0,0 +1,216 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Bounded handoff of frame packets between two threads
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Overlap the simulation of a frame with the rendering of the previous one.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the FrameHandoff class.
+/// @par Revision History:
+///      $Source: FrameHandoff.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/14 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _FRAME_HANDOFF_HPP_
+#define _FRAME_HANDOFF_HPP_
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+/// <summary>
+/// Which submitted frame the consumer gets next.
+/// </summary>
+enum class FrameHandoffMode
+{
+	/// <summary>
+	/// Every frame, in order. The producer waits when all slots are taken, so it runs at most
+	/// slot count - 1 frames ahead of the consumer.
+	/// </summary>
+	Queue,
+
+	/// <summary>
+	/// The newest frame. The producer never waits; frames replaced before the consumer got to
+	/// them are dropped.
+	/// </summary>
+	Latest
+};
+
+/**
+ * @class FrameHandoff
+ * @brief Hands slots of a fixed ring of frame packets from one producer thread to one consumer thread.
+ *
+ * The handoff only tracks which slot is where, the packets themselves live in
+ * the caller's array. A slot is free, being written by the producer, ready or
+ * being read by the consumer. With two slots the producer fills frame N+1
+ * while the consumer reads frame N (double buffering); a third slot lets one
+ * finished frame wait, absorbing jitter at the cost of a frame of latency.
+ *
+ * Exactly one thread may call acquireWrite()/publish() and one other thread
+ * acquireRead()/release(). The latency in the statistics runs from publish()
+ * to release(), i.e. until the consumer is done with the frame.
+ *
+ * Example usage:
+ * @code
+ * // Producer                           // Consumer
+ * unsigned int slot;                   unsigned int slot;
+ * while (handoff.acquireWrite(slot))   while (handoff.acquireRead(slot))
+ * {                                    {
+ *     fill(packets[slot]);                 render(packets[slot]);
+ *     handoff.publish();                   handoff.release();
+ * }                                    }
+ * @endcode
+ */
+class FrameHandoff
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since init() or resetStatistics(); times in milliseconds.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long submitted_frames = 0;
+		unsigned long long consumed_frames = 0;
+		unsigned long long dropped_frames = 0;     // Latest mode only
+		double producer_wait_ms = 0.0;             // Producer blocked in acquireWrite()
+		double consumer_wait_ms = 0.0;             // Consumer idle in acquireRead()
+		double mean_latency_ms = 0.0;              // publish() to release()
+		double max_latency_ms = 0.0;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	FrameHandoff();
+	FrameHandoff(const FrameHandoff&) = delete;
+	FrameHandoff& operator=(const FrameHandoff&) = delete;
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Frees every slot and opens the handoff; neither thread may be inside it.
+	/// </summary>
+	/// <param name="f_slot_count">At least 2.</param>
+	bool init(unsigned int f_slot_count, FrameHandoffMode f_mode);
+
+	/// <summary>
+	/// Producer: takes a slot to fill, waiting in Queue mode while the consumer is behind.
+	/// </summary>
+	/// <returns>false once the handoff is closed.</returns>
+	bool acquireWrite(unsigned int& f_slot);
+
+	/// <summary>
+	/// Producer: hands the slot taken by acquireWrite() to the consumer.
+	/// </summary>
+	void publish();
+
+	/// <summary>
+	/// Consumer: takes the next ready slot, waiting while there is none.
+	/// </summary>
+	/// <returns>false once the handoff is closed and every published frame was consumed.</returns>
+	bool acquireRead(unsigned int& f_slot);
+
+	/// <summary>
+	/// Consumer: gives the slot taken by acquireRead() back to the producer.
+	/// </summary>
+	void release();
+
+	/// <summary>
+	/// Wakes both threads; the producer gets no more slots, the consumer drains the ready ones.
+	/// </summary>
+	void close();
+
+	unsigned int getSlotCount() const { return static_cast<unsigned int>(m_slots.size()); }
+
+	Statistics getStatistics() const;
+
+	void resetStatistics();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	enum class SlotState : unsigned char
+	{
+		Free,
+		Writing,
+		Ready,
+		Reading
+	};
+
+	struct Slot
+	{
+		SlotState state = SlotState::Free;
+		unsigned long long sequence = 0;   // Publish order
+		long long published = 0;           // Clock::now() at publish()
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// First slot in the state, or the slot count when there is none.
+	/// </summary>
+	unsigned int findSlot(SlotState f_state) const;
+
+	/// <summary>
+	/// The ready slot published first, or the slot count when there is none.
+	/// </summary>
+	unsigned int findOldestReady() const;
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_producer_condition;
+	std::condition_variable m_consumer_condition;
+	std::vector<Slot> m_slots;
+	FrameHandoffMode m_mode;
+	unsigned int m_write_slot;
+	unsigned int m_read_slot;
+	unsigned long long m_next_sequence;
+	bool m_closed;
+
+	Statistics m_statistics;
+	double m_latency_sum_ms;
+};
+
+#endif // !_FRAME_HANDOFF_HPP_
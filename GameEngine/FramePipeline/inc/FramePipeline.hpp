@@ -0,0 +1,226 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Render thread fed with frame packets
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Packets are reused, so containers inside them keep their memory from
+//    frame to frame; beginFrame() returns a packet still holding an older
+//    frame, overwrite or clear every field.
+//  - When the render thread presents a DXGI swap chain, the window thread
+//    must keep pumping messages; it should not wait on the render thread for
+//    longer than the bounded handoff does.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Overlap the simulation of a frame with the rendering of the previous one.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the FramePipeline class template.
+/// @par Revision History:
+///      $Source: FramePipeline.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/14 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _FRAME_PIPELINE_HPP_
+#define _FRAME_PIPELINE_HPP_
+
+#include "FrameHandoff.hpp"
+#include <functional>
+#include <thread>
+#include <vector>
+
+struct FramePipelineSettings
+{
+	unsigned int packet_count = 2;            // 2 double buffers, 3 triple buffers
+	FrameHandoffMode mode = FrameHandoffMode::Queue;
+	bool threaded = true;                     // false renders inside submitFrame(), e.g. for debugging
+};
+
+/**
+ * @class FramePipeline
+ * @brief Runs the rendering of frames on a dedicated thread, fed by the thread that simulates them.
+ *
+ * The simulation thread copies what a frame needs to draw into a packet and
+ * submits it; the render thread draws it from there. So the simulation of
+ * frame N+1 overlaps the rendering of frame N, and the thread pumping the
+ * window messages is no longer blocked while a frame renders. The handoff
+ * between the two is a FrameHandoff over packet_count packets, which bounds
+ * how far the simulation can run ahead. Everything the render function
+ * touches must be owned by the render thread or be in the packet.
+ *
+ * Example usage:
+ * @code
+ * FramePipeline<ScenePacket> pipeline;
+ * pipeline.start(FramePipelineSettings(), [&](ScenePacket& f_packet) { renderer.draw(f_packet); });
+ * while (running)
+ * {
+ *     simulate();
+ *     if (ScenePacket* packet = pipeline.beginFrame())
+ *     {
+ *         writeVisibleObjects(*packet);
+ *         pipeline.submitFrame();
+ *     }
+ * }
+ * pipeline.stop();
+ * @endcode
+ */
+template<typename Packet>
+class FramePipeline
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Draws a packet; called on the render thread, or inside submitFrame() when not threaded.
+	/// </summary>
+	using RenderFunction = std::function<void(Packet& f_packet)>;
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	FramePipeline() : m_write_slot(0), m_running(false) {}
+	FramePipeline(const FramePipeline&) = delete;
+	FramePipeline& operator=(const FramePipeline&) = delete;
+	~FramePipeline() { stop(); }
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Allocates the packets and starts the render thread.
+	/// </summary>
+	bool start(const FramePipelineSettings& f_settings, const RenderFunction& f_render)
+	{
+		stop();
+		if (!f_render || !m_handoff.init(f_settings.packet_count, f_settings.mode))
+		{
+			return false;
+		}
+
+		m_settings = f_settings;
+		m_render = f_render;
+		m_packets.assign(f_settings.packet_count, Packet());
+		m_running = true;
+		if (m_settings.threaded)
+		{
+			m_thread = std::thread(&FramePipeline::run, this);
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Takes the packet of the next frame; in Queue mode waits while the render thread is packet_count - 1 frames behind.
+	/// </summary>
+	/// <returns>nullptr when the pipeline is not running.</returns>
+	Packet* beginFrame()
+	{
+		if (!m_running || !m_handoff.acquireWrite(m_write_slot))
+		{
+			return nullptr;
+		}
+		return &m_packets[m_write_slot];
+	}
+
+	/// <summary>
+	/// Hands the packet from beginFrame() to the render thread.
+	/// </summary>
+	void submitFrame()
+	{
+		m_handoff.publish();
+		if (!m_settings.threaded)
+		{
+			renderNext();
+		}
+	}
+
+	/// <summary>
+	/// Renders the frames already submitted and joins the render thread.
+	/// </summary>
+	void stop()
+	{
+		if (!m_running)
+		{
+			return;
+		}
+		m_handoff.close();
+		if (m_thread.joinable())
+		{
+			m_thread.join();
+		}
+		m_running = false;
+	}
+
+	bool isRunning() const { return m_running; }
+
+	const FramePipelineSettings& getSettings() const { return m_settings; }
+
+	FrameHandoff::Statistics getStatistics() const { return m_handoff.getStatistics(); }
+
+	void resetStatistics() { m_handoff.resetStatistics(); }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool renderNext()
+	{
+		unsigned int slot = 0;
+		if (!m_handoff.acquireRead(slot))
+		{
+			return false;
+		}
+		m_render(m_packets[slot]);
+		m_handoff.release();
+		return true;
+	}
+
+	void run()
+	{
+		while (renderNext())
+		{
+		}
+	}
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	FramePipelineSettings m_settings;
+	FrameHandoff m_handoff;
+	std::vector<Packet> m_packets;
+	RenderFunction m_render;
+	std::thread m_thread;
+	unsigned int m_write_slot;
+	bool m_running;
+};
+
+#endif // !_FRAME_PIPELINE_HPP_
@@ -0,0 +1,223 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Bounded handoff of frame packets between two threads
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Overlap the simulation of a frame with the rendering of the previous one.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the FrameHandoff class.
+/// @par Revision History:
+///      $Source: FrameHandoff.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/14 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "FrameHandoff.hpp"
+#include "Clock.hpp"
+#include <algorithm>
+
+namespace
+{
+	double elapsedMs(long long f_start)
+	{
+		return static_cast<double>(Clock::now() - f_start) * 1e-6;
+	}
+}
+
+FrameHandoff::FrameHandoff()
+	: m_mode(FrameHandoffMode::Queue), m_write_slot(0), m_read_slot(0), m_next_sequence(0), m_closed(true), m_latency_sum_ms(0.0)
+{
+}
+
+bool FrameHandoff::init(unsigned int f_slot_count, FrameHandoffMode f_mode)
+{
+	if (f_slot_count < 2)
+	{
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_slots.assign(f_slot_count, Slot());
+	m_mode = f_mode;
+	m_write_slot = f_slot_count;
+	m_read_slot = f_slot_count;
+	m_next_sequence = 0;
+	m_closed = false;
+	m_statistics = Statistics();
+	m_latency_sum_ms = 0.0;
+	return true;
+}
+
+unsigned int FrameHandoff::findSlot(SlotState f_state) const
+{
+	unsigned int slot = 0;
+	while (slot < m_slots.size() && m_slots[slot].state != f_state)
+	{
+		slot++;
+	}
+	return slot;
+}
+
+unsigned int FrameHandoff::findOldestReady() const
+{
+	unsigned int oldest = static_cast<unsigned int>(m_slots.size());
+	for (unsigned int slot = 0; slot < m_slots.size(); ++slot)
+	{
+		if (m_slots[slot].state == SlotState::Ready && (oldest == m_slots.size() || m_slots[slot].sequence < m_slots[oldest].sequence))
+		{
+			oldest = slot;
+		}
+	}
+	return oldest;
+}
+
+bool FrameHandoff::acquireWrite(unsigned int& f_slot)
+{
+	const long long start = Clock::now();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	const unsigned int none = static_cast<unsigned int>(m_slots.size());
+
+	// In Latest mode a ready frame the consumer has not taken yet is overwritten instead of waited for
+	m_producer_condition.wait(lock, [this, none]
+	{
+		return m_closed || findSlot(SlotState::Free) != none || (m_mode == FrameHandoffMode::Latest && findSlot(SlotState::Ready) != none);
+	});
+	m_statistics.producer_wait_ms += elapsedMs(start);
+	if (m_closed)
+	{
+		return false;
+	}
+
+	unsigned int slot = findSlot(SlotState::Free);
+	if (slot == none)
+	{
+		slot = findOldestReady();
+		m_statistics.dropped_frames++;
+	}
+	m_slots[slot].state = SlotState::Writing;
+	m_write_slot = slot;
+	f_slot = slot;
+	return true;
+}
+
+void FrameHandoff::publish()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_write_slot >= m_slots.size())
+		{
+			return;
+		}
+
+		if (m_mode == FrameHandoffMode::Latest)
+		{
+			// Only the newest frame is worth rendering, free the older ones for the producer
+			for (Slot& slot : m_slots)
+			{
+				if (slot.state == SlotState::Ready)
+				{
+					slot.state = SlotState::Free;
+					m_statistics.dropped_frames++;
+				}
+			}
+		}
+
+		Slot& slot = m_slots[m_write_slot];
+		slot.state = SlotState::Ready;
+		slot.sequence = m_next_sequence++;
+		slot.published = Clock::now();
+		m_write_slot = static_cast<unsigned int>(m_slots.size());
+		m_statistics.submitted_frames++;
+	}
+	m_consumer_condition.notify_one();
+}
+
+bool FrameHandoff::acquireRead(unsigned int& f_slot)
+{
+	const long long start = Clock::now();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	const unsigned int none = static_cast<unsigned int>(m_slots.size());
+
+	m_consumer_condition.wait(lock, [this, none] { return m_closed || findSlot(SlotState::Ready) != none; });
+	m_statistics.consumer_wait_ms += elapsedMs(start);
+
+	const unsigned int slot = findOldestReady();
+	if (slot == none)
+	{
+		return false;
+	}
+	m_slots[slot].state = SlotState::Reading;
+	m_read_slot = slot;
+	f_slot = slot;
+	return true;
+}
+
+void FrameHandoff::release()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_read_slot >= m_slots.size())
+		{
+			return;
+		}
+
+		Slot& slot = m_slots[m_read_slot];
+		const double latency_ms = elapsedMs(slot.published);
+		slot.state = SlotState::Free;
+		m_read_slot = static_cast<unsigned int>(m_slots.size());
+
+		m_statistics.consumed_frames++;
+		m_latency_sum_ms += latency_ms;
+		m_statistics.mean_latency_ms = m_latency_sum_ms / static_cast<double>(m_statistics.consumed_frames);
+		m_statistics.max_latency_ms = std::max(m_statistics.max_latency_ms, latency_ms);
+	}
+	m_producer_condition.notify_one();
+}
+
+void FrameHandoff::close()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_closed = true;
+	}
+	m_producer_condition.notify_all();
+	m_consumer_condition.notify_all();
+}
+
+FrameHandoff::Statistics FrameHandoff::getStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+void FrameHandoff::resetStatistics()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_statistics = Statistics();
+	m_latency_sum_ms = 0.0;
+}
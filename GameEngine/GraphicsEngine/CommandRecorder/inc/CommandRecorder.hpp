@@ -0,0 +1,322 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Capture of rendering commands
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Record frames of the engine for offline replay.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the CommandRecorder class.
+/// @par Revision History:
+///      $Source: CommandRecorder.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _COMMAND_RECORDER_HPP_
+#define _COMMAND_RECORDER_HPP_
+
+#include "CommandStream.hpp"
+#include <d3d11.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class CommandRecorder
+ * @brief Records what the engine sends through DeviceContext into a command stream.
+ *
+ * The buffer, shader, input layout, pipeline state, DeviceContext and
+ * SwapChain code report to the recorder through the on*() hooks. Each hook is
+ * inline and returns after one atomic load while the recorder is off.
+ *
+ * With tracking enabled the recorder keeps a copy of every live resource, so
+ * that a capture can start at any frame: beginCapture() arms it, and at the
+ * next present the live resources and the viewport are written as the setup
+ * section of the stream, followed by the next f_frames frames. Resources are
+ * named by the engine object that owns them (the D3D object for input
+ * layouts) and get ids in creation order, so a resource is always written
+ * after the resources it refers to.
+ *
+ * Only what goes through the engine classes is captured: code calling the
+ * ID3D11DeviceContext directly (textures, light lists, text) is not.
+ *
+ * Example usage:
+ * @code
+ * CommandRecorder::get()->setTracking(true);  // before the resources are created
+ * // ...
+ * CommandRecorder::get()->beginCapture("frames.d3cs", 300);
+ * @endcode
+ */
+class CommandRecorder
+{
+public:
+
+	/*--------------------------------------------------------------
+		Factory Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Retrieves the singleton instance of the CommandRecorder.
+	/// </summary>
+	static CommandRecorder* get();
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	CommandRecorder();
+	CommandRecorder(const CommandRecorder&) = delete;
+	CommandRecorder& operator=(const CommandRecorder&) = delete;
+	~CommandRecorder();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Starts or stops keeping copies of the resources; resources created while off cannot be captured.
+	/// </summary>
+	void setTracking(bool f_tracking);
+
+	bool isTracking() const { return m_tracking.load(std::memory_order_relaxed); }
+
+	/// <summary>
+	/// Creates the stream file; capturing starts at the next present.
+	/// </summary>
+	/// <param name="f_frames">Frames to capture before the file is closed, 0 to capture until endCapture().</param>
+	/// <returns>False if tracking is off, a capture is running, the ids ran past max_command_resource_id or the file cannot be created.</returns>
+	bool beginCapture(const char* f_file_name, unsigned int f_frames);
+
+	/// <summary>
+	/// Stops capturing and closes the file.
+	/// </summary>
+	/// <returns>False if a write failed.</returns>
+	bool endCapture();
+
+	/// <summary>
+	/// True from beginCapture() until the file is closed.
+	/// </summary>
+	bool isCapturing() const { return m_capturing.load(std::memory_order_relaxed); }
+
+	unsigned int getCapturedFrameCount();
+
+	/*--------------------------------------------------------------
+		Resource Hooks
+	--------------------------------------------------------------*/
+
+	/// <param name="f_data">Initial contents, or nullptr; not kept for dynamic buffers.</param>
+	void onCreateBuffer(const void* f_buffer, CommandBufferKind f_kind, UINT f_stride, UINT f_byte_size, const void* f_data)
+	{
+		if (isTracking()) recordCreateBuffer(f_buffer, f_kind, f_stride, f_byte_size, f_data);
+	}
+
+	void onUpdateBuffer(const void* f_buffer, UINT f_byte_offset, const void* f_data, UINT f_size)
+	{
+		if (isTracking()) recordUpdateBuffer(f_buffer, f_byte_offset, f_data, f_size);
+	}
+
+	void onCreateShader(const void* f_shader, CommandShaderStage f_stage, const void* f_byte_code, size_t f_size)
+	{
+		if (isTracking()) recordCreateShader(f_shader, f_stage, f_byte_code, f_size);
+	}
+
+	void onCreateInputLayout(const ID3D11InputLayout* f_layout, const D3D11_INPUT_ELEMENT_DESC* f_elements, UINT f_element_count,
+		const void* f_byte_code, size_t f_size)
+	{
+		if (isTracking()) recordCreateInputLayout(f_layout, f_elements, f_element_count, f_byte_code, f_size);
+	}
+
+	/// <summary>
+	/// Reports a pipeline state; the ids of f_desc are filled in from the shader and layout keys.
+	/// </summary>
+	void onCreatePipeline(const void* f_pipeline, const void* f_vertex_shader, const void* f_pixel_shader,
+		const ID3D11InputLayout* f_input_layout, const CommandPipelineDesc& f_desc)
+	{
+		if (isTracking()) recordCreatePipeline(f_pipeline, f_vertex_shader, f_pixel_shader, f_input_layout, f_desc);
+	}
+
+	void onRelease(const void* f_resource)
+	{
+		if (isTracking()) recordRelease(f_resource);
+	}
+
+	/*--------------------------------------------------------------
+		Context Hooks
+	--------------------------------------------------------------*/
+
+	void onSetVertexBuffers(const void* const* f_buffers, const UINT* f_strides, UINT f_count)
+	{
+		if (isCapturing()) recordSetVertexBuffers(f_buffers, f_strides, f_count);
+	}
+
+	void onSetIndexBuffer(const void* f_buffer)
+	{
+		if (isCapturing()) recordSetIndexBuffer(f_buffer);
+	}
+
+	void onSetShader(CommandShaderStage f_stage, const void* f_shader)
+	{
+		if (isCapturing()) recordSetShader(f_stage, f_shader);
+	}
+
+	/// <summary>
+	/// Reported on every bind, also the redundant ones; only switches are written.
+	/// </summary>
+	void onSetPipeline(const void* f_pipeline)
+	{
+		if (isCapturing()) recordSetPipeline(f_pipeline);
+	}
+
+	void onSetConstantBuffer(CommandShaderStage f_stage, UINT f_slot, const void* f_buffer)
+	{
+		if (isCapturing()) recordSetConstantBuffer(f_stage, f_slot, f_buffer);
+	}
+
+	void onSetViewport(UINT f_width, UINT f_height)
+	{
+		if (isTracking()) recordSetViewport(f_width, f_height);
+	}
+
+	void onClear(const float f_color[4])
+	{
+		if (isCapturing()) recordClear(f_color);
+	}
+
+	void onDraw(D3D11_PRIMITIVE_TOPOLOGY f_topology, UINT f_vertex_count, UINT f_start_vertex)
+	{
+		if (isCapturing()) recordDraw(f_topology, f_vertex_count, f_start_vertex);
+	}
+
+	void onDrawIndexed(D3D11_PRIMITIVE_TOPOLOGY f_topology, UINT f_index_count, UINT f_start_index, UINT f_base_vertex)
+	{
+		if (isCapturing()) recordDrawIndexed(f_topology, f_index_count, f_start_index, f_base_vertex);
+	}
+
+	void onPresent()
+	{
+		if (isCapturing()) recordPresent();
+	}
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	enum class ResourceType : unsigned char
+	{
+		Buffer,
+		Shader,
+		InputLayout,
+		Pipeline
+	};
+
+	/// <summary>
+	/// What is needed to write a live resource into the setup section.
+	/// </summary>
+	struct Resource
+	{
+		unsigned int id = 0;
+		ResourceType type = ResourceType::Buffer;
+		CommandBufferKind kind = CommandBufferKind::Vertex;
+		CommandShaderStage stage = CommandShaderStage::Vertex;
+		UINT stride = 0;
+		UINT byte_size = 0;
+		bool has_data = false;
+		std::vector<unsigned char> data;               // Buffer contents or shader byte code
+		std::vector<CommandInputElement> elements;     // Semantic names point into names
+		std::vector<std::string> names;
+		CommandPipelineDesc pipeline;                  // Fixed function state points into data
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void recordCreateBuffer(const void* f_buffer, CommandBufferKind f_kind, UINT f_stride, UINT f_byte_size, const void* f_data);
+	void recordUpdateBuffer(const void* f_buffer, UINT f_byte_offset, const void* f_data, UINT f_size);
+	void recordCreateShader(const void* f_shader, CommandShaderStage f_stage, const void* f_byte_code, size_t f_size);
+	void recordCreateInputLayout(const ID3D11InputLayout* f_layout, const D3D11_INPUT_ELEMENT_DESC* f_elements, UINT f_element_count,
+		const void* f_byte_code, size_t f_size);
+	void recordCreatePipeline(const void* f_pipeline, const void* f_vertex_shader, const void* f_pixel_shader,
+		const ID3D11InputLayout* f_input_layout, const CommandPipelineDesc& f_desc);
+	void recordRelease(const void* f_resource);
+	void recordSetVertexBuffers(const void* const* f_buffers, const UINT* f_strides, UINT f_count);
+	void recordSetIndexBuffer(const void* f_buffer);
+	void recordSetShader(CommandShaderStage f_stage, const void* f_shader);
+	void recordSetPipeline(const void* f_pipeline);
+	void recordSetConstantBuffer(CommandShaderStage f_stage, UINT f_slot, const void* f_buffer);
+	void recordSetViewport(UINT f_width, UINT f_height);
+	void recordClear(const float f_color[4]);
+	void recordDraw(D3D11_PRIMITIVE_TOPOLOGY f_topology, UINT f_vertex_count, UINT f_start_vertex);
+	void recordDrawIndexed(D3D11_PRIMITIVE_TOPOLOGY f_topology, UINT f_index_count, UINT f_start_index, UINT f_base_vertex);
+	void recordPresent();
+
+	/// <summary>
+	/// Starts tracking f_key under a new id, or reuses its id when it is recreated.
+	/// </summary>
+	Resource& track(const void* f_key, ResourceType f_type);
+
+	/// <summary>
+	/// Id of a tracked resource, 0 if unknown; m_mutex must be held.
+	/// </summary>
+	unsigned int findId(const void* f_key) const;
+
+	/// <summary>
+	/// Writes a tracked resource as its create command.
+	/// </summary>
+	void writeResource(const Resource& f_resource);
+
+	/// <summary>
+	/// Writes the live resources and the viewport as the setup section.
+	/// </summary>
+	void writeSetup();
+
+	bool closeCapture();
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::atomic<bool> m_tracking;
+	std::atomic<bool> m_capturing;
+	std::mutex m_mutex;
+	std::unordered_map<const void*, Resource> m_resources;
+	unsigned int m_next_id;
+	UINT m_viewport_width;
+	UINT m_viewport_height;
+
+	CommandStreamWriter m_writer;
+	bool m_setup_written;          // False until the present that starts the capture
+	unsigned int m_frame_limit;
+	unsigned int m_bound_pipeline;
+};
+
+#endif // !_COMMAND_RECORDER_HPP_
@@ -0,0 +1,433 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Capture of rendering commands
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Record frames of the engine for offline replay.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the CommandRecorder class.
+/// @par Revision History:
+///      $Source: CommandRecorder.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "CommandRecorder.hpp"
+#include <algorithm>
+#include <cstring>
+
+CommandRecorder* CommandRecorder::get()
+{
+	static CommandRecorder recorder;
+	return &recorder;
+}
+
+CommandRecorder::CommandRecorder()
+	: m_tracking(false), m_capturing(false), m_next_id(1), m_viewport_width(0), m_viewport_height(0),
+	m_setup_written(false), m_frame_limit(0), m_bound_pipeline(0)
+{
+}
+
+/*--------------------------------------------------------------
+	Control
+--------------------------------------------------------------*/
+
+void CommandRecorder::setTracking(bool f_tracking)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!f_tracking)
+	{
+		closeCapture();
+		m_resources.clear();
+	}
+	m_tracking.store(f_tracking, std::memory_order_relaxed);
+}
+
+bool CommandRecorder::beginCapture(const char* f_file_name, unsigned int f_frames)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	// Ids are never reused; past the limit the reader would reject the stream
+	if (!isTracking() || isCapturing() || m_next_id > max_command_resource_id || !m_writer.open(f_file_name))
+	{
+		return false;
+	}
+	m_setup_written = false;
+	m_frame_limit = f_frames;
+	m_bound_pipeline = 0;
+	m_capturing.store(true, std::memory_order_relaxed);
+	return true;
+}
+
+bool CommandRecorder::endCapture()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return closeCapture();
+}
+
+bool CommandRecorder::closeCapture()
+{
+	if (!isCapturing())
+	{
+		return true;
+	}
+	m_capturing.store(false, std::memory_order_relaxed);
+	if (!m_setup_written)
+	{
+		// No present happened: still a valid stream, with the setup and no frames
+		writeSetup();
+	}
+	return m_writer.close();
+}
+
+unsigned int CommandRecorder::getCapturedFrameCount()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_writer.getFrameCount();
+}
+
+/*--------------------------------------------------------------
+	Resources
+--------------------------------------------------------------*/
+
+CommandRecorder::Resource& CommandRecorder::track(const void* f_key, ResourceType f_type)
+{
+	Resource& resource = m_resources[f_key];
+	const unsigned int id = resource.id ? resource.id : m_next_id++;
+	resource = Resource();
+	resource.id = id;
+	resource.type = f_type;
+	return resource;
+}
+
+unsigned int CommandRecorder::findId(const void* f_key) const
+{
+	if (!f_key)
+	{
+		return 0;
+	}
+	auto it = m_resources.find(f_key);
+	return it != m_resources.end() ? it->second.id : 0;
+}
+
+void CommandRecorder::recordCreateBuffer(const void* f_buffer, CommandBufferKind f_kind, UINT f_stride, UINT f_byte_size, const void* f_data)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Resource& buffer = track(f_buffer, ResourceType::Buffer);
+	buffer.kind = f_kind;
+	buffer.stride = f_stride;
+	buffer.byte_size = f_byte_size;
+	// Dynamic buffers are rewritten every frame, their contents come with the frames
+	if (f_kind != CommandBufferKind::DynamicVertex)
+	{
+		buffer.has_data = f_data != nullptr;
+		buffer.data.resize(f_byte_size);
+		if (f_data) std::memcpy(buffer.data.data(), f_data, f_byte_size);
+	}
+
+	if (isCapturing() && m_setup_written)
+	{
+		writeResource(buffer);
+	}
+}
+
+void CommandRecorder::recordUpdateBuffer(const void* f_buffer, UINT f_byte_offset, const void* f_data, UINT f_size)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_resources.find(f_buffer);
+	if (it == m_resources.end())
+	{
+		return;
+	}
+
+	Resource& buffer = it->second;
+	if (buffer.kind != CommandBufferKind::DynamicVertex && f_byte_offset <= buffer.data.size() && f_size <= buffer.data.size() - f_byte_offset)
+	{
+		std::memcpy(buffer.data.data() + f_byte_offset, f_data, f_size);
+		buffer.has_data = true;
+	}
+
+	if (isCapturing() && m_setup_written)
+	{
+		m_writer.updateBuffer(buffer.id, f_byte_offset, f_data, f_size);
+	}
+}
+
+void CommandRecorder::recordCreateShader(const void* f_shader, CommandShaderStage f_stage, const void* f_byte_code, size_t f_size)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Resource& shader = track(f_shader, ResourceType::Shader);
+	shader.stage = f_stage;
+	const unsigned char* code = static_cast<const unsigned char*>(f_byte_code);
+	shader.data.assign(code, code + f_size);
+
+	if (isCapturing() && m_setup_written)
+	{
+		writeResource(shader);
+	}
+}
+
+void CommandRecorder::recordCreateInputLayout(const ID3D11InputLayout* f_layout, const D3D11_INPUT_ELEMENT_DESC* f_elements,
+	UINT f_element_count, const void* f_byte_code, size_t f_size)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Resource& layout = track(f_layout, ResourceType::InputLayout);
+	const unsigned char* code = static_cast<const unsigned char*>(f_byte_code);
+	layout.data.assign(code, code + f_size);
+
+	// All names first: the elements point into the strings
+	layout.names.resize(f_element_count);
+	for (UINT i = 0; i < f_element_count; ++i)
+	{
+		layout.names[i] = f_elements[i].SemanticName;
+	}
+	layout.elements.resize(f_element_count);
+	for (UINT i = 0; i < f_element_count; ++i)
+	{
+		CommandInputElement& element = layout.elements[i];
+		element.semantic_name = layout.names[i].c_str();
+		element.semantic_index = f_elements[i].SemanticIndex;
+		element.format = f_elements[i].Format;
+		element.input_slot = f_elements[i].InputSlot;
+		element.aligned_byte_offset = f_elements[i].AlignedByteOffset;
+		element.per_instance = f_elements[i].InputSlotClass;
+		element.instance_step_rate = f_elements[i].InstanceDataStepRate;
+	}
+
+	if (isCapturing() && m_setup_written)
+	{
+		writeResource(layout);
+	}
+}
+
+void CommandRecorder::recordCreatePipeline(const void* f_pipeline, const void* f_vertex_shader, const void* f_pixel_shader,
+	const ID3D11InputLayout* f_input_layout, const CommandPipelineDesc& f_desc)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Resource& pipeline = track(f_pipeline, ResourceType::Pipeline);
+
+	// The three fixed function descriptions are kept back to back in data
+	pipeline.data.resize(f_desc.rasterizer_size + f_desc.blend_size + f_desc.depth_stencil_size);
+	unsigned char* state = pipeline.data.data();
+	if (f_desc.rasterizer_size) std::memcpy(state, f_desc.rasterizer, f_desc.rasterizer_size);
+	if (f_desc.blend_size) std::memcpy(state + f_desc.rasterizer_size, f_desc.blend, f_desc.blend_size);
+	if (f_desc.depth_stencil_size) std::memcpy(state + f_desc.rasterizer_size + f_desc.blend_size, f_desc.depth_stencil, f_desc.depth_stencil_size);
+
+	pipeline.pipeline = f_desc;
+	pipeline.pipeline.vertex_shader = findId(f_vertex_shader);
+	pipeline.pipeline.pixel_shader = findId(f_pixel_shader);
+	pipeline.pipeline.input_layout = findId(f_input_layout);
+	pipeline.pipeline.rasterizer = state;
+	pipeline.pipeline.blend = state + f_desc.rasterizer_size;
+	pipeline.pipeline.depth_stencil = state + f_desc.rasterizer_size + f_desc.blend_size;
+
+	if (isCapturing() && m_setup_written)
+	{
+		writeResource(pipeline);
+	}
+}
+
+void CommandRecorder::recordRelease(const void* f_resource)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_resources.find(f_resource);
+	if (it == m_resources.end())
+	{
+		return;
+	}
+
+	if (isCapturing() && m_setup_written)
+	{
+		m_writer.releaseResource(it->second.id);
+	}
+	if (it->second.id == m_bound_pipeline)
+	{
+		m_bound_pipeline = 0;
+	}
+	m_resources.erase(it);
+}
+
+void CommandRecorder::writeResource(const Resource& f_resource)
+{
+	switch (f_resource.type)
+	{
+	case ResourceType::Buffer:
+		m_writer.createBuffer(f_resource.id, f_resource.kind, f_resource.stride, f_resource.byte_size,
+			f_resource.has_data ? f_resource.data.data() : nullptr);
+		break;
+	case ResourceType::Shader:
+		m_writer.createShader(f_resource.id, f_resource.stage, f_resource.data.data(), static_cast<unsigned int>(f_resource.data.size()));
+		break;
+	case ResourceType::InputLayout:
+		m_writer.createInputLayout(f_resource.id, f_resource.elements.data(), static_cast<unsigned int>(f_resource.elements.size()),
+			f_resource.data.data(), static_cast<unsigned int>(f_resource.data.size()));
+		break;
+	case ResourceType::Pipeline:
+		m_writer.createPipeline(f_resource.id, f_resource.pipeline);
+		break;
+	}
+}
+
+void CommandRecorder::writeSetup()
+{
+	// Creation order, so shaders and layouts come before the pipelines using them
+	std::vector<const Resource*> resources;
+	resources.reserve(m_resources.size());
+	for (const auto& entry : m_resources)
+	{
+		resources.push_back(&entry.second);
+	}
+	std::sort(resources.begin(), resources.end(), [](const Resource* f_a, const Resource* f_b)
+	{
+		return f_a->id < f_b->id;
+	});
+
+	for (const Resource* resource : resources)
+	{
+		writeResource(*resource);
+	}
+	if (m_viewport_width && m_viewport_height)
+	{
+		m_writer.setViewport(m_viewport_width, m_viewport_height);
+	}
+	m_writer.beginFrames();
+	m_setup_written = true;
+}
+
+/*--------------------------------------------------------------
+	Context
+--------------------------------------------------------------*/
+
+void CommandRecorder::recordSetVertexBuffers(const void* const* f_buffers, const UINT* f_strides, UINT f_count)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_setup_written)
+	{
+		return;
+	}
+
+	unsigned int ids[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	f_count = std::min<UINT>(f_count, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT);
+	for (UINT i = 0; i < f_count; ++i)
+	{
+		ids[i] = findId(f_buffers[i]);
+	}
+	m_writer.setVertexBuffers(ids, f_strides, f_count);
+}
+
+void CommandRecorder::recordSetIndexBuffer(const void* f_buffer)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_setup_written) m_writer.setIndexBuffer(findId(f_buffer));
+}
+
+void CommandRecorder::recordSetShader(CommandShaderStage f_stage, const void* f_shader)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_setup_written)
+	{
+		return;
+	}
+	m_writer.setShader(f_stage, findId(f_shader));
+	// DeviceContext forgets its pipeline state too, the next bind is a switch
+	m_bound_pipeline = 0;
+}
+
+void CommandRecorder::recordSetPipeline(const void* f_pipeline)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const unsigned int id = findId(f_pipeline);
+	if (!m_setup_written || id == m_bound_pipeline)
+	{
+		return;
+	}
+	m_writer.setPipeline(id);
+	m_bound_pipeline = id;
+}
+
+void CommandRecorder::recordSetConstantBuffer(CommandShaderStage f_stage, UINT f_slot, const void* f_buffer)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_setup_written) m_writer.setConstantBuffer(f_stage, f_slot, findId(f_buffer));
+}
+
+void CommandRecorder::recordSetViewport(UINT f_width, UINT f_height)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_viewport_width = f_width;
+	m_viewport_height = f_height;
+	if (isCapturing() && m_setup_written)
+	{
+		m_writer.setViewport(f_width, f_height);
+	}
+}
+
+void CommandRecorder::recordClear(const float f_color[4])
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_setup_written) m_writer.clear(f_color);
+}
+
+void CommandRecorder::recordDraw(D3D11_PRIMITIVE_TOPOLOGY f_topology, UINT f_vertex_count, UINT f_start_vertex)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_setup_written) m_writer.draw(f_topology, f_vertex_count, f_start_vertex);
+}
+
+void CommandRecorder::recordDrawIndexed(D3D11_PRIMITIVE_TOPOLOGY f_topology, UINT f_index_count, UINT f_start_index, UINT f_base_vertex)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_setup_written) m_writer.drawIndexed(f_topology, f_index_count, f_start_index, f_base_vertex);
+}
+
+void CommandRecorder::recordPresent()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!isCapturing())
+	{
+		return;
+	}
+	if (!m_setup_written)
+	{
+		// The capture starts on a frame boundary, with everything that is alive now
+		writeSetup();
+		m_bound_pipeline = 0;
+		return;
+	}
+
+	m_writer.endFrame();
+	if (m_frame_limit && m_writer.getFrameCount() >= m_frame_limit)
+	{
+		closeCapture();
+	}
+}
+
+CommandRecorder::~CommandRecorder()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	closeCapture();
+}
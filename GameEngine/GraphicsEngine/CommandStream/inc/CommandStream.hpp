@@ -0,0 +1,272 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Recorded rendering commands
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - File layout: a 16 byte header ("D3CS", version, frame count, setup
+//    size) followed by commands, each a type byte and its operands as
+//    LEB128 integers, little endian floats and length prefixed blobs.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Replay captured frames against any rendering backend.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the command stream file format, CommandStreamWriter and CommandStreamReader.
+/// @par Revision History:
+///      $Source: CommandStream.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _COMMAND_STREAM_HPP_
+#define _COMMAND_STREAM_HPP_
+
+#include "ICommandBackend.hpp"
+#include <cstddef>
+#include <fstream>
+#include <vector>
+
+/// <summary>
+/// Type byte of each command in a stream; the values are part of the file format.
+/// </summary>
+enum class CommandType : unsigned char
+{
+	CreateBuffer = 1,
+	UpdateBuffer,
+	CreateShader,
+	CreateInputLayout,
+	CreatePipeline,
+	ReleaseResource,
+	SetVertexBuffers,
+	SetIndexBuffer,
+	SetShader,
+	SetPipeline,
+	SetConstantBuffer,
+	SetViewport,
+	Clear,
+	Draw,
+	DrawIndexed,
+	EndFrame
+};
+
+/**
+ * @class CommandStreamWriter
+ * @brief Encodes the commands it receives into a command stream file.
+ *
+ * Commands are encoded into memory and written out in large blocks. The
+ * commands before beginFrames() form the setup section, the resources alive
+ * when recording started; a replay runs it once and can loop the frames after
+ * it. A draw takes 4 to 8 bytes, so the stream is dominated by buffer
+ * contents.
+ *
+ * Example usage:
+ * @code
+ * writer.open("frames.d3cs");
+ * writer.createBuffer(1, CommandBufferKind::Vertex, 20, 20 * 3, vertices);
+ * writer.beginFrames();
+ * writer.setVertexBuffers(&id, &stride, 1);
+ * writer.draw(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, 3, 0);
+ * writer.endFrame();
+ * writer.close();
+ * @endcode
+ */
+class CommandStreamWriter : public ICommandBackend
+{
+public:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	CommandStreamWriter();
+	CommandStreamWriter(const CommandStreamWriter&) = delete;
+	CommandStreamWriter& operator=(const CommandStreamWriter&) = delete;
+	~CommandStreamWriter();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Creates the file and writes a header; closes a previous stream first.
+	/// </summary>
+	bool open(const char* f_file_name);
+
+	/// <summary>
+	/// Ends the setup section; call once, before the first frame.
+	/// </summary>
+	void beginFrames();
+
+	/// <summary>
+	/// Writes the remaining commands and completes the header.
+	/// </summary>
+	/// <returns>False if any write failed.</returns>
+	bool close();
+
+	bool isOpen() const { return m_stream.is_open(); }
+	unsigned int getFrameCount() const { return m_frame_count; }
+	unsigned long long getBytesWritten() const { return m_bytes_written + m_buffer.size(); }
+
+	/*--------------------------------------------------------------
+		ICommandBackend
+	--------------------------------------------------------------*/
+
+	void createBuffer(unsigned int f_id, CommandBufferKind f_kind, unsigned int f_stride, unsigned int f_byte_size, const void* f_data) override;
+	void updateBuffer(unsigned int f_id, unsigned int f_byte_offset, const void* f_data, unsigned int f_size) override;
+	void createShader(unsigned int f_id, CommandShaderStage f_stage, const void* f_byte_code, unsigned int f_size) override;
+	void createInputLayout(unsigned int f_id, const CommandInputElement* f_elements, unsigned int f_element_count,
+		const void* f_byte_code, unsigned int f_size) override;
+	void createPipeline(unsigned int f_id, const CommandPipelineDesc& f_desc) override;
+	void releaseResource(unsigned int f_id) override;
+	void setVertexBuffers(const unsigned int* f_ids, const unsigned int* f_strides, unsigned int f_count) override;
+	void setIndexBuffer(unsigned int f_id) override;
+	void setShader(CommandShaderStage f_stage, unsigned int f_id) override;
+	void setPipeline(unsigned int f_id) override;
+	void setConstantBuffer(CommandShaderStage f_stage, unsigned int f_slot, unsigned int f_id) override;
+	void setViewport(unsigned int f_width, unsigned int f_height) override;
+	void clear(const float f_color[4]) override;
+	void draw(unsigned int f_topology, unsigned int f_vertex_count, unsigned int f_start_vertex) override;
+	void drawIndexed(unsigned int f_topology, unsigned int f_index_count, unsigned int f_start_index, unsigned int f_base_vertex) override;
+	void endFrame() override;
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void writeType(CommandType f_type) { m_buffer.push_back(static_cast<unsigned char>(f_type)); }
+	void writeUInt(unsigned int f_value);
+	void writeFloat(float f_value);
+	void writeBlob(const void* f_data, unsigned int f_size);
+
+	/// <summary>
+	/// Writes the encoded commands to the file once enough have gathered, or always with f_force.
+	/// </summary>
+	void flush(bool f_force);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::ofstream m_stream;
+	std::vector<unsigned char> m_buffer;
+	unsigned long long m_bytes_written;
+	unsigned int m_frame_count;
+	unsigned int m_setup_size;
+	bool m_failed;
+};
+
+/**
+ * @class CommandStreamReader
+ * @brief Loads a command stream and replays it into an ICommandBackend as fast as it decodes.
+ *
+ * The whole file is read into memory before replaying so that disk speed is
+ * not measured. Pointers passed to the backend point into that memory, are
+ * not aligned and are only valid during the call.
+ *
+ * Example usage:
+ * @code
+ * CommandStreamReader reader;
+ * NullCommandBackend backend;
+ * if (reader.loadFile("frames.d3cs") && reader.replay(&backend, 10))
+ * {
+ *     double frame_ms = reader.getStatistics().replay_ms / reader.getStatistics().frames;
+ * }
+ * @endcode
+ */
+class CommandStreamReader
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters of the last replay(); the setup section is timed separately from the frames.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long commands = 0;
+		unsigned long long draws = 0;
+		unsigned int frames = 0;
+		double setup_ms = 0.0;
+		double replay_ms = 0.0;       // Every replayed frame
+		double min_frame_ms = 0.0;
+		double max_frame_ms = 0.0;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	CommandStreamReader();
+	~CommandStreamReader();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <returns>False if the file cannot be read or is not a command stream of this version.</returns>
+	bool loadFile(const char* f_file_name);
+	bool load(const unsigned char* f_data, size_t f_size);
+
+	/// <summary>
+	/// Replays the setup section once and then the frames f_loops times.
+	/// </summary>
+	/// <returns>False if a command is malformed; the commands before it were replayed.</returns>
+	bool replay(ICommandBackend* f_backend, unsigned int f_loops);
+
+	unsigned int getFrameCount() const { return m_frame_count; }
+	size_t getSize() const { return m_data.size(); }
+	size_t getSetupSize() const { return m_setup_size; }
+	const Statistics& getStatistics() const { return m_statistics; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Decodes and dispatches the commands in [f_begin, f_end), timing every frame.
+	/// </summary>
+	bool replayRange(ICommandBackend* f_backend, size_t f_begin, size_t f_end);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<unsigned char> m_data;
+	unsigned int m_frame_count;
+	size_t m_setup_size;
+	std::vector<CommandInputElement> m_elements;
+	std::vector<unsigned int> m_ids;
+	std::vector<unsigned int> m_strides;
+	Statistics m_statistics;
+};
+
+#endif // !_COMMAND_STREAM_HPP_
@@ -0,0 +1,163 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Recorded rendering commands
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Replay captured frames against any rendering backend.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the command set of a command stream and the ICommandBackend interface.
+/// @par Revision History:
+///      $Source: ICommandBackend.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _ICOMMAND_BACKEND_HPP_
+#define _ICOMMAND_BACKEND_HPP_
+
+/// <summary>
+/// What a recorded buffer is bound as; dynamic vertex buffers are rewritten every frame.
+/// </summary>
+enum class CommandBufferKind : unsigned char
+{
+	Vertex,
+	DynamicVertex,
+	Index,       // 32 bit indices
+	Constant
+};
+
+enum class CommandShaderStage : unsigned char
+{
+	Vertex,
+	Pixel
+};
+
+/// <summary>
+/// One D3D11_INPUT_ELEMENT_DESC with plain types.
+/// </summary>
+struct CommandInputElement
+{
+	const char* semantic_name = "";
+	unsigned int semantic_index = 0;
+	unsigned int format = 0;              // DXGI_FORMAT
+	unsigned int input_slot = 0;
+	unsigned int aligned_byte_offset = 0;
+	unsigned int per_instance = 0;        // D3D11_INPUT_CLASSIFICATION
+	unsigned int instance_step_rate = 0;
+};
+
+/// <summary>
+/// A PipelineStateDesc with resource ids; the fixed function state is kept as the raw D3D11 descriptions.
+/// </summary>
+struct CommandPipelineDesc
+{
+	unsigned int vertex_shader = 0;
+	unsigned int pixel_shader = 0;
+	unsigned int input_layout = 0;
+	unsigned int topology = 0;            // D3D11_PRIMITIVE_TOPOLOGY
+	const void* rasterizer = nullptr;     // D3D11_RASTERIZER_DESC
+	unsigned int rasterizer_size = 0;
+	const void* blend = nullptr;          // D3D11_BLEND_DESC
+	unsigned int blend_size = 0;
+	const void* depth_stencil = nullptr;  // D3D11_DEPTH_STENCIL_DESC
+	unsigned int depth_stencil_size = 0;
+	float blend_factor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	unsigned int sample_mask = 0xffffffff;
+	unsigned int stencil_ref = 0;
+};
+
+/// <summary>
+/// Largest resource id in a command stream. Backends index their resources by
+/// id, so CommandStreamReader rejects creating a larger one.
+/// </summary>
+constexpr unsigned int max_command_resource_id = (1u << 20) - 1;
+
+/**
+ * @interface ICommandBackend
+ * @brief Receives the commands of a command stream, one call per command.
+ *
+ * The command set mirrors what DeviceContext and the buffer, shader and
+ * pipeline state classes do, with every resource named by an id instead of a
+ * pointer; id 0 means none and ids go up to max_command_resource_id. Creating
+ * an id that exists replaces the resource.
+ * CommandStreamWriter implements the interface to record, and
+ * CommandStreamReader::replay() drives any implementation: NullCommandBackend
+ * to measure decoding and validate a stream, D3D11CommandBackend to measure
+ * the driver.
+ */
+class ICommandBackend
+{
+public:
+
+	/*--------------------------------------------------------------
+		Destructor
+	--------------------------------------------------------------*/
+
+	virtual ~ICommandBackend() = default;
+
+	/*--------------------------------------------------------------
+		Resources
+	--------------------------------------------------------------*/
+
+	/// <param name="f_data">f_byte_size bytes of initial contents, or nullptr.</param>
+	virtual void createBuffer(unsigned int f_id, CommandBufferKind f_kind, unsigned int f_stride, unsigned int f_byte_size, const void* f_data) = 0;
+	virtual void updateBuffer(unsigned int f_id, unsigned int f_byte_offset, const void* f_data, unsigned int f_size) = 0;
+	virtual void createShader(unsigned int f_id, CommandShaderStage f_stage, const void* f_byte_code, unsigned int f_size) = 0;
+	virtual void createInputLayout(unsigned int f_id, const CommandInputElement* f_elements, unsigned int f_element_count,
+		const void* f_byte_code, unsigned int f_size) = 0;
+	virtual void createPipeline(unsigned int f_id, const CommandPipelineDesc& f_desc) = 0;
+	virtual void releaseResource(unsigned int f_id) = 0;
+
+	/*--------------------------------------------------------------
+		Context
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Binds buffer i to input slot i at offset 0.
+	/// </summary>
+	virtual void setVertexBuffers(const unsigned int* f_ids, const unsigned int* f_strides, unsigned int f_count) = 0;
+	virtual void setIndexBuffer(unsigned int f_id) = 0;
+	virtual void setShader(CommandShaderStage f_stage, unsigned int f_id) = 0;
+
+	/// <summary>
+	/// Binds a pipeline created by createPipeline(); 0 unbinds the shaders and resets the fixed function state.
+	/// </summary>
+	virtual void setPipeline(unsigned int f_id) = 0;
+	virtual void setConstantBuffer(CommandShaderStage f_stage, unsigned int f_slot, unsigned int f_id) = 0;
+	virtual void setViewport(unsigned int f_width, unsigned int f_height) = 0;
+	virtual void clear(const float f_color[4]) = 0;
+	virtual void draw(unsigned int f_topology, unsigned int f_vertex_count, unsigned int f_start_vertex) = 0;
+	virtual void drawIndexed(unsigned int f_topology, unsigned int f_index_count, unsigned int f_start_index, unsigned int f_base_vertex) = 0;
+
+	/// <summary>
+	/// The frame was presented.
+	/// </summary>
+	virtual void endFrame() = 0;
+};
+
+#endif // !_ICOMMAND_BACKEND_HPP_
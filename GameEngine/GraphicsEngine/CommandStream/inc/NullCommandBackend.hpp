@@ -0,0 +1,181 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Recorded rendering commands
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Replay captured frames against any rendering backend.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the NullCommandBackend class.
+/// @par Revision History:
+///      $Source: NullCommandBackend.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _NULL_COMMAND_BACKEND_HPP_
+#define _NULL_COMMAND_BACKEND_HPP_
+
+#include "ICommandBackend.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * @class NullCommandBackend
+ * @brief Backend that draws nothing but checks every command against the resources it tracks.
+ *
+ * Replaying into it measures the cost of decoding and dispatching a stream,
+ * the floor under any real backend, and validates the stream: references to
+ * unknown or released resources, draws without shaders or buffers and
+ * vertex, index or update ranges outside their buffer are counted as errors.
+ * Buffer contents are not kept.
+ *
+ * Example usage:
+ * @code
+ * NullCommandBackend backend;
+ * reader.replay(&backend, 1);
+ * if (backend.getStatistics().errors) std::cout << backend.getFirstError() << "\n";
+ * @endcode
+ */
+class NullCommandBackend : public ICommandBackend
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	struct Statistics
+	{
+		unsigned long long draws = 0;
+		unsigned long long primitives_vertices = 0;   // Vertices or indices drawn
+		unsigned long long state_changes = 0;         // set* commands
+		unsigned long long uploaded_bytes = 0;        // Initial contents and updates
+		unsigned int created_resources = 0;
+		unsigned int released_resources = 0;
+		unsigned int frames = 0;
+		unsigned int errors = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	NullCommandBackend();
+	~NullCommandBackend();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Description of the first error, empty if there was none.
+	/// </summary>
+	const std::string& getFirstError() const { return m_first_error; }
+
+	/*--------------------------------------------------------------
+		ICommandBackend
+	--------------------------------------------------------------*/
+
+	void createBuffer(unsigned int f_id, CommandBufferKind f_kind, unsigned int f_stride, unsigned int f_byte_size, const void* f_data) override;
+	void updateBuffer(unsigned int f_id, unsigned int f_byte_offset, const void* f_data, unsigned int f_size) override;
+	void createShader(unsigned int f_id, CommandShaderStage f_stage, const void* f_byte_code, unsigned int f_size) override;
+	void createInputLayout(unsigned int f_id, const CommandInputElement* f_elements, unsigned int f_element_count,
+		const void* f_byte_code, unsigned int f_size) override;
+	void createPipeline(unsigned int f_id, const CommandPipelineDesc& f_desc) override;
+	void releaseResource(unsigned int f_id) override;
+	void setVertexBuffers(const unsigned int* f_ids, const unsigned int* f_strides, unsigned int f_count) override;
+	void setIndexBuffer(unsigned int f_id) override;
+	void setShader(CommandShaderStage f_stage, unsigned int f_id) override;
+	void setPipeline(unsigned int f_id) override;
+	void setConstantBuffer(CommandShaderStage f_stage, unsigned int f_slot, unsigned int f_id) override;
+	void setViewport(unsigned int f_width, unsigned int f_height) override;
+	void clear(const float f_color[4]) override;
+	void draw(unsigned int f_topology, unsigned int f_vertex_count, unsigned int f_start_vertex) override;
+	void drawIndexed(unsigned int f_topology, unsigned int f_index_count, unsigned int f_start_index, unsigned int f_base_vertex) override;
+	void endFrame() override;
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	enum class ResourceType : unsigned char
+	{
+		None,
+		Buffer,
+		VertexShader,
+		PixelShader,
+		InputLayout,
+		Pipeline
+	};
+
+	struct Resource
+	{
+		ResourceType type = ResourceType::None;
+		CommandBufferKind kind = CommandBufferKind::Vertex;
+		unsigned int byte_size = 0;
+		unsigned int vertex_shader = 0;  // Of a pipeline
+		unsigned int pixel_shader = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	Resource& create(unsigned int f_id, ResourceType f_type);
+
+	/// <summary>
+	/// True if f_id is 0 or a live resource of the type; counts an error otherwise.
+	/// </summary>
+	bool check(unsigned int f_id, ResourceType f_type, const char* f_command);
+
+	/// <summary>
+	/// True if f_id is a live buffer of the kind; counts an error otherwise.
+	/// </summary>
+	bool checkBuffer(unsigned int f_id, CommandBufferKind f_kind, const char* f_command);
+
+	void error(const char* f_command, const char* f_problem, unsigned int f_id);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<Resource> m_resources;
+	unsigned int m_vertex_buffer;
+	unsigned int m_vertex_stride;
+	unsigned int m_index_buffer;
+	unsigned int m_vertex_shader;
+	unsigned int m_pixel_shader;
+	Statistics m_statistics;
+	std::string m_first_error;
+};
+
+#endif // !_NULL_COMMAND_BACKEND_HPP_
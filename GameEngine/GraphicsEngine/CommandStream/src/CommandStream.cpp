@@ -0,0 +1,662 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Recorded rendering commands
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Replay captured frames against any rendering backend.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements CommandStreamWriter and CommandStreamReader.
+/// @par Revision History:
+///      $Source: CommandStream.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "CommandStream.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+	constexpr unsigned char stream_magic[4] = { 'D', '3', 'C', 'S' };
+	constexpr unsigned int stream_version = 1;
+	constexpr size_t header_size = 16;
+	constexpr size_t flush_size = 4 << 20;
+	constexpr unsigned int max_vertex_buffers = 32;
+
+	void putU32(unsigned char* f_bytes, unsigned int f_value)
+	{
+		for (int i = 0; i < 4; ++i) f_bytes[i] = static_cast<unsigned char>(f_value >> (8 * i));
+	}
+
+	unsigned int getU32(const unsigned char* f_bytes)
+	{
+		return f_bytes[0] | (f_bytes[1] << 8) | (f_bytes[2] << 16) | (static_cast<unsigned int>(f_bytes[3]) << 24);
+	}
+
+	/// <summary>
+	/// Decodes operands; running past the end sets m_failed and yields zeros, checked once per command.
+	/// </summary>
+	class Cursor
+	{
+	public:
+		Cursor(const unsigned char* f_begin, const unsigned char* f_end) : m_position(f_begin), m_end(f_end), m_failed(false) {}
+
+		bool atEnd() const { return m_position >= m_end; }
+		bool failed() const { return m_failed; }
+		const unsigned char* getPosition() const { return m_position; }
+
+		unsigned char readByte()
+		{
+			if (m_position >= m_end)
+			{
+				m_failed = true;
+				return 0;
+			}
+			return *m_position++;
+		}
+
+		unsigned int readUInt()
+		{
+			unsigned int value = 0;
+			for (unsigned int shift = 0; shift < 35; shift += 7)
+			{
+				const unsigned char byte = readByte();
+				value |= static_cast<unsigned int>(byte & 0x7f) << shift;
+				if (!(byte & 0x80))
+				{
+					return value;
+				}
+			}
+			m_failed = true;
+			return 0;
+		}
+
+		float readFloat()
+		{
+			if (m_end - m_position < 4)
+			{
+				m_failed = true;
+				return 0.0f;
+			}
+			const unsigned int bits = getU32(m_position);
+			m_position += 4;
+			float value;
+			std::memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+
+		const unsigned char* readBlob(unsigned int* f_size)
+		{
+			*f_size = readUInt();
+			if (m_failed || static_cast<size_t>(m_end - m_position) < *f_size)
+			{
+				m_failed = true;
+				*f_size = 0;
+				return nullptr;
+			}
+			const unsigned char* data = m_position;
+			m_position += *f_size;
+			return *f_size ? data : nullptr;
+		}
+
+	private:
+		const unsigned char* m_position;
+		const unsigned char* m_end;
+		bool m_failed;
+	};
+}
+
+/*--------------------------------------------------------------
+	CommandStreamWriter
+--------------------------------------------------------------*/
+
+CommandStreamWriter::CommandStreamWriter() : m_bytes_written(0), m_frame_count(0), m_setup_size(0), m_failed(false)
+{
+}
+
+bool CommandStreamWriter::open(const char* f_file_name)
+{
+	close();
+	m_stream.open(f_file_name, std::ios::binary | std::ios::trunc);
+	if (!m_stream)
+	{
+		return false;
+	}
+
+	m_buffer.clear();
+	m_buffer.reserve(flush_size + (1 << 16));
+	m_buffer.resize(header_size);
+	m_bytes_written = 0;
+	m_frame_count = 0;
+	m_setup_size = 0;
+	m_failed = false;
+	return true;
+}
+
+void CommandStreamWriter::beginFrames()
+{
+	m_setup_size = static_cast<unsigned int>(getBytesWritten() - header_size);
+}
+
+bool CommandStreamWriter::close()
+{
+	if (!m_stream.is_open())
+	{
+		return false;
+	}
+
+	flush(true);
+	unsigned char header[header_size];
+	std::memcpy(header, stream_magic, 4);
+	putU32(header + 4, stream_version);
+	putU32(header + 8, m_frame_count);
+	putU32(header + 12, m_setup_size);
+	m_stream.seekp(0);
+	m_stream.write(reinterpret_cast<const char*>(header), header_size);
+	m_failed = m_failed || !m_stream;
+	m_stream.close();
+	return !m_failed;
+}
+
+void CommandStreamWriter::flush(bool f_force)
+{
+	if (m_buffer.empty() || (!f_force && m_buffer.size() < flush_size))
+	{
+		return;
+	}
+	m_stream.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+	m_failed = m_failed || !m_stream;
+	m_bytes_written += m_buffer.size();
+	m_buffer.clear();
+}
+
+void CommandStreamWriter::writeUInt(unsigned int f_value)
+{
+	while (f_value >= 0x80)
+	{
+		m_buffer.push_back(static_cast<unsigned char>(f_value | 0x80));
+		f_value >>= 7;
+	}
+	m_buffer.push_back(static_cast<unsigned char>(f_value));
+}
+
+void CommandStreamWriter::writeFloat(float f_value)
+{
+	unsigned int bits;
+	std::memcpy(&bits, &f_value, sizeof(bits));
+	unsigned char bytes[4];
+	putU32(bytes, bits);
+	m_buffer.insert(m_buffer.end(), bytes, bytes + 4);
+}
+
+void CommandStreamWriter::writeBlob(const void* f_data, unsigned int f_size)
+{
+	if (!f_data) f_size = 0;
+	writeUInt(f_size);
+	const unsigned char* bytes = static_cast<const unsigned char*>(f_data);
+	m_buffer.insert(m_buffer.end(), bytes, bytes + f_size);
+}
+
+void CommandStreamWriter::createBuffer(unsigned int f_id, CommandBufferKind f_kind, unsigned int f_stride, unsigned int f_byte_size, const void* f_data)
+{
+	writeType(CommandType::CreateBuffer);
+	writeUInt(f_id);
+	m_buffer.push_back(static_cast<unsigned char>(f_kind));
+	writeUInt(f_stride);
+	writeUInt(f_byte_size);
+	writeBlob(f_data, f_byte_size);
+	flush(false);
+}
+
+void CommandStreamWriter::updateBuffer(unsigned int f_id, unsigned int f_byte_offset, const void* f_data, unsigned int f_size)
+{
+	writeType(CommandType::UpdateBuffer);
+	writeUInt(f_id);
+	writeUInt(f_byte_offset);
+	writeBlob(f_data, f_size);
+	flush(false);
+}
+
+void CommandStreamWriter::createShader(unsigned int f_id, CommandShaderStage f_stage, const void* f_byte_code, unsigned int f_size)
+{
+	writeType(CommandType::CreateShader);
+	writeUInt(f_id);
+	m_buffer.push_back(static_cast<unsigned char>(f_stage));
+	writeBlob(f_byte_code, f_size);
+	flush(false);
+}
+
+void CommandStreamWriter::createInputLayout(unsigned int f_id, const CommandInputElement* f_elements, unsigned int f_element_count,
+	const void* f_byte_code, unsigned int f_size)
+{
+	writeType(CommandType::CreateInputLayout);
+	writeUInt(f_id);
+	writeUInt(f_element_count);
+	for (unsigned int i = 0; i < f_element_count; ++i)
+	{
+		const CommandInputElement& element = f_elements[i];
+		// Stored with its terminator so the reader can hand out the name in place
+		writeBlob(element.semantic_name, static_cast<unsigned int>(std::strlen(element.semantic_name) + 1));
+		writeUInt(element.semantic_index);
+		writeUInt(element.format);
+		writeUInt(element.input_slot);
+		writeUInt(element.aligned_byte_offset);
+		writeUInt(element.per_instance);
+		writeUInt(element.instance_step_rate);
+	}
+	writeBlob(f_byte_code, f_size);
+	flush(false);
+}
+
+void CommandStreamWriter::createPipeline(unsigned int f_id, const CommandPipelineDesc& f_desc)
+{
+	writeType(CommandType::CreatePipeline);
+	writeUInt(f_id);
+	writeUInt(f_desc.vertex_shader);
+	writeUInt(f_desc.pixel_shader);
+	writeUInt(f_desc.input_layout);
+	writeUInt(f_desc.topology);
+	writeBlob(f_desc.rasterizer, f_desc.rasterizer_size);
+	writeBlob(f_desc.blend, f_desc.blend_size);
+	writeBlob(f_desc.depth_stencil, f_desc.depth_stencil_size);
+	for (float factor : f_desc.blend_factor)
+	{
+		writeFloat(factor);
+	}
+	writeUInt(f_desc.sample_mask);
+	writeUInt(f_desc.stencil_ref);
+}
+
+void CommandStreamWriter::releaseResource(unsigned int f_id)
+{
+	writeType(CommandType::ReleaseResource);
+	writeUInt(f_id);
+}
+
+void CommandStreamWriter::setVertexBuffers(const unsigned int* f_ids, const unsigned int* f_strides, unsigned int f_count)
+{
+	f_count = std::min(f_count, max_vertex_buffers);
+	writeType(CommandType::SetVertexBuffers);
+	writeUInt(f_count);
+	for (unsigned int i = 0; i < f_count; ++i)
+	{
+		writeUInt(f_ids[i]);
+		writeUInt(f_strides[i]);
+	}
+}
+
+void CommandStreamWriter::setIndexBuffer(unsigned int f_id)
+{
+	writeType(CommandType::SetIndexBuffer);
+	writeUInt(f_id);
+}
+
+void CommandStreamWriter::setShader(CommandShaderStage f_stage, unsigned int f_id)
+{
+	writeType(CommandType::SetShader);
+	m_buffer.push_back(static_cast<unsigned char>(f_stage));
+	writeUInt(f_id);
+}
+
+void CommandStreamWriter::setPipeline(unsigned int f_id)
+{
+	writeType(CommandType::SetPipeline);
+	writeUInt(f_id);
+}
+
+void CommandStreamWriter::setConstantBuffer(CommandShaderStage f_stage, unsigned int f_slot, unsigned int f_id)
+{
+	writeType(CommandType::SetConstantBuffer);
+	m_buffer.push_back(static_cast<unsigned char>(f_stage));
+	writeUInt(f_slot);
+	writeUInt(f_id);
+}
+
+void CommandStreamWriter::setViewport(unsigned int f_width, unsigned int f_height)
+{
+	writeType(CommandType::SetViewport);
+	writeUInt(f_width);
+	writeUInt(f_height);
+}
+
+void CommandStreamWriter::clear(const float f_color[4])
+{
+	writeType(CommandType::Clear);
+	for (int i = 0; i < 4; ++i)
+	{
+		writeFloat(f_color[i]);
+	}
+}
+
+void CommandStreamWriter::draw(unsigned int f_topology, unsigned int f_vertex_count, unsigned int f_start_vertex)
+{
+	writeType(CommandType::Draw);
+	writeUInt(f_topology);
+	writeUInt(f_vertex_count);
+	writeUInt(f_start_vertex);
+}
+
+void CommandStreamWriter::drawIndexed(unsigned int f_topology, unsigned int f_index_count, unsigned int f_start_index, unsigned int f_base_vertex)
+{
+	writeType(CommandType::DrawIndexed);
+	writeUInt(f_topology);
+	writeUInt(f_index_count);
+	writeUInt(f_start_index);
+	writeUInt(f_base_vertex);
+}
+
+void CommandStreamWriter::endFrame()
+{
+	writeType(CommandType::EndFrame);
+	m_frame_count++;
+	flush(false);
+}
+
+CommandStreamWriter::~CommandStreamWriter()
+{
+	close();
+}
+
+/*--------------------------------------------------------------
+	CommandStreamReader
+--------------------------------------------------------------*/
+
+CommandStreamReader::CommandStreamReader() : m_frame_count(0), m_setup_size(0)
+{
+}
+
+bool CommandStreamReader::loadFile(const char* f_file_name)
+{
+	std::ifstream file(f_file_name, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		return false;
+	}
+
+	const std::streamsize size = file.tellg();
+	file.seekg(0, std::ios::beg);
+	std::vector<unsigned char> contents(static_cast<size_t>(size));
+	if (!file.read(reinterpret_cast<char*>(contents.data()), size))
+	{
+		return false;
+	}
+	return load(contents.data(), contents.size());
+}
+
+bool CommandStreamReader::load(const unsigned char* f_data, size_t f_size)
+{
+	m_data.clear();
+	m_frame_count = 0;
+	m_setup_size = 0;
+	if (!f_data || f_size < header_size || std::memcmp(f_data, stream_magic, 4) != 0 || getU32(f_data + 4) != stream_version)
+	{
+		return false;
+	}
+
+	const size_t setup_size = getU32(f_data + 12);
+	if (setup_size > f_size - header_size)
+	{
+		return false;
+	}
+	m_data.assign(f_data, f_data + f_size);
+	m_frame_count = getU32(f_data + 8);
+	m_setup_size = setup_size;
+	return true;
+}
+
+bool CommandStreamReader::replay(ICommandBackend* f_backend, unsigned int f_loops)
+{
+	m_statistics = Statistics();
+	if (m_data.empty() || !f_backend)
+	{
+		return false;
+	}
+
+	const size_t frames_begin = header_size + m_setup_size;
+	const auto start = std::chrono::steady_clock::now();
+	if (!replayRange(f_backend, header_size, frames_begin))
+	{
+		return false;
+	}
+	m_statistics.setup_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	for (unsigned int loop = 0; loop < f_loops; ++loop)
+	{
+		if (!replayRange(f_backend, frames_begin, m_data.size()))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CommandStreamReader::replayRange(ICommandBackend* f_backend, size_t f_begin, size_t f_end)
+{
+	Cursor cursor(m_data.data() + f_begin, m_data.data() + f_end);
+	auto frame_start = std::chrono::steady_clock::now();
+	while (!cursor.atEnd())
+	{
+		const CommandType type = static_cast<CommandType>(cursor.readByte());
+		switch (type)
+		{
+		case CommandType::CreateBuffer:
+		{
+			const unsigned int id = cursor.readUInt();
+			const CommandBufferKind kind = static_cast<CommandBufferKind>(cursor.readByte());
+			const unsigned int stride = cursor.readUInt();
+			const unsigned int byte_size = cursor.readUInt();
+			unsigned int size = 0;
+			const unsigned char* data = cursor.readBlob(&size);
+			if (cursor.failed() || id > max_command_resource_id || (data && size != byte_size)) return false;
+			f_backend->createBuffer(id, kind, stride, byte_size, data);
+			break;
+		}
+		case CommandType::UpdateBuffer:
+		{
+			const unsigned int id = cursor.readUInt();
+			const unsigned int offset = cursor.readUInt();
+			unsigned int size = 0;
+			const unsigned char* data = cursor.readBlob(&size);
+			if (cursor.failed()) return false;
+			f_backend->updateBuffer(id, offset, data, size);
+			break;
+		}
+		case CommandType::CreateShader:
+		{
+			const unsigned int id = cursor.readUInt();
+			const CommandShaderStage stage = static_cast<CommandShaderStage>(cursor.readByte());
+			unsigned int size = 0;
+			const unsigned char* byte_code = cursor.readBlob(&size);
+			if (cursor.failed() || id > max_command_resource_id) return false;
+			f_backend->createShader(id, stage, byte_code, size);
+			break;
+		}
+		case CommandType::CreateInputLayout:
+		{
+			const unsigned int id = cursor.readUInt();
+			const unsigned int count = cursor.readUInt();
+			if (cursor.failed() || id > max_command_resource_id || count > 64) return false;
+			m_elements.resize(count);
+			for (CommandInputElement& element : m_elements)
+			{
+				unsigned int name_size = 0;
+				const unsigned char* name = cursor.readBlob(&name_size);
+				if (cursor.failed() || name_size == 0 || name[name_size - 1] != 0) return false;
+				element.semantic_name = reinterpret_cast<const char*>(name);
+				element.semantic_index = cursor.readUInt();
+				element.format = cursor.readUInt();
+				element.input_slot = cursor.readUInt();
+				element.aligned_byte_offset = cursor.readUInt();
+				element.per_instance = cursor.readUInt();
+				element.instance_step_rate = cursor.readUInt();
+			}
+			unsigned int size = 0;
+			const unsigned char* byte_code = cursor.readBlob(&size);
+			if (cursor.failed()) return false;
+			f_backend->createInputLayout(id, m_elements.data(), count, byte_code, size);
+			break;
+		}
+		case CommandType::CreatePipeline:
+		{
+			const unsigned int id = cursor.readUInt();
+			CommandPipelineDesc desc;
+			desc.vertex_shader = cursor.readUInt();
+			desc.pixel_shader = cursor.readUInt();
+			desc.input_layout = cursor.readUInt();
+			desc.topology = cursor.readUInt();
+			desc.rasterizer = cursor.readBlob(&desc.rasterizer_size);
+			desc.blend = cursor.readBlob(&desc.blend_size);
+			desc.depth_stencil = cursor.readBlob(&desc.depth_stencil_size);
+			for (float& factor : desc.blend_factor)
+			{
+				factor = cursor.readFloat();
+			}
+			desc.sample_mask = cursor.readUInt();
+			desc.stencil_ref = cursor.readUInt();
+			if (cursor.failed() || id > max_command_resource_id) return false;
+			f_backend->createPipeline(id, desc);
+			break;
+		}
+		case CommandType::ReleaseResource:
+		{
+			const unsigned int id = cursor.readUInt();
+			if (cursor.failed()) return false;
+			f_backend->releaseResource(id);
+			break;
+		}
+		case CommandType::SetVertexBuffers:
+		{
+			const unsigned int count = cursor.readUInt();
+			if (cursor.failed() || count > max_vertex_buffers) return false;
+			m_ids.resize(count);
+			m_strides.resize(count);
+			for (unsigned int i = 0; i < count; ++i)
+			{
+				m_ids[i] = cursor.readUInt();
+				m_strides[i] = cursor.readUInt();
+			}
+			if (cursor.failed()) return false;
+			f_backend->setVertexBuffers(m_ids.data(), m_strides.data(), count);
+			break;
+		}
+		case CommandType::SetIndexBuffer:
+		{
+			const unsigned int id = cursor.readUInt();
+			if (cursor.failed()) return false;
+			f_backend->setIndexBuffer(id);
+			break;
+		}
+		case CommandType::SetShader:
+		{
+			const CommandShaderStage stage = static_cast<CommandShaderStage>(cursor.readByte());
+			const unsigned int id = cursor.readUInt();
+			if (cursor.failed()) return false;
+			f_backend->setShader(stage, id);
+			break;
+		}
+		case CommandType::SetPipeline:
+		{
+			const unsigned int id = cursor.readUInt();
+			if (cursor.failed()) return false;
+			f_backend->setPipeline(id);
+			break;
+		}
+		case CommandType::SetConstantBuffer:
+		{
+			const CommandShaderStage stage = static_cast<CommandShaderStage>(cursor.readByte());
+			const unsigned int slot = cursor.readUInt();
+			const unsigned int id = cursor.readUInt();
+			if (cursor.failed()) return false;
+			f_backend->setConstantBuffer(stage, slot, id);
+			break;
+		}
+		case CommandType::SetViewport:
+		{
+			const unsigned int width = cursor.readUInt();
+			const unsigned int height = cursor.readUInt();
+			if (cursor.failed()) return false;
+			f_backend->setViewport(width, height);
+			break;
+		}
+		case CommandType::Clear:
+		{
+			float color[4];
+			for (float& channel : color)
+			{
+				channel = cursor.readFloat();
+			}
+			if (cursor.failed()) return false;
+			f_backend->clear(color);
+			break;
+		}
+		case CommandType::Draw:
+		{
+			const unsigned int topology = cursor.readUInt();
+			const unsigned int vertex_count = cursor.readUInt();
+			const unsigned int start_vertex = cursor.readUInt();
+			if (cursor.failed()) return false;
+			f_backend->draw(topology, vertex_count, start_vertex);
+			m_statistics.draws++;
+			break;
+		}
+		case CommandType::DrawIndexed:
+		{
+			const unsigned int topology = cursor.readUInt();
+			const unsigned int index_count = cursor.readUInt();
+			const unsigned int start_index = cursor.readUInt();
+			const unsigned int base_vertex = cursor.readUInt();
+			if (cursor.failed()) return false;
+			f_backend->drawIndexed(topology, index_count, start_index, base_vertex);
+			m_statistics.draws++;
+			break;
+		}
+		case CommandType::EndFrame:
+		{
+			f_backend->endFrame();
+			const auto now = std::chrono::steady_clock::now();
+			const double frame_ms = std::chrono::duration<double, std::milli>(now - frame_start).count();
+			frame_start = now;
+			m_statistics.min_frame_ms = m_statistics.frames ? std::min(m_statistics.min_frame_ms, frame_ms) : frame_ms;
+			m_statistics.max_frame_ms = std::max(m_statistics.max_frame_ms, frame_ms);
+			m_statistics.replay_ms += frame_ms;
+			m_statistics.frames++;
+			break;
+		}
+		default:
+			return false;
+		}
+		m_statistics.commands++;
+	}
+	return true;
+}
+
+CommandStreamReader::~CommandStreamReader()
+{
+}
@@ -0,0 +1,255 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Recorded rendering commands
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Replay captured frames against any rendering backend.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the NullCommandBackend class.
+/// @par Revision History:
+///      $Source: NullCommandBackend.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "NullCommandBackend.hpp"
+
+NullCommandBackend::NullCommandBackend()
+	: m_vertex_buffer(0), m_vertex_stride(0), m_index_buffer(0), m_vertex_shader(0), m_pixel_shader(0)
+{
+}
+
+NullCommandBackend::Resource& NullCommandBackend::create(unsigned int f_id, ResourceType f_type)
+{
+	if (f_id >= m_resources.size())
+	{
+		m_resources.resize(f_id + 1);
+	}
+	m_resources[f_id] = Resource();
+	m_resources[f_id].type = f_type;
+	m_statistics.created_resources++;
+	return m_resources[f_id];
+}
+
+bool NullCommandBackend::check(unsigned int f_id, ResourceType f_type, const char* f_command)
+{
+	if (f_id != 0 && (f_id >= m_resources.size() || m_resources[f_id].type != f_type))
+	{
+		error(f_command, "unknown or released resource", f_id);
+		return false;
+	}
+	return true;
+}
+
+bool NullCommandBackend::checkBuffer(unsigned int f_id, CommandBufferKind f_kind, const char* f_command)
+{
+	if (f_id == 0 || !check(f_id, ResourceType::Buffer, f_command))
+	{
+		if (f_id == 0) error(f_command, "no buffer", f_id);
+		return false;
+	}
+	const CommandBufferKind kind = m_resources[f_id].kind;
+	const bool vertex = kind == CommandBufferKind::Vertex || kind == CommandBufferKind::DynamicVertex;
+	if (f_kind == CommandBufferKind::Vertex ? !vertex : kind != f_kind)
+	{
+		error(f_command, "buffer of the wrong kind", f_id);
+		return false;
+	}
+	return true;
+}
+
+void NullCommandBackend::error(const char* f_command, const char* f_problem, unsigned int f_id)
+{
+	if (m_statistics.errors++ == 0)
+	{
+		m_first_error = std::string(f_command) + ": " + f_problem + " (id " + std::to_string(f_id) + ", frame " + std::to_string(m_statistics.frames) + ")";
+	}
+}
+
+void NullCommandBackend::createBuffer(unsigned int f_id, CommandBufferKind f_kind, unsigned int, unsigned int f_byte_size, const void* f_data)
+{
+	Resource& buffer = create(f_id, ResourceType::Buffer);
+	buffer.kind = f_kind;
+	buffer.byte_size = f_byte_size;
+	m_statistics.uploaded_bytes += f_data ? f_byte_size : 0;
+}
+
+void NullCommandBackend::updateBuffer(unsigned int f_id, unsigned int f_byte_offset, const void*, unsigned int f_size)
+{
+	if (f_id == 0 || !check(f_id, ResourceType::Buffer, "updateBuffer"))
+	{
+		if (f_id == 0) error("updateBuffer", "no buffer", f_id);
+		return;
+	}
+	if (f_byte_offset > m_resources[f_id].byte_size || f_size > m_resources[f_id].byte_size - f_byte_offset)
+	{
+		error("updateBuffer", "range outside the buffer", f_id);
+	}
+	m_statistics.uploaded_bytes += f_size;
+}
+
+void NullCommandBackend::createShader(unsigned int f_id, CommandShaderStage f_stage, const void*, unsigned int)
+{
+	create(f_id, f_stage == CommandShaderStage::Vertex ? ResourceType::VertexShader : ResourceType::PixelShader);
+}
+
+void NullCommandBackend::createInputLayout(unsigned int f_id, const CommandInputElement*, unsigned int, const void*, unsigned int)
+{
+	create(f_id, ResourceType::InputLayout);
+}
+
+void NullCommandBackend::createPipeline(unsigned int f_id, const CommandPipelineDesc& f_desc)
+{
+	check(f_desc.vertex_shader, ResourceType::VertexShader, "createPipeline");
+	check(f_desc.pixel_shader, ResourceType::PixelShader, "createPipeline");
+	check(f_desc.input_layout, ResourceType::InputLayout, "createPipeline");
+	Resource& pipeline = create(f_id, ResourceType::Pipeline);
+	pipeline.vertex_shader = f_desc.vertex_shader;
+	pipeline.pixel_shader = f_desc.pixel_shader;
+}
+
+void NullCommandBackend::releaseResource(unsigned int f_id)
+{
+	if (f_id == 0 || f_id >= m_resources.size() || m_resources[f_id].type == ResourceType::None)
+	{
+		error("releaseResource", "unknown or released resource", f_id);
+		return;
+	}
+	m_resources[f_id].type = ResourceType::None;
+	m_statistics.released_resources++;
+}
+
+void NullCommandBackend::setVertexBuffers(const unsigned int* f_ids, const unsigned int* f_strides, unsigned int f_count)
+{
+	for (unsigned int i = 0; i < f_count; ++i)
+	{
+		if (f_ids[i]) checkBuffer(f_ids[i], CommandBufferKind::Vertex, "setVertexBuffers");
+	}
+	// Draw ranges are checked against slot 0, the only stream every format has
+	m_vertex_buffer = f_count ? f_ids[0] : 0;
+	m_vertex_stride = f_count ? f_strides[0] : 0;
+	m_statistics.state_changes++;
+}
+
+void NullCommandBackend::setIndexBuffer(unsigned int f_id)
+{
+	if (f_id) checkBuffer(f_id, CommandBufferKind::Index, "setIndexBuffer");
+	m_index_buffer = f_id;
+	m_statistics.state_changes++;
+}
+
+void NullCommandBackend::setShader(CommandShaderStage f_stage, unsigned int f_id)
+{
+	if (f_stage == CommandShaderStage::Vertex)
+	{
+		check(f_id, ResourceType::VertexShader, "setShader");
+		m_vertex_shader = f_id;
+	}
+	else
+	{
+		check(f_id, ResourceType::PixelShader, "setShader");
+		m_pixel_shader = f_id;
+	}
+	m_statistics.state_changes++;
+}
+
+void NullCommandBackend::setPipeline(unsigned int f_id)
+{
+	if (check(f_id, ResourceType::Pipeline, "setPipeline"))
+	{
+		m_vertex_shader = f_id ? m_resources[f_id].vertex_shader : 0;
+		m_pixel_shader = f_id ? m_resources[f_id].pixel_shader : 0;
+	}
+	m_statistics.state_changes++;
+}
+
+void NullCommandBackend::setConstantBuffer(CommandShaderStage, unsigned int, unsigned int f_id)
+{
+	checkBuffer(f_id, CommandBufferKind::Constant, "setConstantBuffer");
+	m_statistics.state_changes++;
+}
+
+void NullCommandBackend::setViewport(unsigned int f_width, unsigned int f_height)
+{
+	if (f_width == 0 || f_height == 0)
+	{
+		error("setViewport", "empty viewport", 0);
+	}
+	m_statistics.state_changes++;
+}
+
+void NullCommandBackend::clear(const float*)
+{
+}
+
+void NullCommandBackend::draw(unsigned int, unsigned int f_vertex_count, unsigned int f_start_vertex)
+{
+	m_statistics.draws++;
+	m_statistics.primitives_vertices += f_vertex_count;
+	if (!m_vertex_shader || !m_pixel_shader)
+	{
+		error("draw", "no shader bound", 0);
+	}
+	if (!checkBuffer(m_vertex_buffer, CommandBufferKind::Vertex, "draw") || m_vertex_stride == 0)
+	{
+		return;
+	}
+	const unsigned long long vertices = m_resources[m_vertex_buffer].byte_size / m_vertex_stride;
+	if (static_cast<unsigned long long>(f_start_vertex) + f_vertex_count > vertices)
+	{
+		error("draw", "vertices outside the vertex buffer", m_vertex_buffer);
+	}
+}
+
+void NullCommandBackend::drawIndexed(unsigned int, unsigned int f_index_count, unsigned int f_start_index, unsigned int)
+{
+	m_statistics.draws++;
+	m_statistics.primitives_vertices += f_index_count;
+	if (!m_vertex_shader || !m_pixel_shader)
+	{
+		error("drawIndexed", "no shader bound", 0);
+	}
+	checkBuffer(m_vertex_buffer, CommandBufferKind::Vertex, "drawIndexed");
+	if (!checkBuffer(m_index_buffer, CommandBufferKind::Index, "drawIndexed"))
+	{
+		return;
+	}
+	if (static_cast<unsigned long long>(f_start_index) + f_index_count > m_resources[m_index_buffer].byte_size / 4)
+	{
+		error("drawIndexed", "indices outside the index buffer", m_index_buffer);
+	}
+}
+
+void NullCommandBackend::endFrame()
+{
+	m_statistics.frames++;
+}
+
+NullCommandBackend::~NullCommandBackend()
+{
+}
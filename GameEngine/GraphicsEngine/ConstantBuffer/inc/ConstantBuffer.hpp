@@ -16,6 +16,7 @@ public:
 	~ConstantBuffer();
 private:
 	ID3D11Buffer* m_buffer;
+	UINT m_size_buffer;
 	friend class DeviceContext;
 };
 
@@ -1,14 +1,18 @@
 #include "ConstantBuffer.hpp"
 #include "GraphicsEngine.hpp"
 #include "DeviceContext.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include "CommandRecorder.hpp"
 
-ConstantBuffer::ConstantBuffer() : m_buffer(0)
+ConstantBuffer::ConstantBuffer() : m_buffer(0), m_size_buffer(0)
 {
 }
 
 bool ConstantBuffer::load(void* buffer, UINT size_buffer, IGraphicsEngine* graphics_engine)
 {
-	if (m_buffer)m_buffer->Release();
+	// The GPU may still read the old buffer in a frame in flight
+	if (m_buffer) ResourceReleaseQueue::get()->deferRelease(m_buffer, m_size_buffer);
+	m_buffer = nullptr;
 
 	D3D11_BUFFER_DESC buff_desc = {};
 	buff_desc.Usage = D3D11_USAGE_DEFAULT;
@@ -20,24 +24,29 @@ bool ConstantBuffer::load(void* buffer, UINT size_buffer, IGraphicsEngine* graph
 	D3D11_SUBRESOURCE_DATA init_data = {};
 	init_data.pSysMem = buffer;
 
+	m_size_buffer = size_buffer;
+
 	if (FAILED(graphics_engine->getDevice()->CreateBuffer(&buff_desc, &init_data, &m_buffer)))
 	{
 		return false;
 	}
 
+	CommandRecorder::get()->onCreateBuffer(this, CommandBufferKind::Constant, 0, size_buffer, buffer);
 	return true;
 }
 
 void ConstantBuffer::update(DeviceContext* context, void* buffer)
 {
 	context->getDeviceContext()->UpdateSubresource(this->m_buffer, NULL, NULL, buffer, NULL, NULL);
+	CommandRecorder::get()->onUpdateBuffer(this, 0, buffer, m_size_buffer);
 }
 
 bool ConstantBuffer::release()
 {
 	if (m_buffer)
 	{
-		m_buffer->Release();
+		CommandRecorder::get()->onRelease(this);
+		ResourceReleaseQueue::get()->deferRelease(m_buffer, m_size_buffer);
 		delete this;
 	}
 	return true;
@@ -0,0 +1,195 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Replay of rendering commands on Direct3D 11
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure the driver cost of captured frames.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the D3D11CommandBackend class.
+/// @par Revision History:
+///      $Source: D3D11CommandBackend.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _D3D11_COMMAND_BACKEND_HPP_
+#define _D3D11_COMMAND_BACKEND_HPP_
+
+#include "ICommandBackend.hpp"
+#include <d3d11.h>
+#include <vector>
+
+/**
+ * @class D3D11CommandBackend
+ * @brief Replays a command stream on a Direct3D 11 device of its own, without a window.
+ *
+ * Frames are drawn into an offscreen render target sized by the recorded
+ * viewport. Pipeline binds only send the parts that differ from the bound
+ * pipeline, as DeviceContext does, so the driver sees the calls the engine
+ * made. Updates of dynamic buffers map with D3D11_MAP_WRITE_DISCARD when they
+ * start at offset 0 and with D3D11_MAP_WRITE_NO_OVERWRITE otherwise, which is
+ * how DynamicVertexBuffer fills its ring.
+ *
+ * The software device is WARP, the CPU rasterizer of Direct3D: it makes the
+ * replay independent of the GPU and its driver.
+ *
+ * Example usage:
+ * @code
+ * D3D11CommandBackend backend;
+ * if (backend.init(false, true)) reader.replay(&backend, 10);
+ * backend.finish();
+ * backend.release();
+ * @endcode
+ */
+class D3D11CommandBackend : public ICommandBackend
+{
+public:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	D3D11CommandBackend();
+	D3D11CommandBackend(const D3D11CommandBackend&) = delete;
+	D3D11CommandBackend& operator=(const D3D11CommandBackend&) = delete;
+	~D3D11CommandBackend();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Creates the device.
+	/// </summary>
+	/// <param name="f_software">Use WARP instead of the hardware device.</param>
+	/// <param name="f_wait_for_frames">Make endFrame() wait for the frame to complete, so frame times include the GPU.</param>
+	bool init(bool f_software, bool f_wait_for_frames);
+
+	/// <summary>
+	/// Waits until the device has executed every command submitted so far.
+	/// </summary>
+	void finish();
+
+	/// <summary>
+	/// Commands that could not be executed: failed creations, unknown ids, failed maps.
+	/// </summary>
+	unsigned int getFailureCount() const { return m_failures; }
+
+	void release();
+
+	/*--------------------------------------------------------------
+		ICommandBackend
+	--------------------------------------------------------------*/
+
+	void createBuffer(unsigned int f_id, CommandBufferKind f_kind, unsigned int f_stride, unsigned int f_byte_size, const void* f_data) override;
+	void updateBuffer(unsigned int f_id, unsigned int f_byte_offset, const void* f_data, unsigned int f_size) override;
+	void createShader(unsigned int f_id, CommandShaderStage f_stage, const void* f_byte_code, unsigned int f_size) override;
+	void createInputLayout(unsigned int f_id, const CommandInputElement* f_elements, unsigned int f_element_count,
+		const void* f_byte_code, unsigned int f_size) override;
+	void createPipeline(unsigned int f_id, const CommandPipelineDesc& f_desc) override;
+	void releaseResource(unsigned int f_id) override;
+	void setVertexBuffers(const unsigned int* f_ids, const unsigned int* f_strides, unsigned int f_count) override;
+	void setIndexBuffer(unsigned int f_id) override;
+	void setShader(CommandShaderStage f_stage, unsigned int f_id) override;
+	void setPipeline(unsigned int f_id) override;
+	void setConstantBuffer(CommandShaderStage f_stage, unsigned int f_slot, unsigned int f_id) override;
+	void setViewport(unsigned int f_width, unsigned int f_height) override;
+	void clear(const float f_color[4]) override;
+	void draw(unsigned int f_topology, unsigned int f_vertex_count, unsigned int f_start_vertex) override;
+	void drawIndexed(unsigned int f_topology, unsigned int f_index_count, unsigned int f_start_index, unsigned int f_base_vertex) override;
+	void endFrame() override;
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// One id; only the members of its kind are set.
+	/// </summary>
+	struct Resource
+	{
+		ID3D11Buffer* buffer = nullptr;
+		CommandBufferKind kind = CommandBufferKind::Vertex;
+		UINT byte_size = 0;
+		ID3D11VertexShader* vertex_shader = nullptr;
+		ID3D11PixelShader* pixel_shader = nullptr;
+		ID3D11InputLayout* input_layout = nullptr;
+		ID3D11RasterizerState* rasterizer_state = nullptr;
+		ID3D11BlendState* blend_state = nullptr;
+		ID3D11DepthStencilState* depth_stencil_state = nullptr;
+		CommandPipelineDesc pipeline;      // Ids only, the state pointers are not kept
+		bool is_pipeline = false;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// The resource of f_id after releasing what it held.
+	/// </summary>
+	Resource& replace(unsigned int f_id);
+
+	/// <summary>
+	/// The resource of f_id, nullptr for 0 or an unknown id.
+	/// </summary>
+	Resource* find(unsigned int f_id);
+
+	void releaseResource(Resource& f_resource);
+
+	/// <summary>
+	/// (Re)creates the render target and depth buffer when the viewport outgrows them.
+	/// </summary>
+	bool resizeTargets(UINT f_width, UINT f_height);
+
+	void setTopology(D3D11_PRIMITIVE_TOPOLOGY f_topology);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	ID3D11Device* m_device;
+	ID3D11DeviceContext* m_context;
+	ID3D11Query* m_fence;
+	ID3D11Texture2D* m_color;
+	ID3D11RenderTargetView* m_rtv;
+	ID3D11Texture2D* m_depth;
+	ID3D11DepthStencilView* m_dsv;
+	UINT m_target_width;
+	UINT m_target_height;
+	bool m_wait_for_frames;
+
+	std::vector<Resource> m_resources;
+	unsigned int m_bound_pipeline;
+	D3D11_PRIMITIVE_TOPOLOGY m_topology;
+	unsigned int m_failures;
+};
+
+#endif // !_D3D11_COMMAND_BACKEND_HPP_
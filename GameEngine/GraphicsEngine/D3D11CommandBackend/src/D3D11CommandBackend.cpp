@@ -0,0 +1,508 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Replay of rendering commands on Direct3D 11
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure the driver cost of captured frames.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the D3D11CommandBackend class.
+/// @par Revision History:
+///      $Source: D3D11CommandBackend.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/05 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "D3D11CommandBackend.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	template <typename T>
+	void releaseCom(T*& f_object)
+	{
+		if (f_object)
+		{
+			f_object->Release();
+			f_object = nullptr;
+		}
+	}
+}
+
+D3D11CommandBackend::D3D11CommandBackend()
+	: m_device(nullptr), m_context(nullptr), m_fence(nullptr), m_color(nullptr), m_rtv(nullptr), m_depth(nullptr), m_dsv(nullptr),
+	m_target_width(0), m_target_height(0), m_wait_for_frames(false), m_bound_pipeline(0),
+	m_topology(D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED), m_failures(0)
+{
+}
+
+bool D3D11CommandBackend::init(bool f_software, bool f_wait_for_frames)
+{
+	D3D_FEATURE_LEVEL feature_levels[] =
+	{
+		D3D_FEATURE_LEVEL_11_0
+	};
+
+	const D3D_DRIVER_TYPE driver_type = f_software ? D3D_DRIVER_TYPE_WARP : D3D_DRIVER_TYPE_HARDWARE;
+	if (FAILED(D3D11CreateDevice(NULL, driver_type, NULL, 0, feature_levels, ARRAYSIZE(feature_levels), D3D11_SDK_VERSION,
+		&m_device, nullptr, &m_context)))
+	{
+		return false;
+	}
+
+	D3D11_QUERY_DESC fence_desc = {};
+	fence_desc.Query = D3D11_QUERY_EVENT;
+	if (FAILED(m_device->CreateQuery(&fence_desc, &m_fence)))
+	{
+		return false;
+	}
+
+	m_wait_for_frames = f_wait_for_frames;
+	return resizeTargets(1280, 720);
+}
+
+bool D3D11CommandBackend::resizeTargets(UINT f_width, UINT f_height)
+{
+	if (f_width <= m_target_width && f_height <= m_target_height)
+	{
+		return true;
+	}
+	f_width = std::max(f_width, m_target_width);
+	f_height = std::max(f_height, m_target_height);
+
+	releaseCom(m_rtv);
+	releaseCom(m_color);
+	releaseCom(m_dsv);
+	releaseCom(m_depth);
+
+	D3D11_TEXTURE2D_DESC desc = {};
+	desc.Width = f_width;
+	desc.Height = f_height;
+	desc.MipLevels = 1;
+	desc.ArraySize = 1;
+	desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.BindFlags = D3D11_BIND_RENDER_TARGET;
+	if (FAILED(m_device->CreateTexture2D(&desc, nullptr, &m_color)) || FAILED(m_device->CreateRenderTargetView(m_color, nullptr, &m_rtv)))
+	{
+		return false;
+	}
+
+	desc.Format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+	desc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+	if (FAILED(m_device->CreateTexture2D(&desc, nullptr, &m_depth)) || FAILED(m_device->CreateDepthStencilView(m_depth, nullptr, &m_dsv)))
+	{
+		return false;
+	}
+
+	m_target_width = f_width;
+	m_target_height = f_height;
+	m_context->OMSetRenderTargets(1, &m_rtv, m_dsv);
+	return true;
+}
+
+/*--------------------------------------------------------------
+	Resources
+--------------------------------------------------------------*/
+
+D3D11CommandBackend::Resource& D3D11CommandBackend::replace(unsigned int f_id)
+{
+	if (f_id >= m_resources.size())
+	{
+		m_resources.resize(f_id + 1);
+	}
+	releaseResource(m_resources[f_id]);
+	return m_resources[f_id];
+}
+
+D3D11CommandBackend::Resource* D3D11CommandBackend::find(unsigned int f_id)
+{
+	return f_id != 0 && f_id < m_resources.size() ? &m_resources[f_id] : nullptr;
+}
+
+void D3D11CommandBackend::releaseResource(Resource& f_resource)
+{
+	releaseCom(f_resource.buffer);
+	releaseCom(f_resource.vertex_shader);
+	releaseCom(f_resource.pixel_shader);
+	releaseCom(f_resource.input_layout);
+	releaseCom(f_resource.rasterizer_state);
+	releaseCom(f_resource.blend_state);
+	releaseCom(f_resource.depth_stencil_state);
+	f_resource = Resource();
+}
+
+void D3D11CommandBackend::createBuffer(unsigned int f_id, CommandBufferKind f_kind, unsigned int, unsigned int f_byte_size, const void* f_data)
+{
+	Resource& resource = replace(f_id);
+	resource.kind = f_kind;
+	resource.byte_size = f_byte_size;
+
+	D3D11_BUFFER_DESC desc = {};
+	desc.ByteWidth = f_byte_size;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	switch (f_kind)
+	{
+	case CommandBufferKind::Vertex:
+		desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		break;
+	case CommandBufferKind::DynamicVertex:
+		desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		desc.Usage = D3D11_USAGE_DYNAMIC;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		break;
+	case CommandBufferKind::Index:
+		desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+		break;
+	case CommandBufferKind::Constant:
+		desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		break;
+	}
+
+	D3D11_SUBRESOURCE_DATA init_data = {};
+	init_data.pSysMem = f_data;
+	const bool initialize = f_data && f_kind != CommandBufferKind::DynamicVertex;
+	if (FAILED(m_device->CreateBuffer(&desc, initialize ? &init_data : nullptr, &resource.buffer)))
+	{
+		m_failures++;
+	}
+}
+
+void D3D11CommandBackend::updateBuffer(unsigned int f_id, unsigned int f_byte_offset, const void* f_data, unsigned int f_size)
+{
+	Resource* resource = find(f_id);
+	if (!resource || !resource->buffer || f_byte_offset > resource->byte_size || f_size > resource->byte_size - f_byte_offset)
+	{
+		m_failures++;
+		return;
+	}
+
+	if (resource->kind != CommandBufferKind::DynamicVertex)
+	{
+		D3D11_BOX box = { f_byte_offset, 0, 0, f_byte_offset + f_size, 1, 1 };
+		// Constant buffers can only be updated as a whole
+		m_context->UpdateSubresource(resource->buffer, 0, resource->kind == CommandBufferKind::Constant ? nullptr : &box, f_data, 0, 0);
+		return;
+	}
+
+	const D3D11_MAP map_type = f_byte_offset == 0 ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+	D3D11_MAPPED_SUBRESOURCE mapped = {};
+	if (FAILED(m_context->Map(resource->buffer, 0, map_type, 0, &mapped)))
+	{
+		m_failures++;
+		return;
+	}
+	std::memcpy(static_cast<unsigned char*>(mapped.pData) + f_byte_offset, f_data, f_size);
+	m_context->Unmap(resource->buffer, 0);
+}
+
+void D3D11CommandBackend::createShader(unsigned int f_id, CommandShaderStage f_stage, const void* f_byte_code, unsigned int f_size)
+{
+	Resource& resource = replace(f_id);
+	const HRESULT result = f_stage == CommandShaderStage::Vertex
+		? m_device->CreateVertexShader(f_byte_code, f_size, nullptr, &resource.vertex_shader)
+		: m_device->CreatePixelShader(f_byte_code, f_size, nullptr, &resource.pixel_shader);
+	if (FAILED(result))
+	{
+		m_failures++;
+	}
+}
+
+void D3D11CommandBackend::createInputLayout(unsigned int f_id, const CommandInputElement* f_elements, unsigned int f_element_count,
+	const void* f_byte_code, unsigned int f_size)
+{
+	Resource& resource = replace(f_id);
+
+	std::vector<D3D11_INPUT_ELEMENT_DESC> elements(f_element_count);
+	for (unsigned int i = 0; i < f_element_count; ++i)
+	{
+		elements[i].SemanticName = f_elements[i].semantic_name;
+		elements[i].SemanticIndex = f_elements[i].semantic_index;
+		elements[i].Format = static_cast<DXGI_FORMAT>(f_elements[i].format);
+		elements[i].InputSlot = f_elements[i].input_slot;
+		elements[i].AlignedByteOffset = f_elements[i].aligned_byte_offset;
+		elements[i].InputSlotClass = static_cast<D3D11_INPUT_CLASSIFICATION>(f_elements[i].per_instance);
+		elements[i].InstanceDataStepRate = f_elements[i].instance_step_rate;
+	}
+	if (FAILED(m_device->CreateInputLayout(elements.data(), f_element_count, f_byte_code, f_size, &resource.input_layout)))
+	{
+		m_failures++;
+	}
+}
+
+void D3D11CommandBackend::createPipeline(unsigned int f_id, const CommandPipelineDesc& f_desc)
+{
+	Resource& resource = replace(f_id);
+	resource.is_pipeline = true;
+	resource.pipeline = f_desc;
+	resource.pipeline.rasterizer = nullptr;
+	resource.pipeline.blend = nullptr;
+	resource.pipeline.depth_stencil = nullptr;
+
+	// The descriptions come from an unaligned stream, copy them out before use
+	D3D11_RASTERIZER_DESC rasterizer = {};
+	D3D11_BLEND_DESC blend = {};
+	D3D11_DEPTH_STENCIL_DESC depth_stencil = {};
+	if (f_desc.rasterizer_size != sizeof(rasterizer) || f_desc.blend_size != sizeof(blend) || f_desc.depth_stencil_size != sizeof(depth_stencil))
+	{
+		m_failures++;
+		return;
+	}
+	std::memcpy(&rasterizer, f_desc.rasterizer, sizeof(rasterizer));
+	std::memcpy(&blend, f_desc.blend, sizeof(blend));
+	std::memcpy(&depth_stencil, f_desc.depth_stencil, sizeof(depth_stencil));
+
+	if (FAILED(m_device->CreateRasterizerState(&rasterizer, &resource.rasterizer_state))
+		|| FAILED(m_device->CreateBlendState(&blend, &resource.blend_state))
+		|| FAILED(m_device->CreateDepthStencilState(&depth_stencil, &resource.depth_stencil_state)))
+	{
+		m_failures++;
+	}
+}
+
+void D3D11CommandBackend::releaseResource(unsigned int f_id)
+{
+	Resource* resource = find(f_id);
+	if (!resource)
+	{
+		m_failures++;
+		return;
+	}
+	if (f_id == m_bound_pipeline)
+	{
+		m_bound_pipeline = 0;
+	}
+	releaseResource(*resource);
+}
+
+/*--------------------------------------------------------------
+	Context
+--------------------------------------------------------------*/
+
+void D3D11CommandBackend::setVertexBuffers(const unsigned int* f_ids, const unsigned int* f_strides, unsigned int f_count)
+{
+	ID3D11Buffer* buffers[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	UINT strides[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	UINT offsets[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT] = {};
+	f_count = std::min<unsigned int>(f_count, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT);
+	for (unsigned int i = 0; i < f_count; ++i)
+	{
+		Resource* resource = find(f_ids[i]);
+		buffers[i] = resource ? resource->buffer : nullptr;
+		strides[i] = f_strides[i];
+	}
+	m_context->IASetVertexBuffers(0, f_count, buffers, strides, offsets);
+}
+
+void D3D11CommandBackend::setIndexBuffer(unsigned int f_id)
+{
+	Resource* resource = find(f_id);
+	m_context->IASetIndexBuffer(resource ? resource->buffer : nullptr, DXGI_FORMAT_R32_UINT, 0);
+}
+
+void D3D11CommandBackend::setShader(CommandShaderStage f_stage, unsigned int f_id)
+{
+	Resource* resource = find(f_id);
+	if (f_stage == CommandShaderStage::Vertex)
+	{
+		m_context->VSSetShader(resource ? resource->vertex_shader : nullptr, nullptr, 0);
+	}
+	else
+	{
+		m_context->PSSetShader(resource ? resource->pixel_shader : nullptr, nullptr, 0);
+	}
+	m_bound_pipeline = 0;
+}
+
+void D3D11CommandBackend::setPipeline(unsigned int f_id)
+{
+	if (f_id == 0)
+	{
+		if (m_bound_pipeline)
+		{
+			m_context->VSSetShader(nullptr, nullptr, 0);
+			m_context->PSSetShader(nullptr, nullptr, 0);
+			m_context->IASetInputLayout(nullptr);
+			m_context->RSSetState(nullptr);
+			m_context->OMSetBlendState(nullptr, nullptr, 0xffffffff);
+			m_context->OMSetDepthStencilState(nullptr, 0);
+			m_bound_pipeline = 0;
+		}
+		return;
+	}
+
+	Resource* resource = find(f_id);
+	if (!resource || !resource->is_pipeline)
+	{
+		m_failures++;
+		return;
+	}
+	if (f_id == m_bound_pipeline)
+	{
+		return;
+	}
+
+	const CommandPipelineDesc& desc = resource->pipeline;
+	const Resource* previous = find(m_bound_pipeline);
+	const CommandPipelineDesc* previous_desc = previous ? &previous->pipeline : nullptr;
+
+	if (!previous_desc || previous_desc->vertex_shader != desc.vertex_shader)
+	{
+		Resource* shader = find(desc.vertex_shader);
+		m_context->VSSetShader(shader ? shader->vertex_shader : nullptr, nullptr, 0);
+	}
+	if (!previous_desc || previous_desc->pixel_shader != desc.pixel_shader)
+	{
+		Resource* shader = find(desc.pixel_shader);
+		m_context->PSSetShader(shader ? shader->pixel_shader : nullptr, nullptr, 0);
+	}
+	if (!previous_desc || previous_desc->input_layout != desc.input_layout)
+	{
+		Resource* layout = find(desc.input_layout);
+		m_context->IASetInputLayout(layout ? layout->input_layout : nullptr);
+	}
+	if (!previous || previous->rasterizer_state != resource->rasterizer_state)
+	{
+		m_context->RSSetState(resource->rasterizer_state);
+	}
+	if (!previous || previous->blend_state != resource->blend_state
+		|| std::memcmp(previous_desc->blend_factor, desc.blend_factor, sizeof(desc.blend_factor)) != 0
+		|| previous_desc->sample_mask != desc.sample_mask)
+	{
+		m_context->OMSetBlendState(resource->blend_state, desc.blend_factor, desc.sample_mask);
+	}
+	if (!previous || previous->depth_stencil_state != resource->depth_stencil_state || previous_desc->stencil_ref != desc.stencil_ref)
+	{
+		m_context->OMSetDepthStencilState(resource->depth_stencil_state, desc.stencil_ref);
+	}
+	m_bound_pipeline = f_id;
+}
+
+void D3D11CommandBackend::setConstantBuffer(CommandShaderStage f_stage, unsigned int f_slot, unsigned int f_id)
+{
+	Resource* resource = find(f_id);
+	ID3D11Buffer* buffer = resource ? resource->buffer : nullptr;
+	if (f_stage == CommandShaderStage::Vertex)
+	{
+		m_context->VSSetConstantBuffers(f_slot, 1, &buffer);
+	}
+	else
+	{
+		m_context->PSSetConstantBuffers(f_slot, 1, &buffer);
+	}
+}
+
+void D3D11CommandBackend::setViewport(unsigned int f_width, unsigned int f_height)
+{
+	if (!resizeTargets(f_width, f_height))
+	{
+		m_failures++;
+	}
+
+	D3D11_VIEWPORT viewport = {};
+	viewport.Width = static_cast<FLOAT>(f_width);
+	viewport.Height = static_cast<FLOAT>(f_height);
+	viewport.MinDepth = 0;
+	viewport.MaxDepth = 1;
+	m_context->RSSetViewports(1, &viewport);
+}
+
+void D3D11CommandBackend::clear(const float f_color[4])
+{
+	m_context->ClearRenderTargetView(m_rtv, f_color);
+	m_context->ClearDepthStencilView(m_dsv, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+}
+
+void D3D11CommandBackend::setTopology(D3D11_PRIMITIVE_TOPOLOGY f_topology)
+{
+	if (m_topology != f_topology)
+	{
+		m_context->IASetPrimitiveTopology(f_topology);
+		m_topology = f_topology;
+	}
+}
+
+void D3D11CommandBackend::draw(unsigned int f_topology, unsigned int f_vertex_count, unsigned int f_start_vertex)
+{
+	setTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(f_topology));
+	m_context->Draw(f_vertex_count, f_start_vertex);
+}
+
+void D3D11CommandBackend::drawIndexed(unsigned int f_topology, unsigned int f_index_count, unsigned int f_start_index, unsigned int f_base_vertex)
+{
+	setTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(f_topology));
+	m_context->DrawIndexed(f_index_count, f_start_index, static_cast<INT>(f_base_vertex));
+}
+
+void D3D11CommandBackend::endFrame()
+{
+	// Stands in for Present, which also hands the queued commands to the driver
+	m_context->Flush();
+	if (m_wait_for_frames)
+	{
+		finish();
+	}
+}
+
+void D3D11CommandBackend::finish()
+{
+	if (!m_context || !m_fence)
+	{
+		return;
+	}
+	m_context->End(m_fence);
+	while (m_context->GetData(m_fence, nullptr, 0, 0) == S_FALSE)
+	{
+	}
+}
+
+void D3D11CommandBackend::release()
+{
+	for (Resource& resource : m_resources)
+	{
+		releaseResource(resource);
+	}
+	m_resources.clear();
+	m_bound_pipeline = 0;
+
+	releaseCom(m_rtv);
+	releaseCom(m_color);
+	releaseCom(m_dsv);
+	releaseCom(m_depth);
+	releaseCom(m_fence);
+	releaseCom(m_context);
+	releaseCom(m_device);
+	m_target_width = 0;
+	m_target_height = 0;
+}
+
+D3D11CommandBackend::~D3D11CommandBackend()
+{
+	release();
+}
@@ -0,0 +1,292 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Immediate-mode debug lines and text markers
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Visualize bounds, rays, axes and grids from any thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the DebugDraw class and its vertex and marker types.
+/// @par Revision History:
+///      $Source: DebugDraw.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _DEBUG_DRAW_HPP_
+#define _DEBUG_DRAW_HPP_
+
+#include "Vector3D.hpp"
+#include "Matrix4x4.hpp"
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Set by the DINO3D_DEBUG_DRAW CMake option; 0 turns every call into an empty inline function
+#ifndef DINO3D_DEBUG_DRAW
+#define DINO3D_DEBUG_DRAW 0
+#endif
+
+/// <summary>
+/// Color packed as 8 bit RGBA, red in the lowest byte.
+/// </summary>
+struct DebugColor
+{
+	unsigned int rgba;
+
+	static constexpr DebugColor make(unsigned char f_r, unsigned char f_g, unsigned char f_b, unsigned char f_a = 255)
+	{
+		return { static_cast<unsigned int>(f_r) | static_cast<unsigned int>(f_g) << 8 |
+			static_cast<unsigned int>(f_b) << 16 | static_cast<unsigned int>(f_a) << 24 };
+	}
+};
+
+/// <summary>
+/// Line list vertex, two per segment.
+/// </summary>
+struct DebugDrawVertex
+{
+	float position[3];
+	DebugColor color;
+};
+
+/// <summary>
+/// A string anchored at a world position, drawn by the text renderer.
+/// </summary>
+struct DebugTextMarker
+{
+	static constexpr size_t max_length = 47;
+
+	float position[3];
+	DebugColor color;
+	char text[max_length + 1];
+};
+
+/// <summary>
+/// Lines of the World layer are depth tested, lines of the Overlay layer are drawn on top.
+/// </summary>
+enum class DebugDrawLayer : unsigned int
+{
+	World,
+	Overlay,
+	Count
+};
+
+/**
+ * @class DebugDraw
+ * @brief Collects debug lines and text markers from any thread for one batched draw per layer.
+ *
+ * Each thread writes into its own chunked buffer, with one slot per frame
+ * in a ring of three. A call costs a load of the frame counter and a
+ * store of the chunk fill count, with no lock and no shared cache line.
+ * Once per frame the render thread calls collect(), which ends the frame
+ * for every producer and gathers the spans of the frame's vertices; the
+ * renderer then copies them straight into its vertex buffer. A call still
+ * running while collect() flips the frame may miss that frame.
+ *
+ * Configure with -DDINO3D_DEBUG_DRAW=OFF to compile every call out.
+ *
+ * Example usage:
+ * @code
+ * DebugDraw::get()->box(bounds_min, bounds_max, DebugColor::make(0, 255, 0));
+ * DebugDraw::get()->text(position, "spawn", DebugColor::make(255, 255, 0));
+ * // render thread, once per frame
+ * DebugDraw::get()->collect();
+ * @endcode
+ */
+class DebugDraw
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Contiguous vertices written by one thread.
+	/// </summary>
+	struct Span
+	{
+		const DebugDrawVertex* vertices;
+		size_t count;
+	};
+
+	/// <summary>
+	/// Counters of the last collect() call.
+	/// </summary>
+	struct Statistics
+	{
+		size_t line_count[static_cast<size_t>(DebugDrawLayer::Count)] = {};
+		size_t text_count = 0;
+		size_t thread_count = 0;
+		size_t chunk_bytes = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Factory Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Retrieves the debug draw collector shared by every thread.
+	/// </summary>
+	static DebugDraw* get();
+
+#if DINO3D_DEBUG_DRAW
+
+	/*--------------------------------------------------------------
+		Public Methods (any thread)
+	--------------------------------------------------------------*/
+
+	void line(const Vector3D& f_from, const Vector3D& f_to, DebugColor f_color, DebugDrawLayer f_layer = DebugDrawLayer::World);
+
+	/// <summary>
+	/// Appends line list vertices, two per segment; an odd last vertex is ignored.
+	/// </summary>
+	void lines(const DebugDrawVertex* f_vertices, size_t f_vertex_count, DebugDrawLayer f_layer = DebugDrawLayer::World);
+
+	void ray(const Vector3D& f_origin, const Vector3D& f_direction, DebugColor f_color, DebugDrawLayer f_layer = DebugDrawLayer::World);
+
+	/// <summary>
+	/// Draws the 12 edges of an axis-aligned box.
+	/// </summary>
+	void box(const Vector3D& f_min, const Vector3D& f_max, DebugColor f_color, DebugDrawLayer f_layer = DebugDrawLayer::World);
+
+	/// <summary>
+	/// Draws three great circles of f_segments segments each, at most 64.
+	/// </summary>
+	void sphere(const Vector3D& f_center, float f_radius, DebugColor f_color, DebugDrawLayer f_layer = DebugDrawLayer::World,
+		unsigned int f_segments = 24);
+
+	/// <summary>
+	/// Draws the 12 edges of a frustum from its corners, near plane 0-3 then far plane 4-7, in the same winding.
+	/// </summary>
+	void frustum(const Vector3D (&f_corners)[8], DebugColor f_color, DebugDrawLayer f_layer = DebugDrawLayer::World);
+
+	/// <summary>
+	/// Draws the X, Y and Z axes of a transform in red, green and blue.
+	/// </summary>
+	void axes(const Matrix4x4& f_transform, float f_size, DebugDrawLayer f_layer = DebugDrawLayer::World);
+
+	/// <summary>
+	/// Draws a grid on the XZ plane centered on f_center.
+	/// </summary>
+	void grid(const Vector3D& f_center, float f_size, unsigned int f_divisions, DebugColor f_color,
+		DebugDrawLayer f_layer = DebugDrawLayer::World);
+
+	/// <summary>
+	/// Places a text marker and a small cross at the position; longer text is truncated.
+	/// </summary>
+	void text(const Vector3D& f_position, const char* f_text, DebugColor f_color, DebugDrawLayer f_layer = DebugDrawLayer::Overlay);
+
+	/*--------------------------------------------------------------
+		Public Methods (render thread)
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Ends the current frame for every producer and gathers its lines and markers.
+	/// The results stay valid until the next collect().
+	/// </summary>
+	void collect();
+
+	size_t getVertexCount(DebugDrawLayer f_layer) const { return m_vertex_count[static_cast<size_t>(f_layer)]; }
+
+	const std::vector<Span>& getSpans(DebugDrawLayer f_layer) const { return m_spans[static_cast<size_t>(f_layer)]; }
+
+	/// <summary>
+	/// Copies f_count collected vertices of the layer, starting at f_first, into f_vertices.
+	/// </summary>
+	/// <returns>The number of vertices copied.</returns>
+	size_t copyVertices(DebugDrawLayer f_layer, size_t f_first, size_t f_count, DebugDrawVertex* f_vertices) const;
+
+	const std::vector<DebugTextMarker>& getTextMarkers() const { return m_text_markers; }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+#else
+
+	void line(const Vector3D&, const Vector3D&, DebugColor, DebugDrawLayer = DebugDrawLayer::World) {}
+	void lines(const DebugDrawVertex*, size_t, DebugDrawLayer = DebugDrawLayer::World) {}
+	void ray(const Vector3D&, const Vector3D&, DebugColor, DebugDrawLayer = DebugDrawLayer::World) {}
+	void box(const Vector3D&, const Vector3D&, DebugColor, DebugDrawLayer = DebugDrawLayer::World) {}
+	void sphere(const Vector3D&, float, DebugColor, DebugDrawLayer = DebugDrawLayer::World, unsigned int = 24) {}
+	void frustum(const Vector3D (&)[8], DebugColor, DebugDrawLayer = DebugDrawLayer::World) {}
+	void axes(const Matrix4x4&, float, DebugDrawLayer = DebugDrawLayer::World) {}
+	void grid(const Vector3D&, float, unsigned int, DebugColor, DebugDrawLayer = DebugDrawLayer::World) {}
+	void text(const Vector3D&, const char*, DebugColor, DebugDrawLayer = DebugDrawLayer::Overlay) {}
+	void collect() {}
+	size_t getVertexCount(DebugDrawLayer) const { return 0; }
+	const std::vector<Span>& getSpans(DebugDrawLayer) const { return m_spans[0]; }
+	size_t copyVertices(DebugDrawLayer, size_t, size_t, DebugDrawVertex*) const { return 0; }
+	const std::vector<DebugTextMarker>& getTextMarkers() const { return m_text_markers; }
+	const Statistics& getStatistics() const { return m_statistics; }
+
+#endif
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	DebugDraw();
+	~DebugDraw();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	struct ThreadBuffer;
+	struct ThreadBufferSlot;
+
+#if DINO3D_DEBUG_DRAW
+	/// <summary>
+	/// Registers a buffer for the calling thread, reusing one of an exited thread if possible.
+	/// </summary>
+	ThreadBuffer* getThreadBuffer();
+
+	/// <summary>
+	/// Returns the calling thread's slot of the current frame, emptying it on the first write of the frame.
+	/// </summary>
+	ThreadBufferSlot* beginWrite();
+#endif
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+#if DINO3D_DEBUG_DRAW
+	std::atomic<unsigned long long> m_frame;
+	std::atomic<ThreadBuffer*> m_thread_buffers;
+	size_t m_vertex_count[static_cast<size_t>(DebugDrawLayer::Count)];
+#endif
+
+	std::vector<Span> m_spans[static_cast<size_t>(DebugDrawLayer::Count)];
+	std::vector<DebugTextMarker> m_text_markers;
+	Statistics m_statistics;
+};
+
+#endif // !_DEBUG_DRAW_HPP_
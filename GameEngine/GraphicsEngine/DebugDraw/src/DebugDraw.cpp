@@ -0,0 +1,513 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Immediate-mode debug lines and text markers
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Visualize bounds, rays, axes and grids from any thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the DebugDraw class.
+/// @par Revision History:
+///      $Source: DebugDraw.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "DebugDraw.hpp"
+
+#if DINO3D_DEBUG_DRAW
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	constexpr size_t frame_slot_count = 3;
+	constexpr size_t layer_count = static_cast<size_t>(DebugDrawLayer::Count);
+	constexpr unsigned long long no_frame = ~0ull;
+	constexpr unsigned int max_sphere_segments = 64;
+
+	/// <summary>
+	/// Fixed block of items; count is published with release so the collector may read items below it.
+	/// </summary>
+	template <typename T, size_t Capacity>
+	struct Chunk
+	{
+		std::atomic<size_t> count{ 0 };
+		std::atomic<Chunk*> next{ nullptr };
+		T items[Capacity];
+	};
+
+	/// <summary>
+	/// Chunks of one stream of a thread; only the owning thread appends or resets.
+	/// </summary>
+	template <typename T, size_t Capacity>
+	struct ChunkList
+	{
+		using ChunkType = Chunk<T, Capacity>;
+
+		std::atomic<ChunkType*> head{ nullptr };
+		ChunkType* tail = nullptr;
+		size_t tail_count = Capacity; // Producer copy of tail->count, avoids reading back the atomic
+
+		void append(const T* f_items, size_t f_count)
+		{
+			while (f_count)
+			{
+				if (tail_count == Capacity)
+				{
+					advance();
+				}
+				const size_t copied = std::min(f_count, Capacity - tail_count);
+				::memcpy(tail->items + tail_count, f_items, copied * sizeof(T));
+				tail_count += copied;
+				tail->count.store(tail_count, std::memory_order_release);
+				f_items += copied;
+				f_count -= copied;
+			}
+		}
+
+		/// <summary>
+		/// Fast path of append() for a single segment.
+		/// </summary>
+		void appendPair(const T& f_first, const T& f_second)
+		{
+			if (tail_count == Capacity)
+			{
+				advance();
+			}
+			T* items = tail->items + tail_count;
+			items[0] = f_first;
+			items[1] = f_second;
+			tail_count += 2;
+			tail->count.store(tail_count, std::memory_order_release);
+		}
+
+		/// <summary>
+		/// Empties the list for a new frame; the chunks are kept for reuse.
+		/// </summary>
+		void reset()
+		{
+			for (ChunkType* chunk = head.load(std::memory_order_relaxed); chunk; chunk = chunk->next.load(std::memory_order_relaxed))
+			{
+				if (chunk->count.load(std::memory_order_relaxed) == 0) break;
+				chunk->count.store(0, std::memory_order_relaxed);
+			}
+			tail = head.load(std::memory_order_relaxed);
+			tail_count = tail ? 0 : Capacity;
+		}
+
+		void advance()
+		{
+			ChunkType* next = tail ? tail->next.load(std::memory_order_relaxed) : head.load(std::memory_order_relaxed);
+			if (!next)
+			{
+				next = new ChunkType();
+				if (tail) tail->next.store(next, std::memory_order_release);
+				else head.store(next, std::memory_order_release);
+			}
+			tail = next;
+			tail_count = 0;
+		}
+
+		size_t getChunkBytes() const
+		{
+			size_t bytes = 0;
+			for (ChunkType* chunk = head.load(std::memory_order_acquire); chunk; chunk = chunk->next.load(std::memory_order_acquire))
+			{
+				bytes += sizeof(ChunkType);
+			}
+			return bytes;
+		}
+
+		~ChunkList()
+		{
+			ChunkType* chunk = head.load(std::memory_order_relaxed);
+			while (chunk)
+			{
+				ChunkType* next = chunk->next.load(std::memory_order_relaxed);
+				delete chunk;
+				chunk = next;
+			}
+		}
+	};
+
+	// Even capacity: segments are appended as vertex pairs and never straddle two chunks
+	using VertexList = ChunkList<DebugDrawVertex, 16384>;
+	using TextList = ChunkList<DebugTextMarker, 256>;
+
+	DebugDrawVertex makeVertex(const Vector3D& f_position, DebugColor f_color)
+	{
+		return { { f_position.x, f_position.y, f_position.z }, f_color };
+	}
+}
+
+/// <summary>
+/// What one thread drew during one frame.
+/// </summary>
+struct DebugDraw::ThreadBufferSlot
+{
+	std::atomic<unsigned long long> frame{ no_frame };
+	VertexList lines[layer_count];
+	TextList texts;
+};
+
+/// <summary>
+/// Buffers of one thread, one slot per frame of the ring.
+/// </summary>
+struct DebugDraw::ThreadBuffer
+{
+	ThreadBufferSlot slots[frame_slot_count];
+	std::atomic<bool> owned{ true };
+	ThreadBuffer* next = nullptr;
+
+	// Owner thread only: the frame it last wrote and that frame's slot
+	unsigned long long frame = no_frame;
+	ThreadBufferSlot* slot = nullptr;
+};
+
+namespace
+{
+	/// <summary>
+	/// Hands the buffer back when its thread exits, so a later thread can reuse it.
+	/// </summary>
+	struct ThreadBufferOwner
+	{
+		std::atomic<bool>* owned = nullptr;
+
+		~ThreadBufferOwner()
+		{
+			if (owned) owned->store(false, std::memory_order_release);
+		}
+	};
+
+	thread_local ThreadBufferOwner s_thread_buffer_owner;
+
+	// Kept apart from the owner: a trivially destructible thread_local is a plain TLS load
+	thread_local void* s_thread_buffer = nullptr;
+}
+
+DebugDraw* DebugDraw::get()
+{
+	static DebugDraw debug_draw;
+	return &debug_draw;
+}
+
+DebugDraw::DebugDraw() : m_frame(0), m_thread_buffers(nullptr), m_vertex_count()
+{
+}
+
+DebugDraw::ThreadBuffer* DebugDraw::getThreadBuffer()
+{
+	// Reuse the buffer of an exited thread before growing the list
+	ThreadBuffer* buffer = nullptr;
+	for (ThreadBuffer* it = m_thread_buffers.load(std::memory_order_acquire); it && !buffer; it = it->next)
+	{
+		bool expected = false;
+		if (!it->owned.load(std::memory_order_relaxed) &&
+			it->owned.compare_exchange_strong(expected, true, std::memory_order_acquire))
+		{
+			buffer = it;
+		}
+	}
+	if (!buffer)
+	{
+		buffer = new ThreadBuffer();
+		buffer->next = m_thread_buffers.load(std::memory_order_relaxed);
+		while (!m_thread_buffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	s_thread_buffer_owner.owned = &buffer->owned;
+	s_thread_buffer = buffer;
+	return buffer;
+}
+
+DebugDraw::ThreadBufferSlot* DebugDraw::beginWrite()
+{
+	ThreadBuffer* buffer = static_cast<ThreadBuffer*>(s_thread_buffer);
+	if (!buffer)
+	{
+		buffer = getThreadBuffer();
+	}
+
+	const unsigned long long frame = m_frame.load(std::memory_order_acquire);
+	if (buffer->frame != frame)
+	{
+		// First write of this thread in the frame: the slot was last collected two frames ago
+		ThreadBufferSlot& slot = buffer->slots[frame % frame_slot_count];
+		if (slot.frame.load(std::memory_order_relaxed) != frame)
+		{
+			for (VertexList& lines : slot.lines) lines.reset();
+			slot.texts.reset();
+			slot.frame.store(frame, std::memory_order_release);
+		}
+		buffer->frame = frame;
+		buffer->slot = &slot;
+	}
+	return buffer->slot;
+}
+
+void DebugDraw::line(const Vector3D& f_from, const Vector3D& f_to, DebugColor f_color, DebugDrawLayer f_layer)
+{
+	beginWrite()->lines[static_cast<size_t>(f_layer)].appendPair(makeVertex(f_from, f_color), makeVertex(f_to, f_color));
+}
+
+void DebugDraw::lines(const DebugDrawVertex* f_vertices, size_t f_vertex_count, DebugDrawLayer f_layer)
+{
+	f_vertex_count &= ~static_cast<size_t>(1);
+	if (!f_vertices || f_vertex_count == 0)
+	{
+		return;
+	}
+
+	beginWrite()->lines[static_cast<size_t>(f_layer)].append(f_vertices, f_vertex_count);
+}
+
+void DebugDraw::ray(const Vector3D& f_origin, const Vector3D& f_direction, DebugColor f_color, DebugDrawLayer f_layer)
+{
+	line(f_origin, Vector3D(f_origin.x + f_direction.x, f_origin.y + f_direction.y, f_origin.z + f_direction.z), f_color, f_layer);
+}
+
+void DebugDraw::box(const Vector3D& f_min, const Vector3D& f_max, DebugColor f_color, DebugDrawLayer f_layer)
+{
+	const Vector3D corners[8] =
+	{
+		Vector3D(f_min.x, f_min.y, f_min.z), Vector3D(f_max.x, f_min.y, f_min.z),
+		Vector3D(f_max.x, f_max.y, f_min.z), Vector3D(f_min.x, f_max.y, f_min.z),
+		Vector3D(f_min.x, f_min.y, f_max.z), Vector3D(f_max.x, f_min.y, f_max.z),
+		Vector3D(f_max.x, f_max.y, f_max.z), Vector3D(f_min.x, f_max.y, f_max.z)
+	};
+	frustum(corners, f_color, f_layer);
+}
+
+void DebugDraw::sphere(const Vector3D& f_center, float f_radius, DebugColor f_color, DebugDrawLayer f_layer, unsigned int f_segments)
+{
+	f_segments = std::min(std::max(f_segments, 3u), max_sphere_segments);
+	DebugDrawVertex vertices[max_sphere_segments * 6];
+
+	const float step = 6.28318530718f / static_cast<float>(f_segments);
+	const Vector3D& c = f_center;
+	DebugDrawVertex* vertex = vertices;
+	for (unsigned int i = 0; i < f_segments; ++i)
+	{
+		const float c0 = std::cos(step * i) * f_radius, s0 = std::sin(step * i) * f_radius;
+		const float c1 = std::cos(step * (i + 1)) * f_radius, s1 = std::sin(step * (i + 1)) * f_radius;
+
+		*vertex++ = { { c.x + c0, c.y + s0, c.z }, f_color };
+		*vertex++ = { { c.x + c1, c.y + s1, c.z }, f_color };
+		*vertex++ = { { c.x + c0, c.y, c.z + s0 }, f_color };
+		*vertex++ = { { c.x + c1, c.y, c.z + s1 }, f_color };
+		*vertex++ = { { c.x, c.y + c0, c.z + s0 }, f_color };
+		*vertex++ = { { c.x, c.y + c1, c.z + s1 }, f_color };
+	}
+	lines(vertices, static_cast<size_t>(vertex - vertices), f_layer);
+}
+
+void DebugDraw::frustum(const Vector3D (&f_corners)[8], DebugColor f_color, DebugDrawLayer f_layer)
+{
+	DebugDrawVertex vertices[24];
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		const unsigned int j = (i + 1) % 4;
+		vertices[i * 6 + 0] = makeVertex(f_corners[i], f_color);
+		vertices[i * 6 + 1] = makeVertex(f_corners[j], f_color);
+		vertices[i * 6 + 2] = makeVertex(f_corners[i + 4], f_color);
+		vertices[i * 6 + 3] = makeVertex(f_corners[j + 4], f_color);
+		vertices[i * 6 + 4] = makeVertex(f_corners[i], f_color);
+		vertices[i * 6 + 5] = makeVertex(f_corners[i + 4], f_color);
+	}
+	lines(vertices, 24, f_layer);
+}
+
+void DebugDraw::axes(const Matrix4x4& f_transform, float f_size, DebugDrawLayer f_layer)
+{
+	// Row vector convention: rows 0-2 are the axes, row 3 the translation
+	const float* origin = f_transform.mat[3];
+	const DebugColor colors[3] = { DebugColor::make(255, 0, 0), DebugColor::make(0, 255, 0), DebugColor::make(0, 0, 255) };
+
+	DebugDrawVertex vertices[6];
+	for (unsigned int axis = 0; axis < 3; ++axis)
+	{
+		const float* direction = f_transform.mat[axis];
+		vertices[axis * 2] = { { origin[0], origin[1], origin[2] }, colors[axis] };
+		vertices[axis * 2 + 1] = { { origin[0] + direction[0] * f_size, origin[1] + direction[1] * f_size,
+			origin[2] + direction[2] * f_size }, colors[axis] };
+	}
+	lines(vertices, 6, f_layer);
+}
+
+void DebugDraw::grid(const Vector3D& f_center, float f_size, unsigned int f_divisions, DebugColor f_color, DebugDrawLayer f_layer)
+{
+	f_divisions = std::max(f_divisions, 1u);
+	const float half = f_size * 0.5f;
+	const float step = f_size / static_cast<float>(f_divisions);
+
+	// Appended in fixed batches so large grids need no heap allocation
+	DebugDrawVertex vertices[256];
+	size_t count = 0;
+	for (unsigned int i = 0; i <= f_divisions; ++i)
+	{
+		const float offset = -half + step * i;
+		vertices[count++] = { { f_center.x + offset, f_center.y, f_center.z - half }, f_color };
+		vertices[count++] = { { f_center.x + offset, f_center.y, f_center.z + half }, f_color };
+		vertices[count++] = { { f_center.x - half, f_center.y, f_center.z + offset }, f_color };
+		vertices[count++] = { { f_center.x + half, f_center.y, f_center.z + offset }, f_color };
+		if (count == 256)
+		{
+			lines(vertices, count, f_layer);
+			count = 0;
+		}
+	}
+	lines(vertices, count, f_layer);
+}
+
+void DebugDraw::text(const Vector3D& f_position, const char* f_text, DebugColor f_color, DebugDrawLayer f_layer)
+{
+	DebugTextMarker marker;
+	marker.position[0] = f_position.x;
+	marker.position[1] = f_position.y;
+	marker.position[2] = f_position.z;
+	marker.color = f_color;
+	::strncpy(marker.text, f_text ? f_text : "", DebugTextMarker::max_length);
+	marker.text[DebugTextMarker::max_length] = '\0';
+
+	beginWrite()->texts.append(&marker, 1);
+
+	const float size = 0.1f;
+	const DebugDrawVertex cross[4] =
+	{
+		{ { f_position.x - size, f_position.y, f_position.z }, f_color }, { { f_position.x + size, f_position.y, f_position.z }, f_color },
+		{ { f_position.x, f_position.y - size, f_position.z }, f_color }, { { f_position.x, f_position.y + size, f_position.z }, f_color }
+	};
+	lines(cross, 4, f_layer);
+}
+
+void DebugDraw::collect()
+{
+	// Producers that load the new frame write into the next slot from now on
+	const unsigned long long frame = m_frame.load(std::memory_order_relaxed);
+	m_frame.store(frame + 1, std::memory_order_release);
+	const size_t slot_index = static_cast<size_t>(frame % frame_slot_count);
+
+	m_statistics = Statistics();
+	m_text_markers.clear();
+	for (size_t layer = 0; layer < layer_count; ++layer)
+	{
+		m_spans[layer].clear();
+		m_vertex_count[layer] = 0;
+	}
+
+	for (ThreadBuffer* buffer = m_thread_buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next)
+	{
+		m_statistics.thread_count++;
+		ThreadBufferSlot& slot = buffer->slots[slot_index];
+		for (size_t layer = 0; layer < layer_count; ++layer)
+		{
+			m_statistics.chunk_bytes += slot.lines[layer].getChunkBytes();
+		}
+		if (slot.frame.load(std::memory_order_acquire) != frame)
+		{
+			continue;
+		}
+
+		for (size_t layer = 0; layer < layer_count; ++layer)
+		{
+			for (auto* chunk = slot.lines[layer].head.load(std::memory_order_acquire); chunk; chunk = chunk->next.load(std::memory_order_acquire))
+			{
+				const size_t count = chunk->count.load(std::memory_order_acquire);
+				if (count == 0) break;
+				m_spans[layer].push_back({ chunk->items, count });
+				m_vertex_count[layer] += count;
+			}
+		}
+		for (auto* chunk = slot.texts.head.load(std::memory_order_acquire); chunk; chunk = chunk->next.load(std::memory_order_acquire))
+		{
+			const size_t count = chunk->count.load(std::memory_order_acquire);
+			if (count == 0) break;
+			m_text_markers.insert(m_text_markers.end(), chunk->items, chunk->items + count);
+		}
+	}
+
+	for (size_t layer = 0; layer < layer_count; ++layer)
+	{
+		m_statistics.line_count[layer] = m_vertex_count[layer] / 2;
+	}
+	m_statistics.text_count = m_text_markers.size();
+}
+
+size_t DebugDraw::copyVertices(DebugDrawLayer f_layer, size_t f_first, size_t f_count, DebugDrawVertex* f_vertices) const
+{
+	size_t copied = 0;
+	size_t span_first = 0;
+	for (const Span& span : m_spans[static_cast<size_t>(f_layer)])
+	{
+		if (copied == f_count) break;
+
+		const size_t begin = f_first + copied;
+		if (begin < span_first + span.count)
+		{
+			const size_t offset = begin - span_first;
+			const size_t count = std::min(f_count - copied, span.count - offset);
+			::memcpy(f_vertices + copied, span.vertices + offset, count * sizeof(DebugDrawVertex));
+			copied += count;
+		}
+		span_first += span.count;
+	}
+	return copied;
+}
+
+DebugDraw::~DebugDraw()
+{
+	ThreadBuffer* buffer = m_thread_buffers.load(std::memory_order_acquire);
+	while (buffer)
+	{
+		ThreadBuffer* next = buffer->next;
+		delete buffer;
+		buffer = next;
+	}
+}
+
+#else
+
+DebugDraw* DebugDraw::get()
+{
+	static DebugDraw debug_draw;
+	return &debug_draw;
+}
+
+DebugDraw::DebugDraw()
+{
+}
+
+DebugDraw::~DebugDraw()
+{
+}
+
+#endif
@@ -0,0 +1,151 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Draws the collected debug lines
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Visualize bounds, rays, axes and grids from any thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the DebugDrawRenderer class and the debug vertex format.
+/// @par Revision History:
+///      $Source: DebugDrawRenderer.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _DEBUG_DRAW_RENDERER_HPP_
+#define _DEBUG_DRAW_RENDERER_HPP_
+
+#include "DebugDraw.hpp"
+#include "VertexFormat.hpp"
+#include <functional>
+
+class IGraphicsEngine;
+class DeviceContext;
+class DynamicVertexBuffer;
+
+template <> struct VertexAttributeFormat<DebugColor> { static constexpr DXGI_FORMAT value = DXGI_FORMAT_R8G8B8A8_UNORM; };
+
+/// <summary>
+/// Input layout of DebugDrawVertex: float3 POSITION, unorm4 COLOR.
+/// </summary>
+using DebugDrawVertexFormat = VertexFormat<DebugDrawVertex,
+	VertexElement<VertexSemantic::Position, 0, float[3]>,
+	VertexElement<VertexSemantic::Color, 0, DebugColor>>;
+
+/**
+ * @class DebugDrawRenderer
+ * @brief Draws the lines collected by DebugDraw, one line list draw per layer.
+ *
+ * draw() ends the DebugDraw frame, copies each layer's vertices straight
+ * from the per-thread buffers into a mapped DynamicVertexBuffer and
+ * issues one drawLineList for the World layer and one for the Overlay
+ * layer. A layer larger than the ring is split into several draws.
+ * With DINO3D_DEBUG_DRAW off nothing is collected and draw() returns at once.
+ *
+ * Example usage:
+ * @code
+ * DebugDrawRenderer* debug_renderer = GraphicsEngine::get()->createDebugDrawRenderer(1 << 20);
+ * debug_renderer->draw(device_context, [&](DebugDrawLayer f_layer)
+ * {
+ *     device_context->setPipelineState(f_layer == DebugDrawLayer::World ? lines_depth_tested : lines_on_top);
+ * });
+ * // ...
+ * debug_renderer->release();
+ * @endcode
+ */
+class DebugDrawRenderer
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Binds the line pipeline state and camera constants of a layer.
+	/// </summary>
+	using BindLayerFunction = std::function<void(DebugDrawLayer f_layer)>;
+
+	/// <summary>
+	/// Counters of the last draw() call.
+	/// </summary>
+	struct Statistics
+	{
+		size_t line_count = 0;
+		size_t text_count = 0;
+		unsigned int draw_calls = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Collects the debug lines of the frame and draws them.
+	/// </summary>
+	/// <param name="f_bind_layer">Called before the draws of each non empty layer.</param>
+	void draw(DeviceContext* f_device_context, const BindLayerFunction& f_bind_layer);
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Releases the vertex ring and the renderer itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	DebugDrawRenderer();
+	~DebugDrawRenderer();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(unsigned int f_capacity, IGraphicsEngine* f_graphicsEngine);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	DynamicVertexBuffer* m_vertex_buffer;
+	unsigned int m_capacity;
+	Statistics m_statistics;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_DEBUG_DRAW_RENDERER_HPP_
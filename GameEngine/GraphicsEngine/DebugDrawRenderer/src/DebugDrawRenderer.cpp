@@ -0,0 +1,110 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Draws the collected debug lines
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Visualize bounds, rays, axes and grids from any thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the DebugDrawRenderer class.
+/// @par Revision History:
+///      $Source: DebugDrawRenderer.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "DebugDrawRenderer.hpp"
+#include "DynamicVertexBuffer.hpp"
+#include "DeviceContext.hpp"
+#include <algorithm>
+
+DebugDrawRenderer::DebugDrawRenderer() : m_vertex_buffer(nullptr), m_capacity(0)
+{
+}
+
+bool DebugDrawRenderer::init(unsigned int f_capacity, IGraphicsEngine* f_graphicsEngine)
+{
+	// Whole segments per map, so a split never separates the two vertices of a line
+	m_capacity = f_capacity & ~1u;
+	m_vertex_buffer = new DynamicVertexBuffer();
+	return m_vertex_buffer->load(DebugDrawVertexFormat::stride, m_capacity, f_graphicsEngine);
+}
+
+void DebugDrawRenderer::draw(DeviceContext* f_device_context, const BindLayerFunction& f_bind_layer)
+{
+	m_statistics = Statistics();
+
+	DebugDraw* debug_draw = DebugDraw::get();
+	debug_draw->collect();
+
+	bool vertex_buffer_bound = false;
+	const DebugDrawLayer layers[] = { DebugDrawLayer::World, DebugDrawLayer::Overlay };
+	for (DebugDrawLayer layer : layers)
+	{
+		const size_t vertex_count = debug_draw->getVertexCount(layer);
+		if (vertex_count == 0)
+		{
+			continue;
+		}
+
+		if (f_bind_layer) f_bind_layer(layer);
+		if (!vertex_buffer_bound)
+		{
+			f_device_context->setVertexBuffer(m_vertex_buffer);
+			vertex_buffer_bound = true;
+		}
+
+		for (size_t first = 0; first < vertex_count; )
+		{
+			const UINT count = static_cast<UINT>(std::min<size_t>(vertex_count - first, m_capacity));
+			UINT first_vertex = 0;
+			void* vertices = m_vertex_buffer->map(f_device_context, count, 1, &first_vertex);
+			if (!vertices)
+			{
+				break;
+			}
+			debug_draw->copyVertices(layer, first, count, static_cast<DebugDrawVertex*>(vertices));
+			m_vertex_buffer->unmap(f_device_context);
+
+			f_device_context->drawLineList(count, first_vertex);
+			m_statistics.draw_calls++;
+			first += count;
+		}
+		m_statistics.line_count += vertex_count / 2;
+	}
+	m_statistics.text_count = debug_draw->getTextMarkers().size();
+}
+
+void DebugDrawRenderer::release()
+{
+	if (m_vertex_buffer) m_vertex_buffer->release();
+	delete this;
+}
+
+DebugDrawRenderer::~DebugDrawRenderer()
+{
+}
@@ -5,28 +5,67 @@
 #include <d3d11.h>
 class SwapChain;
 class VertexBuffer;
+class DynamicVertexBuffer;
 class VertexShader;
 class PixelShader;
 class ConstantBuffer;
 class IndexBuffer;
+class PipelineState;
+class CommandRecorder;
 
 class DeviceContext : public IDeviceContext
 {
 public:
+	/// <summary>
+	/// Counters of the work submitted through the context, used to measure state switches.
+	/// </summary>
+	struct Statistics
+	{
+		UINT pipeline_switches = 0;        // setPipelineState calls that changed the bound state
+		UINT redundant_pipeline_binds = 0; // setPipelineState calls with the already bound state
+		UINT state_changes = 0;            // Individual D3D11 state calls issued by pipeline switches
+		UINT draw_calls = 0;
+	};
+
     DeviceContext(ID3D11DeviceContext* f_deviceContext);
     void clearRenderTargetColor(SwapChain* f_swapChain, float r, float g, float b, float alpha);
 	void setVertexBuffer(VertexBuffer* vertex_buffer);
+	void setVertexBuffer(DynamicVertexBuffer* vertex_buffer);
+
+	/// <summary>
+	/// Binds one buffer per stream of a VertexStreamFormat, buffer i to input slot i.
+	/// Passes that only need positions bind the first stream alone with setVertexBuffer.
+	/// </summary>
+	void setVertexBuffers(VertexBuffer* const* vertex_buffers, UINT buffer_count);
 	void setIndexBuffer(IndexBuffer* index_buffer);
 	
 	void drawTriangleList(UINT vertex_count, UINT start_vertex_index);
 	void drawIndexedTriangleList(UINT index_count, UINT start_vertex_index, UINT start_index_location);
 	void drawTriangleStrip(UINT vertex_count, UINT start_vertex_index);
+	void drawLineList(UINT vertex_count, UINT start_vertex_index);
 	
     void setViewportSize(UINT width, UINT height);
 
 	void setVertexShader(VertexShader* f_vertex_shader);
 	void setPixelShader(PixelShader* f_pixel_shader);
 
+	/// <summary>
+	/// Binds shaders, input layout, topology and fixed function state in one call.
+	/// Only the parts that differ from the previously bound pipeline state are sent to the driver.
+	/// </summary>
+	/// <param name="f_pipeline_state">Pipeline state created by GraphicsEngine::createPipelineState, or nullptr to unbind.</param>
+	void setPipelineState(PipelineState* f_pipeline_state);
+
+	/// <summary>
+	/// Retrieves the counters accumulated since the last resetStatistics call.
+	/// </summary>
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Clears the counters, typically once per frame.
+	/// </summary>
+	void resetStatistics() { m_statistics = Statistics(); }
+
 	void setConstantBuffer(VertexShader* f_vertex_shader, ConstantBuffer* f_constant_buffer);
 	void setConstantBuffer(PixelShader* f_pixel_shader, ConstantBuffer* f_constant_buffer);	
 
@@ -40,7 +79,13 @@ public:
     bool release();
     ~DeviceContext();
 private:
+	void setTopology(D3D11_PRIMITIVE_TOPOLOGY f_topology);
+
     ID3D11DeviceContext* m_deviceContext_p;
+	PipelineState* m_pipeline_state = nullptr;
+	D3D11_PRIMITIVE_TOPOLOGY m_topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	Statistics m_statistics;
+	CommandRecorder* m_recorder; // Cached, every call of the context reports to it
 	friend class ConstantBuffer;
 };
 
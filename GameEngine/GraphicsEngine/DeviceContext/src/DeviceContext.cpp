@@ -1,14 +1,18 @@
 #include "DeviceContext.hpp"
 #include "SwapChain.hpp"
 #include "VertexBuffer.hpp"
+#include "DynamicVertexBuffer.hpp"
 #include "IndexBuffer.hpp"
 #include "VertexShader.hpp"
 #include "PixelShader.hpp"
 #include "ConstantBuffer.hpp"
+#include "PipelineState.hpp"
+#include "CommandRecorder.hpp"
 #include <d3d11.h>
 #include <iostream>
+#include <cstring>
 
-DeviceContext::DeviceContext(ID3D11DeviceContext* f_deviceContext) : m_deviceContext_p(f_deviceContext)
+DeviceContext::DeviceContext(ID3D11DeviceContext* f_deviceContext) : m_deviceContext_p(f_deviceContext), m_recorder(CommandRecorder::get())
 {
 }
 
@@ -25,6 +29,7 @@ void DeviceContext::clearRenderTargetColor(SwapChain* f_swapChain, float r, floa
 	}
 	m_deviceContext_p->ClearRenderTargetView(f_swapChain->m_rtv, clearColor);
 	m_deviceContext_p->OMSetRenderTargets(1, &f_swapChain->m_rtv, NULL);
+	m_recorder->onClear(clearColor);
 }
 
 void DeviceContext::setVertexBuffer(VertexBuffer* vertex_buffer)
@@ -32,30 +37,78 @@ void DeviceContext::setVertexBuffer(VertexBuffer* vertex_buffer)
 	UINT stride = vertex_buffer->m_size_vertex;
 	UINT offset = 0;
 	m_deviceContext_p->IASetVertexBuffers(0, 1, &vertex_buffer->m_buffer, &stride, &offset);
-	m_deviceContext_p->IASetInputLayout(vertex_buffer->m_layout);
+	if (m_recorder->isCapturing())
+	{
+		const void* buffer = vertex_buffer;
+		m_recorder->onSetVertexBuffers(&buffer, &stride, 1);
+	}
+	// The input layout is part of the pipeline state and is bound by setPipelineState
+}
+
+void DeviceContext::setVertexBuffer(DynamicVertexBuffer* vertex_buffer)
+{
+	// Always bound at offset 0; the mapped ranges are addressed with the draw's base vertex
+	UINT stride = vertex_buffer->m_size_vertex;
+	UINT offset = 0;
+	m_deviceContext_p->IASetVertexBuffers(0, 1, &vertex_buffer->m_buffer, &stride, &offset);
+	if (m_recorder->isCapturing())
+	{
+		const void* buffer = vertex_buffer;
+		m_recorder->onSetVertexBuffers(&buffer, &stride, 1);
+	}
+}
+
+void DeviceContext::setVertexBuffers(VertexBuffer* const* vertex_buffers, UINT buffer_count)
+{
+	ID3D11Buffer* buffers[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	UINT strides[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	UINT offsets[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT] = {};
+	buffer_count = buffer_count < D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT ? buffer_count : D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT;
+	for (UINT i = 0; i < buffer_count; ++i)
+	{
+		buffers[i] = vertex_buffers[i]->m_buffer;
+		strides[i] = vertex_buffers[i]->m_size_vertex;
+	}
+	m_deviceContext_p->IASetVertexBuffers(0, buffer_count, buffers, strides, offsets);
+	m_recorder->onSetVertexBuffers(reinterpret_cast<const void* const*>(vertex_buffers), strides, buffer_count);
 }
 
 void DeviceContext::setIndexBuffer(IndexBuffer* index_buffer)
 {
 	m_deviceContext_p->IASetIndexBuffer(index_buffer->m_buffer, DXGI_FORMAT_R32_UINT, 0);
+	m_recorder->onSetIndexBuffer(index_buffer);
 }
 
 void DeviceContext::drawTriangleList(UINT vertex_count, UINT start_vertex_index)
 {
-	m_deviceContext_p->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 	m_deviceContext_p->Draw(vertex_count, start_vertex_index);
+	m_statistics.draw_calls++;
+	m_recorder->onDraw(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, vertex_count, start_vertex_index);
 }
 
 void DeviceContext::drawIndexedTriangleList(UINT index_count, UINT start_vertex_index, UINT start_index_location)
 {
-	m_deviceContext_p->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 	m_deviceContext_p->DrawIndexed(index_count, start_index_location, start_vertex_index);
+	m_statistics.draw_calls++;
+	m_recorder->onDrawIndexed(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, index_count, start_index_location, start_vertex_index);
 }
 
 void DeviceContext::drawTriangleStrip(UINT vertex_count, UINT start_vertex_index)
 {
-	m_deviceContext_p->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+	setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+	m_deviceContext_p->Draw(vertex_count, start_vertex_index);
+	m_statistics.draw_calls++;
+	m_recorder->onDraw(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP, vertex_count, start_vertex_index);
+}
+
+void DeviceContext::drawLineList(UINT vertex_count, UINT start_vertex_index)
+{
+	setTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
 	m_deviceContext_p->Draw(vertex_count, start_vertex_index);
+	m_statistics.draw_calls++;
+	m_recorder->onDraw(D3D11_PRIMITIVE_TOPOLOGY_LINELIST, vertex_count, start_vertex_index);
 }
 
 void DeviceContext::setViewportSize(UINT width, UINT height)
@@ -66,26 +119,112 @@ void DeviceContext::setViewportSize(UINT width, UINT height)
 	viewport.MinDepth = 0;
 	viewport.MaxDepth = 1;
 	m_deviceContext_p->RSSetViewports(1, &viewport);
+	m_recorder->onSetViewport(width, height);
 }
 
 void DeviceContext::setVertexShader(VertexShader* f_vertex_shader)
 {
 	m_deviceContext_p->VSSetShader(f_vertex_shader->m_vs, nullptr, 0);
+	m_recorder->onSetShader(CommandShaderStage::Vertex, f_vertex_shader);
+	// The bound pipeline state no longer matches the device, force a full bind next time
+	m_pipeline_state = nullptr;
 }
 
 void DeviceContext::setPixelShader(PixelShader* f_pixel_shader)
 {
 	m_deviceContext_p->PSSetShader(f_pixel_shader->m_ps, nullptr, 0);
+	m_recorder->onSetShader(CommandShaderStage::Pixel, f_pixel_shader);
+	m_pipeline_state = nullptr;
+}
+
+void DeviceContext::setPipelineState(PipelineState* f_pipeline_state)
+{
+	// Before the redundancy check: a capture starting mid-run has to see the state bound before it
+	m_recorder->onSetPipeline(f_pipeline_state);
+
+	if (f_pipeline_state == m_pipeline_state)
+	{
+		m_statistics.redundant_pipeline_binds++;
+		return;
+	}
+
+	if (!f_pipeline_state)
+	{
+		// Back to the DirectX 11 defaults with no shaders, as after ClearState
+		m_deviceContext_p->VSSetShader(nullptr, nullptr, 0);
+		m_deviceContext_p->PSSetShader(nullptr, nullptr, 0);
+		m_deviceContext_p->IASetInputLayout(nullptr);
+		m_deviceContext_p->RSSetState(nullptr);
+		m_deviceContext_p->OMSetBlendState(nullptr, nullptr, 0xffffffff);
+		m_deviceContext_p->OMSetDepthStencilState(nullptr, 0);
+		m_statistics.state_changes += 6;
+		m_pipeline_state = nullptr;
+		m_statistics.pipeline_switches++;
+		return;
+	}
+
+	const PipelineStateDesc& desc = f_pipeline_state->m_desc;
+	const PipelineState* previous = m_pipeline_state;
+
+	if (!previous || previous->m_desc.vertex_shader != desc.vertex_shader)
+	{
+		m_deviceContext_p->VSSetShader(desc.vertex_shader ? desc.vertex_shader->m_vs : nullptr, nullptr, 0);
+		m_statistics.state_changes++;
+	}
+	if (!previous || previous->m_desc.pixel_shader != desc.pixel_shader)
+	{
+		m_deviceContext_p->PSSetShader(desc.pixel_shader ? desc.pixel_shader->m_ps : nullptr, nullptr, 0);
+		m_statistics.state_changes++;
+	}
+	if (!previous || previous->m_desc.input_layout != desc.input_layout)
+	{
+		m_deviceContext_p->IASetInputLayout(desc.input_layout);
+		m_statistics.state_changes++;
+	}
+	if (!previous || previous->m_rasterizer_state != f_pipeline_state->m_rasterizer_state)
+	{
+		m_deviceContext_p->RSSetState(f_pipeline_state->m_rasterizer_state);
+		m_statistics.state_changes++;
+	}
+	if (!previous || previous->m_blend_state != f_pipeline_state->m_blend_state
+		|| ::memcmp(previous->m_desc.blend_factor, desc.blend_factor, sizeof(desc.blend_factor)) != 0
+		|| previous->m_desc.sample_mask != desc.sample_mask)
+	{
+		m_deviceContext_p->OMSetBlendState(f_pipeline_state->m_blend_state, desc.blend_factor, desc.sample_mask);
+		m_statistics.state_changes++;
+	}
+	if (!previous || previous->m_depth_stencil_state != f_pipeline_state->m_depth_stencil_state
+		|| previous->m_desc.stencil_ref != desc.stencil_ref)
+	{
+		m_deviceContext_p->OMSetDepthStencilState(f_pipeline_state->m_depth_stencil_state, desc.stencil_ref);
+		m_statistics.state_changes++;
+	}
+	setTopology(desc.topology);
+
+	m_pipeline_state = f_pipeline_state;
+	m_statistics.pipeline_switches++;
+}
+
+void DeviceContext::setTopology(D3D11_PRIMITIVE_TOPOLOGY f_topology)
+{
+	if (m_topology != f_topology)
+	{
+		m_deviceContext_p->IASetPrimitiveTopology(f_topology);
+		m_topology = f_topology;
+		m_statistics.state_changes++;
+	}
 }
 
 void DeviceContext::setConstantBuffer(VertexShader* f_vertex_shader, ConstantBuffer* f_constant_buffer)
 {
 	m_deviceContext_p->VSSetConstantBuffers(0, 1, &f_constant_buffer->m_buffer);
+	m_recorder->onSetConstantBuffer(CommandShaderStage::Vertex, 0, f_constant_buffer);
 }
 
 void DeviceContext::setConstantBuffer(PixelShader* f_pixel_shader, ConstantBuffer* f_constant_buffer)
 {
 	m_deviceContext_p->PSSetConstantBuffers(0, 1, &f_constant_buffer->m_buffer);
+	m_recorder->onSetConstantBuffer(CommandShaderStage::Pixel, 0, f_constant_buffer);
 }
 
 bool DeviceContext::release()
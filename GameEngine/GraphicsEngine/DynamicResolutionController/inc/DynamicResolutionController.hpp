@@ -0,0 +1,191 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Render scale driven by the measured frame time
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Hold the frame budget by trading resolution for time.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the DynamicResolutionController class.
+/// @par Revision History:
+///      $Source: DynamicResolutionController.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _DYNAMIC_RESOLUTION_CONTROLLER_HPP_
+#define _DYNAMIC_RESOLUTION_CONTROLLER_HPP_
+
+/// <summary>
+/// Tuning of the dynamic resolution controller. Scales are per axis, 1 being the output resolution.
+/// </summary>
+struct DynamicResolutionSettings
+{
+	/// <summary>
+	/// Frame time budget in milliseconds; keep it below the refresh interval to leave headroom.
+	/// </summary>
+	float target_frame_ms = 15.0f;
+
+	float min_scale = 0.5f;
+	float max_scale = 1.0f;
+
+	/// <summary>
+	/// PID gains on the relative budget error, acting on the pixel count (scale squared).
+	/// </summary>
+	float proportional_gain = 0.3f;
+	float integral_gain = 0.25f;
+	float derivative_gain = 0.05f;
+
+	/// <summary>
+	/// Relative error around the budget treated as on target, so noise does not move the scale.
+	/// </summary>
+	float deadband = 0.05f;
+
+	/// <summary>
+	/// Smallest scale change applied; smaller corrections accumulate until they reach it.
+	/// </summary>
+	float hysteresis = 0.04f;
+
+	/// <summary>
+	/// Largest scale change per update: drop quickly when over budget, recover slowly.
+	/// </summary>
+	float max_step_down = 0.1f;
+	float max_step_up = 0.02f;
+
+	/// <summary>
+	/// Weight of the newest frame in the exponential frame time average.
+	/// </summary>
+	float smoothing = 0.3f;
+
+	/// <summary>
+	/// Render sizes are rounded to a multiple of this many pixels.
+	/// </summary>
+	unsigned int size_alignment = 8;
+};
+
+/**
+ * @class DynamicResolutionController
+ * @brief Chooses the render scale from measured frame times with a PID loop.
+ *
+ * Each update() feeds one frame time. The error against the budget drives
+ * an incremental PID controller on the pixel count, since GPU time grows
+ * with the number of shaded pixels rather than with the scale. The
+ * incremental form clamps without integral windup. The result is rate
+ * limited, clamped to [min_scale, max_scale] and only applied once it moved
+ * by the hysteresis, so the render size does not flicker between
+ * neighbouring values. Nothing here touches the GPU: feed it GPU frame
+ * times at runtime, or a recorded trace in a test.
+ *
+ * Example usage:
+ * @code
+ * DynamicResolutionController controller;
+ * controller.update(gpu_frame_ms);
+ * unsigned int render_width = 0, render_height = 0;
+ * controller.getRenderSize(output_width, output_height, render_width, render_height);
+ * @endcode
+ */
+class DynamicResolutionController
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since the last reset().
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int frame_count = 0;
+		unsigned int frames_over_budget = 0;
+		unsigned int scale_changes = 0;
+		float filtered_frame_ms = 0.0f;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	DynamicResolutionController();
+	~DynamicResolutionController();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Replaces the tuning and restarts the controller at the maximum scale.
+	/// </summary>
+	void setSettings(const DynamicResolutionSettings& f_settings);
+
+	const DynamicResolutionSettings& getSettings() const { return m_settings; }
+
+	/// <summary>
+	/// Feeds the time of the last frame rendered at getScale().
+	/// </summary>
+	/// <returns>The scale to render the next frame at.</returns>
+	float update(float f_frame_ms);
+
+	/// <summary>
+	/// Scale currently applied to the render size.
+	/// </summary>
+	float getScale() const { return m_scale; }
+
+	/// <summary>
+	/// Unquantized controller output the applied scale follows.
+	/// </summary>
+	float getTargetScale() const { return m_target_scale; }
+
+	/// <summary>
+	/// Render size for an output size at the applied scale, aligned and at least one alignment step.
+	/// </summary>
+	void getRenderSize(unsigned int f_output_width, unsigned int f_output_height, unsigned int& f_render_width, unsigned int& f_render_height) const;
+
+	/// <summary>
+	/// Forgets the frame history and starts again at the maximum scale.
+	/// </summary>
+	void reset();
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	DynamicResolutionSettings m_settings;
+	float m_scale;
+	float m_target_scale;
+	float m_filtered_frame_ms;
+	float m_previous_error;
+	float m_previous_error_2;
+	Statistics m_statistics;
+};
+
+#endif // !_DYNAMIC_RESOLUTION_CONTROLLER_HPP_
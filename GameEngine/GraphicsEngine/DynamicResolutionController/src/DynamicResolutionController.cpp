@@ -0,0 +1,130 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Render scale driven by the measured frame time
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Hold the frame budget by trading resolution for time.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the DynamicResolutionController class.
+/// @par Revision History:
+///      $Source: DynamicResolutionController.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "DynamicResolutionController.hpp"
+#include <algorithm>
+#include <cmath>
+
+DynamicResolutionController::DynamicResolutionController()
+	: m_scale(1.0f), m_target_scale(1.0f), m_filtered_frame_ms(0.0f), m_previous_error(0.0f), m_previous_error_2(0.0f)
+{
+	reset();
+}
+
+void DynamicResolutionController::setSettings(const DynamicResolutionSettings& f_settings)
+{
+	m_settings = f_settings;
+	m_settings.min_scale = std::max(0.01f, std::min(m_settings.min_scale, m_settings.max_scale));
+	m_settings.size_alignment = std::max(1u, m_settings.size_alignment);
+	reset();
+}
+
+void DynamicResolutionController::reset()
+{
+	m_scale = m_settings.max_scale;
+	m_target_scale = m_settings.max_scale;
+	m_filtered_frame_ms = 0.0f;
+	m_previous_error = 0.0f;
+	m_previous_error_2 = 0.0f;
+	m_statistics = Statistics();
+}
+
+float DynamicResolutionController::update(float f_frame_ms)
+{
+	if (!(f_frame_ms > 0.0f) || !std::isfinite(f_frame_ms) || !(m_settings.target_frame_ms > 0.0f))
+	{
+		return m_scale;
+	}
+
+	m_statistics.frame_count++;
+	if (f_frame_ms > m_settings.target_frame_ms)
+	{
+		m_statistics.frames_over_budget++;
+	}
+
+	m_filtered_frame_ms = m_statistics.frame_count == 1 ? f_frame_ms :
+		m_filtered_frame_ms + m_settings.smoothing * (f_frame_ms - m_filtered_frame_ms);
+	m_statistics.filtered_frame_ms = m_filtered_frame_ms;
+
+	// Positive when there is headroom; a hitch of several budgets counts as one so it cannot slam the scale
+	float error = (m_settings.target_frame_ms - m_filtered_frame_ms) / m_settings.target_frame_ms;
+	error = std::max(-1.0f, std::min(1.0f, error));
+	if (std::fabs(error) < m_settings.deadband)
+	{
+		error = 0.0f;
+	}
+
+	// Incremental PID on the pixel count: the integral term lives in the output, so clamping it cannot wind up
+	const float pixel_delta = m_settings.proportional_gain * (error - m_previous_error) +
+		m_settings.integral_gain * error +
+		m_settings.derivative_gain * (error - 2.0f * m_previous_error + m_previous_error_2);
+	m_previous_error_2 = m_previous_error;
+	m_previous_error = error;
+
+	const float pixels = std::max(0.0f, m_target_scale * m_target_scale * (1.0f + pixel_delta));
+	float target_scale = std::sqrt(pixels);
+	target_scale = std::max(m_target_scale - m_settings.max_step_down, std::min(m_target_scale + m_settings.max_step_up, target_scale));
+	m_target_scale = std::max(m_settings.min_scale, std::min(m_settings.max_scale, target_scale));
+
+	// Reaching a limit is always applied, otherwise the last step below the hysteresis would never land
+	const bool at_limit = m_target_scale == m_settings.min_scale || m_target_scale == m_settings.max_scale;
+	if (std::fabs(m_target_scale - m_scale) >= m_settings.hysteresis || (at_limit && m_target_scale != m_scale))
+	{
+		m_scale = m_target_scale;
+		m_statistics.scale_changes++;
+	}
+	return m_scale;
+}
+
+void DynamicResolutionController::getRenderSize(unsigned int f_output_width, unsigned int f_output_height,
+	unsigned int& f_render_width, unsigned int& f_render_height) const
+{
+	const unsigned int alignment = m_settings.size_alignment;
+	auto scaleSize = [this, alignment](unsigned int f_size)
+	{
+		const unsigned int scaled = static_cast<unsigned int>(f_size * m_scale / alignment + 0.5f) * alignment;
+		return std::max(std::min(alignment, f_size), std::min(scaled, f_size));
+	};
+	f_render_width = scaleSize(f_output_width);
+	f_render_height = scaleSize(f_output_height);
+}
+
+DynamicResolutionController::~DynamicResolutionController()
+{
+}
@@ -0,0 +1,147 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Scene color target rendered at a fraction of the output size
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Render the scene at a dynamic resolution and upscale it.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the DynamicResolutionTarget class.
+/// @par Revision History:
+///      $Source: DynamicResolutionTarget.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _DYNAMIC_RESOLUTION_TARGET_HPP_
+#define _DYNAMIC_RESOLUTION_TARGET_HPP_
+
+#include <d3d11.h>
+
+class IGraphicsEngine;
+class DeviceContext;
+class SwapChain;
+class VertexShader;
+class PixelShader;
+class ConstantBuffer;
+
+/**
+ * @class DynamicResolutionTarget
+ * @brief An output sized color target the scene renders into at a smaller viewport, then upscaled.
+ *
+ * The texture is allocated once at the output size and the scene only
+ * renders into its top-left render size, so changing the scale every frame
+ * costs a viewport change instead of a reallocation. upscale() draws one
+ * full screen triangle into the swap chain with Upscale.hlsl, sampling the
+ * rendered area bilinearly and clamping the taps so the unrendered texels
+ * never bleed in.
+ *
+ * Example usage:
+ * @code
+ * DynamicResolutionTarget* scene_color = GraphicsEngine::get()->createDynamicResolutionTarget(width, height);
+ * controller.getRenderSize(width, height, render_width, render_height);
+ * scene_color->begin(device_context, render_width, render_height, clear_color);
+ * // ... draw the scene ...
+ * scene_color->upscale(device_context, swap_chain);
+ * @endcode
+ */
+class DynamicResolutionTarget
+{
+public:
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Reallocates the target for a new output size; does nothing if the size is unchanged.
+	/// </summary>
+	bool resize(UINT f_width, UINT f_height);
+
+	/// <summary>
+	/// Binds and clears the target and sets the viewport to the render size.
+	/// </summary>
+	/// <param name="f_render_width">Width rendered this frame, clamped to the output width.</param>
+	/// <param name="f_render_height">Height rendered this frame, clamped to the output height.</param>
+	void begin(DeviceContext* f_device_context, UINT f_render_width, UINT f_render_height, const FLOAT f_clear_color[4]);
+
+	/// <summary>
+	/// Stretches the rendered area over the whole swap chain back buffer.
+	/// </summary>
+	void upscale(DeviceContext* f_device_context, SwapChain* f_swap_chain);
+
+	UINT getWidth() const { return m_width; }
+	UINT getHeight() const { return m_height; }
+	UINT getRenderWidth() const { return m_render_width; }
+	UINT getRenderHeight() const { return m_render_height; }
+
+	/// <summary>
+	/// Releases the target, the upscale shaders and the object itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	DynamicResolutionTarget();
+	~DynamicResolutionTarget();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(UINT f_width, UINT f_height, IGraphicsEngine* f_graphicsEngine);
+	void releaseTarget();
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	IGraphicsEngine* m_graphics_engine;
+	ID3D11Texture2D* m_texture;
+	ID3D11RenderTargetView* m_rtv;
+	ID3D11ShaderResourceView* m_srv;
+	ID3D11SamplerState* m_sampler;
+	VertexShader* m_vertex_shader;
+	PixelShader* m_pixel_shader;
+	ConstantBuffer* m_constant_buffer;
+	UINT m_width;
+	UINT m_height;
+	UINT m_render_width;
+	UINT m_render_height;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_DYNAMIC_RESOLUTION_TARGET_HPP_
@@ -0,0 +1,214 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Scene color target rendered at a fraction of the output size
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Render the scene at a dynamic resolution and upscale it.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the DynamicResolutionTarget class.
+/// @par Revision History:
+///      $Source: DynamicResolutionTarget.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "DynamicResolutionTarget.hpp"
+#include "GraphicsEngine.hpp"
+#include "DeviceContext.hpp"
+#include "VertexShader.hpp"
+#include "PixelShader.hpp"
+#include "ConstantBuffer.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include <algorithm>
+
+namespace
+{
+	struct UpscaleConstants
+	{
+		float uv_scale[2];
+		float uv_max[2];
+	};
+}
+
+DynamicResolutionTarget::DynamicResolutionTarget()
+	: m_graphics_engine(nullptr), m_texture(nullptr), m_rtv(nullptr), m_srv(nullptr), m_sampler(nullptr),
+	m_vertex_shader(nullptr), m_pixel_shader(nullptr), m_constant_buffer(nullptr), m_width(0), m_height(0), m_render_width(0), m_render_height(0)
+{
+}
+
+bool DynamicResolutionTarget::init(UINT f_width, UINT f_height, IGraphicsEngine* f_graphicsEngine)
+{
+	m_graphics_engine = f_graphicsEngine;
+
+	ID3DBlob* byte_code = nullptr;
+	if (!f_graphicsEngine->compileVertexShader(L"Upscale.hlsl", "vsmain", nullptr, &byte_code))
+	{
+		return false;
+	}
+	m_vertex_shader = f_graphicsEngine->createVertexShader(byte_code->GetBufferPointer(), byte_code->GetBufferSize());
+	byte_code->Release();
+
+	byte_code = nullptr;
+	if (!f_graphicsEngine->compilePixelShader(L"Upscale.hlsl", "psmain", nullptr, &byte_code))
+	{
+		return false;
+	}
+	m_pixel_shader = f_graphicsEngine->createPixelShader(byte_code->GetBufferPointer(), byte_code->GetBufferSize());
+	byte_code->Release();
+	if (!m_vertex_shader || !m_pixel_shader)
+	{
+		return false;
+	}
+
+	UpscaleConstants constants = {};
+	m_constant_buffer = new ConstantBuffer();
+	if (!m_constant_buffer->load(&constants, sizeof(constants), f_graphicsEngine))
+	{
+		return false;
+	}
+
+	D3D11_SAMPLER_DESC sampler_desc = {};
+	sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+	sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampler_desc.MaxLOD = D3D11_FLOAT32_MAX;
+	if (FAILED(f_graphicsEngine->getDevice()->CreateSamplerState(&sampler_desc, &m_sampler)))
+	{
+		return false;
+	}
+
+	return resize(f_width, f_height);
+}
+
+bool DynamicResolutionTarget::resize(UINT f_width, UINT f_height)
+{
+	if (m_texture && f_width == m_width && f_height == m_height)
+	{
+		return true;
+	}
+	releaseTarget();
+	if (f_width == 0 || f_height == 0)
+	{
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC texture_desc = {};
+	texture_desc.Width = f_width;
+	texture_desc.Height = f_height;
+	texture_desc.MipLevels = 1;
+	texture_desc.ArraySize = 1;
+	texture_desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	texture_desc.SampleDesc.Count = 1;
+	texture_desc.Usage = D3D11_USAGE_DEFAULT;
+	texture_desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+	ID3D11Device* device = m_graphics_engine->getDevice();
+	if (FAILED(device->CreateTexture2D(&texture_desc, nullptr, &m_texture)) ||
+		FAILED(device->CreateRenderTargetView(m_texture, nullptr, &m_rtv)) ||
+		FAILED(device->CreateShaderResourceView(m_texture, nullptr, &m_srv)))
+	{
+		releaseTarget();
+		return false;
+	}
+
+	m_width = f_width;
+	m_height = f_height;
+	m_render_width = f_width;
+	m_render_height = f_height;
+	return true;
+}
+
+void DynamicResolutionTarget::begin(DeviceContext* f_device_context, UINT f_render_width, UINT f_render_height, const FLOAT f_clear_color[4])
+{
+	m_render_width = std::max(1u, std::min(f_render_width, m_width));
+	m_render_height = std::max(1u, std::min(f_render_height, m_height));
+
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	context->ClearRenderTargetView(m_rtv, f_clear_color);
+	context->OMSetRenderTargets(1, &m_rtv, nullptr);
+	f_device_context->setViewportSize(m_render_width, m_render_height);
+}
+
+void DynamicResolutionTarget::upscale(DeviceContext* f_device_context, SwapChain* f_swap_chain)
+{
+	// Sample inside the rendered area only: the last texel centre is the furthest a bilinear tap may go
+	UpscaleConstants constants = {};
+	constants.uv_scale[0] = static_cast<float>(m_render_width) / m_width;
+	constants.uv_scale[1] = static_cast<float>(m_render_height) / m_height;
+	constants.uv_max[0] = (m_render_width - 0.5f) / m_width;
+	constants.uv_max[1] = (m_render_height - 0.5f) / m_height;
+	m_constant_buffer->update(f_device_context, &constants);
+
+	// The whole back buffer is overwritten, the clear only binds it
+	f_device_context->clearRenderTargetColor(f_swap_chain, 0.0f, 0.0f, 0.0f, 1.0f);
+	f_device_context->setViewportSize(m_width, m_height);
+
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	context->IASetInputLayout(nullptr);
+	context->RSSetState(nullptr);
+	context->OMSetBlendState(nullptr, nullptr, 0xffffffff);
+	context->OMSetDepthStencilState(nullptr, 0);
+	f_device_context->setVertexShader(m_vertex_shader);
+	f_device_context->setPixelShader(m_pixel_shader);
+	f_device_context->setConstantBuffer(m_pixel_shader, m_constant_buffer);
+	context->PSSetShaderResources(0, 1, &m_srv);
+	context->PSSetSamplers(0, 1, &m_sampler);
+
+	f_device_context->drawTriangleList(3, 0);
+
+	// Unbind so the target can be bound for output again next frame
+	ID3D11ShaderResourceView* no_view = nullptr;
+	context->PSSetShaderResources(0, 1, &no_view);
+}
+
+void DynamicResolutionTarget::releaseTarget()
+{
+	const unsigned long long texture_bytes = static_cast<unsigned long long>(m_width) * m_height * 4;
+	if (m_srv) ResourceReleaseQueue::get()->deferRelease(m_srv, 0);
+	if (m_rtv) ResourceReleaseQueue::get()->deferRelease(m_rtv, 0);
+	if (m_texture) ResourceReleaseQueue::get()->deferRelease(m_texture, texture_bytes);
+	m_srv = nullptr;
+	m_rtv = nullptr;
+	m_texture = nullptr;
+	m_width = m_height = 0;
+}
+
+void DynamicResolutionTarget::release()
+{
+	releaseTarget();
+	if (m_sampler) ResourceReleaseQueue::get()->deferRelease(m_sampler, 0);
+	if (m_constant_buffer) m_constant_buffer->release();
+	if (m_vertex_shader) m_vertex_shader->release();
+	if (m_pixel_shader) m_pixel_shader->release();
+	delete this;
+}
+
+DynamicResolutionTarget::~DynamicResolutionTarget()
+{
+}
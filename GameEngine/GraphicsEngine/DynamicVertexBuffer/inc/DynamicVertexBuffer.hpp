@@ -0,0 +1,122 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Vertex buffer rewritten by the CPU every frame
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Stream per-frame vertices without creating buffers.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the DynamicVertexBuffer class.
+/// @par Revision History:
+///      $Source: DynamicVertexBuffer.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _DYNAMIC_VERTEX_BUFFER_HPP_
+#define _DYNAMIC_VERTEX_BUFFER_HPP_
+
+#include <d3d11.h>
+
+class DeviceContext;
+class IGraphicsEngine;
+
+/**
+ * @class DynamicVertexBuffer
+ * @brief A D3D11_USAGE_DYNAMIC vertex buffer used as a ring of per-frame vertex streams.
+ *
+ * Every map() appends after the previous one with D3D11_MAP_WRITE_NO_OVERWRITE,
+ * so vertices already handed to the GPU are never touched. When the ring is
+ * full the buffer is mapped with D3D11_MAP_WRITE_DISCARD and writing restarts
+ * at vertex 0; the driver gives the buffer new memory while the frames in
+ * flight keep reading the old one. Bind it once and pass the returned first
+ * vertex as the base vertex of the draws.
+ *
+ * Example usage:
+ * @code
+ * UINT first_vertex = 0;
+ * void* vertices = buffer->map(device_context, vertex_count, 1, &first_vertex);
+ * // ... write vertex_count vertices
+ * buffer->unmap(device_context);
+ * device_context->setVertexBuffer(buffer);
+ * device_context->drawTriangleList(vertex_count, first_vertex);
+ * @endcode
+ */
+class DynamicVertexBuffer
+{
+public:
+	/// <summary>
+	/// Counters since the buffer was created.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long mapped_vertices = 0;
+		UINT maps = 0;
+		UINT discards = 0; // Times the ring wrapped
+	};
+
+	DynamicVertexBuffer();
+
+	/// <summary>
+	/// Creates the ring for f_capacity vertices of f_size_vertex bytes.
+	/// </summary>
+	bool load(UINT f_size_vertex, UINT f_capacity, IGraphicsEngine* f_graphics_engine);
+
+	/// <summary>
+	/// Maps room for f_vertex_count vertices.
+	/// </summary>
+	/// <param name="f_vertex_alignment">The first vertex is a multiple of it, e.g. 4 to keep quads 16 byte aligned.</param>
+	/// <param name="f_first_vertex">Receives the index of the first mapped vertex, the base vertex of the draws.</param>
+	/// <returns>Write-only memory for the vertices, or nullptr if they do not fit in the ring or Map failed.</returns>
+	void* map(DeviceContext* f_context, UINT f_vertex_count, UINT f_vertex_alignment, UINT* f_first_vertex);
+
+	/// <summary>
+	/// Ends the write started by map().
+	/// </summary>
+	void unmap(DeviceContext* f_context);
+
+	UINT getCapacity() const { return m_capacity; }
+	UINT getSizeVertex() const { return m_size_vertex; }
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	bool release();
+	~DynamicVertexBuffer();
+private:
+	UINT m_size_vertex;
+	UINT m_capacity;
+	UINT m_write_vertex;
+	ID3D11Buffer* m_buffer;
+	Statistics m_statistics;
+
+	// The range of the last map(), recorded at unmap() while a capture runs
+	unsigned char* m_mapped;
+	UINT m_mapped_first;
+	UINT m_mapped_count;
+	friend class DeviceContext;
+};
+
+#endif // !_DYNAMIC_VERTEX_BUFFER_HPP_
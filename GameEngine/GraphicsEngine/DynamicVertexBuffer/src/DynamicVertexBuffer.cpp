@@ -0,0 +1,136 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Vertex buffer rewritten by the CPU every frame
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Stream per-frame vertices without creating buffers.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the DynamicVertexBuffer class.
+/// @par Revision History:
+///      $Source: DynamicVertexBuffer.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "DynamicVertexBuffer.hpp"
+#include "GraphicsEngine.hpp"
+#include "DeviceContext.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include "CommandRecorder.hpp"
+
+DynamicVertexBuffer::DynamicVertexBuffer()
+	: m_size_vertex(0), m_capacity(0), m_write_vertex(0), m_buffer(nullptr), m_mapped(nullptr), m_mapped_first(0), m_mapped_count(0)
+{
+}
+
+bool DynamicVertexBuffer::load(UINT f_size_vertex, UINT f_capacity, IGraphicsEngine* f_graphics_engine)
+{
+	if (m_buffer) ResourceReleaseQueue::get()->deferRelease(m_buffer, m_size_vertex * m_capacity);
+	m_buffer = nullptr;
+
+	D3D11_BUFFER_DESC buff_desc = {};
+	buff_desc.Usage = D3D11_USAGE_DYNAMIC;
+	buff_desc.ByteWidth = f_size_vertex * f_capacity;
+	buff_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	buff_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	buff_desc.MiscFlags = 0;
+
+	m_size_vertex = f_size_vertex;
+	m_capacity = f_capacity;
+	// The first map of a dynamic buffer has to discard
+	m_write_vertex = f_capacity;
+
+	if (FAILED(f_graphics_engine->getDevice()->CreateBuffer(&buff_desc, nullptr, &m_buffer)))
+	{
+		return false;
+	}
+
+	CommandRecorder::get()->onCreateBuffer(this, CommandBufferKind::DynamicVertex, f_size_vertex, buff_desc.ByteWidth, nullptr);
+	return true;
+}
+
+void* DynamicVertexBuffer::map(DeviceContext* f_context, UINT f_vertex_count, UINT f_vertex_alignment, UINT* f_first_vertex)
+{
+	if (!m_buffer || f_vertex_count == 0 || f_vertex_count > m_capacity)
+	{
+		return nullptr;
+	}
+
+	UINT first_vertex = m_write_vertex;
+	if (f_vertex_alignment > 1)
+	{
+		first_vertex = (first_vertex + f_vertex_alignment - 1) / f_vertex_alignment * f_vertex_alignment;
+	}
+
+	D3D11_MAP map_type = D3D11_MAP_WRITE_NO_OVERWRITE;
+	if (first_vertex >= m_capacity || f_vertex_count > m_capacity - first_vertex)
+	{
+		map_type = D3D11_MAP_WRITE_DISCARD;
+		first_vertex = 0;
+		m_statistics.discards++;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE mapped = {};
+	if (FAILED(f_context->getDeviceContext()->Map(m_buffer, 0, map_type, 0, &mapped)))
+	{
+		return nullptr;
+	}
+
+	m_write_vertex = first_vertex + f_vertex_count;
+	m_statistics.maps++;
+	m_statistics.mapped_vertices += f_vertex_count;
+	if (f_first_vertex) *f_first_vertex = first_vertex;
+	m_mapped = static_cast<unsigned char*>(mapped.pData) + static_cast<size_t>(first_vertex) * m_size_vertex;
+	m_mapped_first = first_vertex;
+	m_mapped_count = f_vertex_count;
+	return m_mapped;
+}
+
+void DynamicVertexBuffer::unmap(DeviceContext* f_context)
+{
+	// Reading back write-combined memory is slow, but only done while capturing
+	CommandRecorder* recorder = CommandRecorder::get();
+	if (recorder->isCapturing() && m_mapped)
+	{
+		recorder->onUpdateBuffer(this, m_mapped_first * m_size_vertex, m_mapped, m_mapped_count * m_size_vertex);
+	}
+	m_mapped = nullptr;
+	f_context->getDeviceContext()->Unmap(m_buffer, 0);
+}
+
+bool DynamicVertexBuffer::release()
+{
+	CommandRecorder::get()->onRelease(this);
+	ResourceReleaseQueue::get()->deferRelease(m_buffer, m_size_vertex * m_capacity);
+	delete this;
+	return true;
+}
+
+DynamicVertexBuffer::~DynamicVertexBuffer()
+{
+}
@@ -0,0 +1,225 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: TrueType glyph outlines and rasterization
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Rasterization is pure CPU work on the font data, so glyphs can be
+//    produced and tested on any platform and off the render thread.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Rasterize glyphs on the CPU without a platform font API.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the Font class and the glyph bitmap.
+/// @par Revision History:
+///      $Source: Font.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/04 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _FONT_HPP_
+#define _FONT_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// What a glyph bitmap stores per pixel.
+/// </summary>
+enum class GlyphRasterMode : unsigned char
+{
+	/// <summary>
+	/// Antialiased coverage, 255 inside the outline.
+	/// </summary>
+	Coverage,
+
+	/// <summary>
+	/// Signed distance to the outline, 128 on the edge and larger inside.
+	/// Scales to any size from one raster.
+	/// </summary>
+	SignedDistance
+};
+
+/// <summary>
+/// An 8 bit glyph image and where it sits relative to the pen.
+/// </summary>
+struct GlyphBitmap
+{
+	int width = 0;
+	int height = 0;
+
+	/// <summary>
+	/// Offset of the top-left pixel from the pen position on the baseline, y down.
+	/// </summary>
+	int offset_x = 0;
+	int offset_y = 0;
+
+	std::vector<unsigned char> pixels;
+};
+
+/// <summary>
+/// Vertical metrics of a font at a pixel height, y down from the baseline.
+/// </summary>
+struct FontLineMetrics
+{
+	float ascent = 0.0f;
+	float descent = 0.0f;
+	float line_gap = 0.0f;
+};
+
+/**
+ * @class Font
+ * @brief A TrueType font: character mapping, metrics, kerning and glyph rasterization.
+ *
+ * Reads the sfnt tables of a .ttf (cmap formats 4 and 12, simple and composite
+ * glyf outlines, hmtx and the kern format 0 pairs) and rasterizes glyphs into
+ * antialiased coverage with a signed area accumulation, or into a signed
+ * distance field. Hinting, OpenType layout and CFF outlines are not supported.
+ * A pixel height is the distance from the ascender to the descender.
+ *
+ * Example usage:
+ * @code
+ * Font font;
+ * font.loadFile("Fonts/Roboto-Regular.ttf");
+ * GlyphBitmap bitmap;
+ * font.rasterize(font.getGlyphIndex('A'), 24.0f, GlyphRasterMode::Coverage, bitmap);
+ * @endcode
+ */
+class Font
+{
+public:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	Font();
+	~Font();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Copies and parses a TrueType font.
+	/// </summary>
+	/// <returns>False if the data is not a TrueType font with glyf outlines.</returns>
+	bool load(const unsigned char* f_data, size_t f_size);
+
+	/// <summary>
+	/// Reads and parses a TrueType font file.
+	/// </summary>
+	bool loadFile(const char* f_file_name);
+
+	bool isLoaded() const { return m_glyph_count != 0; }
+
+	/// <summary>
+	/// Glyph of a Unicode code point, 0 (the missing glyph) if the font has none.
+	/// </summary>
+	unsigned int getGlyphIndex(unsigned int f_codepoint) const;
+
+	/// <summary>
+	/// Font units to pixels at the pixel height.
+	/// </summary>
+	float getScale(float f_pixel_height) const;
+
+	FontLineMetrics getLineMetrics(float f_pixel_height) const;
+
+	/// <summary>
+	/// Horizontal advance of the glyph in pixels.
+	/// </summary>
+	float getAdvance(unsigned int f_glyph, float f_pixel_height) const;
+
+	/// <summary>
+	/// Kerning adjustment between two glyphs in pixels, 0 if the pair is not kerned.
+	/// </summary>
+	float getKerning(unsigned int f_left_glyph, unsigned int f_right_glyph, float f_pixel_height) const;
+
+	/// <summary>
+	/// Rasterizes a glyph. Glyphs without an outline, like the space, give an empty bitmap.
+	/// </summary>
+	/// <param name="f_bitmap">Receives the image; its pixel storage is reused between calls.</param>
+	/// <returns>False if the glyph does not exist or its outline is malformed.</returns>
+	bool rasterize(unsigned int f_glyph, float f_pixel_height, GlyphRasterMode f_mode, GlyphBitmap& f_bitmap) const;
+
+	/// <summary>
+	/// Padding in pixels around a signed distance glyph, the distance at which the field saturates.
+	/// </summary>
+	static constexpr int distance_spread = 4;
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Point
+	{
+		float x;
+		float y;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Reads the table directory and the tables every glyph lookup needs.
+	/// </summary>
+	bool parse();
+
+	/// <summary>
+	/// Appends the glyph outline in pixels as closed polylines, curves flattened.
+	/// </summary>
+	/// <param name="f_transform">2x3 matrix from font units to pixels: x' = t0 x + t2 y + t4, y' = t1 x + t3 y + t5.</param>
+	bool appendOutline(unsigned int f_glyph, const float f_transform[6], int f_depth,
+		std::vector<Point>& f_points, std::vector<unsigned int>& f_contour_ends) const;
+
+	bool getGlyphData(unsigned int f_glyph, size_t& f_offset, size_t& f_length) const;
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<unsigned char> m_data;
+	unsigned int m_glyph_count;
+	unsigned int m_units_per_em;
+	int m_ascent;
+	int m_descent;
+	int m_line_gap;
+	unsigned int m_h_metric_count;
+	bool m_long_loca;
+
+	// Table offsets into m_data, 0 when absent
+	size_t m_cmap;
+	size_t m_loca;
+	size_t m_glyf;
+	size_t m_hmtx;
+	size_t m_kern_pairs;
+	unsigned int m_kern_pair_count;
+	size_t m_glyf_size;
+};
+
+#endif // !_FONT_HPP_
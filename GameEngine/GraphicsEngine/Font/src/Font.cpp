@@ -0,0 +1,861 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: TrueType glyph outlines and rasterization
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Rasterize glyphs on the CPU without a platform font API.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the Font class.
+/// @par Revision History:
+///      $Source: Font.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/04 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "Font.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace
+{
+	constexpr int max_composite_depth = 8;
+	constexpr float flatten_tolerance = 0.2f;
+	constexpr float distance_infinity = 1e20f;
+
+	unsigned int readU16(const unsigned char* f_data) { return (f_data[0] << 8) | f_data[1]; }
+	int readS16(const unsigned char* f_data) { return static_cast<short>(readU16(f_data)); }
+	unsigned int readU32(const unsigned char* f_data) { return (readU16(f_data) << 16) | readU16(f_data + 2); }
+	float readF2Dot14(const unsigned char* f_data) { return readS16(f_data) / 16384.0f; }
+
+	unsigned int makeTag(const char* f_tag)
+	{
+		return (static_cast<unsigned int>(f_tag[0]) << 24) | (f_tag[1] << 16) | (f_tag[2] << 8) | f_tag[3];
+	}
+
+	// Signed area accumulation: every edge adds the area it covers to the cells of the rows it
+	// crosses, with the remainder carried one cell to the right. A running sum along a row then
+	// gives the winding coverage of each pixel.
+	void accumulateLine(float* f_accumulation, int f_height, int f_stride, float f_x0, float f_y0, float f_x1, float f_y1)
+	{
+		if (std::fabs(f_y0 - f_y1) <= 1e-7f)
+		{
+			return;
+		}
+
+		float direction = 1.0f;
+		if (f_y0 > f_y1)
+		{
+			std::swap(f_x0, f_x1);
+			std::swap(f_y0, f_y1);
+			direction = -1.0f;
+		}
+
+		const float dxdy = (f_x1 - f_x0) / (f_y1 - f_y0);
+		float x = f_x0;
+		if (f_y0 < 0.0f)
+		{
+			x -= f_y0 * dxdy;
+		}
+
+		const int row_end = std::min(f_height, static_cast<int>(std::ceil(f_y1)));
+		for (int y = std::max(0, static_cast<int>(f_y0)); y < row_end; ++y)
+		{
+			float* row = f_accumulation + static_cast<size_t>(y) * f_stride;
+			const float dy = std::min(static_cast<float>(y + 1), f_y1) - std::max(static_cast<float>(y), f_y0);
+			const float x_next = x + dxdy * dy;
+			const float d = dy * direction;
+
+			const float x_left = std::min(x, x_next);
+			const float x_right = std::max(x, x_next);
+			const float x_left_floor = std::floor(x_left);
+			const int left = static_cast<int>(x_left_floor);
+			const float x_right_ceil = std::ceil(x_right);
+			const int right = static_cast<int>(x_right_ceil);
+
+			if (right <= left + 1)
+			{
+				// The edge stays inside one pixel column on this row
+				const float x_middle = 0.5f * (x + x_next) - x_left_floor;
+				row[left] += d - d * x_middle;
+				row[left + 1] += d * x_middle;
+			}
+			else
+			{
+				const float inverse_width = 1.0f / (x_right - x_left);
+				const float left_fraction = x_left - x_left_floor;
+				const float area_first = 0.5f * inverse_width * (1.0f - left_fraction) * (1.0f - left_fraction);
+				const float right_fraction = x_right - x_right_ceil + 1.0f;
+				const float area_last = 0.5f * inverse_width * right_fraction * right_fraction;
+
+				row[left] += d * area_first;
+				if (right == left + 2)
+				{
+					row[left + 1] += d * (1.0f - area_first - area_last);
+				}
+				else
+				{
+					const float area_second = inverse_width * (1.5f - left_fraction);
+					row[left + 1] += d * (area_second - area_first);
+					for (int column = left + 2; column < right - 1; ++column)
+					{
+						row[column] += d * inverse_width;
+					}
+					const float area_before_last = area_second + (right - left - 3) * inverse_width;
+					row[right - 1] += d * (1.0f - area_before_last - area_last);
+				}
+				row[right] += d * area_last;
+			}
+			x = x_next;
+		}
+	}
+
+	// One pass of the Felzenszwalb-Huttenlocher squared distance transform: lower envelope of parabolas
+	void transformLine(float* f_grid, size_t f_offset, size_t f_stride, int f_length, float* f_values, int* f_vertices, float* f_bounds)
+	{
+		f_vertices[0] = 0;
+		f_bounds[0] = -distance_infinity;
+		f_bounds[1] = distance_infinity;
+		f_values[0] = f_grid[f_offset];
+
+		for (int q = 1, k = 0; q < f_length; ++q)
+		{
+			f_values[q] = f_grid[f_offset + q * f_stride];
+			const float q2 = static_cast<float>(q) * q;
+			float s = 0.0f;
+			do
+			{
+				const int r = f_vertices[k];
+				s = (f_values[q] - f_values[r] + q2 - static_cast<float>(r) * r) / (q - r) / 2.0f;
+			} while (s <= f_bounds[k] && --k > -1);
+
+			++k;
+			f_vertices[k] = q;
+			f_bounds[k] = s;
+			f_bounds[k + 1] = distance_infinity;
+		}
+
+		for (int q = 0, k = 0; q < f_length; ++q)
+		{
+			while (f_bounds[k + 1] < q)
+			{
+				++k;
+			}
+			const int r = f_vertices[k];
+			f_grid[f_offset + q * f_stride] = f_values[r] + static_cast<float>(q - r) * (q - r);
+		}
+	}
+
+	void transformGrid(float* f_grid, int f_width, int f_height, std::vector<float>& f_values, std::vector<int>& f_vertices, std::vector<float>& f_bounds)
+	{
+		for (int x = 0; x < f_width; ++x)
+		{
+			transformLine(f_grid, x, f_width, f_height, f_values.data(), f_vertices.data(), f_bounds.data());
+		}
+		for (int y = 0; y < f_height; ++y)
+		{
+			transformLine(f_grid, static_cast<size_t>(y) * f_width, 1, f_width, f_values.data(), f_vertices.data(), f_bounds.data());
+		}
+	}
+}
+
+Font::Font() : m_glyph_count(0), m_units_per_em(0), m_ascent(0), m_descent(0), m_line_gap(0), m_h_metric_count(0),
+	m_long_loca(false), m_cmap(0), m_loca(0), m_glyf(0), m_hmtx(0), m_kern_pairs(0), m_kern_pair_count(0), m_glyf_size(0)
+{
+}
+
+bool Font::load(const unsigned char* f_data, size_t f_size)
+{
+	if (!f_data)
+	{
+		return false;
+	}
+
+	m_data.assign(f_data, f_data + f_size);
+	return parse();
+}
+
+bool Font::loadFile(const char* f_file_name)
+{
+	std::ifstream file(f_file_name, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		return false;
+	}
+
+	const std::streamsize size = file.tellg();
+	file.seekg(0, std::ios::beg);
+	m_data.resize(static_cast<size_t>(size));
+	if (!file.read(reinterpret_cast<char*>(m_data.data()), size))
+	{
+		m_data.clear();
+		return false;
+	}
+	return parse();
+}
+
+bool Font::parse()
+{
+	m_glyph_count = 0;
+	m_kern_pairs = 0;
+	m_kern_pair_count = 0;
+
+	const unsigned char* data = m_data.data();
+	const size_t size = m_data.size();
+	if (size < 12 || (readU32(data) != 0x00010000 && readU32(data) != makeTag("true")))
+	{
+		return false;
+	}
+
+	size_t head = 0, hhea = 0, maxp = 0, kern = 0;
+	size_t head_size = 0, hhea_size = 0, maxp_size = 0, hmtx_size = 0, loca_size = 0, cmap_size = 0, kern_size = 0;
+	m_cmap = m_loca = m_glyf = m_hmtx = 0;
+
+	const unsigned int table_count = readU16(data + 4);
+	if (12 + static_cast<size_t>(table_count) * 16 > size)
+	{
+		return false;
+	}
+	for (unsigned int i = 0; i < table_count; ++i)
+	{
+		const unsigned char* record = data + 12 + i * 16;
+		const unsigned int tag = readU32(record);
+		const size_t offset = readU32(record + 8);
+		const size_t length = readU32(record + 12);
+		if (offset > size || length > size - offset)
+		{
+			return false;
+		}
+
+		if (tag == makeTag("head")) { head = offset; head_size = length; }
+		else if (tag == makeTag("hhea")) { hhea = offset; hhea_size = length; }
+		else if (tag == makeTag("maxp")) { maxp = offset; maxp_size = length; }
+		else if (tag == makeTag("hmtx")) { m_hmtx = offset; hmtx_size = length; }
+		else if (tag == makeTag("loca")) { m_loca = offset; loca_size = length; }
+		else if (tag == makeTag("glyf")) { m_glyf = offset; m_glyf_size = length; }
+		else if (tag == makeTag("cmap")) { m_cmap = offset; cmap_size = length; }
+		else if (tag == makeTag("kern")) { kern = offset; kern_size = length; }
+	}
+
+	if (head_size < 54 || hhea_size < 36 || maxp_size < 6 || !m_hmtx || !m_loca || !m_glyf || cmap_size < 4)
+	{
+		return false;
+	}
+
+	m_units_per_em = readU16(data + head + 18);
+	m_long_loca = readS16(data + head + 50) != 0;
+	m_ascent = readS16(data + hhea + 4);
+	m_descent = readS16(data + hhea + 6);
+	m_line_gap = readS16(data + hhea + 8);
+	m_h_metric_count = readU16(data + hhea + 34);
+	const unsigned int glyph_count = readU16(data + maxp + 4);
+
+	if (m_units_per_em == 0 || glyph_count == 0 || m_h_metric_count == 0 || hmtx_size < m_h_metric_count * 4u ||
+		loca_size < (glyph_count + 1u) * (m_long_loca ? 4u : 2u))
+	{
+		return false;
+	}
+
+	// Prefer the full Unicode mapping, fall back to the basic plane
+	const size_t cmap = m_cmap;
+	m_cmap = 0;
+	int best_score = 0;
+	const unsigned int subtable_count = readU16(data + cmap + 2);
+	for (unsigned int i = 0; i < subtable_count && 4 + (i + 1) * 8 <= cmap_size; ++i)
+	{
+		const unsigned char* record = data + cmap + 4 + i * 8;
+		const unsigned int platform = readU16(record);
+		const unsigned int encoding = readU16(record + 2);
+		const size_t offset = readU32(record + 4);
+		if (offset + 8 > cmap_size || (platform != 0 && !(platform == 3 && (encoding == 1 || encoding == 10))))
+		{
+			continue;
+		}
+
+		const unsigned int format = readU16(data + cmap + offset);
+		const size_t length = format == 12 ? readU32(data + cmap + offset + 4) : readU16(data + cmap + offset + 2);
+		const int score = format == 12 ? 2 : format == 4 ? 1 : 0;
+		if (score > best_score && length <= cmap_size - offset)
+		{
+			best_score = score;
+			m_cmap = cmap + offset;
+		}
+	}
+	if (!m_cmap)
+	{
+		return false;
+	}
+
+	// Only the classic horizontal pair list; class based kerning lives in GPOS and is not read
+	if (kern_size >= 18 && readU16(data + kern) == 0 && readU16(data + kern + 2) > 0)
+	{
+		const unsigned int coverage = readU16(data + kern + 8);
+		const unsigned int pair_count = readU16(data + kern + 10);
+		if ((coverage >> 8) == 0 && (coverage & 1) && 18 + pair_count * 6u <= kern_size)
+		{
+			m_kern_pairs = kern + 18;
+			m_kern_pair_count = pair_count;
+		}
+	}
+
+	m_glyph_count = glyph_count;
+	return true;
+}
+
+unsigned int Font::getGlyphIndex(unsigned int f_codepoint) const
+{
+	if (!isLoaded())
+	{
+		return 0;
+	}
+
+	const unsigned char* table = m_data.data() + m_cmap;
+	const unsigned int format = readU16(table);
+	unsigned int glyph = 0;
+	if (format == 4)
+	{
+		if (f_codepoint > 0xffff)
+		{
+			return 0;
+		}
+
+		const unsigned int length = readU16(table + 2);
+		const unsigned int segment_count = readU16(table + 6) / 2;
+		if (16 + segment_count * 8u > length)
+		{
+			return 0;
+		}
+		const unsigned char* end_codes = table + 14;
+		const unsigned char* start_codes = table + 16 + segment_count * 2;
+		const unsigned char* deltas = start_codes + segment_count * 2;
+		const unsigned char* range_offsets = deltas + segment_count * 2;
+
+		// First segment whose end code is not below the code point
+		unsigned int low = 0, high = segment_count;
+		while (low < high)
+		{
+			const unsigned int middle = (low + high) / 2;
+			if (readU16(end_codes + middle * 2) < f_codepoint) low = middle + 1;
+			else high = middle;
+		}
+		if (low == segment_count || readU16(start_codes + low * 2) > f_codepoint)
+		{
+			return 0;
+		}
+
+		const unsigned int start = readU16(start_codes + low * 2);
+		const unsigned int delta = readU16(deltas + low * 2);
+		const unsigned int range_offset = readU16(range_offsets + low * 2);
+		if (range_offset == 0)
+		{
+			glyph = (f_codepoint + delta) & 0xffff;
+		}
+		else
+		{
+			const size_t position = static_cast<size_t>(range_offsets + low * 2 - table) + range_offset + (f_codepoint - start) * 2;
+			if (position + 2 > length)
+			{
+				return 0;
+			}
+			glyph = readU16(table + position);
+			if (glyph) glyph = (glyph + delta) & 0xffff;
+		}
+	}
+	else if (format == 12)
+	{
+		const unsigned int group_count = readU32(table + 12);
+		if (16 + static_cast<size_t>(group_count) * 12 > readU32(table + 4))
+		{
+			return 0;
+		}
+
+		unsigned int low = 0, high = group_count;
+		while (low < high)
+		{
+			const unsigned int middle = (low + high) / 2;
+			const unsigned char* group = table + 16 + middle * 12;
+			if (f_codepoint < readU32(group)) high = middle;
+			else if (f_codepoint > readU32(group + 4)) low = middle + 1;
+			else
+			{
+				glyph = readU32(group + 8) + (f_codepoint - readU32(group));
+				break;
+			}
+		}
+	}
+	return glyph < m_glyph_count ? glyph : 0;
+}
+
+float Font::getScale(float f_pixel_height) const
+{
+	const int height = m_ascent - m_descent;
+	return f_pixel_height / static_cast<float>(height > 0 ? height : static_cast<int>(m_units_per_em));
+}
+
+FontLineMetrics Font::getLineMetrics(float f_pixel_height) const
+{
+	const float scale = getScale(f_pixel_height);
+	FontLineMetrics metrics;
+	metrics.ascent = m_ascent * scale;
+	metrics.descent = -m_descent * scale;
+	metrics.line_gap = m_line_gap * scale;
+	return metrics;
+}
+
+float Font::getAdvance(unsigned int f_glyph, float f_pixel_height) const
+{
+	if (!isLoaded() || f_glyph >= m_glyph_count)
+	{
+		return 0.0f;
+	}
+
+	const unsigned int metric = std::min(f_glyph, m_h_metric_count - 1);
+	return readU16(m_data.data() + m_hmtx + metric * 4) * getScale(f_pixel_height);
+}
+
+float Font::getKerning(unsigned int f_left_glyph, unsigned int f_right_glyph, float f_pixel_height) const
+{
+	if (!m_kern_pair_count)
+	{
+		return 0.0f;
+	}
+
+	// Pairs are sorted by the left and right glyph packed into one key
+	const unsigned int key = (f_left_glyph << 16) | f_right_glyph;
+	const unsigned char* pairs = m_data.data() + m_kern_pairs;
+	unsigned int low = 0, high = m_kern_pair_count;
+	while (low < high)
+	{
+		const unsigned int middle = (low + high) / 2;
+		const unsigned int pair_key = readU32(pairs + middle * 6);
+		if (pair_key < key) low = middle + 1;
+		else if (pair_key > key) high = middle;
+		else return readS16(pairs + middle * 6 + 4) * getScale(f_pixel_height);
+	}
+	return 0.0f;
+}
+
+bool Font::getGlyphData(unsigned int f_glyph, size_t& f_offset, size_t& f_length) const
+{
+	const unsigned char* loca = m_data.data() + m_loca;
+	const size_t begin = m_long_loca ? readU32(loca + f_glyph * 4) : readU16(loca + f_glyph * 2) * 2u;
+	const size_t end = m_long_loca ? readU32(loca + f_glyph * 4 + 4) : readU16(loca + f_glyph * 2 + 2) * 2u;
+	if (end < begin || end > m_glyf_size)
+	{
+		return false;
+	}
+
+	f_offset = m_glyf + begin;
+	f_length = end - begin;
+	return true;
+}
+
+bool Font::appendOutline(unsigned int f_glyph, const float f_transform[6], int f_depth,
+	std::vector<Point>& f_points, std::vector<unsigned int>& f_contour_ends) const
+{
+	size_t offset = 0, length = 0;
+	if (f_glyph >= m_glyph_count || !getGlyphData(f_glyph, offset, length))
+	{
+		return false;
+	}
+	if (length == 0)
+	{
+		return true;
+	}
+	if (length < 10)
+	{
+		return false;
+	}
+
+	const unsigned char* glyph = m_data.data() + offset;
+	const unsigned char* glyph_end = glyph + length;
+	const int contour_count = readS16(glyph);
+
+	if (contour_count < 0)
+	{
+		if (f_depth >= max_composite_depth)
+		{
+			return false;
+		}
+
+		const unsigned char* component = glyph + 10;
+		unsigned int flags = 0;
+		do
+		{
+			if (component + 6 > glyph_end)
+			{
+				return false;
+			}
+			flags = readU16(component);
+			const unsigned int component_glyph = readU16(component + 2);
+			component += 4;
+
+			float dx = 0.0f, dy = 0.0f;
+			if (flags & 0x0001)
+			{
+				dx = static_cast<float>(readS16(component));
+				dy = static_cast<float>(readS16(component + 2));
+				component += 4;
+			}
+			else
+			{
+				dx = static_cast<signed char>(component[0]);
+				dy = static_cast<signed char>(component[1]);
+				component += 2;
+			}
+			if (!(flags & 0x0002))
+			{
+				// Anchored by matching points rather than by offset; rare outside of hinted CJK fonts
+				dx = dy = 0.0f;
+			}
+
+			float a = 1.0f, b = 0.0f, c = 0.0f, d = 1.0f;
+			if (flags & 0x0008)
+			{
+				a = d = readF2Dot14(component);
+				component += 2;
+			}
+			else if (flags & 0x0040)
+			{
+				a = readF2Dot14(component);
+				d = readF2Dot14(component + 2);
+				component += 4;
+			}
+			else if (flags & 0x0080)
+			{
+				a = readF2Dot14(component);
+				b = readF2Dot14(component + 2);
+				c = readF2Dot14(component + 4);
+				d = readF2Dot14(component + 6);
+				component += 8;
+			}
+			if (component > glyph_end)
+			{
+				return false;
+			}
+
+			const float* t = f_transform;
+			const float transform[6] =
+			{
+				t[0] * a + t[2] * b, t[1] * a + t[3] * b,
+				t[0] * c + t[2] * d, t[1] * c + t[3] * d,
+				t[0] * dx + t[2] * dy + t[4], t[1] * dx + t[3] * dy + t[5]
+			};
+			if (!appendOutline(component_glyph, transform, f_depth + 1, f_points, f_contour_ends))
+			{
+				return false;
+			}
+		} while (flags & 0x0020);
+		return true;
+	}
+
+	if (10 + contour_count * 2 + 2 > static_cast<int>(length))
+	{
+		return false;
+	}
+	const unsigned char* end_points = glyph + 10;
+	const unsigned int point_count = contour_count ? readU16(end_points + (contour_count - 1) * 2) + 1 : 0;
+	const unsigned int instruction_length = readU16(end_points + contour_count * 2);
+	const unsigned char* cursor = end_points + contour_count * 2 + 2 + instruction_length;
+
+	std::vector<unsigned char> flags(point_count);
+	for (unsigned int i = 0; i < point_count; )
+	{
+		if (cursor >= glyph_end)
+		{
+			return false;
+		}
+		const unsigned char flag = *cursor++;
+		flags[i++] = flag;
+		if (flag & 0x08)
+		{
+			if (cursor >= glyph_end)
+			{
+				return false;
+			}
+			for (unsigned int repeat = *cursor++; repeat > 0 && i < point_count; --repeat)
+			{
+				flags[i++] = flag;
+			}
+		}
+	}
+
+	// Coordinates are deltas, one or two bytes each depending on the flags
+	std::vector<Point> coordinates(point_count);
+	for (int axis = 0; axis < 2; ++axis)
+	{
+		const unsigned char short_bit = axis == 0 ? 0x02 : 0x04;
+		const unsigned char same_bit = axis == 0 ? 0x10 : 0x20;
+		int value = 0;
+		for (unsigned int i = 0; i < point_count; ++i)
+		{
+			if (flags[i] & short_bit)
+			{
+				if (cursor + 1 > glyph_end)
+				{
+					return false;
+				}
+				value += (flags[i] & same_bit) ? *cursor : -static_cast<int>(*cursor);
+				cursor += 1;
+			}
+			else if (!(flags[i] & same_bit))
+			{
+				if (cursor + 2 > glyph_end)
+				{
+					return false;
+				}
+				value += readS16(cursor);
+				cursor += 2;
+			}
+			(axis == 0 ? coordinates[i].x : coordinates[i].y) = static_cast<float>(value);
+		}
+	}
+
+	const float* t = f_transform;
+	auto transform = [t](const Point& f_point) -> Point
+	{
+		return { t[0] * f_point.x + t[2] * f_point.y + t[4], t[1] * f_point.x + t[3] * f_point.y + t[5] };
+	};
+	auto middle = [](const Point& f_a, const Point& f_b) -> Point
+	{
+		return { 0.5f * (f_a.x + f_b.x), 0.5f * (f_a.y + f_b.y) };
+	};
+	auto appendCurve = [&f_points](const Point& f_from, const Point& f_control, const Point& f_to)
+	{
+		const float ddx = f_from.x - 2.0f * f_control.x + f_to.x;
+		const float ddy = f_from.y - 2.0f * f_control.y + f_to.y;
+		const float deviation = std::sqrt(ddx * ddx + ddy * ddy);
+		const int steps = std::max(1, std::min(32, static_cast<int>(std::ceil(std::sqrt(deviation / (4.0f * flatten_tolerance))))));
+		for (int step = 1; step <= steps; ++step)
+		{
+			const float s = static_cast<float>(step) / steps;
+			const float r = 1.0f - s;
+			f_points.push_back({ r * r * f_from.x + 2.0f * r * s * f_control.x + s * s * f_to.x,
+				r * r * f_from.y + 2.0f * r * s * f_control.y + s * s * f_to.y });
+		}
+	};
+
+	unsigned int contour_start = 0;
+	for (int contour = 0; contour < contour_count; ++contour)
+	{
+		const unsigned int contour_end = readU16(end_points + contour * 2);
+		if (contour_end < contour_start || contour_end >= point_count)
+		{
+			return false;
+		}
+		const unsigned int count = contour_end - contour_start + 1;
+		auto isOnCurve = [&](unsigned int f_index) { return (flags[contour_start + f_index % count] & 0x01) != 0; };
+		auto pointAt = [&](unsigned int f_index) { return transform(coordinates[contour_start + f_index % count]); };
+
+		// Start on an on-curve point, or between two control points when the contour has none
+		unsigned int first_on = 0;
+		while (first_on < count && !isOnCurve(first_on))
+		{
+			first_on++;
+		}
+		const bool all_off = first_on == count;
+		const Point begin = all_off ? middle(pointAt(count - 1), pointAt(0)) : pointAt(first_on);
+		const unsigned int first = all_off ? 0 : first_on + 1;
+		const unsigned int last = all_off ? count : first_on + count + 1;
+
+		f_points.push_back(begin);
+		Point current = begin;
+		Point control = begin;
+		bool has_control = false;
+		for (unsigned int i = first; i < last; ++i)
+		{
+			const bool on_curve = isOnCurve(i);
+			const Point point = pointAt(i);
+			if (on_curve)
+			{
+				if (has_control) appendCurve(current, control, point);
+				else f_points.push_back(point);
+				current = point;
+				has_control = false;
+			}
+			else
+			{
+				if (has_control)
+				{
+					const Point implied = middle(control, point);
+					appendCurve(current, control, implied);
+					current = implied;
+				}
+				control = point;
+				has_control = true;
+			}
+		}
+		if (all_off)
+		{
+			if (has_control) appendCurve(current, control, begin);
+			else f_points.push_back(begin);
+		}
+
+		f_contour_ends.push_back(static_cast<unsigned int>(f_points.size()));
+		contour_start = contour_end + 1;
+	}
+	return true;
+}
+
+bool Font::rasterize(unsigned int f_glyph, float f_pixel_height, GlyphRasterMode f_mode, GlyphBitmap& f_bitmap) const
+{
+	f_bitmap.width = f_bitmap.height = 0;
+	f_bitmap.offset_x = f_bitmap.offset_y = 0;
+	f_bitmap.pixels.clear();
+	if (!isLoaded() || f_glyph >= m_glyph_count || !(f_pixel_height > 0.0f))
+	{
+		return false;
+	}
+
+	// Flip y so the bitmap grows downward from the baseline
+	const float scale = getScale(f_pixel_height);
+	const float transform[6] = { scale, 0.0f, 0.0f, -scale, 0.0f, 0.0f };
+	std::vector<Point> points;
+	std::vector<unsigned int> contour_ends;
+	if (!appendOutline(f_glyph, transform, 0, points, contour_ends))
+	{
+		return false;
+	}
+	if (points.empty())
+	{
+		return true;
+	}
+
+	float min_x = points[0].x, max_x = points[0].x, min_y = points[0].y, max_y = points[0].y;
+	for (const Point& point : points)
+	{
+		min_x = std::min(min_x, point.x);
+		max_x = std::max(max_x, point.x);
+		min_y = std::min(min_y, point.y);
+		max_y = std::max(max_y, point.y);
+	}
+
+	const int padding = f_mode == GlyphRasterMode::SignedDistance ? distance_spread : 0;
+	const int left = static_cast<int>(std::floor(min_x)) - padding;
+	const int top = static_cast<int>(std::floor(min_y)) - padding;
+	const int width = std::max(1, static_cast<int>(std::ceil(max_x)) + padding - left);
+	const int height = std::max(1, static_cast<int>(std::ceil(max_y)) + padding - top);
+	if (width > 4096 || height > 4096)
+	{
+		return false;
+	}
+
+	const int stride = width + 2;
+	std::vector<float> accumulation(static_cast<size_t>(stride) * height, 0.0f);
+	unsigned int contour_begin = 0;
+	for (unsigned int contour_end : contour_ends)
+	{
+		for (unsigned int i = contour_begin; i < contour_end; ++i)
+		{
+			const Point& from = points[i];
+			const Point& to = points[i + 1 < contour_end ? i + 1 : contour_begin];
+			accumulateLine(accumulation.data(), height, stride, from.x - left, from.y - top, to.x - left, to.y - top);
+		}
+		contour_begin = contour_end;
+	}
+
+	f_bitmap.width = width;
+	f_bitmap.height = height;
+	f_bitmap.offset_x = left;
+	f_bitmap.offset_y = top;
+	f_bitmap.pixels.resize(static_cast<size_t>(width) * height);
+
+	// Coverage is the running sum of the row; reuse the accumulation in place
+	for (int y = 0; y < height; ++y)
+	{
+		float* row = accumulation.data() + static_cast<size_t>(y) * stride;
+		float sum = 0.0f;
+		for (int x = 0; x < width; ++x)
+		{
+			sum += row[x];
+			row[x] = std::min(1.0f, std::fabs(sum));
+		}
+	}
+
+	if (f_mode == GlyphRasterMode::Coverage)
+	{
+		for (int y = 0; y < height; ++y)
+		{
+			const float* row = accumulation.data() + static_cast<size_t>(y) * stride;
+			unsigned char* pixel = f_bitmap.pixels.data() + static_cast<size_t>(y) * width;
+			for (int x = 0; x < width; ++x)
+			{
+				pixel[x] = static_cast<unsigned char>(row[x] * 255.0f + 0.5f);
+			}
+		}
+		return true;
+	}
+
+	// Squared distances to the outside and to the inside, seeded with the subpixel edge position of partial pixels
+	const size_t pixel_count = static_cast<size_t>(width) * height;
+	std::vector<float> outside(pixel_count), inside(pixel_count);
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			// Snap the rounding residue of the running sum, it would otherwise seed edges everywhere
+			float coverage = accumulation[static_cast<size_t>(y) * stride + x];
+			if (coverage < 0.5f / 255.0f) coverage = 0.0f;
+			if (coverage > 254.5f / 255.0f) coverage = 1.0f;
+			const size_t index = static_cast<size_t>(y) * width + x;
+			if (coverage >= 1.0f)
+			{
+				outside[index] = 0.0f;
+				inside[index] = distance_infinity;
+			}
+			else if (coverage <= 0.0f)
+			{
+				outside[index] = distance_infinity;
+				inside[index] = 0.0f;
+			}
+			else
+			{
+				outside[index] = std::max(0.0f, 0.5f - coverage) * std::max(0.0f, 0.5f - coverage);
+				inside[index] = std::max(0.0f, coverage - 0.5f) * std::max(0.0f, coverage - 0.5f);
+			}
+		}
+	}
+
+	const int longest = std::max(width, height);
+	std::vector<float> values(longest), bounds(longest + 1);
+	std::vector<int> vertices(longest);
+	transformGrid(outside.data(), width, height, values, vertices, bounds);
+	transformGrid(inside.data(), width, height, values, vertices, bounds);
+
+	for (size_t i = 0; i < pixel_count; ++i)
+	{
+		const float distance = std::sqrt(outside[i]) - std::sqrt(inside[i]);
+		const float value = std::min(1.0f, std::max(0.0f, 0.5f - distance / (2.0f * distance_spread)));
+		f_bitmap.pixels[i] = static_cast<unsigned char>(value * 255.0f + 0.5f);
+	}
+	return true;
+}
+
+Font::~Font()
+{
+}
@@ -0,0 +1,163 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Readback of the back buffer through a ring of staging textures
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Record frames to disk without stalling the render thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the FrameCapture class.
+/// @par Revision History:
+///      $Source: FrameCapture.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/18 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _FRAME_CAPTURE_HPP_
+#define _FRAME_CAPTURE_HPP_
+
+#include "FrameCaptureWriter.hpp"
+#include <d3d11.h>
+#include <vector>
+
+class IGraphicsEngine;
+class DeviceContext;
+class SwapChain;
+
+/**
+ * @class FrameCapture
+ * @brief Copies the back buffer into a ring of staging textures and feeds the finished ones to a FrameCaptureWriter.
+ *
+ * Mapping a texture the GPU has just been asked to fill waits for the GPU,
+ * so capture() only queues a CopyResource into the next staging texture and
+ * maps the older ones with D3D11_MAP_FLAG_DO_NOT_WAIT, a few frames later
+ * when the copies are done. When every staging texture is still in flight,
+ * or the writer has no free slot, the frame is dropped instead of waiting.
+ * Call capture() after the frame is rendered and before SwapChain::present().
+ *
+ * Example usage:
+ * @code
+ * FrameCapture* capture = GraphicsEngine::get()->createFrameCapture(3);
+ * // every frame, while recording
+ * capture->capture(device_context, swap_chain, &writer);
+ * swap_chain->present(true);
+ * // when recording stops
+ * capture->flush(device_context, &writer);
+ * writer.close();
+ * @endcode
+ */
+class FrameCapture
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since creation; the drops of the writer are counted by the writer.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long captured_frames = 0;  // Copies queued on the GPU
+		unsigned long long dropped_frames = 0;   // Every staging texture was still in flight
+		unsigned long long read_frames = 0;      // Readbacks handed to the writer
+	};
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Passes the finished readbacks to the writer and queues a copy of the current back buffer.
+	/// </summary>
+	/// <param name="f_writer">An open writer with the size of the back buffer.</param>
+	/// <returns>False if the frame was dropped or cannot be captured.</returns>
+	bool capture(DeviceContext* f_device_context, SwapChain* f_swap_chain, FrameCaptureWriter* f_writer);
+
+	/// <summary>
+	/// Waits for the copies still in flight and passes them to the writer; call when recording stops.
+	/// </summary>
+	void flush(DeviceContext* f_device_context, FrameCaptureWriter* f_writer);
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Releases the staging textures and the object itself; flush() first to keep the frames in flight.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	FrameCapture();
+	~FrameCapture();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(UINT f_readback_frames, IGraphicsEngine* f_graphicsEngine);
+
+	/// <summary>
+	/// (Re)creates the staging textures for a back buffer description.
+	/// </summary>
+	bool createReadbacks(const D3D11_TEXTURE2D_DESC& f_back_buffer_desc);
+	void releaseReadbacks();
+
+	/// <summary>
+	/// Maps the oldest copy in flight and submits it to the writer.
+	/// </summary>
+	/// <param name="f_wait">Block until the copy is done instead of returning false.</param>
+	/// <returns>False if the copy is not done yet.</returns>
+	bool readBack(DeviceContext* f_device_context, FrameCaptureWriter* f_writer, bool f_wait);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	IGraphicsEngine* m_graphics_engine;
+	std::vector<ID3D11Texture2D*> m_readbacks;
+	UINT m_width;
+	UINT m_height;
+	DXGI_FORMAT m_format;
+	FramePixelLayout m_layout;
+	unsigned long long m_issued;
+	unsigned long long m_read;
+	Statistics m_statistics;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_FRAME_CAPTURE_HPP_
@@ -0,0 +1,206 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Readback of the back buffer through a ring of staging textures
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Record frames to disk without stalling the render thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the FrameCapture class.
+/// @par Revision History:
+///      $Source: FrameCapture.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/18 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "FrameCapture.hpp"
+#include "GraphicsEngine.hpp"
+#include "DeviceContext.hpp"
+#include "SwapChain.hpp"
+#include "ResourceReleaseQueue.hpp"
+
+FrameCapture::FrameCapture()
+	: m_graphics_engine(nullptr), m_width(0), m_height(0), m_format(DXGI_FORMAT_UNKNOWN), m_layout(FramePixelLayout::RGBA8),
+	m_issued(0), m_read(0)
+{
+}
+
+bool FrameCapture::init(UINT f_readback_frames, IGraphicsEngine* f_graphicsEngine)
+{
+	// The staging textures are created on the first capture, once the back buffer is known
+	m_graphics_engine = f_graphicsEngine;
+	m_readbacks.assign(f_readback_frames ? f_readback_frames : 1, nullptr);
+	return true;
+}
+
+bool FrameCapture::createReadbacks(const D3D11_TEXTURE2D_DESC& f_back_buffer_desc)
+{
+	releaseReadbacks();
+
+	switch (f_back_buffer_desc.Format)
+	{
+	case DXGI_FORMAT_R8G8B8A8_UNORM:
+	case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+		m_layout = FramePixelLayout::RGBA8;
+		break;
+	case DXGI_FORMAT_B8G8R8A8_UNORM:
+		m_layout = FramePixelLayout::BGRA8;
+		break;
+	default:
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC desc = {};
+	desc.Width = f_back_buffer_desc.Width;
+	desc.Height = f_back_buffer_desc.Height;
+	desc.MipLevels = 1;
+	desc.ArraySize = 1;
+	desc.Format = f_back_buffer_desc.Format;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_STAGING;
+	desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+	for (ID3D11Texture2D*& readback : m_readbacks)
+	{
+		if (FAILED(m_graphics_engine->getDevice()->CreateTexture2D(&desc, nullptr, &readback)))
+		{
+			releaseReadbacks();
+			return false;
+		}
+	}
+
+	m_width = desc.Width;
+	m_height = desc.Height;
+	m_format = desc.Format;
+	return true;
+}
+
+void FrameCapture::releaseReadbacks()
+{
+	const unsigned long long texture_bytes = static_cast<unsigned long long>(m_width) * m_height * 4;
+	for (ID3D11Texture2D*& readback : m_readbacks)
+	{
+		if (readback) ResourceReleaseQueue::get()->deferRelease(readback, texture_bytes);
+		readback = nullptr;
+	}
+	m_width = m_height = 0;
+	m_format = DXGI_FORMAT_UNKNOWN;
+	m_read = m_issued;
+}
+
+bool FrameCapture::capture(DeviceContext* f_device_context, SwapChain* f_swap_chain, FrameCaptureWriter* f_writer)
+{
+	// Hand over every finished copy first, it frees the staging texture for this frame
+	while (m_read < m_issued && readBack(f_device_context, f_writer, false))
+	{
+	}
+
+	ID3D11Resource* back_buffer = nullptr;
+	ID3D11Texture2D* back_buffer_texture = nullptr;
+	f_swap_chain->m_rtv->GetResource(&back_buffer);
+	const HRESULT result = back_buffer->QueryInterface(__uuidof(ID3D11Texture2D), (void**)&back_buffer_texture);
+	back_buffer->Release();
+	if (FAILED(result))
+	{
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC desc = {};
+	back_buffer_texture->GetDesc(&desc);
+	bool ready = desc.Width == f_writer->getSettings().width && desc.Height == f_writer->getSettings().height;
+	if (ready && (desc.Width != m_width || desc.Height != m_height || desc.Format != m_format))
+	{
+		flush(f_device_context, f_writer);
+		ready = createReadbacks(desc);
+	}
+	if (!ready)
+	{
+		back_buffer_texture->Release();
+		return false;
+	}
+
+	if (m_issued - m_read == m_readbacks.size())
+	{
+		// Every copy is still in flight; mapping one now would stall on the GPU
+		back_buffer_texture->Release();
+		m_statistics.dropped_frames++;
+		return false;
+	}
+
+	f_device_context->getDeviceContext()->CopyResource(m_readbacks[m_issued % m_readbacks.size()], back_buffer_texture);
+	back_buffer_texture->Release();
+	m_issued++;
+	m_statistics.captured_frames++;
+	return true;
+}
+
+void FrameCapture::flush(DeviceContext* f_device_context, FrameCaptureWriter* f_writer)
+{
+	while (m_read < m_issued)
+	{
+		readBack(f_device_context, f_writer, true);
+	}
+}
+
+bool FrameCapture::readBack(DeviceContext* f_device_context, FrameCaptureWriter* f_writer, bool f_wait)
+{
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	ID3D11Texture2D* readback = m_readbacks[m_read % m_readbacks.size()];
+
+	D3D11_MAPPED_SUBRESOURCE mapped = {};
+	const HRESULT result = context->Map(readback, 0, D3D11_MAP_READ, f_wait ? 0 : D3D11_MAP_FLAG_DO_NOT_WAIT, &mapped);
+	if (result == DXGI_ERROR_WAS_STILL_DRAWING)
+	{
+		return false;
+	}
+
+	m_read++;
+	if (FAILED(result))
+	{
+		return true;
+	}
+
+	// The writer copies the rows into its own slot, so the texture is free again right after
+	const FrameCaptureSettings& settings = f_writer->getSettings();
+	if (settings.width == m_width && settings.height == m_height)
+	{
+		f_writer->submit(mapped.pData, mapped.RowPitch, m_layout);
+		m_statistics.read_frames++;
+	}
+	context->Unmap(readback, 0);
+	return true;
+}
+
+void FrameCapture::release()
+{
+	releaseReadbacks();
+	delete this;
+}
+
+FrameCapture::~FrameCapture()
+{
+}
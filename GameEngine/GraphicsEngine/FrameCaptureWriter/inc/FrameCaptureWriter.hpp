@@ -0,0 +1,236 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Background conversion and encoding of captured frames
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Record frames to disk without stalling the render thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the FrameCaptureWriter class.
+/// @par Revision History:
+///      $Source: FrameCaptureWriter.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/18 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _FRAME_CAPTURE_WRITER_HPP_
+#define _FRAME_CAPTURE_WRITER_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Byte order of the 32 bit pixels handed to FrameCaptureWriter::submit().
+/// </summary>
+enum class FramePixelLayout
+{
+	RGBA8,
+	BGRA8
+};
+
+/// <summary>
+/// What FrameCaptureWriter writes.
+/// </summary>
+enum class FrameCaptureFormat
+{
+	/// <summary>
+	/// One uncompressed 32 bit TGA file per frame.
+	/// </summary>
+	ImageSequence,
+
+	/// <summary>
+	/// One raw YUV4MPEG2 stream (4:2:0, full range BT.601), playable and encodable by ffmpeg.
+	/// </summary>
+	Y4M
+};
+
+/// <summary>
+/// Output and queue configuration of a FrameCaptureWriter.
+/// </summary>
+struct FrameCaptureSettings
+{
+	FrameCaptureFormat format = FrameCaptureFormat::Y4M;
+
+	/// <summary>
+	/// Y4M: the stream file. ImageSequence: a printf pattern with one %u for the frame number, e.g. "capture/frame_%05u.tga".
+	/// </summary>
+	std::string path;
+
+	unsigned int width = 0;
+	unsigned int height = 0;
+
+	/// <summary>
+	/// Frame rate written into the Y4M header.
+	/// </summary>
+	unsigned int frame_rate = 60;
+
+	/// <summary>
+	/// Frames waiting for or being converted; submit() drops frames beyond this.
+	/// </summary>
+	unsigned int max_queued_frames = 4;
+};
+
+/**
+ * @class FrameCaptureWriter
+ * @brief Converts and writes captured frames on a worker thread, dropping frames instead of blocking.
+ *
+ * submit() only copies the pixels into one of max_queued_frames preallocated
+ * slots and returns; the worker swizzles or converts them to YUV (SSE2 where
+ * available) and streams them to disk. When the disk or the conversion falls
+ * behind and every slot is taken, submit() drops the frame and counts it, so
+ * the caller never waits for the encoder. Frames are written in submission
+ * order. The writer knows nothing about the GPU: FrameCapture feeds it from
+ * readback textures, and any CPU framebuffer can be recorded the same way.
+ *
+ * Example usage:
+ * @code
+ * FrameCaptureSettings settings;
+ * settings.path = "capture.y4m";
+ * settings.width = width;
+ * settings.height = height;
+ * writer.open(settings);
+ * writer.submit(pixels, width * 4, FramePixelLayout::RGBA8);   // every frame
+ * writer.close();                                              // writes the queued frames
+ * @endcode
+ */
+class FrameCaptureWriter
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since open().
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long submitted_frames = 0;
+		unsigned long long written_frames = 0;
+		unsigned long long dropped_frames = 0;   // submit() found every slot taken
+		unsigned long long failed_frames = 0;    // the file could not be written
+		unsigned long long bytes_written = 0;
+		double convert_ms = 0.0;                 // Worker time spent converting pixels
+		double write_ms = 0.0;                   // Worker time spent in file writes
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	FrameCaptureWriter();
+	FrameCaptureWriter(const FrameCaptureWriter&) = delete;
+	FrameCaptureWriter& operator=(const FrameCaptureWriter&) = delete;
+	~FrameCaptureWriter();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Allocates the frame slots, opens the output and starts the worker; closes a previous capture first.
+	/// </summary>
+	/// <returns>False if the size is empty or the output cannot be created.</returns>
+	bool open(const FrameCaptureSettings& f_settings);
+
+	/// <summary>
+	/// Queues a copy of a frame of the size given to open().
+	/// </summary>
+	/// <param name="f_pixels">Top row first, 4 bytes per pixel.</param>
+	/// <param name="f_row_pitch">Bytes between the starts of two rows, at least width * 4.</param>
+	/// <returns>False if the frame was dropped because every slot is busy, or no capture is open.</returns>
+	bool submit(const void* f_pixels, unsigned int f_row_pitch, FramePixelLayout f_layout);
+
+	/// <summary>
+	/// Writes the queued frames, stops the worker and closes the output.
+	/// </summary>
+	void close();
+
+	bool isOpen() const { return m_worker.joinable(); }
+
+	const FrameCaptureSettings& getSettings() const { return m_settings; }
+
+	/// <summary>
+	/// Snapshot of the counters; safe to call while the worker runs.
+	/// </summary>
+	Statistics getStatistics();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Slot
+	{
+		std::vector<unsigned char> pixels;
+		FramePixelLayout layout = FramePixelLayout::RGBA8;
+		unsigned long long frame = 0;
+		bool busy = false;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Worker loop: converts and writes the queued slots until close().
+	/// </summary>
+	void run();
+
+	/// <summary>
+	/// Converts one frame into m_converted and writes it.
+	/// </summary>
+	/// <returns>The bytes written, 0 if the write failed.</returns>
+	unsigned long long writeFrame(const Slot& f_slot, double& f_convert_ms, double& f_write_ms);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	FrameCaptureSettings m_settings;
+	std::vector<Slot> m_slots;
+	std::deque<size_t> m_queue;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::thread m_worker;
+	bool m_stopping;
+	unsigned long long m_next_frame;
+	Statistics m_statistics;
+
+	// Worker only: the Y4M stream and the conversion scratch, allocated once per capture
+	std::ofstream m_stream;
+	std::vector<unsigned char> m_converted;
+};
+
+#endif // !_FRAME_CAPTURE_WRITER_HPP_
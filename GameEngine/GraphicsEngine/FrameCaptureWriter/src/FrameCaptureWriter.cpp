@@ -0,0 +1,407 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Background conversion and encoding of captured frames
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Record frames to disk without stalling the render thread.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the FrameCaptureWriter class.
+/// @par Revision History:
+///      $Source: FrameCaptureWriter.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/18 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "FrameCaptureWriter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FRAME_CAPTURE_SSE2 1
+#endif
+
+namespace
+{
+	// Full range BT.601 in Q14, the matrix C420jpeg streams are decoded with
+	constexpr int fixed_shift = 14;
+	constexpr int fixed_half = 1 << (fixed_shift - 1);
+	constexpr int chroma_offset = 128 << fixed_shift;
+	constexpr int y_r = 4899, y_g = 9617, y_b = 1868;
+	constexpr int u_r = -2765, u_g = -5427, u_b = 8192;
+	constexpr int v_r = 8192, v_g = -6860, v_b = -1332;
+
+	constexpr size_t tga_header_size = 18;
+
+	struct ChannelOffsets
+	{
+		unsigned int r;
+		unsigned int g;
+		unsigned int b;
+	};
+
+	ChannelOffsets getChannelOffsets(FramePixelLayout f_layout)
+	{
+		return f_layout == FramePixelLayout::RGBA8 ? ChannelOffsets{ 0, 1, 2 } : ChannelOffsets{ 2, 1, 0 };
+	}
+
+	double elapsedMs(std::chrono::steady_clock::time_point f_start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - f_start).count();
+	}
+
+	/// <summary>
+	/// Writes a row as opaque BGRA, the pixel order of 32 bit TGA.
+	/// </summary>
+	void convertRowToBgra(const unsigned char* f_source, unsigned int f_width, FramePixelLayout f_layout, unsigned char* f_destination)
+	{
+		unsigned int x = 0;
+#if FRAME_CAPTURE_SSE2
+		const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000u));
+		const __m128i green = _mm_set1_epi32(0x0000ff00);
+		const __m128i low_byte = _mm_set1_epi32(0x000000ff);
+		for (; x + 4 <= f_width; x += 4)
+		{
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_source + x * 4));
+			if (f_layout == FramePixelLayout::RGBA8)
+			{
+				// Swap bytes 0 and 2 of every pixel
+				const __m128i red_blue = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(pixels, 16), low_byte),
+					_mm_slli_epi32(_mm_and_si128(pixels, low_byte), 16));
+				pixels = _mm_or_si128(_mm_and_si128(pixels, green), red_blue);
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(f_destination + x * 4), _mm_or_si128(pixels, alpha));
+		}
+#endif
+		const ChannelOffsets offsets = getChannelOffsets(f_layout);
+		for (; x < f_width; ++x)
+		{
+			const unsigned char* pixel = f_source + x * 4;
+			unsigned char* out = f_destination + x * 4;
+			out[0] = pixel[offsets.b];
+			out[1] = pixel[offsets.g];
+			out[2] = pixel[offsets.r];
+			out[3] = 255;
+		}
+	}
+
+	/// <summary>
+	/// Writes the luma of a row, one byte per pixel.
+	/// </summary>
+	void convertRowToLuma(const unsigned char* f_source, unsigned int f_width, FramePixelLayout f_layout, unsigned char* f_destination)
+	{
+		unsigned int x = 0;
+#if FRAME_CAPTURE_SSE2
+		// madd yields r*cr + g*cg and b*cb + a*0 per pixel; the two halves are then added
+		const __m128i coefficients = f_layout == FramePixelLayout::RGBA8 ?
+			_mm_setr_epi16(y_r, y_g, y_b, 0, y_r, y_g, y_b, 0) : _mm_setr_epi16(y_b, y_g, y_r, 0, y_b, y_g, y_r, 0);
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i half = _mm_set1_epi32(fixed_half);
+		for (; x + 4 <= f_width; x += 4)
+		{
+			const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_source + x * 4));
+			const __m128 low = _mm_castsi128_ps(_mm_madd_epi16(_mm_unpacklo_epi8(pixels, zero), coefficients));
+			const __m128 high = _mm_castsi128_ps(_mm_madd_epi16(_mm_unpackhi_epi8(pixels, zero), coefficients));
+			const __m128i even = _mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+			const __m128i odd = _mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+			__m128i luma = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(even, odd), half), fixed_shift);
+			luma = _mm_packs_epi32(luma, luma);
+			luma = _mm_packus_epi16(luma, luma);
+			const int packed = _mm_cvtsi128_si32(luma);
+			::memcpy(f_destination + x, &packed, sizeof(packed));
+		}
+#endif
+		const ChannelOffsets offsets = getChannelOffsets(f_layout);
+		for (; x < f_width; ++x)
+		{
+			const unsigned char* pixel = f_source + x * 4;
+			const int luma = (y_r * pixel[offsets.r] + y_g * pixel[offsets.g] + y_b * pixel[offsets.b] + fixed_half) >> fixed_shift;
+			f_destination[x] = static_cast<unsigned char>(std::min(luma, 255));
+		}
+	}
+
+	/// <summary>
+	/// Writes the chroma of two rows, one U and one V byte per 2x2 block; odd edges repeat the last pixel.
+	/// </summary>
+	void convertRowsToChroma(const unsigned char* f_row0, const unsigned char* f_row1, unsigned int f_width, FramePixelLayout f_layout,
+		unsigned char* f_u, unsigned char* f_v)
+	{
+		const ChannelOffsets offsets = getChannelOffsets(f_layout);
+		for (unsigned int x = 0, block = 0; x < f_width; x += 2, ++block)
+		{
+			const unsigned int x1 = std::min(x + 1, f_width - 1);
+			const unsigned char* pixels[4] = { f_row0 + x * 4, f_row0 + x1 * 4, f_row1 + x * 4, f_row1 + x1 * 4 };
+			int r = 2, g = 2, b = 2;
+			for (const unsigned char* pixel : pixels)
+			{
+				r += pixel[offsets.r];
+				g += pixel[offsets.g];
+				b += pixel[offsets.b];
+			}
+			r >>= 2;
+			g >>= 2;
+			b >>= 2;
+			const int u = (u_r * r + u_g * g + u_b * b + chroma_offset + fixed_half) >> fixed_shift;
+			const int v = (v_r * r + v_g * g + v_b * b + chroma_offset + fixed_half) >> fixed_shift;
+			f_u[block] = static_cast<unsigned char>(std::max(0, std::min(u, 255)));
+			f_v[block] = static_cast<unsigned char>(std::max(0, std::min(v, 255)));
+		}
+	}
+}
+
+FrameCaptureWriter::FrameCaptureWriter() : m_stopping(false), m_next_frame(0)
+{
+}
+
+bool FrameCaptureWriter::open(const FrameCaptureSettings& f_settings)
+{
+	close();
+	if (f_settings.width == 0 || f_settings.height == 0 || f_settings.path.empty())
+	{
+		return false;
+	}
+	if (f_settings.format == FrameCaptureFormat::ImageSequence && (f_settings.width > 0xffff || f_settings.height > 0xffff))
+	{
+		return false;
+	}
+
+	m_settings = f_settings;
+	m_settings.max_queued_frames = std::max(1u, f_settings.max_queued_frames);
+
+	const size_t frame_bytes = static_cast<size_t>(m_settings.width) * m_settings.height * 4;
+	m_slots.assign(m_settings.max_queued_frames, Slot());
+	for (Slot& slot : m_slots)
+	{
+		slot.pixels.resize(frame_bytes);
+	}
+	m_queue.clear();
+	m_statistics = Statistics();
+	m_next_frame = 0;
+	m_stopping = false;
+
+	if (m_settings.format == FrameCaptureFormat::Y4M)
+	{
+		m_stream.open(m_settings.path, std::ios::binary | std::ios::trunc);
+		if (!m_stream)
+		{
+			return false;
+		}
+		char header[96];
+		const int header_size = std::snprintf(header, sizeof(header), "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C420jpeg\n",
+			m_settings.width, m_settings.height, std::max(1u, m_settings.frame_rate));
+		m_stream.write(header, header_size);
+
+		const size_t chroma_bytes = static_cast<size_t>((m_settings.width + 1) / 2) * ((m_settings.height + 1) / 2);
+		m_converted.resize(static_cast<size_t>(m_settings.width) * m_settings.height + 2 * chroma_bytes);
+	}
+	else
+	{
+		m_converted.resize(tga_header_size + frame_bytes);
+	}
+
+	m_worker = std::thread(&FrameCaptureWriter::run, this);
+	return true;
+}
+
+bool FrameCaptureWriter::submit(const void* f_pixels, unsigned int f_row_pitch, FramePixelLayout f_layout)
+{
+	const size_t row_bytes = static_cast<size_t>(m_settings.width) * 4;
+	if (!isOpen() || !f_pixels || f_row_pitch < row_bytes)
+	{
+		return false;
+	}
+
+	Slot* slot = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_statistics.submitted_frames++;
+		for (Slot& candidate : m_slots)
+		{
+			if (!candidate.busy)
+			{
+				slot = &candidate;
+				break;
+			}
+		}
+		if (!slot)
+		{
+			// The worker is behind: lose this frame rather than wait for it
+			m_statistics.dropped_frames++;
+			return false;
+		}
+		slot->busy = true;
+		slot->frame = m_next_frame++;
+	}
+
+	// The copy runs outside the lock so the worker keeps converting meanwhile
+	const unsigned char* source = static_cast<const unsigned char*>(f_pixels);
+	if (f_row_pitch == row_bytes)
+	{
+		::memcpy(slot->pixels.data(), source, row_bytes * m_settings.height);
+	}
+	else
+	{
+		for (unsigned int y = 0; y < m_settings.height; ++y)
+		{
+			::memcpy(slot->pixels.data() + y * row_bytes, source + static_cast<size_t>(y) * f_row_pitch, row_bytes);
+		}
+	}
+	slot->layout = f_layout;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queue.push_back(static_cast<size_t>(slot - m_slots.data()));
+	}
+	m_condition.notify_one();
+	return true;
+}
+
+void FrameCaptureWriter::close()
+{
+	if (!m_worker.joinable())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_condition.notify_all();
+	m_worker.join();
+
+	if (m_stream.is_open())
+	{
+		m_stream.close();
+	}
+}
+
+FrameCaptureWriter::Statistics FrameCaptureWriter::getStatistics()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+void FrameCaptureWriter::run()
+{
+	for (;;)
+	{
+		size_t slot_index = 0;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this] { return !m_queue.empty() || m_stopping; });
+			if (m_queue.empty())
+			{
+				return;
+			}
+			slot_index = m_queue.front();
+			m_queue.pop_front();
+		}
+
+		double convert_ms = 0.0;
+		double write_ms = 0.0;
+		const unsigned long long bytes = writeFrame(m_slots[slot_index], convert_ms, write_ms);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_slots[slot_index].busy = false;
+		m_statistics.convert_ms += convert_ms;
+		m_statistics.write_ms += write_ms;
+		m_statistics.bytes_written += bytes;
+		if (bytes) m_statistics.written_frames++;
+		else m_statistics.failed_frames++;
+	}
+}
+
+unsigned long long FrameCaptureWriter::writeFrame(const Slot& f_slot, double& f_convert_ms, double& f_write_ms)
+{
+	const unsigned int width = m_settings.width;
+	const unsigned int height = m_settings.height;
+	const size_t row_bytes = static_cast<size_t>(width) * 4;
+	const unsigned char* pixels = f_slot.pixels.data();
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if (m_settings.format == FrameCaptureFormat::Y4M)
+	{
+		const unsigned int chroma_width = (width + 1) / 2;
+		const unsigned int chroma_height = (height + 1) / 2;
+		unsigned char* luma = m_converted.data();
+		unsigned char* u = luma + static_cast<size_t>(width) * height;
+		unsigned char* v = u + static_cast<size_t>(chroma_width) * chroma_height;
+
+		for (unsigned int y = 0; y < height; ++y)
+		{
+			convertRowToLuma(pixels + y * row_bytes, width, f_slot.layout, luma + static_cast<size_t>(y) * width);
+		}
+		for (unsigned int y = 0; y < chroma_height; ++y)
+		{
+			const unsigned int row0 = y * 2;
+			const unsigned int row1 = std::min(row0 + 1, height - 1);
+			convertRowsToChroma(pixels + row0 * row_bytes, pixels + row1 * row_bytes, width, f_slot.layout,
+				u + static_cast<size_t>(y) * chroma_width, v + static_cast<size_t>(y) * chroma_width);
+		}
+		f_convert_ms = elapsedMs(start);
+
+		start = std::chrono::steady_clock::now();
+		static const char frame_header[] = "FRAME\n";
+		m_stream.write(frame_header, sizeof(frame_header) - 1);
+		m_stream.write(reinterpret_cast<const char*>(m_converted.data()), static_cast<std::streamsize>(m_converted.size()));
+		f_write_ms = elapsedMs(start);
+		return m_stream ? sizeof(frame_header) - 1 + m_converted.size() : 0;
+	}
+
+	// Uncompressed true color TGA, top-left origin, 8 alpha bits
+	unsigned char* header = m_converted.data();
+	::memset(header, 0, tga_header_size);
+	header[2] = 2;
+	header[12] = static_cast<unsigned char>(width & 0xff);
+	header[13] = static_cast<unsigned char>(width >> 8);
+	header[14] = static_cast<unsigned char>(height & 0xff);
+	header[15] = static_cast<unsigned char>(height >> 8);
+	header[16] = 32;
+	header[17] = 0x28;
+	for (unsigned int y = 0; y < height; ++y)
+	{
+		convertRowToBgra(pixels + y * row_bytes, width, f_slot.layout, header + tga_header_size + y * row_bytes);
+	}
+	f_convert_ms = elapsedMs(start);
+
+	start = std::chrono::steady_clock::now();
+	std::vector<char> file_name(m_settings.path.size() + 32);
+	std::snprintf(file_name.data(), file_name.size(), m_settings.path.c_str(), static_cast<unsigned int>(f_slot.frame));
+	std::ofstream file(file_name.data(), std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(m_converted.data()), static_cast<std::streamsize>(m_converted.size()));
+	f_write_ms = elapsedMs(start);
+	return file ? m_converted.size() : 0;
+}
+
+FrameCaptureWriter::~FrameCaptureWriter()
+{
+	close();
+}
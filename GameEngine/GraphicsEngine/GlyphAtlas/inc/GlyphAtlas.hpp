@@ -0,0 +1,268 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Glyph atlas with shelf packing and LRU eviction
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep the glyphs in use resident in one texture.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the GlyphAtlas class.
+/// @par Revision History:
+///      $Source: GlyphAtlas.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/04 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _GLYPH_ATLAS_HPP_
+#define _GLYPH_ATLAS_HPP_
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// Where a glyph image sits in the atlas, in texels, and its offset from the pen.
+/// </summary>
+struct GlyphAtlasRegion
+{
+	unsigned short x = 0;
+	unsigned short y = 0;
+	unsigned short width = 0;
+	unsigned short height = 0;
+	float offset_x = 0.0f;
+	float offset_y = 0.0f;
+};
+
+/// <summary>
+/// A rectangle of atlas texels changed since the last upload.
+/// </summary>
+struct GlyphAtlasRect
+{
+	unsigned int x = 0;
+	unsigned int y = 0;
+	unsigned int width = 0;
+	unsigned int height = 0;
+};
+
+/**
+ * @class GlyphAtlas
+ * @brief An 8 bit atlas of glyph images keyed by a 64 bit glyph key, with LRU eviction.
+ *
+ * Glyphs are packed on shelves whose height is rounded up to 4 texels, so a
+ * glyph freed by eviction leaves a slot that similar glyphs reuse. When the
+ * atlas is full the least recently used glyphs are evicted until the new one
+ * fits; glyphs used during the current frame are never evicted, so the
+ * regions handed out for a frame stay valid until it ends. The texels live
+ * on the CPU; the changed rectangles are listed for the texture upload.
+ *
+ * Example usage:
+ * @code
+ * atlas.init(1024, 1024);
+ * atlas.beginFrame();
+ * unsigned int handle = atlas.find(key);
+ * if (handle == GlyphAtlas::invalid_handle)
+ * {
+ *     handle = atlas.insert(key, bitmap.pixels.data(), bitmap.width, bitmap.height, bitmap.width,
+ *         static_cast<float>(bitmap.offset_x), static_cast<float>(bitmap.offset_y));
+ * }
+ * const GlyphAtlasRegion& region = atlas.getRegion(handle);
+ * @endcode
+ */
+class GlyphAtlas
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since init().
+	/// </summary>
+	struct Statistics
+	{
+		size_t glyph_count = 0;
+		size_t inserts = 0;
+		size_t evictions = 0;
+		size_t failed_inserts = 0;
+		size_t shelf_count = 0;
+	};
+
+	static constexpr unsigned int invalid_handle = ~0u;
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	GlyphAtlas();
+	~GlyphAtlas();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Allocates a cleared atlas and drops every glyph.
+	/// </summary>
+	/// <param name="f_padding">Empty texels kept between glyphs so bilinear filtering does not bleed.</param>
+	bool init(unsigned int f_width, unsigned int f_height, unsigned int f_padding = 1);
+
+	/// <summary>
+	/// Starts a frame: glyphs not used since the previous beginFrame() become evictable.
+	/// </summary>
+	void beginFrame() { m_frame++; }
+
+	/// <summary>
+	/// Looks a glyph up and marks it used this frame.
+	/// </summary>
+	/// <returns>The glyph handle, or invalid_handle if the glyph is not in the atlas.</returns>
+	unsigned int find(unsigned long long f_key);
+
+	/// <summary>
+	/// Marks a glyph found earlier as used this frame, if the handle still holds it.
+	/// </summary>
+	/// <returns>False if the glyph was evicted since; look it up again.</returns>
+	bool touch(unsigned int f_handle, unsigned long long f_key)
+	{
+		if (f_handle >= m_entries.size() || m_entries[f_handle].key != f_key || !m_entries[f_handle].in_use)
+		{
+			return false;
+		}
+		if (m_entries[f_handle].frame != m_frame)
+		{
+			moveToFront(f_handle);
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Copies a glyph image into the atlas, evicting the least recently used glyphs if needed.
+	/// Empty images take no space and are kept so blank glyphs are not rasterized again.
+	/// </summary>
+	/// <param name="f_pitch">Bytes between rows of f_pixels.</param>
+	/// <returns>The glyph handle, or invalid_handle if it does not fit next to this frame's glyphs.</returns>
+	unsigned int insert(unsigned long long f_key, const unsigned char* f_pixels, int f_width, int f_height, int f_pitch,
+		float f_offset_x, float f_offset_y);
+
+	const GlyphAtlasRegion& getRegion(unsigned int f_handle) const { return m_entries[f_handle].region; }
+
+	unsigned int getWidth() const { return m_width; }
+	unsigned int getHeight() const { return m_height; }
+	const unsigned char* getPixels() const { return m_pixels.data(); }
+
+	/// <summary>
+	/// Rectangles changed since the last clearDirtyRects(); many small ones collapse into their bounds.
+	/// </summary>
+	const std::vector<GlyphAtlasRect>& getDirtyRects() const { return m_dirty_rects; }
+
+	void clearDirtyRects() { m_dirty_rects.clear(); }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Span
+	{
+		unsigned int x;
+		unsigned int width;
+	};
+
+	struct Shelf
+	{
+		unsigned int y = 0;
+		unsigned int height = 0;
+		unsigned int cursor = 0;
+		unsigned int entry_count = 0;
+
+		/// <summary>
+		/// Slots freed left of the cursor, sorted by x and merged when adjacent.
+		/// </summary>
+		std::vector<Span> free_spans;
+	};
+
+	struct Entry
+	{
+		unsigned long long key = 0;
+		unsigned long long frame = 0;
+		GlyphAtlasRegion region;
+		unsigned int shelf = invalid_handle;
+		unsigned int slot_x = 0;
+		unsigned int slot_width = 0;
+		unsigned int previous = invalid_handle;
+		unsigned int next = invalid_handle;
+		bool in_use = false;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Finds room for a slot of the size on an existing or a new shelf.
+	/// </summary>
+	bool allocate(unsigned int f_slot_width, unsigned int f_height, unsigned int& f_shelf, unsigned int& f_x);
+
+	/// <summary>
+	/// Removes the least recently used glyph if it was not used this frame.
+	/// </summary>
+	bool evictOldest();
+
+	void release(unsigned int f_handle);
+	void moveToFront(unsigned int f_handle);
+	void unlink(unsigned int f_handle);
+	void addDirtyRect(const GlyphAtlasRect& f_rect);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	unsigned int m_width;
+	unsigned int m_height;
+	unsigned int m_padding;
+	std::vector<unsigned char> m_pixels;
+
+	std::vector<Shelf> m_shelves;
+	unsigned int m_next_shelf_y;
+
+	std::vector<Entry> m_entries;
+	std::vector<unsigned int> m_free_entries;
+	std::unordered_map<unsigned long long, unsigned int> m_lookup;
+
+	// Most recently used first
+	unsigned int m_lru_head;
+	unsigned int m_lru_tail;
+	unsigned long long m_frame;
+
+	std::vector<GlyphAtlasRect> m_dirty_rects;
+	Statistics m_statistics;
+};
+
+#endif // !_GLYPH_ATLAS_HPP_
@@ -0,0 +1,361 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Glyph atlas with shelf packing and LRU eviction
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep the glyphs in use resident in one texture.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the GlyphAtlas class.
+/// @par Revision History:
+///      $Source: GlyphAtlas.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/04 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "GlyphAtlas.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	constexpr unsigned int shelf_height_step = 4;
+	constexpr size_t max_dirty_rects = 64;
+}
+
+GlyphAtlas::GlyphAtlas() : m_width(0), m_height(0), m_padding(0), m_next_shelf_y(0),
+	m_lru_head(invalid_handle), m_lru_tail(invalid_handle), m_frame(1)
+{
+}
+
+bool GlyphAtlas::init(unsigned int f_width, unsigned int f_height, unsigned int f_padding)
+{
+	if (f_width == 0 || f_height == 0 || f_width > 0xffff || f_height > 0xffff)
+	{
+		return false;
+	}
+
+	m_width = f_width;
+	m_height = f_height;
+	m_padding = f_padding;
+	m_pixels.assign(static_cast<size_t>(f_width) * f_height, 0);
+	m_shelves.clear();
+	m_next_shelf_y = 0;
+	m_entries.clear();
+	m_free_entries.clear();
+	m_lookup.clear();
+	m_lru_head = m_lru_tail = invalid_handle;
+	m_statistics = Statistics();
+
+	m_dirty_rects.clear();
+	addDirtyRect({ 0, 0, f_width, f_height });
+	return true;
+}
+
+unsigned int GlyphAtlas::find(unsigned long long f_key)
+{
+	const auto found = m_lookup.find(f_key);
+	if (found == m_lookup.end())
+	{
+		return invalid_handle;
+	}
+
+	if (m_entries[found->second].frame != m_frame)
+	{
+		moveToFront(found->second);
+	}
+	return found->second;
+}
+
+unsigned int GlyphAtlas::insert(unsigned long long f_key, const unsigned char* f_pixels, int f_width, int f_height, int f_pitch,
+	float f_offset_x, float f_offset_y)
+{
+	const unsigned int existing = find(f_key);
+	if (existing != invalid_handle)
+	{
+		return existing;
+	}
+	if (m_pixels.empty() || f_width < 0 || f_height < 0 || ((f_width > 0 && f_height > 0) && !f_pixels))
+	{
+		return invalid_handle;
+	}
+
+	const bool empty = f_width == 0 || f_height == 0;
+	unsigned int shelf = invalid_handle;
+	unsigned int slot_x = 0;
+	const unsigned int slot_width = empty ? 0 : f_width + m_padding;
+	if (!empty)
+	{
+		while (!allocate(slot_width, f_height, shelf, slot_x))
+		{
+			if (!evictOldest())
+			{
+				m_statistics.failed_inserts++;
+				return invalid_handle;
+			}
+		}
+	}
+
+	unsigned int handle = 0;
+	if (!m_free_entries.empty())
+	{
+		handle = m_free_entries.back();
+		m_free_entries.pop_back();
+	}
+	else
+	{
+		handle = static_cast<unsigned int>(m_entries.size());
+		m_entries.emplace_back();
+	}
+
+	Entry& entry = m_entries[handle];
+	entry.key = f_key;
+	entry.shelf = shelf;
+	entry.slot_x = slot_x;
+	entry.slot_width = slot_width;
+	entry.in_use = true;
+	entry.region.offset_x = f_offset_x;
+	entry.region.offset_y = f_offset_y;
+	entry.region.width = static_cast<unsigned short>(empty ? 0 : f_width);
+	entry.region.height = static_cast<unsigned short>(empty ? 0 : f_height);
+	entry.region.x = 0;
+	entry.region.y = 0;
+	entry.previous = entry.next = invalid_handle;
+	moveToFront(handle);
+	m_lookup.emplace(f_key, handle);
+
+	if (!empty)
+	{
+		entry.region.x = static_cast<unsigned short>(slot_x + m_padding);
+		entry.region.y = static_cast<unsigned short>(m_shelves[shelf].y + m_padding);
+
+		// Clear the padding around the glyph as well, a reused slot may still hold an older glyph
+		const unsigned int clear_x = entry.region.x - m_padding;
+		const unsigned int clear_y = entry.region.y - m_padding;
+		const unsigned int clear_width = std::min(f_width + 2 * m_padding, m_width - clear_x);
+		const unsigned int clear_height = std::min(f_height + 2 * m_padding, m_height - clear_y);
+		for (unsigned int y = 0; y < clear_height; ++y)
+		{
+			std::memset(m_pixels.data() + static_cast<size_t>(clear_y + y) * m_width + clear_x, 0, clear_width);
+		}
+		for (int y = 0; y < f_height; ++y)
+		{
+			std::memcpy(m_pixels.data() + static_cast<size_t>(entry.region.y + y) * m_width + entry.region.x,
+				f_pixels + static_cast<size_t>(y) * f_pitch, f_width);
+		}
+		addDirtyRect({ clear_x, clear_y, clear_width, clear_height });
+	}
+
+	m_statistics.inserts++;
+	m_statistics.glyph_count++;
+	return handle;
+}
+
+bool GlyphAtlas::allocate(unsigned int f_slot_width, unsigned int f_height, unsigned int& f_shelf, unsigned int& f_x)
+{
+	const unsigned int height = (f_height + shelf_height_step - 1) / shelf_height_step * shelf_height_step;
+	if (f_slot_width + m_padding > m_width)
+	{
+		return false;
+	}
+
+	// A shelf up to a quarter taller than needed is fine; an empty one takes any shorter glyph
+	for (unsigned int index = 0; index < m_shelves.size(); ++index)
+	{
+		Shelf& shelf = m_shelves[index];
+		if (shelf.height < height || (shelf.height > height + height / 4 + shelf_height_step && shelf.entry_count > 0))
+		{
+			continue;
+		}
+
+		for (size_t span = 0; span < shelf.free_spans.size(); ++span)
+		{
+			Span& free_span = shelf.free_spans[span];
+			if (free_span.width >= f_slot_width)
+			{
+				f_shelf = index;
+				f_x = free_span.x;
+				free_span.x += f_slot_width;
+				free_span.width -= f_slot_width;
+				if (free_span.width == 0)
+				{
+					shelf.free_spans.erase(shelf.free_spans.begin() + span);
+				}
+				shelf.entry_count++;
+				return true;
+			}
+		}
+		if (shelf.cursor + f_slot_width + m_padding <= m_width)
+		{
+			f_shelf = index;
+			f_x = shelf.cursor;
+			shelf.cursor += f_slot_width;
+			shelf.entry_count++;
+			return true;
+		}
+	}
+
+	if (m_next_shelf_y + height + 2 * m_padding > m_height)
+	{
+		return false;
+	}
+
+	Shelf shelf;
+	shelf.y = m_next_shelf_y;
+	shelf.height = height;
+	shelf.cursor = f_slot_width;
+	shelf.entry_count = 1;
+	m_next_shelf_y += height + m_padding;
+	m_shelves.push_back(shelf);
+	m_statistics.shelf_count = m_shelves.size();
+
+	f_shelf = static_cast<unsigned int>(m_shelves.size() - 1);
+	f_x = 0;
+	return true;
+}
+
+bool GlyphAtlas::evictOldest()
+{
+	// The list is ordered by use, so once the oldest glyph was used this frame every glyph was
+	if (m_lru_tail == invalid_handle || m_entries[m_lru_tail].frame == m_frame)
+	{
+		return false;
+	}
+
+	release(m_lru_tail);
+	m_statistics.evictions++;
+	return true;
+}
+
+void GlyphAtlas::release(unsigned int f_handle)
+{
+	Entry& entry = m_entries[f_handle];
+	unlink(f_handle);
+	m_lookup.erase(entry.key);
+	entry.in_use = false;
+	m_free_entries.push_back(f_handle);
+	m_statistics.glyph_count--;
+
+	if (entry.shelf == invalid_handle)
+	{
+		return;
+	}
+
+	Shelf& shelf = m_shelves[entry.shelf];
+	entry.shelf = invalid_handle;
+	shelf.entry_count--;
+	if (shelf.entry_count == 0)
+	{
+		shelf.cursor = 0;
+		shelf.free_spans.clear();
+
+		// Hand trailing empty shelves back so a different height can use the rows
+		while (!m_shelves.empty() && m_shelves.back().entry_count == 0)
+		{
+			m_next_shelf_y = m_shelves.back().y;
+			m_shelves.pop_back();
+		}
+		m_statistics.shelf_count = m_shelves.size();
+		return;
+	}
+
+	Span freed = { entry.slot_x, entry.slot_width };
+	auto position = std::lower_bound(shelf.free_spans.begin(), shelf.free_spans.end(), freed.x,
+		[](const Span& f_span, unsigned int f_x) { return f_span.x < f_x; });
+	position = shelf.free_spans.insert(position, freed);
+
+	if (position + 1 != shelf.free_spans.end() && position->x + position->width == (position + 1)->x)
+	{
+		position->width += (position + 1)->width;
+		shelf.free_spans.erase(position + 1);
+	}
+	if (position != shelf.free_spans.begin() && (position - 1)->x + (position - 1)->width == position->x)
+	{
+		(position - 1)->width += position->width;
+		position = shelf.free_spans.erase(position) - 1;
+	}
+	if (position->x + position->width == shelf.cursor)
+	{
+		shelf.cursor = position->x;
+		shelf.free_spans.erase(position);
+	}
+}
+
+void GlyphAtlas::moveToFront(unsigned int f_handle)
+{
+	unlink(f_handle);
+
+	Entry& entry = m_entries[f_handle];
+	entry.frame = m_frame;
+	entry.previous = invalid_handle;
+	entry.next = m_lru_head;
+	if (m_lru_head != invalid_handle)
+	{
+		m_entries[m_lru_head].previous = f_handle;
+	}
+	m_lru_head = f_handle;
+	if (m_lru_tail == invalid_handle)
+	{
+		m_lru_tail = f_handle;
+	}
+}
+
+void GlyphAtlas::unlink(unsigned int f_handle)
+{
+	Entry& entry = m_entries[f_handle];
+	if (entry.previous != invalid_handle) m_entries[entry.previous].next = entry.next;
+	else if (m_lru_head == f_handle) m_lru_head = entry.next;
+	if (entry.next != invalid_handle) m_entries[entry.next].previous = entry.previous;
+	else if (m_lru_tail == f_handle) m_lru_tail = entry.previous;
+	entry.previous = entry.next = invalid_handle;
+}
+
+void GlyphAtlas::addDirtyRect(const GlyphAtlasRect& f_rect)
+{
+	if (m_dirty_rects.size() < max_dirty_rects)
+	{
+		m_dirty_rects.push_back(f_rect);
+		return;
+	}
+
+	// Past a handful of rectangles one larger upload is cheaper than many small ones
+	GlyphAtlasRect bounds = f_rect;
+	for (const GlyphAtlasRect& rect : m_dirty_rects)
+	{
+		const unsigned int right = std::max(bounds.x + bounds.width, rect.x + rect.width);
+		const unsigned int bottom = std::max(bounds.y + bounds.height, rect.y + rect.height);
+		bounds.x = std::min(bounds.x, rect.x);
+		bounds.y = std::min(bounds.y, rect.y);
+		bounds.width = right - bounds.x;
+		bounds.height = bottom - bounds.y;
+	}
+	m_dirty_rects.assign(1, bounds);
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+}
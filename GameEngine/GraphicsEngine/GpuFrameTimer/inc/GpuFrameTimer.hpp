@@ -0,0 +1,139 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: GPU frame time from timestamp queries
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure the GPU cost of a frame without stalling.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the GpuFrameTimer class.
+/// @par Revision History:
+///      $Source: GpuFrameTimer.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _GPU_FRAME_TIMER_HPP_
+#define _GPU_FRAME_TIMER_HPP_
+
+#include <d3d11.h>
+
+class IGraphicsEngine;
+class DeviceContext;
+
+/**
+ * @class GpuFrameTimer
+ * @brief Times the GPU work between begin() and end() with timestamp queries.
+ *
+ * Queries of several frames are kept in flight and read back without
+ * flushing once the GPU has finished them, so the result lags a few frames
+ * behind and never waits on the GPU. Unlike the CPU frame delta it is not
+ * pinned to the refresh interval by vsync, which makes it the input for
+ * load-dependent decisions such as the render scale.
+ *
+ * Example usage:
+ * @code
+ * gpu_timer->begin(device_context);
+ * // ... draw the frame ...
+ * gpu_timer->end(device_context);
+ * float gpu_ms = 0.0f;
+ * if (gpu_timer->getFrameTime(gpu_ms)) controller.update(gpu_ms);
+ * @endcode
+ */
+class GpuFrameTimer
+{
+public:
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Starts timing a frame. Skipped when every query set is still in flight.
+	/// </summary>
+	void begin(DeviceContext* f_device_context);
+
+	/// <summary>
+	/// Ends the frame started by begin().
+	/// </summary>
+	void end(DeviceContext* f_device_context);
+
+	/// <summary>
+	/// Reads the frames the GPU finished since the last call.
+	/// </summary>
+	/// <param name="f_frame_ms">Receives the GPU time of the newest finished frame.</param>
+	/// <returns>False if no frame finished, or the only finished ones were disjoint.</returns>
+	bool getFrameTime(DeviceContext* f_device_context, float& f_frame_ms);
+
+	/// <summary>
+	/// Releases the queries and the timer itself.
+	/// </summary>
+	void release();
+
+	static constexpr unsigned int frames_in_flight = 4;
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	GpuFrameTimer();
+	~GpuFrameTimer();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(IGraphicsEngine* f_graphicsEngine);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	struct QuerySet
+	{
+		ID3D11Query* disjoint = nullptr;
+		ID3D11Query* begin = nullptr;
+		ID3D11Query* end = nullptr;
+	};
+
+	QuerySet m_queries[frames_in_flight];
+
+	// Frames issued and read back; their difference is the number in flight
+	unsigned long long m_issued;
+	unsigned long long m_read;
+	bool m_timing;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_GPU_FRAME_TIMER_HPP_
@@ -0,0 +1,142 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: GPU frame time from timestamp queries
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Measure the GPU cost of a frame without stalling.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the GpuFrameTimer class.
+/// @par Revision History:
+///      $Source: GpuFrameTimer.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/11 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "GpuFrameTimer.hpp"
+#include "GraphicsEngine.hpp"
+#include "DeviceContext.hpp"
+#include "ResourceReleaseQueue.hpp"
+
+GpuFrameTimer::GpuFrameTimer() : m_issued(0), m_read(0), m_timing(false)
+{
+}
+
+bool GpuFrameTimer::init(IGraphicsEngine* f_graphicsEngine)
+{
+	D3D11_QUERY_DESC disjoint_desc = {};
+	disjoint_desc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+	D3D11_QUERY_DESC timestamp_desc = {};
+	timestamp_desc.Query = D3D11_QUERY_TIMESTAMP;
+
+	ID3D11Device* device = f_graphicsEngine->getDevice();
+	for (QuerySet& queries : m_queries)
+	{
+		if (FAILED(device->CreateQuery(&disjoint_desc, &queries.disjoint)) ||
+			FAILED(device->CreateQuery(&timestamp_desc, &queries.begin)) ||
+			FAILED(device->CreateQuery(&timestamp_desc, &queries.end)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void GpuFrameTimer::begin(DeviceContext* f_device_context)
+{
+	m_timing = m_issued - m_read < frames_in_flight;
+	if (!m_timing)
+	{
+		return;
+	}
+
+	const QuerySet& queries = m_queries[m_issued % frames_in_flight];
+	f_device_context->getDeviceContext()->Begin(queries.disjoint);
+	f_device_context->getDeviceContext()->End(queries.begin);
+}
+
+void GpuFrameTimer::end(DeviceContext* f_device_context)
+{
+	if (!m_timing)
+	{
+		return;
+	}
+
+	const QuerySet& queries = m_queries[m_issued % frames_in_flight];
+	f_device_context->getDeviceContext()->End(queries.end);
+	f_device_context->getDeviceContext()->End(queries.disjoint);
+	m_issued++;
+	m_timing = false;
+}
+
+bool GpuFrameTimer::getFrameTime(DeviceContext* f_device_context, float& f_frame_ms)
+{
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	bool found = false;
+	while (m_read < m_issued)
+	{
+		const QuerySet& queries = m_queries[m_read % frames_in_flight];
+
+		// DONOTFLUSH: the frames are flushed by Present anyway, polling must not add a flush
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint = {};
+		if (context->GetData(queries.disjoint, &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+		{
+			break;
+		}
+
+		UINT64 begin = 0, end = 0;
+		if (context->GetData(queries.begin, &begin, sizeof(begin), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK ||
+			context->GetData(queries.end, &end, sizeof(end), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+		{
+			break;
+		}
+		m_read++;
+
+		// A disjoint frame saw a clock change, e.g. a power state switch; its timestamps are meaningless
+		if (!disjoint.Disjoint && disjoint.Frequency && end >= begin)
+		{
+			f_frame_ms = static_cast<float>(static_cast<double>(end - begin) * 1000.0 / disjoint.Frequency);
+			found = true;
+		}
+	}
+	return found;
+}
+
+void GpuFrameTimer::release()
+{
+	for (QuerySet& queries : m_queries)
+	{
+		if (queries.disjoint) ResourceReleaseQueue::get()->deferRelease(queries.disjoint, 0);
+		if (queries.begin) ResourceReleaseQueue::get()->deferRelease(queries.begin, 0);
+		if (queries.end) ResourceReleaseQueue::get()->deferRelease(queries.end, 0);
+	}
+	delete this;
+}
+
+GpuFrameTimer::~GpuFrameTimer()
+{
+}
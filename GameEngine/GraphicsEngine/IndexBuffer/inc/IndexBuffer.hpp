@@ -2,6 +2,7 @@
 #define _INDEX_BUFFER_HPP_
 
 #include <d3d11.h>
+#include "UploadQueue.hpp"
 
 class DeviceContext;
 class IGraphicsEngine; // Forward declaration for IGraphicsEngine
@@ -11,10 +12,19 @@ class IndexBuffer
 public:
 	IndexBuffer();
     bool load(void* list_indices, UINT size_list, IGraphicsEngine* graphics_engine);
+
+	/// <summary>
+	/// Creates the buffer and stages the indices in the UploadManager instead of
+	/// copying them inline; the data may be freed when the call returns.
+	/// Callable from any thread. Draw only once the token is complete.
+	/// </summary>
+	bool loadAsync(const void* list_indices, UINT size_list, IGraphicsEngine* graphics_engine, UploadToken* token);
+
 	UINT getSizeIndexList();
 	bool release();
     ~IndexBuffer();
 private:
+	bool createBuffer(const void* list_indices, UINT size_list, IGraphicsEngine* graphics_engine);
 	UINT m_size_list;
 	ID3D11Buffer* m_buffer;
 	friend class DeviceContext;
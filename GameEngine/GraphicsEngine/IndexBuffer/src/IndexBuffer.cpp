@@ -1,5 +1,8 @@
 #include "IndexBuffer.hpp"
 #include "GraphicsEngine.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include "UploadManager.hpp"
+#include "CommandRecorder.hpp"
 
 IndexBuffer::IndexBuffer() : m_buffer(0), m_size_list(0)
 {
@@ -7,7 +10,27 @@ IndexBuffer::IndexBuffer() : m_buffer(0), m_size_list(0)
 
 bool IndexBuffer::load(void* list_indices, UINT size_list, IGraphicsEngine* graphics_engine)
 {
-	if (m_buffer)m_buffer->Release();
+	return createBuffer(list_indices, size_list, graphics_engine);
+}
+
+bool IndexBuffer::loadAsync(const void* list_indices, UINT size_list, IGraphicsEngine* graphics_engine, UploadToken* token)
+{
+	if (!createBuffer(nullptr, size_list, graphics_engine))
+	{
+		return false;
+	}
+
+	UploadToken upload_token = UploadManager::get()->upload(m_buffer, 0, list_indices, 4 * size_list);
+	CommandRecorder::get()->onUpdateBuffer(this, 0, list_indices, 4 * size_list);
+	if (token) *token = upload_token;
+	return upload_token != invalid_upload_token;
+}
+
+bool IndexBuffer::createBuffer(const void* list_indices, UINT size_list, IGraphicsEngine* graphics_engine)
+{
+	// The GPU may still read the old buffer in a frame in flight
+	if (m_buffer) ResourceReleaseQueue::get()->deferRelease(m_buffer, 4 * m_size_list);
+	m_buffer = nullptr;
 
 	D3D11_BUFFER_DESC buff_desc = {};
 	buff_desc.Usage = D3D11_USAGE_DEFAULT;
@@ -21,11 +44,12 @@ bool IndexBuffer::load(void* list_indices, UINT size_list, IGraphicsEngine* grap
 
 	m_size_list = size_list;
 
-	if (FAILED(graphics_engine->getDevice()->CreateBuffer(&buff_desc, &init_data, &m_buffer)))
+	if (FAILED(graphics_engine->getDevice()->CreateBuffer(&buff_desc, list_indices ? &init_data : nullptr, &m_buffer)))
 	{
 		return false;
 	}
 
+	CommandRecorder::get()->onCreateBuffer(this, CommandBufferKind::Index, 4, buff_desc.ByteWidth, list_indices);
 	return true;
 }
 
@@ -36,7 +60,8 @@ UINT IndexBuffer::getSizeIndexList()
 
 bool IndexBuffer::release()
 {
-	m_buffer->Release();
+	CommandRecorder::get()->onRelease(this);
+	ResourceReleaseQueue::get()->deferRelease(m_buffer, 4 * m_size_list);
 	delete this;
 	return true;
 }
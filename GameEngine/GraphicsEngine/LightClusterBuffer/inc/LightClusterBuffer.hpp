@@ -0,0 +1,164 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: GPU buffers of the clustered light lists
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Upload the lights and their cluster lists once per frame.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the LightClusterBuffer class.
+/// @par Revision History:
+///      $Source: LightClusterBuffer.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _LIGHT_CLUSTER_BUFFER_HPP_
+#define _LIGHT_CLUSTER_BUFFER_HPP_
+
+#include "LightClusterGrid.hpp"
+#include <d3d11.h>
+
+class IGraphicsEngine;
+class DeviceContext;
+
+/**
+ * @class LightClusterBuffer
+ * @brief The structured buffers and constants ClusteredLights.hlsli reads.
+ *
+ * update() writes the lights, one offset and count per cluster, the light
+ * index list and the cluster constants with D3D11_MAP_WRITE_DISCARD, once
+ * per frame after LightClusterGrid::build(). Buffers that are too small are
+ * recreated with twice the size needed, so the light count can grow from
+ * frame to frame. bind() sets them for the pixel shader at t8, t9, t10 and
+ * b1, the registers declared by ClusteredLights.hlsli.
+ *
+ * Example usage:
+ * @code
+ * LightClusterBuffer* light_buffer = GraphicsEngine::get()->createLightClusterBuffer(1024, grid.getClusterCount(), 16384);
+ * grid.build(lights.data(), light_count, 4);
+ * light_buffer->update(device_context, grid, lights.data(), light_count, width, height);
+ * light_buffer->bind(device_context);
+ * @endcode
+ */
+class LightClusterBuffer
+{
+public:
+
+	/*--------------------------------------------------------------
+		Static Constants
+	--------------------------------------------------------------*/
+
+	static constexpr UINT first_texture_slot = 8;   // Lights, clusters and light indices in three slots
+	static constexpr UINT constant_slot = 1;
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Uploads the result of the last LightClusterGrid::build().
+	/// </summary>
+	/// <param name="f_lights">The lights the grid was built with.</param>
+	/// <param name="f_width">Width of the render target the lights are shaded in.</param>
+	/// <param name="f_height">Height of the render target the lights are shaded in.</param>
+	/// <returns>False if a buffer could not be grown or mapped.</returns>
+	bool update(DeviceContext* f_device_context, const LightClusterGrid& f_grid, const ClusterLight* f_lights, UINT f_light_count,
+		UINT f_width, UINT f_height);
+
+	/// <summary>
+	/// Binds the buffers to the pixel shader stage.
+	/// </summary>
+	void bind(DeviceContext* f_device_context);
+
+	/// <summary>
+	/// Bytes of the three structured buffers.
+	/// </summary>
+	unsigned long long getGpuBytes() const;
+
+	/// <summary>
+	/// Releases the buffers and the object itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct StructuredBuffer
+	{
+		ID3D11Buffer* buffer = nullptr;
+		ID3D11ShaderResourceView* srv = nullptr;
+		UINT stride = 0;
+		UINT capacity = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	LightClusterBuffer();
+	~LightClusterBuffer();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(UINT f_max_lights, UINT f_cluster_count, UINT f_max_light_indices, IGraphicsEngine* f_graphicsEngine);
+
+	/// <summary>
+	/// Creates the buffer with room for f_capacity elements, releasing the old one.
+	/// </summary>
+	bool createBuffer(StructuredBuffer& f_buffer, UINT f_capacity);
+
+	/// <summary>
+	/// Writes f_count elements, growing the buffer first if needed.
+	/// </summary>
+	bool upload(DeviceContext* f_device_context, StructuredBuffer& f_buffer, const void* f_data, UINT f_count);
+
+	void releaseBuffer(StructuredBuffer& f_buffer);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	IGraphicsEngine* m_graphics_engine;
+	StructuredBuffer m_lights;
+	StructuredBuffer m_clusters;
+	StructuredBuffer m_light_indices;
+	ID3D11Buffer* m_constants;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_LIGHT_CLUSTER_BUFFER_HPP_
@@ -0,0 +1,179 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: GPU buffers of the clustered light lists
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Upload the lights and their cluster lists once per frame.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the LightClusterBuffer class.
+/// @par Revision History:
+///      $Source: LightClusterBuffer.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "LightClusterBuffer.hpp"
+#include "GraphicsEngine.hpp"
+#include "DeviceContext.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include <algorithm>
+#include <cstring>
+
+static_assert(sizeof(ClusterLight) == 48, "ClusterLight must match the HLSL structure");
+static_assert(sizeof(LightClusterRange) == 8, "LightClusterRange must match uint2");
+static_assert(sizeof(LightClusterConstants) == 32, "LightClusterConstants must fill two constant registers");
+
+LightClusterBuffer::LightClusterBuffer() : m_graphics_engine(nullptr), m_constants(nullptr)
+{
+}
+
+bool LightClusterBuffer::init(UINT f_max_lights, UINT f_cluster_count, UINT f_max_light_indices, IGraphicsEngine* f_graphicsEngine)
+{
+	m_graphics_engine = f_graphicsEngine;
+	m_lights.stride = sizeof(ClusterLight);
+	m_clusters.stride = sizeof(LightClusterRange);
+	m_light_indices.stride = sizeof(unsigned int);
+	if (!createBuffer(m_lights, f_max_lights) || !createBuffer(m_clusters, f_cluster_count) || !createBuffer(m_light_indices, f_max_light_indices))
+	{
+		return false;
+	}
+
+	D3D11_BUFFER_DESC constants_desc = {};
+	constants_desc.ByteWidth = sizeof(LightClusterConstants);
+	constants_desc.Usage = D3D11_USAGE_DYNAMIC;
+	constants_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	constants_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	return SUCCEEDED(f_graphicsEngine->getDevice()->CreateBuffer(&constants_desc, nullptr, &m_constants));
+}
+
+bool LightClusterBuffer::createBuffer(StructuredBuffer& f_buffer, UINT f_capacity)
+{
+	releaseBuffer(f_buffer);
+
+	D3D11_BUFFER_DESC buffer_desc = {};
+	buffer_desc.ByteWidth = std::max(1u, f_capacity) * f_buffer.stride;
+	buffer_desc.Usage = D3D11_USAGE_DYNAMIC;
+	buffer_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	buffer_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	buffer_desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+	buffer_desc.StructureByteStride = f_buffer.stride;
+
+	ID3D11Device* device = m_graphics_engine->getDevice();
+	if (FAILED(device->CreateBuffer(&buffer_desc, nullptr, &f_buffer.buffer)) ||
+		FAILED(device->CreateShaderResourceView(f_buffer.buffer, nullptr, &f_buffer.srv)))
+	{
+		releaseBuffer(f_buffer);
+		return false;
+	}
+	f_buffer.capacity = std::max(1u, f_capacity);
+	return true;
+}
+
+bool LightClusterBuffer::upload(DeviceContext* f_device_context, StructuredBuffer& f_buffer, const void* f_data, UINT f_count)
+{
+	if (f_count > f_buffer.capacity && !createBuffer(f_buffer, f_count * 2))
+	{
+		return false;
+	}
+	if (f_count == 0)
+	{
+		// Nothing reads the old contents: every count the shader sees is 0
+		return true;
+	}
+
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	D3D11_MAPPED_SUBRESOURCE mapped = {};
+	if (FAILED(context->Map(f_buffer.buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+	{
+		return false;
+	}
+	std::memcpy(mapped.pData, f_data, static_cast<size_t>(f_count) * f_buffer.stride);
+	context->Unmap(f_buffer.buffer, 0);
+	return true;
+}
+
+bool LightClusterBuffer::update(DeviceContext* f_device_context, const LightClusterGrid& f_grid, const ClusterLight* f_lights, UINT f_light_count,
+	UINT f_width, UINT f_height)
+{
+	const std::vector<LightClusterRange>& clusters = f_grid.getClusters();
+	const std::vector<unsigned int>& light_indices = f_grid.getLightIndices();
+	if (!upload(f_device_context, m_lights, f_lights, f_light_count) ||
+		!upload(f_device_context, m_clusters, clusters.data(), static_cast<UINT>(clusters.size())) ||
+		!upload(f_device_context, m_light_indices, light_indices.data(), static_cast<UINT>(light_indices.size())))
+	{
+		return false;
+	}
+
+	const LightClusterConstants constants = f_grid.getShaderConstants(f_width, f_height);
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	D3D11_MAPPED_SUBRESOURCE mapped = {};
+	if (FAILED(context->Map(m_constants, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+	{
+		return false;
+	}
+	std::memcpy(mapped.pData, &constants, sizeof(constants));
+	context->Unmap(m_constants, 0);
+	return true;
+}
+
+void LightClusterBuffer::bind(DeviceContext* f_device_context)
+{
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	ID3D11ShaderResourceView* views[3] = { m_lights.srv, m_clusters.srv, m_light_indices.srv };
+	context->PSSetShaderResources(first_texture_slot, 3, views);
+	context->PSSetConstantBuffers(constant_slot, 1, &m_constants);
+}
+
+unsigned long long LightClusterBuffer::getGpuBytes() const
+{
+	return static_cast<unsigned long long>(m_lights.capacity) * m_lights.stride +
+		static_cast<unsigned long long>(m_clusters.capacity) * m_clusters.stride +
+		static_cast<unsigned long long>(m_light_indices.capacity) * m_light_indices.stride;
+}
+
+void LightClusterBuffer::releaseBuffer(StructuredBuffer& f_buffer)
+{
+	if (f_buffer.srv) ResourceReleaseQueue::get()->deferRelease(f_buffer.srv, 0);
+	if (f_buffer.buffer) ResourceReleaseQueue::get()->deferRelease(f_buffer.buffer, static_cast<unsigned long long>(f_buffer.capacity) * f_buffer.stride);
+	f_buffer.srv = nullptr;
+	f_buffer.buffer = nullptr;
+	f_buffer.capacity = 0;
+}
+
+void LightClusterBuffer::release()
+{
+	releaseBuffer(m_lights);
+	releaseBuffer(m_clusters);
+	releaseBuffer(m_light_indices);
+	if (m_constants) ResourceReleaseQueue::get()->deferRelease(m_constants, sizeof(LightClusterConstants));
+	delete this;
+}
+
+LightClusterBuffer::~LightClusterBuffer()
+{
+}
@@ -0,0 +1,250 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Clustered assignment of point and spot lights
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Give every view cluster the short list of lights reaching it.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the LightClusterGrid class and the GPU light layout.
+/// @par Revision History:
+///      $Source: LightClusterGrid.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _LIGHT_CLUSTER_GRID_HPP_
+#define _LIGHT_CLUSTER_GRID_HPP_
+
+#include <vector>
+
+/// <summary>
+/// A point or spot light, laid out like ClusterLight in ClusteredLights.hlsli.
+/// </summary>
+struct ClusterLight
+{
+	float position[3];       // World space
+	float range;             // No light reaches beyond it
+	float direction[3];      // World space unit vector the spot points along; unused by point lights
+	float cos_outer = -1.0f; // Cosine of the outer half angle, at most 90 degrees; -1 makes a point light
+	float color[3];
+	float cos_inner = -1.0f; // Cosine of the half angle the falloff starts at
+};
+
+/// <summary>
+/// Lights of one cluster: light_indices[offset] to light_indices[offset + count - 1], like a uint2 in HLSL.
+/// </summary>
+struct LightClusterRange
+{
+	unsigned int offset;
+	unsigned int count;
+};
+
+/// <summary>
+/// What the pixel shader needs to find its cluster, a 32 byte constant buffer.
+/// </summary>
+struct LightClusterConstants
+{
+	unsigned int grid[3];
+	unsigned int logarithmic;   // Slices are spaced exponentially in depth, else linearly
+	float tile_scale[2];        // Clusters per pixel
+	float depth_scale;          // slice = (logarithmic ? log(depth) : depth) * depth_scale + depth_bias
+	float depth_bias;
+};
+
+/**
+ * @class LightClusterGrid
+ * @brief Slices the view frustum into clusters and lists the lights reaching each one.
+ *
+ * The frustum is cut into screen tiles and depth slices, 32x16x32 clusters
+ * by default; perspective projections get exponentially spaced slices so
+ * near and far clusters keep similar proportions. Each light is projected
+ * to the range of clusters its bounding sphere can touch, then tested
+ * exactly against four clusters at a time: sphere against the cluster's
+ * view space box, and for spot lights cone against the cluster's bounding
+ * sphere. The depth slices are independent and are assigned in parallel;
+ * the result is one compact light index list with an offset and a count
+ * per cluster, uploaded once per frame by a LightClusterBuffer.
+ *
+ * Matrices are row-major for row vectors like Matrix4x4::mat, with D3D
+ * clip space depth from 0 to 1; both perspective and orthographic
+ * projections work.
+ *
+ * Example usage:
+ * @code
+ * grid.setCamera(view.mat, projection.mat);
+ * grid.build(lights.data(), light_count, 4);
+ * light_buffer->update(device_context, grid, lights.data(), light_count, width, height);
+ * @endcode
+ */
+class LightClusterGrid
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters of the last build.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int lights = 0;
+		unsigned int visible_lights = 0;           // Lights overlapping the frustum
+		unsigned int light_indices = 0;            // Light and cluster pairs
+		unsigned int max_lights_per_cluster = 0;
+		float build_ms = 0.0f;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	LightClusterGrid(unsigned int f_grid_x = 32, unsigned int f_grid_y = 16, unsigned int f_grid_z = 32);
+	~LightClusterGrid();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Changes the number of clusters along the screen width, the screen height and the depth.
+	/// </summary>
+	void setGrid(unsigned int f_grid_x, unsigned int f_grid_y, unsigned int f_grid_z);
+
+	/// <summary>
+	/// Sets the camera; the cluster bounds are only recomputed when the projection changes.
+	/// </summary>
+	void setCamera(const float f_view[4][4], const float f_projection[4][4]);
+
+	/// <summary>
+	/// Assigns the lights to the clusters on f_thread_count threads, the caller included.
+	/// </summary>
+	/// <param name="f_lights">Kept by pointer until the build ends.</param>
+	void build(const ClusterLight* f_lights, unsigned int f_light_count, unsigned int f_thread_count);
+
+	/// <summary>
+	/// First step of build(): moves the lights to view space and finds the clusters each can reach.
+	/// </summary>
+	void beginBuild(const ClusterLight* f_lights, unsigned int f_light_count);
+
+	/// <summary>
+	/// Second step of build(): assigns the lights of one depth slice. Different slices may run concurrently.
+	/// </summary>
+	void assignSlice(unsigned int f_slice);
+
+	/// <summary>
+	/// Last step of build(): joins the slices into one light index list.
+	/// </summary>
+	void endBuild();
+
+	unsigned int getGridX() const { return m_grid_x; }
+	unsigned int getGridY() const { return m_grid_y; }
+	unsigned int getGridZ() const { return m_grid_z; }
+	unsigned int getClusterCount() const { return m_grid_x * m_grid_y * m_grid_z; }
+	unsigned int getClusterIndex(unsigned int f_x, unsigned int f_y, unsigned int f_z) const { return (f_z * m_grid_y + f_y) * m_grid_x + f_x; }
+
+	/// <summary>
+	/// View space depth where the slice starts; slice getGridZ() gives the far plane.
+	/// </summary>
+	float getSliceDepth(unsigned int f_slice) const;
+
+	/// <summary>
+	/// One range per cluster, indexed by getClusterIndex().
+	/// </summary>
+	const std::vector<LightClusterRange>& getClusters() const { return m_clusters; }
+	const std::vector<unsigned int>& getLightIndices() const { return m_light_indices; }
+
+	/// <summary>
+	/// Constants for a render target of the given size.
+	/// </summary>
+	LightClusterConstants getShaderConstants(unsigned int f_width, unsigned int f_height) const;
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// A light moved to view space with the cluster ranges it may touch.
+	/// </summary>
+	struct ViewLight
+	{
+		float center[3];
+		float range;
+		float direction[3];
+		float cos_outer;
+		float sin_outer;
+		unsigned int min_x, max_x, min_y, max_y, min_z, max_z;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void updateClusterBounds();
+	unsigned int getSlice(float f_depth) const;
+	float getNdcX(float f_x, float f_depth) const;
+	float getNdcY(float f_y, float f_depth) const;
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	unsigned int m_grid_x;
+	unsigned int m_grid_y;
+	unsigned int m_grid_z;
+	unsigned int m_row_stride;   // m_grid_x rounded up to 4 so rows load as whole SSE registers
+	float m_view[4][4];
+	float m_projection[4][4];
+	float m_near;
+	float m_far;
+	bool m_logarithmic;
+	bool m_bounds_valid;
+
+	// View space bounds of every cluster, one array per component, rows padded to m_row_stride
+	std::vector<float> m_bounds[6];    // min x, min y, min z, max x, max y, max z
+	std::vector<float> m_spheres[4];   // centre x, y, z and radius
+
+	const ClusterLight* m_lights;
+	std::vector<ViewLight> m_view_lights;
+	unsigned int m_mask_words;
+	unsigned int m_summary_words;
+	std::vector<unsigned int> m_light_masks;     // One bit per light for every cluster
+	std::vector<unsigned int> m_mask_summaries;  // One bit per non zero mask word, so empty clusters cost one read
+	std::vector<std::vector<unsigned int>> m_slice_indices;
+	std::vector<LightClusterRange> m_clusters;
+	std::vector<unsigned int> m_light_indices;
+
+	Statistics m_statistics;
+};
+
+#endif // !_LIGHT_CLUSTER_GRID_HPP_
@@ -0,0 +1,482 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Clustered assignment of point and spot lights
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Give every view cluster the short list of lights reaching it.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the LightClusterGrid class.
+/// @par Revision History:
+///      $Source: LightClusterGrid.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/27 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "LightClusterGrid.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LIGHT_CLUSTER_GRID_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+	constexpr float empty_bound = 1e30f;
+
+	unsigned int countTrailingZeros(unsigned int f_bits)
+	{
+#if defined(_MSC_VER)
+		unsigned long index = 0;
+		_BitScanForward(&index, f_bits);
+		return static_cast<unsigned int>(index);
+#else
+		return static_cast<unsigned int>(__builtin_ctz(f_bits));
+#endif
+	}
+
+	unsigned int toCell(float f_value, unsigned int f_count)
+	{
+		return static_cast<unsigned int>(std::min(std::max(f_value, 0.0f), static_cast<float>(f_count - 1)));
+	}
+}
+
+LightClusterGrid::LightClusterGrid(unsigned int f_grid_x, unsigned int f_grid_y, unsigned int f_grid_z)
+	: m_grid_x(0), m_grid_y(0), m_grid_z(0), m_row_stride(0), m_view{}, m_projection{}, m_near(0.1f), m_far(1000.0f),
+	m_logarithmic(true), m_bounds_valid(false), m_lights(nullptr), m_mask_words(0), m_summary_words(0)
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		m_view[i][i] = 1.0f;
+		m_projection[i][i] = 1.0f;
+	}
+	setGrid(f_grid_x, f_grid_y, f_grid_z);
+}
+
+void LightClusterGrid::setGrid(unsigned int f_grid_x, unsigned int f_grid_y, unsigned int f_grid_z)
+{
+	m_grid_x = std::max(1u, f_grid_x);
+	m_grid_y = std::max(1u, f_grid_y);
+	m_grid_z = std::max(1u, f_grid_z);
+	m_row_stride = (m_grid_x + 3) & ~3u;
+	m_clusters.assign(getClusterCount(), LightClusterRange{ 0, 0 });
+	m_slice_indices.resize(m_grid_z);
+	m_bounds_valid = false;
+}
+
+void LightClusterGrid::setCamera(const float f_view[4][4], const float f_projection[4][4])
+{
+	std::memcpy(m_view, f_view, sizeof(m_view));
+	if (std::memcmp(m_projection, f_projection, sizeof(m_projection)) != 0)
+	{
+		std::memcpy(m_projection, f_projection, sizeof(m_projection));
+		m_bounds_valid = false;
+	}
+}
+
+float LightClusterGrid::getNdcX(float f_x, float f_depth) const
+{
+	return (f_x * m_projection[0][0] + f_depth * m_projection[2][0] + m_projection[3][0]) /
+		(f_depth * m_projection[2][3] + m_projection[3][3]);
+}
+
+float LightClusterGrid::getNdcY(float f_y, float f_depth) const
+{
+	return (f_y * m_projection[1][1] + f_depth * m_projection[2][1] + m_projection[3][1]) /
+		(f_depth * m_projection[2][3] + m_projection[3][3]);
+}
+
+float LightClusterGrid::getSliceDepth(unsigned int f_slice) const
+{
+	const float t = static_cast<float>(f_slice) / m_grid_z;
+	return m_logarithmic ? m_near * std::pow(m_far / m_near, t) : m_near + (m_far - m_near) * t;
+}
+
+unsigned int LightClusterGrid::getSlice(float f_depth) const
+{
+	const float t = m_logarithmic ? std::log(f_depth / m_near) / std::log(m_far / m_near) : (f_depth - m_near) / (m_far - m_near);
+	return toCell(t * m_grid_z, m_grid_z);
+}
+
+void LightClusterGrid::updateClusterBounds()
+{
+	// Depth of the clip space planes z = 0 and z = w
+	m_near = -m_projection[3][2] / m_projection[2][2];
+	m_far = (m_projection[3][3] - m_projection[3][2]) / (m_projection[2][2] - m_projection[2][3]);
+	m_logarithmic = m_projection[2][3] != 0.0f && m_near > 0.0f;
+
+	const size_t padded_count = static_cast<size_t>(m_row_stride) * m_grid_y * m_grid_z;
+	for (int i = 0; i < 3; ++i)
+	{
+		m_bounds[i].assign(padded_count, empty_bound);
+		m_bounds[i + 3].assign(padded_count, -empty_bound);
+	}
+	for (std::vector<float>& component : m_spheres)
+	{
+		component.assign(padded_count, 0.0f);
+	}
+
+	for (unsigned int z = 0; z < m_grid_z; ++z)
+	{
+		const float depths[2] = { getSliceDepth(z), getSliceDepth(z + 1) };
+		for (unsigned int y = 0; y < m_grid_y; ++y)
+		{
+			const float ndc_y[2] = { 1.0f - 2.0f * y / m_grid_y, 1.0f - 2.0f * (y + 1) / m_grid_y };
+			for (unsigned int x = 0; x < m_grid_x; ++x)
+			{
+				const float ndc_x[2] = { 2.0f * x / m_grid_x - 1.0f, 2.0f * (x + 1) / m_grid_x - 1.0f };
+				const size_t cluster = (static_cast<size_t>(z) * m_grid_y + y) * m_row_stride + x;
+
+				float low[3] = { empty_bound, empty_bound, empty_bound };
+				float high[3] = { -empty_bound, -empty_bound, -empty_bound };
+				for (int corner = 0; corner < 8; ++corner)
+				{
+					const float depth = depths[corner >> 2];
+					const float w = depth * m_projection[2][3] + m_projection[3][3];
+					const float point[3] =
+					{
+						(ndc_x[corner & 1] * w - depth * m_projection[2][0] - m_projection[3][0]) / m_projection[0][0],
+						(ndc_y[(corner >> 1) & 1] * w - depth * m_projection[2][1] - m_projection[3][1]) / m_projection[1][1],
+						depth
+					};
+					for (int axis = 0; axis < 3; ++axis)
+					{
+						low[axis] = std::min(low[axis], point[axis]);
+						high[axis] = std::max(high[axis], point[axis]);
+					}
+				}
+
+				float radius_squared = 0.0f;
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					m_bounds[axis][cluster] = low[axis];
+					m_bounds[axis + 3][cluster] = high[axis];
+					m_spheres[axis][cluster] = (low[axis] + high[axis]) * 0.5f;
+					radius_squared += (high[axis] - low[axis]) * (high[axis] - low[axis]) * 0.25f;
+				}
+				m_spheres[3][cluster] = std::sqrt(radius_squared);
+			}
+		}
+	}
+	m_bounds_valid = true;
+}
+
+void LightClusterGrid::beginBuild(const ClusterLight* f_lights, unsigned int f_light_count)
+{
+	if (!m_bounds_valid)
+	{
+		updateClusterBounds();
+	}
+
+	m_lights = f_lights;
+	m_statistics = Statistics();
+	m_statistics.lights = f_light_count;
+	m_view_lights.resize(f_light_count);
+
+	for (unsigned int i = 0; i < f_light_count; ++i)
+	{
+		const ClusterLight& light = f_lights[i];
+		ViewLight& view_light = m_view_lights[i];
+		for (int column = 0; column < 3; ++column)
+		{
+			view_light.center[column] = light.position[0] * m_view[0][column] + light.position[1] * m_view[1][column] +
+				light.position[2] * m_view[2][column] + m_view[3][column];
+			view_light.direction[column] = light.direction[0] * m_view[0][column] + light.direction[1] * m_view[1][column] +
+				light.direction[2] * m_view[2][column];
+		}
+		view_light.range = light.range;
+		view_light.cos_outer = std::min(std::max(light.cos_outer, -1.0f), 1.0f);
+		view_light.sin_outer = std::sqrt(1.0f - view_light.cos_outer * view_light.cos_outer);
+
+		// Empty ranges unless the bounding sphere overlaps the frustum
+		view_light.min_x = view_light.min_y = view_light.min_z = 1;
+		view_light.max_x = view_light.max_y = view_light.max_z = 0;
+
+		const float near_depth = std::max(view_light.center[2] - light.range, m_near);
+		const float far_depth = std::min(view_light.center[2] + light.range, m_far);
+		if (light.range <= 0.0f || near_depth > far_depth)
+		{
+			continue;
+		}
+
+		// The projection is monotonic in x and in depth, so the corners of the sphere's box bound it
+		float min_ndc[2] = { empty_bound, empty_bound }, max_ndc[2] = { -empty_bound, -empty_bound };
+		for (int corner = 0; corner < 4; ++corner)
+		{
+			const float depth = (corner & 2) ? far_depth : near_depth;
+			const float sign = (corner & 1) ? 1.0f : -1.0f;
+			const float ndc[2] =
+			{
+				getNdcX(view_light.center[0] + sign * light.range, depth),
+				getNdcY(view_light.center[1] + sign * light.range, depth)
+			};
+			for (int axis = 0; axis < 2; ++axis)
+			{
+				min_ndc[axis] = std::min(min_ndc[axis], ndc[axis]);
+				max_ndc[axis] = std::max(max_ndc[axis], ndc[axis]);
+			}
+		}
+		if (max_ndc[0] < -1.0f || min_ndc[0] > 1.0f || max_ndc[1] < -1.0f || min_ndc[1] > 1.0f)
+		{
+			continue;
+		}
+
+		view_light.min_x = toCell((min_ndc[0] + 1.0f) * 0.5f * m_grid_x, m_grid_x);
+		view_light.max_x = toCell((max_ndc[0] + 1.0f) * 0.5f * m_grid_x, m_grid_x);
+		view_light.min_y = toCell((1.0f - max_ndc[1]) * 0.5f * m_grid_y, m_grid_y);
+		view_light.max_y = toCell((1.0f - min_ndc[1]) * 0.5f * m_grid_y, m_grid_y);
+		view_light.min_z = getSlice(near_depth);
+		view_light.max_z = getSlice(far_depth);
+		m_statistics.visible_lights++;
+	}
+
+	m_mask_words = (f_light_count + 31) / 32;
+	m_summary_words = (m_mask_words + 31) / 32;
+	m_light_masks.resize(static_cast<size_t>(m_row_stride) * m_grid_y * m_grid_z * m_mask_words);
+	m_mask_summaries.resize(static_cast<size_t>(m_row_stride) * m_grid_y * m_grid_z * m_summary_words);
+}
+
+void LightClusterGrid::assignSlice(unsigned int f_slice)
+{
+	const size_t slice_clusters = static_cast<size_t>(m_row_stride) * m_grid_y;
+	unsigned int* masks = m_light_masks.data() + slice_clusters * f_slice * m_mask_words;
+	unsigned int* summaries = m_mask_summaries.data() + slice_clusters * f_slice * m_summary_words;
+	std::fill(summaries, summaries + slice_clusters * m_summary_words, 0u);
+
+	for (unsigned int light = 0; light < m_view_lights.size(); ++light)
+	{
+		const ViewLight& view_light = m_view_lights[light];
+		if (f_slice < view_light.min_z || f_slice > view_light.max_z)
+		{
+			continue;
+		}
+		const bool spot = view_light.cos_outer > -1.0f;
+		const unsigned int word = light / 32;
+		const unsigned int bit = 1u << (light % 32);
+		const unsigned int summary_word = word / 32;
+		const unsigned int summary_bit = 1u << (word % 32);
+
+		for (unsigned int y = view_light.min_y; y <= view_light.max_y; ++y)
+		{
+			const size_t row = (static_cast<size_t>(f_slice) * m_grid_y + y) * m_row_stride;
+			unsigned int* row_masks = masks + static_cast<size_t>(y) * m_row_stride * m_mask_words;
+			unsigned int* row_summaries = summaries + static_cast<size_t>(y) * m_row_stride * m_summary_words;
+
+			// Whole groups of 4 clusters; the padding lanes have empty bounds and never pass
+			for (unsigned int x = view_light.min_x & ~3u; x <= view_light.max_x; x += 4)
+			{
+				const size_t cluster = row + x;
+				int lanes = 0;
+#if LIGHT_CLUSTER_GRID_SSE2
+				const __m128 zero = _mm_setzero_ps();
+				__m128 distance_squared = zero;
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					const __m128 center = _mm_set1_ps(view_light.center[axis]);
+					const __m128 below = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&m_bounds[axis][cluster]), center), zero);
+					const __m128 above = _mm_max_ps(_mm_sub_ps(center, _mm_loadu_ps(&m_bounds[axis + 3][cluster])), zero);
+					const __m128 distance = _mm_add_ps(below, above);
+					distance_squared = _mm_add_ps(distance_squared, _mm_mul_ps(distance, distance));
+				}
+				__m128 inside = _mm_cmple_ps(distance_squared, _mm_set1_ps(view_light.range * view_light.range));
+
+				if (spot)
+				{
+					// Cone against the cluster's bounding sphere
+					__m128 to_center[3];
+					__m128 length_squared = zero, along = zero;
+					for (int axis = 0; axis < 3; ++axis)
+					{
+						to_center[axis] = _mm_sub_ps(_mm_loadu_ps(&m_spheres[axis][cluster]), _mm_set1_ps(view_light.center[axis]));
+						length_squared = _mm_add_ps(length_squared, _mm_mul_ps(to_center[axis], to_center[axis]));
+						along = _mm_add_ps(along, _mm_mul_ps(to_center[axis], _mm_set1_ps(view_light.direction[axis])));
+					}
+					const __m128 radius = _mm_loadu_ps(&m_spheres[3][cluster]);
+					const __m128 across = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(length_squared, _mm_mul_ps(along, along)), zero));
+					const __m128 closest = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(view_light.cos_outer), across),
+						_mm_mul_ps(_mm_set1_ps(view_light.sin_outer), along));
+					inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmple_ps(closest, radius),
+						_mm_cmpge_ps(along, _mm_sub_ps(zero, radius))));
+				}
+				lanes = _mm_movemask_ps(inside);
+#else
+				for (int lane = 0; lane < 4; ++lane)
+				{
+					float distance_squared = 0.0f;
+					for (int axis = 0; axis < 3; ++axis)
+					{
+						const float center = view_light.center[axis];
+						const float distance = std::max(m_bounds[axis][cluster + lane] - center, 0.0f) + std::max(center - m_bounds[axis + 3][cluster + lane], 0.0f);
+						distance_squared += distance * distance;
+					}
+					bool inside = distance_squared <= view_light.range * view_light.range;
+
+					if (spot && inside)
+					{
+						float length_squared = 0.0f, along = 0.0f;
+						for (int axis = 0; axis < 3; ++axis)
+						{
+							const float to_center = m_spheres[axis][cluster + lane] - view_light.center[axis];
+							length_squared += to_center * to_center;
+							along += to_center * view_light.direction[axis];
+						}
+						const float radius = m_spheres[3][cluster + lane];
+						const float across = std::sqrt(std::max(length_squared - along * along, 0.0f));
+						inside = view_light.cos_outer * across - view_light.sin_outer * along <= radius && along >= -radius;
+					}
+					lanes |= inside ? 1 << lane : 0;
+				}
+#endif
+				for (; lanes; lanes &= lanes - 1)
+				{
+					// A mask word is only read once its summary bit is set, so it is cleared on first use instead of per slice
+					const unsigned int lane_x = x + countTrailingZeros(static_cast<unsigned int>(lanes));
+					unsigned int& summary = row_summaries[lane_x * m_summary_words + summary_word];
+					unsigned int& mask = row_masks[lane_x * m_mask_words + word];
+					mask = (summary & summary_bit) ? mask | bit : bit;
+					summary |= summary_bit;
+				}
+			}
+		}
+	}
+
+	// Lights in index order, offsets relative to the slice until endBuild()
+	std::vector<unsigned int>& indices = m_slice_indices[f_slice];
+	indices.clear();
+	for (unsigned int y = 0; y < m_grid_y; ++y)
+	{
+		for (unsigned int x = 0; x < m_grid_x; ++x)
+		{
+			const size_t cluster = static_cast<size_t>(y) * m_row_stride + x;
+			const unsigned int* cluster_masks = masks + cluster * m_mask_words;
+			const unsigned int offset = static_cast<unsigned int>(indices.size());
+			for (unsigned int summary_word = 0; summary_word < m_summary_words; ++summary_word)
+			{
+				for (unsigned int words = summaries[cluster * m_summary_words + summary_word]; words; words &= words - 1)
+				{
+					const unsigned int word = summary_word * 32 + countTrailingZeros(words);
+					for (unsigned int bits = cluster_masks[word]; bits; bits &= bits - 1)
+					{
+						indices.push_back(word * 32 + countTrailingZeros(bits));
+					}
+				}
+			}
+			m_clusters[getClusterIndex(x, y, f_slice)] = { offset, static_cast<unsigned int>(indices.size()) - offset };
+		}
+	}
+}
+
+void LightClusterGrid::endBuild()
+{
+	size_t total = 0;
+	for (const std::vector<unsigned int>& indices : m_slice_indices)
+	{
+		total += indices.size();
+	}
+	m_light_indices.resize(total);
+
+	unsigned int base = 0;
+	const unsigned int slice_clusters = m_grid_x * m_grid_y;
+	for (unsigned int slice = 0; slice < m_grid_z; ++slice)
+	{
+		const std::vector<unsigned int>& indices = m_slice_indices[slice];
+		std::copy(indices.begin(), indices.end(), m_light_indices.begin() + base);
+		for (unsigned int cluster = slice * slice_clusters; cluster < (slice + 1) * slice_clusters; ++cluster)
+		{
+			m_clusters[cluster].offset += base;
+			m_statistics.max_lights_per_cluster = std::max(m_statistics.max_lights_per_cluster, m_clusters[cluster].count);
+		}
+		base += static_cast<unsigned int>(indices.size());
+	}
+	m_statistics.light_indices = base;
+	m_lights = nullptr;
+}
+
+void LightClusterGrid::build(const ClusterLight* f_lights, unsigned int f_light_count, unsigned int f_thread_count)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	beginBuild(f_lights, f_light_count);
+
+	std::atomic<unsigned int> next_slice(0);
+	auto assignSlices = [this, &next_slice]()
+	{
+		for (unsigned int slice = next_slice++; slice < m_grid_z; slice = next_slice++)
+		{
+			assignSlice(slice);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (unsigned int i = 1; i < std::min(f_thread_count, m_grid_z); ++i)
+	{
+		threads.emplace_back(assignSlices);
+	}
+	assignSlices();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	endBuild();
+	m_statistics.build_ms = static_cast<float>(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+LightClusterConstants LightClusterGrid::getShaderConstants(unsigned int f_width, unsigned int f_height) const
+{
+	LightClusterConstants constants = {};
+	constants.grid[0] = m_grid_x;
+	constants.grid[1] = m_grid_y;
+	constants.grid[2] = m_grid_z;
+	constants.logarithmic = m_logarithmic ? 1 : 0;
+	constants.tile_scale[0] = static_cast<float>(m_grid_x) / std::max(1u, f_width);
+	constants.tile_scale[1] = static_cast<float>(m_grid_y) / std::max(1u, f_height);
+	if (m_logarithmic)
+	{
+		constants.depth_scale = m_grid_z / std::log(m_far / m_near);
+		constants.depth_bias = -std::log(m_near) * constants.depth_scale;
+	}
+	else
+	{
+		constants.depth_scale = m_grid_z / (m_far - m_near);
+		constants.depth_bias = -m_near * constants.depth_scale;
+	}
+	return constants;
+}
+
+LightClusterGrid::~LightClusterGrid()
+{
+}
@@ -0,0 +1,247 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Software occlusion culling against a low resolution depth buffer
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Skip objects hidden behind large occluders before they are drawn.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the OcclusionCuller class.
+/// @par Revision History:
+///      $Source: OcclusionCuller.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/25 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _OCCLUSION_CULLER_HPP_
+#define _OCCLUSION_CULLER_HPP_
+
+#include <atomic>
+#include <vector>
+
+/// <summary>
+/// World space axis-aligned bounds of an object tested by the OcclusionCuller.
+/// </summary>
+struct OcclusionBox
+{
+	float min[3];
+	float max[3];
+};
+
+/**
+ * @class OcclusionCuller
+ * @brief Rasterizes a few large occluders on the CPU and rejects the boxes hidden behind them.
+ *
+ * The occluders are rasterized into a small float depth buffer (320x192 by
+ * default) split into 64x32 tiles; each tile is independent, so the tiles
+ * are spread over threads. Every 8x4 pixel block also keeps its farthest
+ * depth. A box is projected to a screen rectangle and its nearest depth: a
+ * block whose farthest depth is nearer than the box hides it without
+ * looking at its pixels, the other blocks are tested pixel by pixel.
+ *
+ * The test is conservative: boxes crossing the near plane or outside the
+ * screen are reported visible, and occluders are only rasterized where they
+ * cover pixel centres. Depth follows the D3D convention, 0 near and 1 far,
+ * and matrices are row-major for row vectors like Matrix4x4::mat.
+ *
+ * Example usage:
+ * @code
+ * culler.beginFrame(view_projection.mat);
+ * culler.addOccluder(wall_positions, wall_vertex_count, wall_indices, wall_index_count);
+ * culler.rasterize(4);
+ * culler.cullBoxes(mesh_bounds.data(), mesh_count, visible_flags);
+ * static_geometry->draw(device_context, visible_flags, bind_material);
+ * @endcode
+ */
+class OcclusionCuller
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters of the current frame.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int occluders = 0;
+		unsigned int occluder_triangles = 0;
+		unsigned int rasterized_triangles = 0;   // After near clipping and dropping degenerate triangles
+		unsigned int binned_triangles = 0;       // Triangle and tile pairs
+		unsigned int tested_boxes = 0;
+		unsigned int culled_boxes = 0;
+		float rasterize_ms = 0.0f;
+		float test_ms = 0.0f;
+
+		float getCulledRate() const { return tested_boxes ? static_cast<float>(culled_boxes) / tested_boxes : 0.0f; }
+	};
+
+	/*--------------------------------------------------------------
+		Static Constants
+	--------------------------------------------------------------*/
+
+	static constexpr unsigned int tile_width = 64;
+	static constexpr unsigned int tile_height = 32;
+	static constexpr unsigned int block_width = 8;
+	static constexpr unsigned int block_height = 4;
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Creates the depth buffer; the size is rounded up to whole 8x4 blocks.
+	/// </summary>
+	OcclusionCuller(unsigned int f_width = 320, unsigned int f_height = 192);
+	~OcclusionCuller();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Changes the depth buffer size; the size is rounded up to whole 8x4 blocks.
+	/// </summary>
+	void resize(unsigned int f_width, unsigned int f_height);
+
+	/// <summary>
+	/// Removes the occluders of the previous frame and sets the camera.
+	/// </summary>
+	/// <param name="f_view_projection">World to clip space, row vectors.</param>
+	void beginFrame(const float f_view_projection[4][4]);
+
+	/// <summary>
+	/// Adds a triangle mesh that hides what is behind it; both faces are rasterized.
+	/// Pick few, large, simple meshes: walls, terrain, building shells.
+	/// </summary>
+	/// <param name="f_positions">f_vertex_count xyz triples.</param>
+	/// <param name="f_world">Object to world transform, or nullptr if the positions are in world space.</param>
+	/// <returns>Occluder index for getOccluderCoverage().</returns>
+	unsigned int addOccluder(const float* f_positions, unsigned int f_vertex_count, const unsigned int* f_indices, unsigned int f_index_count,
+		const float (*f_world)[4] = nullptr);
+
+	/// <summary>
+	/// Clips and bins the occluder triangles, then rasterizes the tiles on f_thread_count threads, the caller included.
+	/// </summary>
+	void rasterize(unsigned int f_thread_count);
+
+	/// <summary>
+	/// First half of rasterize(): clips, projects and bins the occluder triangles to tiles.
+	/// </summary>
+	void prepareTiles();
+
+	/// <summary>
+	/// Second half of rasterize(): rasterizes one tile and its blocks. Different tiles may run concurrently.
+	/// </summary>
+	void rasterizeTile(unsigned int f_tile);
+
+	unsigned int getTileCount() const { return m_tiles_x * m_tiles_y; }
+
+	/// <summary>
+	/// Tests one box against the rasterized occluders. Safe to call from several threads.
+	/// </summary>
+	/// <returns>False only if the box is certainly hidden.</returns>
+	bool isVisible(const OcclusionBox& f_box) const;
+
+	/// <summary>
+	/// Tests many boxes and counts them in the statistics.
+	/// </summary>
+	/// <param name="f_visible">Receives one flag per box, the format StaticGeometry::draw() takes.</param>
+	void cullBoxes(const OcclusionBox* f_boxes, unsigned int f_count, bool* f_visible);
+
+	/// <summary>
+	/// Depth pixels the occluder was nearest in when written; occluders covering little are not worth their cost.
+	/// </summary>
+	unsigned int getOccluderCoverage(unsigned int f_occluder) const { return m_occluder_coverage[f_occluder].load(std::memory_order_relaxed); }
+
+	unsigned int getWidth() const { return m_width; }
+	unsigned int getHeight() const { return m_height; }
+
+	/// <summary>
+	/// The depth buffer, row by row; for debug views.
+	/// </summary>
+	const float* getDepthBuffer() const { return m_depth.data(); }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct ClipVertex
+	{
+		float x, y, z, w;
+	};
+
+	/// <summary>
+	/// A screen space triangle set up for rasterization: three edge functions and the depth plane.
+	/// </summary>
+	struct ScreenTriangle
+	{
+		float edge_a[3];
+		float edge_b[3];
+		float edge_c[3];
+		float depth_a, depth_b, depth_c;
+		int min_x, min_y, max_x, max_y;
+		unsigned int occluder;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void addScreenTriangle(const ClipVertex& f_v0, const ClipVertex& f_v1, const ClipVertex& f_v2, unsigned int f_occluder);
+	bool isBlockVisible(unsigned int f_block_x, unsigned int f_block_y, int f_min_x, int f_min_y, int f_max_x, int f_max_y, float f_depth) const;
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	unsigned int m_width;
+	unsigned int m_height;
+	unsigned int m_tiles_x;
+	unsigned int m_tiles_y;
+	float m_view_projection[4][4];
+
+	std::vector<float> m_depth;
+	std::vector<float> m_block_depth;   // Farthest depth of every 8x4 block
+
+	std::vector<ClipVertex> m_vertices;
+	std::vector<unsigned int> m_triangles;   // Three m_vertices indices and the occluder index per triangle
+	std::vector<ScreenTriangle> m_screen_triangles;
+	std::vector<std::vector<unsigned int>> m_tile_triangles;
+	std::vector<std::atomic<unsigned int>> m_occluder_coverage;   // Summed by the tiles as they finish
+	unsigned int m_occluder_count;
+
+	Statistics m_statistics;
+};
+
+#endif // !_OCCLUSION_CULLER_HPP_
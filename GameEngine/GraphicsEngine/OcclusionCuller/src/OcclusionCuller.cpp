@@ -0,0 +1,482 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Software occlusion culling against a low resolution depth buffer
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Skip objects hidden behind large occluders before they are drawn.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the OcclusionCuller class.
+/// @par Revision History:
+///      $Source: OcclusionCuller.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/25 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "OcclusionCuller.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OCCLUSION_CULLER_SSE2 1
+#endif
+
+namespace
+{
+	constexpr float min_triangle_area = 1e-6f;
+
+	unsigned int roundUp(unsigned int f_value, unsigned int f_multiple)
+	{
+		return (std::max(f_value, 1u) + f_multiple - 1) / f_multiple * f_multiple;
+	}
+
+	/// <summary>
+	/// Row vector times row-major matrix, w = 1.
+	/// </summary>
+	void transformPoint(const float f_point[3], const float f_matrix[4][4], float f_out[4])
+	{
+		for (int column = 0; column < 4; ++column)
+		{
+			f_out[column] = f_point[0] * f_matrix[0][column] + f_point[1] * f_matrix[1][column] +
+				f_point[2] * f_matrix[2][column] + f_matrix[3][column];
+		}
+	}
+
+	double elapsedMs(std::chrono::steady_clock::time_point f_start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - f_start).count();
+	}
+}
+
+OcclusionCuller::OcclusionCuller(unsigned int f_width, unsigned int f_height)
+	: m_width(0), m_height(0), m_tiles_x(0), m_tiles_y(0), m_view_projection{}, m_occluder_count(0)
+{
+	resize(f_width, f_height);
+}
+
+void OcclusionCuller::resize(unsigned int f_width, unsigned int f_height)
+{
+	m_width = roundUp(f_width, block_width);
+	m_height = roundUp(f_height, block_height);
+	m_tiles_x = (m_width + tile_width - 1) / tile_width;
+	m_tiles_y = (m_height + tile_height - 1) / tile_height;
+
+	m_depth.assign(static_cast<size_t>(m_width) * m_height, 1.0f);
+	m_block_depth.assign(static_cast<size_t>(m_width / block_width) * (m_height / block_height), 1.0f);
+	m_tile_triangles.resize(getTileCount());
+}
+
+void OcclusionCuller::beginFrame(const float f_view_projection[4][4])
+{
+	std::copy(&f_view_projection[0][0], &f_view_projection[0][0] + 16, &m_view_projection[0][0]);
+	m_vertices.clear();
+	m_triangles.clear();
+	m_occluder_count = 0;
+	m_statistics = Statistics();
+}
+
+unsigned int OcclusionCuller::addOccluder(const float* f_positions, unsigned int f_vertex_count, const unsigned int* f_indices,
+	unsigned int f_index_count, const float (*f_world)[4])
+{
+	float world_view_projection[4][4];
+	const float (*matrix)[4] = m_view_projection;
+	if (f_world)
+	{
+		for (int row = 0; row < 4; ++row)
+		{
+			for (int column = 0; column < 4; ++column)
+			{
+				world_view_projection[row][column] = f_world[row][0] * m_view_projection[0][column] + f_world[row][1] * m_view_projection[1][column] +
+					f_world[row][2] * m_view_projection[2][column] + f_world[row][3] * m_view_projection[3][column];
+			}
+		}
+		matrix = world_view_projection;
+	}
+
+	const unsigned int base_vertex = static_cast<unsigned int>(m_vertices.size());
+	for (unsigned int i = 0; i < f_vertex_count; ++i)
+	{
+		float clip[4];
+		transformPoint(f_positions + i * 3, matrix, clip);
+		m_vertices.push_back({ clip[0], clip[1], clip[2], clip[3] });
+	}
+
+	const unsigned int occluder = m_occluder_count++;
+	for (unsigned int i = 0; i + 2 < f_index_count; i += 3)
+	{
+		if (f_indices[i] >= f_vertex_count || f_indices[i + 1] >= f_vertex_count || f_indices[i + 2] >= f_vertex_count)
+		{
+			continue;
+		}
+		m_triangles.insert(m_triangles.end(), { base_vertex + f_indices[i], base_vertex + f_indices[i + 1], base_vertex + f_indices[i + 2], occluder });
+	}
+
+	m_statistics.occluders = m_occluder_count;
+	m_statistics.occluder_triangles = static_cast<unsigned int>(m_triangles.size() / 4);
+	return occluder;
+}
+
+void OcclusionCuller::addScreenTriangle(const ClipVertex& f_v0, const ClipVertex& f_v1, const ClipVertex& f_v2, unsigned int f_occluder)
+{
+	const ClipVertex* clip[3] = { &f_v0, &f_v1, &f_v2 };
+	float x[3], y[3], z[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		const float inverse_w = 1.0f / clip[i]->w;
+		x[i] = (clip[i]->x * inverse_w * 0.5f + 0.5f) * m_width;
+		y[i] = (0.5f - clip[i]->y * inverse_w * 0.5f) * m_height;
+		z[i] = clip[i]->z * inverse_w;
+	}
+
+	ScreenTriangle triangle;
+	triangle.min_x = std::max(0, static_cast<int>(std::floor(std::min({ x[0], x[1], x[2] }))));
+	triangle.min_y = std::max(0, static_cast<int>(std::floor(std::min({ y[0], y[1], y[2] }))));
+	triangle.max_x = std::min(static_cast<int>(m_width) - 1, static_cast<int>(std::ceil(std::max({ x[0], x[1], x[2] }))));
+	triangle.max_y = std::min(static_cast<int>(m_height) - 1, static_cast<int>(std::ceil(std::max({ y[0], y[1], y[2] }))));
+	if (triangle.min_x > triangle.max_x || triangle.min_y > triangle.max_y)
+	{
+		return;
+	}
+
+	const float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+	if (std::fabs(area) < min_triangle_area)
+	{
+		return;
+	}
+
+	// Edge i runs from vertex i to vertex i + 1; flipped so the inside is positive whatever the winding
+	const float sign = area > 0.0f ? 1.0f : -1.0f;
+	for (int i = 0; i < 3; ++i)
+	{
+		const int j = (i + 1) % 3;
+		triangle.edge_a[i] = sign * (y[i] - y[j]);
+		triangle.edge_b[i] = sign * (x[j] - x[i]);
+		triangle.edge_c[i] = sign * (x[i] * y[j] - y[i] * x[j]);
+	}
+
+	// z / w is linear in screen space
+	triangle.depth_a = ((z[1] - z[0]) * (y[2] - y[0]) - (z[2] - z[0]) * (y[1] - y[0])) / area;
+	triangle.depth_b = ((z[2] - z[0]) * (x[1] - x[0]) - (z[1] - z[0]) * (x[2] - x[0])) / area;
+	triangle.depth_c = z[0] - triangle.depth_a * x[0] - triangle.depth_b * y[0];
+	triangle.occluder = f_occluder;
+
+	const unsigned int index = static_cast<unsigned int>(m_screen_triangles.size());
+	m_screen_triangles.push_back(triangle);
+	m_statistics.rasterized_triangles++;
+
+	for (int tile_y = triangle.min_y / static_cast<int>(tile_height); tile_y <= triangle.max_y / static_cast<int>(tile_height); ++tile_y)
+	{
+		for (int tile_x = triangle.min_x / static_cast<int>(tile_width); tile_x <= triangle.max_x / static_cast<int>(tile_width); ++tile_x)
+		{
+			m_tile_triangles[tile_y * m_tiles_x + tile_x].push_back(index);
+			m_statistics.binned_triangles++;
+		}
+	}
+}
+
+void OcclusionCuller::prepareTiles()
+{
+	m_screen_triangles.clear();
+	for (std::vector<unsigned int>& triangles : m_tile_triangles)
+	{
+		triangles.clear();
+	}
+	std::vector<std::atomic<unsigned int>> coverage(m_occluder_count);
+	m_occluder_coverage.swap(coverage);
+	for (std::atomic<unsigned int>& pixels : m_occluder_coverage)
+	{
+		pixels.store(0, std::memory_order_relaxed);
+	}
+	m_statistics.rasterized_triangles = 0;
+	m_statistics.binned_triangles = 0;
+
+	for (size_t i = 0; i < m_triangles.size(); i += 4)
+	{
+		const ClipVertex* vertices[3] = { &m_vertices[m_triangles[i]], &m_vertices[m_triangles[i + 1]], &m_vertices[m_triangles[i + 2]] };
+		const unsigned int occluder = m_triangles[i + 3];
+
+		// Clip against the near plane z = 0; the other planes are handled by the screen bounds
+		ClipVertex polygon[4];
+		int count = 0;
+		for (int k = 0; k < 3; ++k)
+		{
+			const ClipVertex& current = *vertices[k];
+			const ClipVertex& next = *vertices[(k + 1) % 3];
+			if (current.z >= 0.0f)
+			{
+				polygon[count++] = current;
+			}
+			if ((current.z >= 0.0f) != (next.z >= 0.0f))
+			{
+				const float t = current.z / (current.z - next.z);
+				polygon[count++] = { current.x + (next.x - current.x) * t, current.y + (next.y - current.y) * t, 0.0f,
+					current.w + (next.w - current.w) * t };
+			}
+		}
+
+		for (int k = 1; k + 1 < count; ++k)
+		{
+			if (polygon[0].w > 0.0f && polygon[k].w > 0.0f && polygon[k + 1].w > 0.0f)
+			{
+				addScreenTriangle(polygon[0], polygon[k], polygon[k + 1], occluder);
+			}
+		}
+	}
+}
+
+void OcclusionCuller::rasterizeTile(unsigned int f_tile)
+{
+	const int tile_min_x = static_cast<int>((f_tile % m_tiles_x) * tile_width);
+	const int tile_min_y = static_cast<int>((f_tile / m_tiles_x) * tile_height);
+	const int tile_max_x = std::min(tile_min_x + static_cast<int>(tile_width), static_cast<int>(m_width)) - 1;
+	const int tile_max_y = std::min(tile_min_y + static_cast<int>(tile_height), static_cast<int>(m_height)) - 1;
+
+	for (int y = tile_min_y; y <= tile_max_y; ++y)
+	{
+		std::fill(m_depth.begin() + y * m_width + tile_min_x, m_depth.begin() + y * m_width + tile_max_x + 1, 1.0f);
+	}
+
+	unsigned int covered_pixels = 0;
+	unsigned int covered_occluder = ~0u;
+	for (unsigned int index : m_tile_triangles[f_tile])
+	{
+		const ScreenTriangle& triangle = m_screen_triangles[index];
+		if (triangle.occluder != covered_occluder)
+		{
+			if (covered_pixels) m_occluder_coverage[covered_occluder].fetch_add(covered_pixels, std::memory_order_relaxed);
+			covered_occluder = triangle.occluder;
+			covered_pixels = 0;
+		}
+
+		// Tiles and rows start on multiples of 4 pixels, so the 4 wide steps never leave the tile
+		const int min_x = std::max(triangle.min_x, tile_min_x) & ~3;
+		const int max_x = std::min(triangle.max_x, tile_max_x);
+		const int min_y = std::max(triangle.min_y, tile_min_y);
+		const int max_y = std::min(triangle.max_y, tile_max_y);
+
+		for (int y = min_y; y <= max_y; ++y)
+		{
+			float* row = m_depth.data() + static_cast<size_t>(y) * m_width;
+			const float pixel_y = y + 0.5f;
+#if OCCLUSION_CULLER_SSE2
+			static const int bit_count[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 four = _mm_set1_ps(4.0f);
+			const __m128 edge_a0 = _mm_set1_ps(triangle.edge_a[0]);
+			const __m128 edge_a1 = _mm_set1_ps(triangle.edge_a[1]);
+			const __m128 edge_a2 = _mm_set1_ps(triangle.edge_a[2]);
+			const __m128 edge_row0 = _mm_set1_ps(triangle.edge_b[0] * pixel_y + triangle.edge_c[0]);
+			const __m128 edge_row1 = _mm_set1_ps(triangle.edge_b[1] * pixel_y + triangle.edge_c[1]);
+			const __m128 edge_row2 = _mm_set1_ps(triangle.edge_b[2] * pixel_y + triangle.edge_c[2]);
+			const __m128 depth_a = _mm_set1_ps(triangle.depth_a);
+			const __m128 depth_row = _mm_set1_ps(triangle.depth_b * pixel_y + triangle.depth_c);
+			__m128 pixel_x = _mm_add_ps(_mm_set1_ps(static_cast<float>(min_x)), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f));
+
+			for (int x = min_x; x <= max_x; x += 4, pixel_x = _mm_add_ps(pixel_x, four))
+			{
+				const __m128 inside = _mm_and_ps(_mm_and_ps(
+					_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_a0, pixel_x), edge_row0), zero),
+					_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_a1, pixel_x), edge_row1), zero)),
+					_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edge_a2, pixel_x), edge_row2), zero));
+				const __m128 depth = _mm_add_ps(_mm_mul_ps(depth_a, pixel_x), depth_row);
+				const __m128 stored = _mm_loadu_ps(row + x);
+				const __m128 closer = _mm_and_ps(inside, _mm_cmplt_ps(depth, stored));
+				const int mask = _mm_movemask_ps(closer);
+				if (mask)
+				{
+					_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(closer, depth), _mm_andnot_ps(closer, stored)));
+					covered_pixels += bit_count[mask];
+				}
+			}
+#else
+			for (int x = min_x; x <= max_x; ++x)
+			{
+				const float pixel_x = x + 0.5f;
+				bool inside = true;
+				for (int i = 0; i < 3; ++i)
+				{
+					inside = inside && triangle.edge_a[i] * pixel_x + (triangle.edge_b[i] * pixel_y + triangle.edge_c[i]) >= 0.0f;
+				}
+				const float depth = triangle.depth_a * pixel_x + (triangle.depth_b * pixel_y + triangle.depth_c);
+				if (inside && depth < row[x])
+				{
+					row[x] = depth;
+					covered_pixels++;
+				}
+			}
+#endif
+		}
+	}
+	if (covered_pixels) m_occluder_coverage[covered_occluder].fetch_add(covered_pixels, std::memory_order_relaxed);
+
+	// Farthest depth of every block of the tile
+	const unsigned int blocks_per_row = m_width / block_width;
+	for (int block_y = tile_min_y; block_y <= tile_max_y; block_y += block_height)
+	{
+		for (int block_x = tile_min_x; block_x <= tile_max_x; block_x += block_width)
+		{
+			float farthest = 0.0f;
+			for (unsigned int y = 0; y < block_height; ++y)
+			{
+				const float* row = m_depth.data() + static_cast<size_t>(block_y + y) * m_width + block_x;
+				for (unsigned int x = 0; x < block_width; ++x)
+				{
+					farthest = std::max(farthest, row[x]);
+				}
+			}
+			m_block_depth[(block_y / block_height) * blocks_per_row + block_x / block_width] = farthest;
+		}
+	}
+}
+
+void OcclusionCuller::rasterize(unsigned int f_thread_count)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	prepareTiles();
+
+	std::atomic<unsigned int> next_tile(0);
+	const unsigned int tile_count = getTileCount();
+	auto rasterizeTiles = [this, &next_tile, tile_count]()
+	{
+		for (unsigned int tile = next_tile++; tile < tile_count; tile = next_tile++)
+		{
+			rasterizeTile(tile);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (unsigned int i = 1; i < std::min(f_thread_count, tile_count); ++i)
+	{
+		threads.emplace_back(rasterizeTiles);
+	}
+	rasterizeTiles();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	m_statistics.rasterize_ms = static_cast<float>(elapsedMs(start));
+}
+
+bool OcclusionCuller::isBlockVisible(unsigned int f_block_x, unsigned int f_block_y, int f_min_x, int f_min_y, int f_max_x, int f_max_y, float f_depth) const
+{
+	const int block_min_x = static_cast<int>(f_block_x * block_width);
+	const int block_min_y = static_cast<int>(f_block_y * block_height);
+	const int min_x = std::max(f_min_x, block_min_x);
+	const int min_y = std::max(f_min_y, block_min_y);
+	const int max_x = std::min(f_max_x, block_min_x + static_cast<int>(block_width) - 1);
+	const int max_y = std::min(f_max_y, block_min_y + static_cast<int>(block_height) - 1);
+
+	for (int y = min_y; y <= max_y; ++y)
+	{
+		const float* row = m_depth.data() + static_cast<size_t>(y) * m_width;
+		for (int x = min_x; x <= max_x; ++x)
+		{
+			if (f_depth <= row[x])
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool OcclusionCuller::isVisible(const OcclusionBox& f_box) const
+{
+	float min_x = static_cast<float>(m_width), min_y = static_cast<float>(m_height), min_depth = 1.0f;
+	float max_x = 0.0f, max_y = 0.0f;
+	for (int corner = 0; corner < 8; ++corner)
+	{
+		const float point[3] = { (corner & 1) ? f_box.max[0] : f_box.min[0], (corner & 2) ? f_box.max[1] : f_box.min[1],
+			(corner & 4) ? f_box.max[2] : f_box.min[2] };
+		float clip[4];
+		transformPoint(point, m_view_projection, clip);
+		if (clip[2] < 0.0f || clip[3] <= 0.0f)
+		{
+			// Crosses the near plane: the projected rectangle is unbounded
+			return true;
+		}
+
+		const float inverse_w = 1.0f / clip[3];
+		const float x = (clip[0] * inverse_w * 0.5f + 0.5f) * m_width;
+		const float y = (0.5f - clip[1] * inverse_w * 0.5f) * m_height;
+		min_x = std::min(min_x, x);
+		max_x = std::max(max_x, x);
+		min_y = std::min(min_y, y);
+		max_y = std::max(max_y, y);
+		min_depth = std::min(min_depth, clip[2] * inverse_w);
+	}
+
+	const int pixel_min_x = std::max(0, static_cast<int>(std::floor(min_x)));
+	const int pixel_min_y = std::max(0, static_cast<int>(std::floor(min_y)));
+	const int pixel_max_x = std::min(static_cast<int>(m_width) - 1, static_cast<int>(std::floor(max_x)));
+	const int pixel_max_y = std::min(static_cast<int>(m_height) - 1, static_cast<int>(std::floor(max_y)));
+	if (pixel_min_x > pixel_max_x || pixel_min_y > pixel_max_y)
+	{
+		// Off screen: that is for frustum culling to decide
+		return true;
+	}
+
+	const unsigned int blocks_per_row = m_width / block_width;
+	for (unsigned int block_y = pixel_min_y / block_height; block_y <= pixel_max_y / block_height; ++block_y)
+	{
+		for (unsigned int block_x = pixel_min_x / block_width; block_x <= pixel_max_x / block_width; ++block_x)
+		{
+			if (min_depth > m_block_depth[block_y * blocks_per_row + block_x])
+			{
+				// Every pixel of the block is nearer than the box
+				continue;
+			}
+			if (isBlockVisible(block_x, block_y, pixel_min_x, pixel_min_y, pixel_max_x, pixel_max_y, min_depth))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void OcclusionCuller::cullBoxes(const OcclusionBox* f_boxes, unsigned int f_count, bool* f_visible)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	unsigned int culled = 0;
+	for (unsigned int i = 0; i < f_count; ++i)
+	{
+		f_visible[i] = isVisible(f_boxes[i]);
+		culled += f_visible[i] ? 0 : 1;
+	}
+	m_statistics.tested_boxes += f_count;
+	m_statistics.culled_boxes += culled;
+	m_statistics.test_ms += static_cast<float>(elapsedMs(start));
+}
+
+OcclusionCuller::~OcclusionCuller()
+{
+}
@@ -0,0 +1,228 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Immutable pipeline state objects and their cache
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Pipeline states are owned by the PipelineStateCache, never by the user.
+//  - Two identical descriptions always resolve to the same PipelineState.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Bundle shaders, input layout, topology and fixed function
+//              state into one object that is bound with a single call.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the PipelineStateDesc, PipelineState and PipelineStateCache classes.
+/// @par Revision History:
+///      $Source: PipelineState.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/02 11:20:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _PIPELINE_STATE_HPP_
+#define _PIPELINE_STATE_HPP_
+
+#include <d3d11.h>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+class IGraphicsEngine; // Forward declaration for IGraphicsEngine
+class DeviceContext;
+class VertexShader;
+class PixelShader;
+
+/**
+ * @struct PipelineStateDesc
+ * @brief Plain description of everything a PipelineState binds.
+ *
+ * The constructor fills the fixed function state with the DirectX 11 defaults
+ * (solid fill, back face culling, no blending, depth test disabled) so that a
+ * description only has to set the shaders, the input layout and the topology.
+ */
+struct PipelineStateDesc
+{
+	/// <summary>
+	/// Builds a description with the DirectX 11 default fixed function state.
+	/// </summary>
+	PipelineStateDesc();
+
+	/// <summary>
+	/// Computes a hash over every field of the description.
+	/// Equal descriptions always produce the same hash.
+	/// </summary>
+	/// <returns>The hash of the description.</returns>
+	size_t hash() const;
+
+	/// <summary>
+	/// Compares two descriptions field by field (padding bytes are ignored).
+	/// </summary>
+	bool operator==(const PipelineStateDesc& rhs) const;
+
+	VertexShader* vertex_shader;
+	PixelShader* pixel_shader;
+	ID3D11InputLayout* input_layout;
+	D3D11_PRIMITIVE_TOPOLOGY topology;
+	D3D11_RASTERIZER_DESC rasterizer;
+	D3D11_BLEND_DESC blend;
+	D3D11_DEPTH_STENCIL_DESC depth_stencil;
+	FLOAT blend_factor[4];
+	UINT sample_mask;
+	UINT stencil_ref;
+};
+
+/**
+ * @class PipelineState
+ * @brief Immutable bundle of the whole graphics pipeline configuration.
+ *
+ * A PipelineState is created once through GraphicsEngine::createPipelineState()
+ * and never changes afterwards. DeviceContext::setPipelineState() compares it
+ * with the previously bound state and only issues the calls for the parts that
+ * actually differ, so switching materials stays cheap.
+ */
+class PipelineState
+{
+public:
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Retrieves the description this pipeline state was created from.
+	/// </summary>
+	const PipelineStateDesc& getDesc() const { return m_desc; }
+
+	/// <summary>
+	/// Retrieves the hash of the description, computed once at creation.
+	/// </summary>
+	size_t getHash() const { return m_hash; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	PipelineState();
+	PipelineState(const PipelineState&) = delete;
+	PipelineState& operator=(const PipelineState&) = delete;
+	~PipelineState();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(const PipelineStateDesc& f_desc, size_t f_hash, IGraphicsEngine* f_graphicsEngine);
+	void release();
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	PipelineStateDesc m_desc;
+	size_t m_hash;
+	ID3D11RasterizerState* m_rasterizer_state;
+	ID3D11BlendState* m_blend_state;
+	ID3D11DepthStencilState* m_depth_stencil_state;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class PipelineStateCache;
+	friend class DeviceContext;
+};
+
+/**
+ * @class PipelineStateCache
+ * @brief Hashes and deduplicates every PipelineState created by the engine.
+ *
+ * The cache owns the pipeline states it hands out. Requesting a description
+ * that was already seen returns the existing object, which keeps the number
+ * of distinct states (and therefore of state switches) as low as possible.
+ *
+ * A state holds a reference on its shaders and input layout. Releasing a
+ * shader elsewhere therefore never leaves a cached state dangling, nor lets a
+ * new shader reuse its address and match the old state; the shader is only
+ * destroyed once the cache is released.
+ */
+class PipelineStateCache
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	struct Statistics
+	{
+		UINT states = 0;     // Distinct pipeline states alive in the cache
+		UINT hits = 0;       // Requests served by an existing state
+		UINT misses = 0;     // Requests that created a new state
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	PipelineStateCache() = default;
+	PipelineStateCache(const PipelineStateCache&) = delete;
+	PipelineStateCache& operator=(const PipelineStateCache&) = delete;
+	~PipelineStateCache();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Returns the pipeline state matching the description, creating it on first use.
+	/// </summary>
+	/// <param name="f_desc">Description of the requested pipeline state.</param>
+	/// <param name="f_graphicsEngine">Engine used to create the fixed function state objects.</param>
+	/// <returns>The shared pipeline state, or nullptr if creation failed.</returns>
+	PipelineState* getOrCreate(const PipelineStateDesc& f_desc, IGraphicsEngine* f_graphicsEngine);
+
+	/// <summary>
+	/// Retrieves the hit/miss counters of the cache.
+	/// </summary>
+	Statistics getStatistics();
+
+	/// <summary>
+	/// Releases every pipeline state owned by the cache.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::unordered_multimap<size_t, PipelineState*> m_states;
+	Statistics m_statistics;
+	std::mutex m_mutex;
+};
+
+#endif // !_PIPELINE_STATE_HPP_
@@ -0,0 +1,348 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Immutable pipeline state objects and their cache
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Pipeline states are owned by the PipelineStateCache, never by the user.
+//  - Two identical descriptions always resolve to the same PipelineState.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Bundle shaders, input layout, topology and fixed function
+//              state into one object that is bound with a single call.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the PipelineStateDesc, PipelineState and PipelineStateCache classes.
+/// @par Revision History:
+///      $Source: PipelineState.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/02 11:20:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "PipelineState.hpp"
+#include "IGraphicsEngine.hpp"
+#include "VertexShader.hpp"
+#include "PixelShader.hpp"
+#include "CommandRecorder.hpp"
+#include <cstring>
+
+namespace
+{
+	// FNV-1a, fed one field at a time so struct padding never reaches the hash
+	class Hasher
+	{
+	public:
+		template <typename T>
+		void add(const T& f_value)
+		{
+			const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&f_value);
+			for (size_t i = 0; i < sizeof(T); ++i)
+			{
+				m_hash ^= bytes[i];
+				m_hash *= 1099511628211ull;
+			}
+		}
+
+		size_t get() const { return static_cast<size_t>(m_hash); }
+
+	private:
+		unsigned long long m_hash = 14695981039346656037ull;
+	};
+
+	bool equalRasterizer(const D3D11_RASTERIZER_DESC& a, const D3D11_RASTERIZER_DESC& b)
+	{
+		return a.FillMode == b.FillMode && a.CullMode == b.CullMode
+			&& a.FrontCounterClockwise == b.FrontCounterClockwise && a.DepthBias == b.DepthBias
+			&& a.DepthBiasClamp == b.DepthBiasClamp && a.SlopeScaledDepthBias == b.SlopeScaledDepthBias
+			&& a.DepthClipEnable == b.DepthClipEnable && a.ScissorEnable == b.ScissorEnable
+			&& a.MultisampleEnable == b.MultisampleEnable && a.AntialiasedLineEnable == b.AntialiasedLineEnable;
+	}
+
+	bool equalBlend(const D3D11_BLEND_DESC& a, const D3D11_BLEND_DESC& b)
+	{
+		if (a.AlphaToCoverageEnable != b.AlphaToCoverageEnable || a.IndependentBlendEnable != b.IndependentBlendEnable)
+		{
+			return false;
+		}
+		for (UINT i = 0; i < ARRAYSIZE(a.RenderTarget); ++i)
+		{
+			const D3D11_RENDER_TARGET_BLEND_DESC& ra = a.RenderTarget[i];
+			const D3D11_RENDER_TARGET_BLEND_DESC& rb = b.RenderTarget[i];
+			if (ra.BlendEnable != rb.BlendEnable || ra.SrcBlend != rb.SrcBlend || ra.DestBlend != rb.DestBlend
+				|| ra.BlendOp != rb.BlendOp || ra.SrcBlendAlpha != rb.SrcBlendAlpha || ra.DestBlendAlpha != rb.DestBlendAlpha
+				|| ra.BlendOpAlpha != rb.BlendOpAlpha || ra.RenderTargetWriteMask != rb.RenderTargetWriteMask)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool equalStencilOp(const D3D11_DEPTH_STENCILOP_DESC& a, const D3D11_DEPTH_STENCILOP_DESC& b)
+	{
+		return a.StencilFailOp == b.StencilFailOp && a.StencilDepthFailOp == b.StencilDepthFailOp
+			&& a.StencilPassOp == b.StencilPassOp && a.StencilFunc == b.StencilFunc;
+	}
+
+	bool equalDepthStencil(const D3D11_DEPTH_STENCIL_DESC& a, const D3D11_DEPTH_STENCIL_DESC& b)
+	{
+		return a.DepthEnable == b.DepthEnable && a.DepthWriteMask == b.DepthWriteMask
+			&& a.DepthFunc == b.DepthFunc && a.StencilEnable == b.StencilEnable
+			&& a.StencilReadMask == b.StencilReadMask && a.StencilWriteMask == b.StencilWriteMask
+			&& equalStencilOp(a.FrontFace, b.FrontFace) && equalStencilOp(a.BackFace, b.BackFace);
+	}
+}
+
+/*--------------------------------------------------------------
+	PipelineStateDesc
+--------------------------------------------------------------*/
+
+PipelineStateDesc::PipelineStateDesc()
+	: vertex_shader(nullptr), pixel_shader(nullptr), input_layout(nullptr),
+	topology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST), sample_mask(0xffffffff), stencil_ref(0)
+{
+	::memset(&rasterizer, 0, sizeof(rasterizer));
+	rasterizer.FillMode = D3D11_FILL_SOLID;
+	rasterizer.CullMode = D3D11_CULL_BACK;
+	rasterizer.DepthClipEnable = TRUE;
+
+	::memset(&blend, 0, sizeof(blend));
+	for (UINT i = 0; i < ARRAYSIZE(blend.RenderTarget); ++i)
+	{
+		blend.RenderTarget[i].SrcBlend = D3D11_BLEND_ONE;
+		blend.RenderTarget[i].DestBlend = D3D11_BLEND_ZERO;
+		blend.RenderTarget[i].BlendOp = D3D11_BLEND_OP_ADD;
+		blend.RenderTarget[i].SrcBlendAlpha = D3D11_BLEND_ONE;
+		blend.RenderTarget[i].DestBlendAlpha = D3D11_BLEND_ZERO;
+		blend.RenderTarget[i].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+		blend.RenderTarget[i].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+	}
+
+	::memset(&depth_stencil, 0, sizeof(depth_stencil));
+	depth_stencil.DepthEnable = FALSE;
+	depth_stencil.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ALL;
+	depth_stencil.DepthFunc = D3D11_COMPARISON_LESS;
+	depth_stencil.StencilReadMask = D3D11_DEFAULT_STENCIL_READ_MASK;
+	depth_stencil.StencilWriteMask = D3D11_DEFAULT_STENCIL_WRITE_MASK;
+	depth_stencil.FrontFace.StencilFailOp = D3D11_STENCIL_OP_KEEP;
+	depth_stencil.FrontFace.StencilDepthFailOp = D3D11_STENCIL_OP_KEEP;
+	depth_stencil.FrontFace.StencilPassOp = D3D11_STENCIL_OP_KEEP;
+	depth_stencil.FrontFace.StencilFunc = D3D11_COMPARISON_ALWAYS;
+	depth_stencil.BackFace = depth_stencil.FrontFace;
+
+	for (UINT i = 0; i < 4; ++i)
+	{
+		blend_factor[i] = 1.0f;
+	}
+}
+
+size_t PipelineStateDesc::hash() const
+{
+	Hasher h;
+	h.add(vertex_shader);
+	h.add(pixel_shader);
+	h.add(input_layout);
+	h.add(topology);
+
+	h.add(rasterizer.FillMode);
+	h.add(rasterizer.CullMode);
+	h.add(rasterizer.FrontCounterClockwise);
+	h.add(rasterizer.DepthBias);
+	h.add(rasterizer.DepthBiasClamp);
+	h.add(rasterizer.SlopeScaledDepthBias);
+	h.add(rasterizer.DepthClipEnable);
+	h.add(rasterizer.ScissorEnable);
+	h.add(rasterizer.MultisampleEnable);
+	h.add(rasterizer.AntialiasedLineEnable);
+
+	h.add(blend.AlphaToCoverageEnable);
+	h.add(blend.IndependentBlendEnable);
+	for (UINT i = 0; i < ARRAYSIZE(blend.RenderTarget); ++i)
+	{
+		const D3D11_RENDER_TARGET_BLEND_DESC& rt = blend.RenderTarget[i];
+		h.add(rt.BlendEnable);
+		h.add(rt.SrcBlend);
+		h.add(rt.DestBlend);
+		h.add(rt.BlendOp);
+		h.add(rt.SrcBlendAlpha);
+		h.add(rt.DestBlendAlpha);
+		h.add(rt.BlendOpAlpha);
+		h.add(rt.RenderTargetWriteMask);
+	}
+
+	h.add(depth_stencil.DepthEnable);
+	h.add(depth_stencil.DepthWriteMask);
+	h.add(depth_stencil.DepthFunc);
+	h.add(depth_stencil.StencilEnable);
+	h.add(depth_stencil.StencilReadMask);
+	h.add(depth_stencil.StencilWriteMask);
+	const D3D11_DEPTH_STENCILOP_DESC* faces[] = { &depth_stencil.FrontFace, &depth_stencil.BackFace };
+	for (const D3D11_DEPTH_STENCILOP_DESC* face : faces)
+	{
+		h.add(face->StencilFailOp);
+		h.add(face->StencilDepthFailOp);
+		h.add(face->StencilPassOp);
+		h.add(face->StencilFunc);
+	}
+
+	h.add(blend_factor);
+	h.add(sample_mask);
+	h.add(stencil_ref);
+	return h.get();
+}
+
+bool PipelineStateDesc::operator==(const PipelineStateDesc& rhs) const
+{
+	return vertex_shader == rhs.vertex_shader && pixel_shader == rhs.pixel_shader
+		&& input_layout == rhs.input_layout && topology == rhs.topology
+		&& equalRasterizer(rasterizer, rhs.rasterizer) && equalBlend(blend, rhs.blend)
+		&& equalDepthStencil(depth_stencil, rhs.depth_stencil)
+		&& ::memcmp(blend_factor, rhs.blend_factor, sizeof(blend_factor)) == 0
+		&& sample_mask == rhs.sample_mask && stencil_ref == rhs.stencil_ref;
+}
+
+/*--------------------------------------------------------------
+	PipelineState
+--------------------------------------------------------------*/
+
+PipelineState::PipelineState()
+	: m_hash(0), m_rasterizer_state(nullptr), m_blend_state(nullptr), m_depth_stencil_state(nullptr)
+{
+}
+
+bool PipelineState::init(const PipelineStateDesc& f_desc, size_t f_hash, IGraphicsEngine* f_graphicsEngine)
+{
+	m_desc = f_desc;
+	m_hash = f_hash;
+
+	// Held for the lifetime of the state: the cache matches descriptions by these addresses
+	if (m_desc.vertex_shader) m_desc.vertex_shader->addReference();
+	if (m_desc.pixel_shader) m_desc.pixel_shader->addReference();
+	if (m_desc.input_layout) m_desc.input_layout->AddRef();
+
+	ID3D11Device* device = f_graphicsEngine->getDevice();
+
+	// The runtime already shares identical state objects, so creating them per PSO is cheap
+	if (FAILED(device->CreateRasterizerState(&m_desc.rasterizer, &m_rasterizer_state)))
+	{
+		return false;
+	}
+	if (FAILED(device->CreateBlendState(&m_desc.blend, &m_blend_state)))
+	{
+		return false;
+	}
+	if (FAILED(device->CreateDepthStencilState(&m_desc.depth_stencil, &m_depth_stencil_state)))
+	{
+		return false;
+	}
+
+	CommandRecorder* recorder = CommandRecorder::get();
+	if (recorder->isTracking())
+	{
+		CommandPipelineDesc desc;
+		desc.topology = m_desc.topology;
+		desc.rasterizer = &m_desc.rasterizer;
+		desc.rasterizer_size = sizeof(m_desc.rasterizer);
+		desc.blend = &m_desc.blend;
+		desc.blend_size = sizeof(m_desc.blend);
+		desc.depth_stencil = &m_desc.depth_stencil;
+		desc.depth_stencil_size = sizeof(m_desc.depth_stencil);
+		::memcpy(desc.blend_factor, m_desc.blend_factor, sizeof(desc.blend_factor));
+		desc.sample_mask = m_desc.sample_mask;
+		desc.stencil_ref = m_desc.stencil_ref;
+		recorder->onCreatePipeline(this, m_desc.vertex_shader, m_desc.pixel_shader, m_desc.input_layout, desc);
+	}
+	return true;
+}
+
+void PipelineState::release()
+{
+	CommandRecorder::get()->onRelease(this);
+	if (m_rasterizer_state) m_rasterizer_state->Release();
+	if (m_blend_state) m_blend_state->Release();
+	if (m_depth_stencil_state) m_depth_stencil_state->Release();
+	if (m_desc.vertex_shader) m_desc.vertex_shader->release();
+	if (m_desc.pixel_shader) m_desc.pixel_shader->release();
+	if (m_desc.input_layout) m_desc.input_layout->Release();
+	delete this;
+}
+
+PipelineState::~PipelineState()
+{
+}
+
+/*--------------------------------------------------------------
+	PipelineStateCache
+--------------------------------------------------------------*/
+
+PipelineState* PipelineStateCache::getOrCreate(const PipelineStateDesc& f_desc, IGraphicsEngine* f_graphicsEngine)
+{
+	const size_t hash = f_desc.hash();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto range = m_states.equal_range(hash);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second->m_desc == f_desc)
+		{
+			m_statistics.hits++;
+			return it->second;
+		}
+	}
+
+	PipelineState* state = new PipelineState();
+	if (!state->init(f_desc, hash, f_graphicsEngine))
+	{
+		state->release();
+		return nullptr;
+	}
+
+	m_states.emplace(hash, state);
+	m_statistics.misses++;
+	m_statistics.states = static_cast<UINT>(m_states.size());
+	return state;
+}
+
+PipelineStateCache::Statistics PipelineStateCache::getStatistics()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_statistics;
+}
+
+void PipelineStateCache::release()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto& entry : m_states)
+	{
+		entry.second->release();
+	}
+	m_states.clear();
+	m_statistics.states = 0;
+}
+
+PipelineStateCache::~PipelineStateCache()
+{
+	release();
+}
@@ -2,6 +2,7 @@
 #define _PIXEL_SHADER_HPP
 
 #include <d3d11.h>
+#include <atomic>
 
 class IGraphicsEngine; // Forward declaration for IGraphicsEngine	
 class DeviceContext;
@@ -10,11 +11,17 @@ class PixelShader
 {
 public:
 	PixelShader();
+
+	// Pipeline states take a reference so a shader released elsewhere never leaves them dangling
+	void addReference();
+
+	// Drops a reference; the last one destroys the shader
 	void release();
 	~PixelShader();
 private:
 	bool init(const void* f_shader_byte_code, size_t f_byte_code_size, IGraphicsEngine* f_graphicsEngine);
 	ID3D11PixelShader* m_ps;
+	std::atomic<unsigned int> m_references;
 	friend class GraphicsEngine;
 	friend class DeviceContext;
 };
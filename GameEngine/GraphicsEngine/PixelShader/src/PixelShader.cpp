@@ -1,18 +1,30 @@
 #include "PixelShader.hpp"
 #include "GraphicsEngine.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include "CommandRecorder.hpp"
 #include <iostream>
 
-PixelShader::PixelShader()
+PixelShader::PixelShader() : m_ps(nullptr), m_references(1)
 {
 }
 
+void PixelShader::addReference()
+{
+	m_references.fetch_add(1, std::memory_order_relaxed);
+}
+
 void PixelShader::release()
 {
+	if (m_references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
 	if (m_ps)
 	{
-		m_ps->Release();
-		delete this;
+		CommandRecorder::get()->onRelease(this);
+		ResourceReleaseQueue::get()->deferRelease(m_ps, 0);
 	}
+	delete this;
 }
 
 bool PixelShader::init(const void* f_shader_byte_code, size_t f_byte_code_size, IGraphicsEngine* f_graphicsEngine)
@@ -22,6 +34,7 @@ bool PixelShader::init(const void* f_shader_byte_code, size_t f_byte_code_size,
 		std::cout << "aici\n";
 		return false;
 	}
+	CommandRecorder::get()->onCreateShader(this, CommandShaderStage::Pixel, f_shader_byte_code, f_byte_code_size);
 	return true;
 }
 
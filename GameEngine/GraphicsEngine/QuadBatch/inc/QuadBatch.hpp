@@ -0,0 +1,212 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Material-sorted collection of dynamic quads
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - submit() is called once per quad per frame, so it stays inline and
+//    only appends a compact record; the vertices are expanded by write().
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Batch HUD, billboard and effect quads by material.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the QuadBatch class and the quad vertex layout.
+/// @par Revision History:
+///      $Source: QuadBatch.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _QUAD_BATCH_HPP_
+#define _QUAD_BATCH_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// Color packed as 8 bit RGBA, red in the lowest byte.
+/// </summary>
+struct QuadColor
+{
+	unsigned int rgba = 0xffffffff;
+};
+
+/// <summary>
+/// Vertex written into the vertex buffer, four per quad.
+/// </summary>
+struct QuadVertex
+{
+	float position[2];
+	float uv[2];
+	QuadColor color;
+};
+
+/// <summary>
+/// An axis-aligned quad with its texture rectangle.
+/// </summary>
+struct Quad
+{
+	float x = 0.0f;
+	float y = 0.0f;
+	float width = 0.0f;
+	float height = 0.0f;
+	float u0 = 0.0f;
+	float v0 = 0.0f;
+	float u1 = 1.0f;
+	float v1 = 1.0f;
+	QuadColor color;
+};
+
+/// <summary>
+/// One draw over quads sharing a material, in quads of the sorted sequence.
+/// </summary>
+struct QuadDraw
+{
+	unsigned int material = 0;
+	unsigned int first_quad = 0;
+	unsigned int quad_count = 0;
+};
+
+/**
+ * @class QuadBatch
+ * @brief Collects the quads of a frame per material and expands them into vertices.
+ *
+ * Quads go into one bucket per material as they are submitted, so sorting by
+ * material costs nothing per quad: sort() only orders the buckets. Runs of
+ * quads with the same material are the fast path; switching material costs
+ * a scan of the materials used this frame. The sorted sequence is then
+ * written in one or more ranges straight into mapped vertex memory with
+ * write(). Quads of one material keep their submission order; quads of
+ * different materials are not ordered against each other, so draw blended
+ * layers that must overlap in separate batches.
+ *
+ * Example usage:
+ * @code
+ * batch.clear();
+ * batch.submit(font_material, glyph_quad);
+ * batch.submit(icon_material, icon_quad);
+ * const std::vector<QuadDraw>& draws = batch.sort();
+ * batch.write(0, batch.getQuadCount(), mapped_vertices);
+ * @endcode
+ */
+class QuadBatch
+{
+public:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	QuadBatch();
+	~QuadBatch();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Appends a quad drawn with the material.
+	/// </summary>
+	void submit(unsigned int f_material, const Quad& f_quad)
+	{
+		if (f_material != m_active_material || m_cursor == m_cursor_end)
+		{
+			selectBucket(f_material);
+		}
+		*m_cursor++ = f_quad;
+	}
+
+	/// <summary>
+	/// Orders the buckets by material and builds one draw per non empty bucket.
+	/// </summary>
+	/// <returns>The draws, valid until the next clear() or submit().</returns>
+	const std::vector<QuadDraw>& sort();
+
+	/// <summary>
+	/// Expands f_quad_count quads of the sorted sequence, starting at f_first_quad, into vertices.
+	/// </summary>
+	/// <param name="f_vertices">Destination for 4 * f_quad_count vertices, typically mapped GPU memory.</param>
+	/// <returns>The number of quads written.</returns>
+	unsigned int write(unsigned int f_first_quad, unsigned int f_quad_count, QuadVertex* f_vertices) const;
+
+	/// <summary>
+	/// Number of quads submitted since the last clear().
+	/// </summary>
+	unsigned int getQuadCount() const;
+
+	const std::vector<QuadDraw>& getDraws() const { return m_draws; }
+
+	/// <summary>
+	/// Removes the quads of the frame; bucket memory is kept for the next one.
+	/// </summary>
+	void clear();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Bucket
+	{
+		unsigned int material = 0;
+		unsigned int count = 0;
+
+		/// <summary>
+		/// Grown by doubling and never shrunk, so steady frames do not allocate.
+		/// </summary>
+		std::vector<Quad> quads;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Makes the bucket of the material the write target, growing it when full.
+	/// </summary>
+	void selectBucket(unsigned int f_material);
+
+	/// <summary>
+	/// Stores the write position of the active bucket into its count.
+	/// </summary>
+	void commitActiveBucket();
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<Bucket> m_buckets;
+	std::vector<unsigned int> m_sorted_buckets;
+	std::vector<QuadDraw> m_draws;
+
+	// Write position inside the active bucket, kept out of the bucket so submit() is a compare and a copy
+	size_t m_active_bucket;
+	unsigned int m_active_material;
+	Quad* m_cursor;
+	Quad* m_cursor_end;
+};
+
+#endif // !_QUAD_BATCH_HPP_
@@ -0,0 +1,217 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Material-sorted collection of dynamic quads
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Batch HUD, billboard and effect quads by material.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the QuadBatch class.
+/// @par Revision History:
+///      $Source: QuadBatch.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "QuadBatch.hpp"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define QUAD_BATCH_SSE2 1
+#endif
+
+namespace
+{
+	constexpr size_t no_bucket = ~static_cast<size_t>(0);
+	constexpr size_t min_bucket_capacity = 256;
+
+	static_assert(sizeof(QuadVertex) == 20, "QuadVertex must stay tightly packed");
+	static_assert(sizeof(Quad) == 36, "Quad must stay tightly packed");
+
+	void expandQuads(const Quad* f_quads, unsigned int f_count, QuadVertex* f_vertices)
+	{
+#if QUAD_BATCH_SSE2
+		// One quad is 80 bytes of vertices: five 16 byte stores instead of twenty 4 byte ones
+		const __m128 size_mask = _mm_castsi128_ps(_mm_set_epi32(-1, -1, 0, 0));
+		float* out = reinterpret_cast<float*>(f_vertices);
+		for (unsigned int i = 0; i < f_count; ++i, out += 20)
+		{
+			const float* quad = reinterpret_cast<const float*>(f_quads + i);
+			const __m128 rect = _mm_loadu_ps(quad);                             // x  y  w  h
+			const __m128 uv = _mm_loadu_ps(quad + 4);                           // u0 v0 u1 v1
+			const __m128 color = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(f_quads[i].color.rgba)));
+			const __m128 corners = _mm_add_ps(_mm_shuffle_ps(rect, rect, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm_and_ps(rect, size_mask));                                   // x  y  x1 y1
+
+			const __m128 x1_y_u1 = _mm_shuffle_ps(corners, uv, _MM_SHUFFLE(2, 2, 1, 2));
+			const __m128 c_x1 = _mm_unpacklo_ps(color, x1_y_u1);
+			const __m128 v0_c = _mm_shuffle_ps(uv, color, _MM_SHUFFLE(0, 0, 1, 1));
+			const __m128 c_x = _mm_unpacklo_ps(color, corners);
+			const __m128 y1_u0 = _mm_shuffle_ps(corners, uv, _MM_SHUFFLE(0, 0, 3, 3));
+			const __m128 v1_c = _mm_shuffle_ps(uv, color, _MM_SHUFFLE(0, 0, 3, 3));
+
+			_mm_storeu_ps(out, _mm_movelh_ps(corners, uv));                                       // x  y  u0 v0
+			_mm_storeu_ps(out + 4, _mm_shuffle_ps(c_x1, x1_y_u1, _MM_SHUFFLE(2, 1, 1, 0)));     // c  x1 y  u1
+			_mm_storeu_ps(out + 8, _mm_shuffle_ps(v0_c, corners, _MM_SHUFFLE(3, 2, 2, 0)));     // v0 c  x1 y1
+			_mm_storeu_ps(out + 12, _mm_shuffle_ps(uv, c_x, _MM_SHUFFLE(1, 0, 3, 2)));          // u1 v1 c  x
+			_mm_storeu_ps(out + 16, _mm_shuffle_ps(y1_u0, v1_c, _MM_SHUFFLE(2, 0, 2, 0)));      // y1 u0 v1 c
+		}
+#else
+		QuadVertex* vertex = f_vertices;
+		for (unsigned int i = 0; i < f_count; ++i, vertex += 4)
+		{
+			const Quad& quad = f_quads[i];
+			const float x1 = quad.x + quad.width;
+			const float y1 = quad.y + quad.height;
+			vertex[0] = { { quad.x, quad.y }, { quad.u0, quad.v0 }, quad.color };
+			vertex[1] = { { x1, quad.y }, { quad.u1, quad.v0 }, quad.color };
+			vertex[2] = { { x1, y1 }, { quad.u1, quad.v1 }, quad.color };
+			vertex[3] = { { quad.x, y1 }, { quad.u0, quad.v1 }, quad.color };
+		}
+#endif
+	}
+}
+
+QuadBatch::QuadBatch() : m_active_bucket(no_bucket), m_active_material(0), m_cursor(nullptr), m_cursor_end(nullptr)
+{
+}
+
+void QuadBatch::commitActiveBucket()
+{
+	if (m_active_bucket != no_bucket)
+	{
+		Bucket& bucket = m_buckets[m_active_bucket];
+		bucket.count = static_cast<unsigned int>(m_cursor - bucket.quads.data());
+	}
+}
+
+void QuadBatch::selectBucket(unsigned int f_material)
+{
+	commitActiveBucket();
+
+	// A frame uses few materials, a linear scan beats hashing here
+	size_t index = 0;
+	while (index < m_buckets.size() && m_buckets[index].material != f_material)
+	{
+		index++;
+	}
+	if (index == m_buckets.size())
+	{
+		m_buckets.emplace_back();
+		m_buckets.back().material = f_material;
+	}
+
+	Bucket& bucket = m_buckets[index];
+	if (bucket.count == bucket.quads.size())
+	{
+		bucket.quads.resize(bucket.quads.empty() ? min_bucket_capacity : bucket.quads.size() * 2);
+	}
+
+	m_active_bucket = index;
+	m_active_material = f_material;
+	m_cursor = bucket.quads.data() + bucket.count;
+	m_cursor_end = bucket.quads.data() + bucket.quads.size();
+}
+
+const std::vector<QuadDraw>& QuadBatch::sort()
+{
+	commitActiveBucket();
+
+	m_sorted_buckets.clear();
+	for (unsigned int i = 0; i < m_buckets.size(); ++i)
+	{
+		if (m_buckets[i].count)
+		{
+			m_sorted_buckets.push_back(i);
+		}
+	}
+	std::sort(m_sorted_buckets.begin(), m_sorted_buckets.end(), [this](unsigned int f_a, unsigned int f_b)
+	{
+		return m_buckets[f_a].material < m_buckets[f_b].material;
+	});
+
+	m_draws.clear();
+	unsigned int first_quad = 0;
+	for (unsigned int bucket : m_sorted_buckets)
+	{
+		QuadDraw draw;
+		draw.material = m_buckets[bucket].material;
+		draw.first_quad = first_quad;
+		draw.quad_count = m_buckets[bucket].count;
+		m_draws.push_back(draw);
+		first_quad += draw.quad_count;
+	}
+	return m_draws;
+}
+
+unsigned int QuadBatch::write(unsigned int f_first_quad, unsigned int f_quad_count, QuadVertex* f_vertices) const
+{
+	unsigned int written = 0;
+	for (size_t i = 0; i < m_draws.size() && written < f_quad_count; ++i)
+	{
+		const QuadDraw& draw = m_draws[i];
+		const unsigned int begin = f_first_quad + written;
+		if (begin >= draw.first_quad + draw.quad_count)
+		{
+			continue;
+		}
+
+		const Quad* quads = m_buckets[m_sorted_buckets[i]].quads.data() + (begin - draw.first_quad);
+		const unsigned int count = std::min(f_quad_count - written, draw.first_quad + draw.quad_count - begin);
+		expandQuads(quads, count, f_vertices + static_cast<size_t>(written) * 4);
+		written += count;
+	}
+	return written;
+}
+
+unsigned int QuadBatch::getQuadCount() const
+{
+	unsigned int count = 0;
+	for (size_t i = 0; i < m_buckets.size(); ++i)
+	{
+		count += i == m_active_bucket ? static_cast<unsigned int>(m_cursor - m_buckets[i].quads.data()) : m_buckets[i].count;
+	}
+	return count;
+}
+
+void QuadBatch::clear()
+{
+	for (Bucket& bucket : m_buckets)
+	{
+		bucket.count = 0;
+	}
+	m_sorted_buckets.clear();
+	m_draws.clear();
+	m_active_bucket = no_bucket;
+	m_cursor = nullptr;
+	m_cursor_end = nullptr;
+}
+
+QuadBatch::~QuadBatch()
+{
+}
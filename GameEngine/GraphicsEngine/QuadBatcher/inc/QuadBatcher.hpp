@@ -0,0 +1,167 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Dynamic quads streamed through a vertex ring
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Draw HUD, billboard and effect quads in a few draw calls.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the QuadBatcher class and the quad vertex format.
+/// @par Revision History:
+///      $Source: QuadBatcher.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _QUAD_BATCHER_HPP_
+#define _QUAD_BATCHER_HPP_
+
+#include "QuadBatch.hpp"
+#include "VertexFormat.hpp"
+#include <functional>
+
+class IGraphicsEngine;
+class DeviceContext;
+class DynamicVertexBuffer;
+class IndexBuffer;
+
+template <> struct VertexAttributeFormat<QuadColor> { static constexpr DXGI_FORMAT value = DXGI_FORMAT_R8G8B8A8_UNORM; };
+
+/// <summary>
+/// Input layout of QuadVertex: float2 POSITION, float2 TEXCOORD, unorm4 COLOR.
+/// </summary>
+using QuadVertexFormat = VertexFormat<QuadVertex,
+	VertexElement<VertexSemantic::Position, 0, float[2]>,
+	VertexElement<VertexSemantic::TexCoord, 0, float[2]>,
+	VertexElement<VertexSemantic::Color, 0, QuadColor>>;
+
+/**
+ * @class QuadBatcher
+ * @brief Collects dynamic quads during the frame and draws them sorted by material.
+ *
+ * flush() sorts the submitted quads by material, expands them straight into
+ * a mapped DynamicVertexBuffer and issues one drawIndexedTriangleList per
+ * material, against a static index buffer shared by every quad. When more
+ * quads were submitted than the ring holds they are streamed in several
+ * maps, so a material may then take one extra draw per wrap.
+ *
+ * Example usage:
+ * @code
+ * QuadBatcher* quads = GraphicsEngine::get()->createQuadBatcher(65536);
+ * quads->submit(hud_material, health_bar);
+ * quads->flush(device_context, [&](unsigned int f_material)
+ * {
+ *     device_context->setPipelineState(materials[f_material]);
+ * });
+ * // ...
+ * quads->release();
+ * @endcode
+ */
+class QuadBatcher
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Binds the pipeline state, constant buffers and textures of a material.
+	/// </summary>
+	using BindMaterialFunction = std::function<void(unsigned int f_material)>;
+
+	/// <summary>
+	/// Counters of the last flush() call.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int quad_count = 0;
+		unsigned int draw_calls = 0;
+		unsigned int material_binds = 0;
+		unsigned int maps = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Queues a quad for the next flush().
+	/// </summary>
+	void submit(unsigned int f_material, const Quad& f_quad) { m_batch.submit(f_material, f_quad); }
+
+	/// <summary>
+	/// Draws every queued quad and empties the queue.
+	/// </summary>
+	/// <param name="f_bind_material">Called before the draws of each material.</param>
+	void flush(DeviceContext* f_device_context, const BindMaterialFunction& f_bind_material);
+
+	/// <summary>
+	/// Number of quads one map of the vertex ring can hold.
+	/// </summary>
+	unsigned int getCapacity() const { return m_capacity; }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Releases the buffers and the batcher itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	QuadBatcher();
+	~QuadBatcher();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(unsigned int f_capacity, IGraphicsEngine* f_graphicsEngine);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	QuadBatch m_batch;
+	DynamicVertexBuffer* m_vertex_buffer;
+	IndexBuffer* m_index_buffer;
+	unsigned int m_capacity;
+	Statistics m_statistics;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_QUAD_BATCHER_HPP_
@@ -0,0 +1,150 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Dynamic quads streamed through a vertex ring
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Draw HUD, billboard and effect quads in a few draw calls.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the QuadBatcher class.
+/// @par Revision History:
+///      $Source: QuadBatcher.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "QuadBatcher.hpp"
+#include "DynamicVertexBuffer.hpp"
+#include "IndexBuffer.hpp"
+#include "DeviceContext.hpp"
+#include <algorithm>
+
+QuadBatcher::QuadBatcher() : m_vertex_buffer(nullptr), m_index_buffer(nullptr), m_capacity(0)
+{
+}
+
+bool QuadBatcher::init(unsigned int f_capacity, IGraphicsEngine* f_graphicsEngine)
+{
+	m_capacity = f_capacity;
+
+	// Every quad uses the same six indices relative to its first vertex
+	std::vector<unsigned int> indices(static_cast<size_t>(f_capacity) * 6);
+	for (unsigned int quad = 0; quad < f_capacity; ++quad)
+	{
+		const unsigned int vertex = quad * 4;
+		unsigned int* index = &indices[static_cast<size_t>(quad) * 6];
+		index[0] = vertex;
+		index[1] = vertex + 1;
+		index[2] = vertex + 2;
+		index[3] = vertex + 2;
+		index[4] = vertex + 3;
+		index[5] = vertex;
+	}
+
+	m_index_buffer = new IndexBuffer();
+	if (!m_index_buffer->load(indices.data(), static_cast<UINT>(indices.size()), f_graphicsEngine))
+	{
+		return false;
+	}
+
+	m_vertex_buffer = new DynamicVertexBuffer();
+	return m_vertex_buffer->load(QuadVertexFormat::stride, f_capacity * 4, f_graphicsEngine);
+}
+
+void QuadBatcher::flush(DeviceContext* f_device_context, const BindMaterialFunction& f_bind_material)
+{
+	m_statistics = Statistics();
+
+	const std::vector<QuadDraw>& draws = m_batch.sort();
+	const unsigned int quad_count = m_batch.getQuadCount();
+	if (quad_count == 0)
+	{
+		return;
+	}
+
+	f_device_context->setVertexBuffer(m_vertex_buffer);
+	f_device_context->setIndexBuffer(m_index_buffer);
+
+	size_t draw_index = 0;
+	bool material_bound = false;
+	unsigned int bound_material = 0;
+	for (unsigned int chunk_first = 0; chunk_first < quad_count; )
+	{
+		const unsigned int chunk_count = std::min(quad_count - chunk_first, m_capacity);
+
+		// Aligning to four vertices keeps each 80 byte quad on 16 byte boundaries for the vector stores
+		UINT first_vertex = 0;
+		void* vertices = m_vertex_buffer->map(f_device_context, chunk_count * 4, 4, &first_vertex);
+		if (!vertices)
+		{
+			break;
+		}
+		m_batch.write(chunk_first, chunk_count, static_cast<QuadVertex*>(vertices));
+		m_vertex_buffer->unmap(f_device_context);
+		m_statistics.maps++;
+
+		const unsigned int chunk_end = chunk_first + chunk_count;
+		while (draw_index < draws.size() && draws[draw_index].first_quad < chunk_end)
+		{
+			const QuadDraw& draw = draws[draw_index];
+			if (!material_bound || bound_material != draw.material)
+			{
+				if (f_bind_material) f_bind_material(draw.material);
+				bound_material = draw.material;
+				material_bound = true;
+				m_statistics.material_binds++;
+			}
+
+			const unsigned int begin = std::max(draw.first_quad, chunk_first);
+			const unsigned int end = std::min(draw.first_quad + draw.quad_count, chunk_end);
+			f_device_context->drawIndexedTriangleList((end - begin) * 6, first_vertex + (begin - chunk_first) * 4, 0);
+			m_statistics.draw_calls++;
+
+			// A draw cut by the end of the chunk continues in the next one
+			if (draw.first_quad + draw.quad_count > chunk_end)
+			{
+				break;
+			}
+			draw_index++;
+		}
+		chunk_first = chunk_end;
+	}
+
+	m_statistics.quad_count = quad_count;
+	m_batch.clear();
+}
+
+void QuadBatcher::release()
+{
+	if (m_vertex_buffer) m_vertex_buffer->release();
+	if (m_index_buffer) m_index_buffer->release();
+	delete this;
+}
+
+QuadBatcher::~QuadBatcher()
+{
+}
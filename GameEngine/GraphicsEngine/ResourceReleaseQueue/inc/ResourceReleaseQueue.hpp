@@ -0,0 +1,219 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Deferred, frame-fenced destruction of GPU objects
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - push() may be called from any thread; advanceFrame(), retire() and
+//    flush() only from the thread that owns the device context.
+//  - This library has no DirectX dependency; COM objects are released
+//    through deferRelease(), which only needs a Release() method.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep GPU objects alive until the frames using them completed.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the ResourceReleaseQueue class.
+/// @par Revision History:
+///      $Source: ResourceReleaseQueue.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/30 09:20:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _RESOURCE_RELEASE_QUEUE_HPP_
+#define _RESOURCE_RELEASE_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class ResourceReleaseQueue
+ * @brief Lock-free multi-producer queue that releases objects once the GPU finished their frame.
+ *
+ * Each pushed object is stamped with the frame being recorded. Producers
+ * link their entry into an atomic list with a single compare-exchange, so
+ * releasing a resource from a loading thread never blocks the renderer.
+ * Once per frame the owning thread takes the whole list in one exchange,
+ * and retire() releases, in one batch, every entry whose frame the GPU
+ * reported as completed.
+ *
+ * Example usage:
+ * @code
+ * // any thread
+ * ResourceReleaseQueue::get()->deferRelease(m_buffer, byte_width);
+ *
+ * // render thread, after present
+ * queue->advanceFrame(frame_index + 1);
+ * queue->retire(completed_frame_count);
+ * @endcode
+ */
+class ResourceReleaseQueue
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Function that destroys a queued object.
+	/// </summary>
+	using ReleaseFunction = void(*)(void*);
+
+	/// <summary>
+	/// Snapshot of the queue metrics.
+	/// </summary>
+	struct Statistics
+	{
+		/// <summary>
+		/// Objects waiting to be released (queue depth).
+		/// </summary>
+		size_t pending_count = 0;
+
+		/// <summary>
+		/// GPU memory held by the waiting objects, in bytes.
+		/// </summary>
+		unsigned long long pending_bytes = 0;
+
+		size_t peak_pending_count = 0;
+		unsigned long long peak_pending_bytes = 0;
+		unsigned long long retired_count = 0;
+		unsigned long long retired_bytes = 0;
+
+		/// <summary>
+		/// Objects released by the last retire() call.
+		/// </summary>
+		size_t last_batch_count = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Factory Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Retrieves the queue shared by every GPU resource.
+	/// </summary>
+	static ResourceReleaseQueue* get();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Queues an object for release once the frame being recorded completed. Thread-safe.
+	/// </summary>
+	/// <param name="f_object">Object handed to f_release; ignored when nullptr.</param>
+	/// <param name="f_release">Function that destroys the object.</param>
+	/// <param name="f_bytes">GPU memory held by the object, for the metrics.</param>
+	void push(void* f_object, ReleaseFunction f_release, unsigned long long f_bytes);
+
+	/// <summary>
+	/// Queues a reference counted (COM) object whose Release() is called later. Thread-safe.
+	/// </summary>
+	template <typename T>
+	void deferRelease(T* f_object, unsigned long long f_bytes)
+	{
+		push(f_object, [](void* f_pointer) { static_cast<T*>(f_pointer)->Release(); }, f_bytes);
+	}
+
+	/// <summary>
+	/// Sets the frame whose commands are recorded from now on; new entries are stamped with it.
+	/// </summary>
+	void advanceFrame(unsigned long long f_frame);
+
+	/// <summary>
+	/// Releases the entries of every frame below f_completed_frame_count, oldest first.
+	/// </summary>
+	/// <param name="f_completed_frame_count">Number of frames the GPU has finished.</param>
+	/// <param name="f_max_count">Maximum number of objects to release, 0 for no limit.</param>
+	/// <returns>The number of objects released.</returns>
+	size_t retire(unsigned long long f_completed_frame_count, size_t f_max_count = 0);
+
+	/// <summary>
+	/// Releases everything immediately. Only call it when the GPU is idle.
+	/// </summary>
+	/// <returns>The number of objects released.</returns>
+	size_t flush();
+
+	/// <summary>
+	/// Retrieves the queue metrics. Thread-safe.
+	/// </summary>
+	Statistics getStatistics() const;
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Node
+	{
+		void* object;
+		ReleaseFunction release;
+		unsigned long long bytes;
+		unsigned long long frame;
+		Node* next;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	ResourceReleaseQueue();
+	~ResourceReleaseQueue();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void collect();
+	size_t releaseFront(size_t f_count, bool f_all, unsigned long long f_completed_frame_count);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Entries pushed since the last collect(), newest first.
+	/// </summary>
+	std::atomic<Node*> m_incoming;
+
+	std::atomic<unsigned long long> m_frame;
+
+	/// <summary>
+	/// Collected entries in push order, owned by the consumer thread.
+	/// </summary>
+	Node* m_pending_head;
+	Node* m_pending_tail;
+
+	std::atomic<size_t> m_pending_count;
+	std::atomic<unsigned long long> m_pending_bytes;
+	std::atomic<size_t> m_peak_pending_count;
+	std::atomic<unsigned long long> m_peak_pending_bytes;
+	std::atomic<unsigned long long> m_retired_count;
+	std::atomic<unsigned long long> m_retired_bytes;
+	std::atomic<size_t> m_last_batch_count;
+};
+
+#endif // !_RESOURCE_RELEASE_QUEUE_HPP_
@@ -0,0 +1,192 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Deferred, frame-fenced destruction of GPU objects
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep GPU objects alive until the frames using them completed.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the ResourceReleaseQueue class.
+/// @par Revision History:
+///      $Source: ResourceReleaseQueue.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/30 09:20:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "ResourceReleaseQueue.hpp"
+
+namespace
+{
+	template <typename T>
+	void updateMax(std::atomic<T>& f_max, T f_value)
+	{
+		T current = f_max.load(std::memory_order_relaxed);
+		while (current < f_value && !f_max.compare_exchange_weak(current, f_value, std::memory_order_relaxed))
+		{
+		}
+	}
+}
+
+ResourceReleaseQueue* ResourceReleaseQueue::get()
+{
+	static ResourceReleaseQueue queue;
+	return &queue;
+}
+
+ResourceReleaseQueue::ResourceReleaseQueue()
+	: m_incoming(nullptr), m_frame(0), m_pending_head(nullptr), m_pending_tail(nullptr),
+	m_pending_count(0), m_pending_bytes(0), m_peak_pending_count(0), m_peak_pending_bytes(0),
+	m_retired_count(0), m_retired_bytes(0), m_last_batch_count(0)
+{
+}
+
+void ResourceReleaseQueue::push(void* f_object, ReleaseFunction f_release, unsigned long long f_bytes)
+{
+	if (!f_object || !f_release)
+	{
+		return;
+	}
+
+	Node* node = new Node{ f_object, f_release, f_bytes, m_frame.load(std::memory_order_acquire), nullptr };
+
+	Node* head = m_incoming.load(std::memory_order_relaxed);
+	do
+	{
+		node->next = head;
+	} while (!m_incoming.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+
+	updateMax(m_peak_pending_count, m_pending_count.fetch_add(1, std::memory_order_relaxed) + 1);
+	updateMax(m_peak_pending_bytes, m_pending_bytes.fetch_add(f_bytes, std::memory_order_relaxed) + f_bytes);
+}
+
+void ResourceReleaseQueue::advanceFrame(unsigned long long f_frame)
+{
+	m_frame.store(f_frame, std::memory_order_release);
+}
+
+size_t ResourceReleaseQueue::retire(unsigned long long f_completed_frame_count, size_t f_max_count)
+{
+	collect();
+	const size_t released = releaseFront(f_max_count, false, f_completed_frame_count);
+	m_last_batch_count.store(released, std::memory_order_relaxed);
+	return released;
+}
+
+size_t ResourceReleaseQueue::flush()
+{
+	collect();
+	const size_t released = releaseFront(0, true, 0);
+	m_last_batch_count.store(released, std::memory_order_relaxed);
+	return released;
+}
+
+ResourceReleaseQueue::Statistics ResourceReleaseQueue::getStatistics() const
+{
+	Statistics statistics;
+	statistics.pending_count = m_pending_count.load(std::memory_order_relaxed);
+	statistics.pending_bytes = m_pending_bytes.load(std::memory_order_relaxed);
+	statistics.peak_pending_count = m_peak_pending_count.load(std::memory_order_relaxed);
+	statistics.peak_pending_bytes = m_peak_pending_bytes.load(std::memory_order_relaxed);
+	statistics.retired_count = m_retired_count.load(std::memory_order_relaxed);
+	statistics.retired_bytes = m_retired_bytes.load(std::memory_order_relaxed);
+	statistics.last_batch_count = m_last_batch_count.load(std::memory_order_relaxed);
+	return statistics;
+}
+
+void ResourceReleaseQueue::collect()
+{
+	// Take every entry pushed so far in one exchange, then restore push order
+	Node* incoming = m_incoming.exchange(nullptr, std::memory_order_acquire);
+	Node* reversed = nullptr;
+	Node* last = incoming;
+	while (incoming)
+	{
+		Node* next = incoming->next;
+		incoming->next = reversed;
+		reversed = incoming;
+		incoming = next;
+	}
+
+	if (!reversed)
+	{
+		return;
+	}
+	if (m_pending_tail)
+	{
+		m_pending_tail->next = reversed;
+	}
+	else
+	{
+		m_pending_head = reversed;
+	}
+	m_pending_tail = last;
+}
+
+size_t ResourceReleaseQueue::releaseFront(size_t f_count, bool f_all, unsigned long long f_completed_frame_count)
+{
+	// Entries are in push order, hence in (nearly) increasing frame order. Stopping
+	// at the first entry that is not ready only ever delays a release, never hastens it.
+	size_t released = 0;
+	unsigned long long released_bytes = 0;
+	while (m_pending_head && (f_count == 0 || released < f_count))
+	{
+		Node* node = m_pending_head;
+		if (!f_all && node->frame >= f_completed_frame_count)
+		{
+			break;
+		}
+
+		m_pending_head = node->next;
+		if (!m_pending_head)
+		{
+			m_pending_tail = nullptr;
+		}
+
+		node->release(node->object);
+		released_bytes += node->bytes;
+		released++;
+		delete node;
+	}
+
+	m_pending_count.fetch_sub(released, std::memory_order_relaxed);
+	m_pending_bytes.fetch_sub(released_bytes, std::memory_order_relaxed);
+	m_retired_count.fetch_add(released, std::memory_order_relaxed);
+	m_retired_bytes.fetch_add(released_bytes, std::memory_order_relaxed);
+	return released;
+}
+
+ResourceReleaseQueue::~ResourceReleaseQueue()
+{
+	// The device is gone by now; drop the entries without calling into it
+	collect();
+	while (m_pending_head)
+	{
+		Node* next = m_pending_head->next;
+		delete m_pending_head;
+		m_pending_head = next;
+	}
+}
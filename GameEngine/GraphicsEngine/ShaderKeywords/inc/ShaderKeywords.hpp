@@ -0,0 +1,213 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Shader feature keywords and permutation keys
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - This library has no DirectX dependency so the key logic builds anywhere.
+//  - A variant key is a bitmask: bit N set means keyword N is enabled.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Map shader keywords to bitmask keys and keys to defines.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the ShaderKeywordSet and ShaderVariantCache classes.
+/// @par Revision History:
+///      $Source: ShaderKeywords.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/16 09:40:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _SHADER_KEYWORDS_HPP_
+#define _SHADER_KEYWORDS_HPP_
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Identifies one permutation of a shader: bit N is set when keyword N is enabled.
+/// </summary>
+using ShaderVariantKey = unsigned long long;
+
+/**
+ * @class ShaderKeywordSet
+ * @brief The feature keywords a shader declares, each bound to one bit of a ShaderVariantKey.
+ *
+ * Keywords are turned into preprocessor defines ("KEYWORD" = "1") when a
+ * variant is compiled. Bits of keywords that the shader did not declare are
+ * always masked out, so callers cannot create duplicate variants by passing
+ * keywords the shader does not use.
+ *
+ * Example usage:
+ * @code
+ * ShaderKeywordSet keywords;
+ * keywords.declare("ANIMATED_COLOR");
+ * keywords.declare("FOG");
+ * ShaderVariantKey key = keywords.makeKey({ "FOG" });      // 0b10
+ * auto defines = keywords.getDefines(key);                // { "FOG", "1" }
+ * @endcode
+ */
+class ShaderKeywordSet
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	using Define = std::pair<std::string, std::string>;
+
+	/*--------------------------------------------------------------
+		Static Constants
+	--------------------------------------------------------------*/
+
+	static constexpr unsigned int max_keywords = 64;
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Declares a keyword and returns its bit; declaring it again returns the same bit.
+	/// </summary>
+	/// <returns>The bit index of the keyword, or -1 if all 64 bits are taken.</returns>
+	int declare(const std::string& f_name);
+
+	/// <summary>
+	/// Returns the bit index of a keyword, or -1 when the keyword is not declared.
+	/// </summary>
+	int find(const std::string& f_name) const;
+
+	/// <summary>
+	/// Builds the key enabling the named keywords. Undeclared names are ignored.
+	/// </summary>
+	ShaderVariantKey makeKey(std::initializer_list<const char*> f_names) const;
+
+	/// <summary>
+	/// Clears every bit of the key that does not belong to a declared keyword.
+	/// </summary>
+	ShaderVariantKey sanitize(ShaderVariantKey f_key) const { return f_key & m_mask; }
+
+	/// <summary>
+	/// Returns the preprocessor defines enabled by the key, in declaration order.
+	/// </summary>
+	std::vector<Define> getDefines(ShaderVariantKey f_key) const;
+
+	/// <summary>
+	/// Number of declared keywords.
+	/// </summary>
+	size_t getCount() const { return m_names.size(); }
+
+	/// <summary>
+	/// Bitmask with one bit set for each declared keyword.
+	/// </summary>
+	ShaderVariantKey getMask() const { return m_mask; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<std::string> m_names;
+	ShaderVariantKey m_mask = 0;
+};
+
+/**
+ * @class ShaderVariantCache
+ * @brief Bitmask keyed store of compiled variants that compiles each one on first request.
+ *
+ * Lookups are a single hash map probe, so resolving the variant on the draw
+ * path costs O(1). A variant is compiled only when a key is requested for
+ * the first time; failed compilations are remembered as empty entries so a
+ * broken permutation is not recompiled every frame.
+ */
+template <typename Variant>
+class ShaderVariantCache
+{
+public:
+
+	/// <summary>
+	/// Returns the variant of the key, or nullptr if it was never requested or failed to compile.
+	/// </summary>
+	Variant* find(ShaderVariantKey f_key) const
+	{
+		auto it = m_variants.find(f_key);
+		return it != m_variants.end() ? it->second.get() : nullptr;
+	}
+
+	/// <summary>
+	/// Returns the variant of the key, invoking f_compile(key) on the first request.
+	/// The functor returns a std::unique_ptr&lt;Variant&gt;, empty on failure.
+	/// </summary>
+	template <typename Compile>
+	Variant* getOrCompile(ShaderVariantKey f_key, Compile&& f_compile)
+	{
+		auto it = m_variants.find(f_key);
+		if (it != m_variants.end())
+		{
+			return it->second.get();
+		}
+		m_compilations++;
+		return m_variants.emplace(f_key, f_compile(f_key)).first->second.get();
+	}
+
+	/// <summary>
+	/// Number of variants compiled so far (including failed ones).
+	/// </summary>
+	size_t getCompilationCount() const { return m_compilations; }
+
+	/// <summary>
+	/// Calls f_visit(key, variant) for every successfully compiled variant.
+	/// </summary>
+	template <typename Visit>
+	void forEach(Visit&& f_visit)
+	{
+		for (auto& entry : m_variants)
+		{
+			if (entry.second)
+			{
+				f_visit(entry.first, *entry.second);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Drops every variant.
+	/// </summary>
+	void clear()
+	{
+		m_variants.clear();
+	}
+
+private:
+	std::unordered_map<ShaderVariantKey, std::unique_ptr<Variant>> m_variants;
+	size_t m_compilations = 0;
+};
+
+#endif // !_SHADER_KEYWORDS_HPP_
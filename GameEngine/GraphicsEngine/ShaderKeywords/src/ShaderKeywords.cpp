@@ -0,0 +1,99 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Shader feature keywords and permutation keys
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - This library has no DirectX dependency so the key logic builds anywhere.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Map shader keywords to bitmask keys and keys to defines.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the ShaderKeywordSet class.
+/// @par Revision History:
+///      $Source: ShaderKeywords.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/16 09:40:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "ShaderKeywords.hpp"
+
+int ShaderKeywordSet::declare(const std::string& f_name)
+{
+	const int existing = find(f_name);
+	if (existing >= 0)
+	{
+		return existing;
+	}
+	if (m_names.size() >= max_keywords)
+	{
+		return -1;
+	}
+
+	m_names.push_back(f_name);
+	const int bit = static_cast<int>(m_names.size() - 1);
+	m_mask |= ShaderVariantKey(1) << bit;
+	return bit;
+}
+
+int ShaderKeywordSet::find(const std::string& f_name) const
+{
+	for (size_t i = 0; i < m_names.size(); ++i)
+	{
+		if (m_names[i] == f_name)
+		{
+			return static_cast<int>(i);
+		}
+	}
+	return -1;
+}
+
+ShaderVariantKey ShaderKeywordSet::makeKey(std::initializer_list<const char*> f_names) const
+{
+	ShaderVariantKey key = 0;
+	for (const char* name : f_names)
+	{
+		const int bit = find(name);
+		if (bit >= 0)
+		{
+			key |= ShaderVariantKey(1) << bit;
+		}
+	}
+	return key;
+}
+
+std::vector<ShaderKeywordSet::Define> ShaderKeywordSet::getDefines(ShaderVariantKey f_key) const
+{
+	std::vector<Define> defines;
+	const ShaderVariantKey key = sanitize(f_key);
+	for (size_t i = 0; i < m_names.size(); ++i)
+	{
+		if (key & (ShaderVariantKey(1) << i))
+		{
+			defines.emplace_back(m_names[i], "1");
+		}
+	}
+	return defines;
+}
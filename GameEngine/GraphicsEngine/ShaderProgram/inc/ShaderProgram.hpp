@@ -0,0 +1,166 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Shader program with lazily compiled permutations
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Only the permutations that are actually requested are ever compiled.
+//  - Declare every keyword before requesting the first variant.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Compile vertex/pixel shader pairs per set of feature keywords.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the ShaderProgram class.
+/// @par Revision History:
+///      $Source: ShaderProgram.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/16 09:40:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _SHADER_PROGRAM_HPP_
+#define _SHADER_PROGRAM_HPP_
+
+#include "ShaderKeywords.hpp"
+#include <string>
+#include <vector>
+
+class IGraphicsEngine;
+class VertexShader;
+class PixelShader;
+
+/**
+ * @class ShaderProgram
+ * @brief A vertex/pixel shader pair compiled per keyword permutation.
+ *
+ * The program declares its feature keywords once. getVariant() resolves a
+ * ShaderVariantKey with a single hash lookup and compiles the permutation
+ * with the matching defines only the first time the key is requested.
+ *
+ * Example usage:
+ * @code
+ * ShaderProgram* program = GraphicsEngine::get()->createShaderProgram(L"VertexShader.hlsl", "vsmain",
+ *     L"PixelShader.hlsl", "psmain");
+ * program->declareKeyword("ANIMATED_COLOR");
+ * ShaderVariantKey key = program->makeKey({ "ANIMATED_COLOR" });
+ * const ShaderProgram::Variant* variant = program->getVariant(key);
+ * // ...
+ * program->release();
+ * @endcode
+ */
+class ShaderProgram
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// One compiled permutation of the program.
+	/// </summary>
+	struct Variant
+	{
+		VertexShader* vertex_shader = nullptr;
+		PixelShader* pixel_shader = nullptr;
+
+		/// <summary>
+		/// Vertex shader byte code, kept for input layout creation.
+		/// </summary>
+		std::vector<unsigned char> vertex_byte_code;
+	};
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Declares a feature keyword of the program.
+	/// </summary>
+	/// <returns>The bit of the keyword inside a ShaderVariantKey, or -1 if no bit is left.</returns>
+	int declareKeyword(const char* f_name);
+
+	/// <summary>
+	/// Builds the key enabling the named keywords.
+	/// </summary>
+	ShaderVariantKey makeKey(std::initializer_list<const char*> f_names) const;
+
+	/// <summary>
+	/// Returns the permutation of the key, compiling it on the first request.
+	/// </summary>
+	/// <returns>The compiled variant, or nullptr if it failed to compile.</returns>
+	const Variant* getVariant(ShaderVariantKey f_key);
+
+	/// <summary>
+	/// Number of permutations compiled so far.
+	/// </summary>
+	size_t getCompiledVariantCount() const { return m_variants.getCompilationCount(); }
+
+	/// <summary>
+	/// Retrieves the keywords declared by the program.
+	/// </summary>
+	const ShaderKeywordSet& getKeywords() const { return m_keywords; }
+
+	/// <summary>
+	/// Releases every compiled variant and the program itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	ShaderProgram();
+	~ShaderProgram();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(const wchar_t* f_vs_file_name, const char* f_vs_entry_point,
+		const wchar_t* f_ps_file_name, const char* f_ps_entry_point, IGraphicsEngine* f_graphicsEngine);
+	std::unique_ptr<Variant> compile(ShaderVariantKey f_key);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::wstring m_vs_file_name;
+	std::string m_vs_entry_point;
+	std::wstring m_ps_file_name;
+	std::string m_ps_entry_point;
+	IGraphicsEngine* m_graphics_engine;
+	ShaderKeywordSet m_keywords;
+	ShaderVariantCache<Variant> m_variants;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_SHADER_PROGRAM_HPP_
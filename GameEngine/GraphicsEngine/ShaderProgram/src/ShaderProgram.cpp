@@ -0,0 +1,137 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Shader program with lazily compiled permutations
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Only the permutations that are actually requested are ever compiled.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Compile vertex/pixel shader pairs per set of feature keywords.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the ShaderProgram class.
+/// @par Revision History:
+///      $Source: ShaderProgram.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/16 09:40:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "ShaderProgram.hpp"
+#include "IGraphicsEngine.hpp"
+#include "VertexShader.hpp"
+#include "PixelShader.hpp"
+
+ShaderProgram::ShaderProgram() : m_graphics_engine(nullptr)
+{
+}
+
+bool ShaderProgram::init(const wchar_t* f_vs_file_name, const char* f_vs_entry_point,
+	const wchar_t* f_ps_file_name, const char* f_ps_entry_point, IGraphicsEngine* f_graphicsEngine)
+{
+	if (!f_vs_file_name || !f_vs_entry_point || !f_ps_file_name || !f_ps_entry_point)
+	{
+		return false;
+	}
+	m_vs_file_name = f_vs_file_name;
+	m_vs_entry_point = f_vs_entry_point;
+	m_ps_file_name = f_ps_file_name;
+	m_ps_entry_point = f_ps_entry_point;
+	m_graphics_engine = f_graphicsEngine;
+	return true;
+}
+
+int ShaderProgram::declareKeyword(const char* f_name)
+{
+	return m_keywords.declare(f_name);
+}
+
+ShaderVariantKey ShaderProgram::makeKey(std::initializer_list<const char*> f_names) const
+{
+	return m_keywords.makeKey(f_names);
+}
+
+const ShaderProgram::Variant* ShaderProgram::getVariant(ShaderVariantKey f_key)
+{
+	return m_variants.getOrCompile(m_keywords.sanitize(f_key),
+		[this](ShaderVariantKey f_variant_key) { return compile(f_variant_key); });
+}
+
+std::unique_ptr<ShaderProgram::Variant> ShaderProgram::compile(ShaderVariantKey f_key)
+{
+	const std::vector<ShaderKeywordSet::Define> defines = m_keywords.getDefines(f_key);
+
+	std::vector<D3D_SHADER_MACRO> macros;
+	macros.reserve(defines.size() + 1);
+	for (const ShaderKeywordSet::Define& define : defines)
+	{
+		macros.push_back({ define.first.c_str(), define.second.c_str() });
+	}
+	macros.push_back({ nullptr, nullptr }); // Terminator expected by D3DCompile
+
+	std::unique_ptr<Variant> variant(new Variant());
+
+	ID3DBlob* byte_code = nullptr;
+	if (!m_graphics_engine->compileVertexShader(m_vs_file_name.c_str(), m_vs_entry_point.c_str(), macros.data(), &byte_code))
+	{
+		return nullptr;
+	}
+	variant->vertex_shader = m_graphics_engine->createVertexShader(byte_code->GetBufferPointer(), byte_code->GetBufferSize());
+	const unsigned char* bytes = static_cast<const unsigned char*>(byte_code->GetBufferPointer());
+	variant->vertex_byte_code.assign(bytes, bytes + byte_code->GetBufferSize());
+	byte_code->Release();
+
+	byte_code = nullptr;
+	if (!m_graphics_engine->compilePixelShader(m_ps_file_name.c_str(), m_ps_entry_point.c_str(), macros.data(), &byte_code))
+	{
+		if (variant->vertex_shader) variant->vertex_shader->release();
+		return nullptr;
+	}
+	variant->pixel_shader = m_graphics_engine->createPixelShader(byte_code->GetBufferPointer(), byte_code->GetBufferSize());
+	byte_code->Release();
+
+	if (!variant->vertex_shader || !variant->pixel_shader)
+	{
+		if (variant->vertex_shader) variant->vertex_shader->release();
+		if (variant->pixel_shader) variant->pixel_shader->release();
+		return nullptr;
+	}
+
+	return variant;
+}
+
+void ShaderProgram::release()
+{
+	m_variants.forEach([](ShaderVariantKey, Variant& f_variant)
+	{
+		f_variant.vertex_shader->release();
+		f_variant.pixel_shader->release();
+	});
+	m_variants.clear();
+	delete this;
+}
+
+ShaderProgram::~ShaderProgram()
+{
+}
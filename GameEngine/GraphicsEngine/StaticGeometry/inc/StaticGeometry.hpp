@@ -0,0 +1,160 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Static level geometry in shared buffers
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - The vertex and index data are dropped once uploaded; only the mesh
+//    ranges are kept to build the draws.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Draw static scenery with a handful of draw calls.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the StaticGeometry class.
+/// @par Revision History:
+///      $Source: StaticGeometry.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/13 09:30:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _STATIC_GEOMETRY_HPP_
+#define _STATIC_GEOMETRY_HPP_
+
+#include "StaticGeometryBuilder.hpp"
+#include <functional>
+
+class IGraphicsEngine;
+class DeviceContext;
+class VertexBuffer;
+class IndexBuffer;
+
+/**
+ * @class StaticGeometry
+ * @brief GPU side of a StaticGeometryBuilder: one vertex and index buffer per batch.
+ *
+ * draw() walks the batches in order, binds each batch's buffers and material
+ * once and issues one drawIndexedTriangleList per run of adjacent visible
+ * meshes instead of one per mesh.
+ *
+ * Example usage:
+ * @code
+ * StaticGeometry* scenery = GraphicsEngine::get()->createStaticGeometry(builder);
+ * scenery->draw(device_context, visible_flags, [&](unsigned int f_material)
+ * {
+ *     device_context->setPipelineState(materials[f_material]);
+ * });
+ * // ...
+ * scenery->release();
+ * @endcode
+ */
+class StaticGeometry
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Binds the pipeline state, constant buffers and textures of a material.
+	/// </summary>
+	using BindMaterialFunction = std::function<void(unsigned int f_material)>;
+
+	/// <summary>
+	/// Counters of the last draw() call.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int mesh_count = 0;
+		unsigned int batch_count = 0;
+		unsigned int visible_mesh_count = 0;
+		unsigned int draw_calls = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Draws the visible meshes.
+	/// </summary>
+	/// <param name="f_visible">One flag per mesh id returned by the builder, or nullptr to draw everything.</param>
+	/// <param name="f_bind_material">Called once per batch before its draws.</param>
+	void draw(DeviceContext* f_device_context, const bool* f_visible, const BindMaterialFunction& f_bind_material);
+
+	/// <summary>
+	/// Where a mesh was packed; lets callers draw a single mesh themselves.
+	/// </summary>
+	const StaticMeshRange& getMeshRange(unsigned int f_mesh) const { return m_meshes[f_mesh]; }
+
+	unsigned int getMeshCount() const { return static_cast<unsigned int>(m_meshes.size()); }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Releases the buffers of every batch and the geometry itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	StaticGeometry();
+	~StaticGeometry();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(const StaticGeometryBuilder& f_builder, IGraphicsEngine* f_graphicsEngine);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	struct Batch
+	{
+		unsigned int material = 0;
+		VertexBuffer* vertex_buffer = nullptr;
+		IndexBuffer* index_buffer = nullptr;
+	};
+
+	std::vector<Batch> m_batches;
+	std::vector<std::vector<unsigned int>> m_batch_meshes;
+	std::vector<StaticMeshRange> m_meshes;
+	std::vector<StaticDraw> m_draws;
+	Statistics m_statistics;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_STATIC_GEOMETRY_HPP_
@@ -0,0 +1,119 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Static level geometry in shared buffers
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Draw static scenery with a handful of draw calls.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the StaticGeometry class.
+/// @par Revision History:
+///      $Source: StaticGeometry.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/13 09:30:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "StaticGeometry.hpp"
+#include "VertexBuffer.hpp"
+#include "IndexBuffer.hpp"
+#include "DeviceContext.hpp"
+
+StaticGeometry::StaticGeometry()
+{
+}
+
+bool StaticGeometry::init(const StaticGeometryBuilder& f_builder, IGraphicsEngine* f_graphicsEngine)
+{
+	for (const StaticGeometryBuilder::Batch& source : f_builder.getBatches())
+	{
+		Batch batch;
+		batch.material = source.key.material;
+		batch.vertex_buffer = new VertexBuffer();
+		batch.index_buffer = new IndexBuffer();
+		m_batches.push_back(batch);
+		m_batch_meshes.push_back(source.meshes);
+
+		if (!batch.vertex_buffer->load(const_cast<unsigned char*>(source.vertices.data()), source.key.vertex_stride,
+			source.getVertexCount(), f_graphicsEngine))
+		{
+			return false;
+		}
+		if (!batch.index_buffer->load(const_cast<unsigned int*>(source.indices.data()),
+			static_cast<UINT>(source.indices.size()), f_graphicsEngine))
+		{
+			return false;
+		}
+	}
+
+	m_meshes = f_builder.getMeshes();
+	m_statistics.mesh_count = static_cast<unsigned int>(m_meshes.size());
+	m_statistics.batch_count = static_cast<unsigned int>(m_batches.size());
+	return true;
+}
+
+void StaticGeometry::draw(DeviceContext* f_device_context, const bool* f_visible, const BindMaterialFunction& f_bind_material)
+{
+	StaticGeometryBuilder::buildDraws(m_meshes, m_batch_meshes, f_visible, m_draws);
+
+	m_statistics.visible_mesh_count = 0;
+	for (unsigned int mesh = 0; mesh < m_meshes.size(); ++mesh)
+	{
+		if (!f_visible || f_visible[mesh]) m_statistics.visible_mesh_count++;
+	}
+	m_statistics.draw_calls = static_cast<unsigned int>(m_draws.size());
+
+	unsigned int bound_batch = ~0u;
+	for (const StaticDraw& draw : m_draws)
+	{
+		if (draw.batch != bound_batch)
+		{
+			const Batch& batch = m_batches[draw.batch];
+			if (f_bind_material) f_bind_material(batch.material);
+			f_device_context->setVertexBuffer(batch.vertex_buffer);
+			f_device_context->setIndexBuffer(batch.index_buffer);
+			bound_batch = draw.batch;
+		}
+
+		// Indices were rebased while packing, so every draw starts at vertex 0
+		f_device_context->drawIndexedTriangleList(draw.index_count, 0, draw.first_index);
+	}
+}
+
+void StaticGeometry::release()
+{
+	for (Batch& batch : m_batches)
+	{
+		if (batch.vertex_buffer) batch.vertex_buffer->release();
+		if (batch.index_buffer) batch.index_buffer->release();
+	}
+	m_batches.clear();
+	delete this;
+}
+
+StaticGeometry::~StaticGeometry()
+{
+}
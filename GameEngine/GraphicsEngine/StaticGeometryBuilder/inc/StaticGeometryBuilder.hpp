@@ -0,0 +1,178 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Packing of static meshes into shared buffers
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - This library has no DirectX dependency so levels can be merged offline.
+//  - Indices are 32 bit, like IndexBuffer.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Merge static meshes per vertex format and material.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the StaticGeometryBuilder class and its range and draw types.
+/// @par Revision History:
+///      $Source: StaticGeometryBuilder.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/13 09:30:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _STATIC_GEOMETRY_BUILDER_HPP_
+#define _STATIC_GEOMETRY_BUILDER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// Meshes with equal keys share one vertex buffer, one index buffer and one material bind.
+/// </summary>
+struct StaticBatchKey
+{
+	/// <summary>
+	/// Hash of the vertex format (VertexFormat::getHash()).
+	/// </summary>
+	unsigned long long format_hash = 0;
+	unsigned int vertex_stride = 0;
+	unsigned int material = 0;
+
+	bool operator==(const StaticBatchKey& f_other) const
+	{
+		return format_hash == f_other.format_hash && vertex_stride == f_other.vertex_stride && material == f_other.material;
+	}
+};
+
+/// <summary>
+/// Where a mesh ended up inside its batch.
+/// </summary>
+struct StaticMeshRange
+{
+	unsigned int batch = 0;
+	unsigned int base_vertex = 0;
+	unsigned int vertex_count = 0;
+	unsigned int first_index = 0;
+	unsigned int index_count = 0;
+};
+
+/// <summary>
+/// One draw call over a run of consecutive visible meshes of a batch.
+/// </summary>
+struct StaticDraw
+{
+	unsigned int batch = 0;
+	unsigned int first_index = 0;
+	unsigned int index_count = 0;
+};
+
+/**
+ * @class StaticGeometryBuilder
+ * @brief Packs static meshes that share a vertex format and material into merged buffers.
+ *
+ * Each mesh is appended to the batch of its key and its indices are rebased
+ * by its base vertex while packing. Every mesh of a batch therefore draws
+ * with a base vertex of 0, so meshes that are adjacent in the index buffer
+ * can be merged into a single DrawIndexed by buildDraws(). Add meshes in
+ * spatial order (e.g. cell by cell) so that meshes visible together are
+ * also adjacent in the buffers.
+ *
+ * Example usage:
+ * @code
+ * StaticGeometryBuilder builder;
+ * StaticBatchKey key = { Format::getHash(), Format::stride, material_id };
+ * unsigned int mesh = builder.addMesh(key, vertices, vertex_count, indices, index_count);
+ * std::vector<StaticDraw> draws;
+ * builder.buildDraws(visibility.data(), draws);
+ * @endcode
+ */
+class StaticGeometryBuilder
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Merged data of one key.
+	/// </summary>
+	struct Batch
+	{
+		StaticBatchKey key;
+		std::vector<unsigned char> vertices;
+		std::vector<unsigned int> indices;
+
+		/// <summary>
+		/// Meshes of the batch in index buffer order.
+		/// </summary>
+		std::vector<unsigned int> meshes;
+
+		unsigned int getVertexCount() const { return key.vertex_stride ? static_cast<unsigned int>(vertices.size() / key.vertex_stride) : 0; }
+	};
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Appends a mesh to the batch of its key.
+	/// </summary>
+	/// <param name="f_vertices">f_vertex_count vertices of f_key.vertex_stride bytes.</param>
+	/// <param name="f_indices">Indices relative to the first vertex of the mesh.</param>
+	/// <returns>The mesh id, or ~0u when the mesh is empty or an index is out of range.</returns>
+	unsigned int addMesh(const StaticBatchKey& f_key, const void* f_vertices, unsigned int f_vertex_count,
+		const unsigned int* f_indices, unsigned int f_index_count);
+
+	/// <summary>
+	/// Builds the draws for the visible meshes, merging runs of adjacent visible meshes.
+	/// </summary>
+	/// <param name="f_visible">One flag per mesh id, or nullptr to draw every mesh.</param>
+	/// <param name="f_draws">Receives the draws, grouped by batch.</param>
+	void buildDraws(const bool* f_visible, std::vector<StaticDraw>& f_draws) const;
+
+	/// <summary>
+	/// Builds the draws for the visible meshes from ranges and batch mesh lists,
+	/// for users that kept only the layout of the merged geometry.
+	/// </summary>
+	static void buildDraws(const std::vector<StaticMeshRange>& f_meshes, const std::vector<std::vector<unsigned int>>& f_batch_meshes,
+		const bool* f_visible, std::vector<StaticDraw>& f_draws);
+
+	const std::vector<Batch>& getBatches() const { return m_batches; }
+	const std::vector<StaticMeshRange>& getMeshes() const { return m_meshes; }
+
+	/// <summary>
+	/// Removes every batch and mesh.
+	/// </summary>
+	void clear();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<Batch> m_batches;
+	std::vector<StaticMeshRange> m_meshes;
+};
+
+#endif // !_STATIC_GEOMETRY_BUILDER_HPP_
@@ -0,0 +1,148 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Packing of static meshes into shared buffers
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Merge static meshes per vertex format and material.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the StaticGeometryBuilder class.
+/// @par Revision History:
+///      $Source: StaticGeometryBuilder.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/13 09:30:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "StaticGeometryBuilder.hpp"
+
+namespace
+{
+	void appendDraw(const StaticMeshRange& f_range, std::vector<StaticDraw>& f_draws)
+	{
+		// Extend the previous draw when the mesh directly follows it in the same index buffer
+		if (!f_draws.empty() && f_draws.back().batch == f_range.batch &&
+			f_draws.back().first_index + f_draws.back().index_count == f_range.first_index)
+		{
+			f_draws.back().index_count += f_range.index_count;
+		}
+		else
+		{
+			f_draws.push_back({ f_range.batch, f_range.first_index, f_range.index_count });
+		}
+	}
+}
+
+unsigned int StaticGeometryBuilder::addMesh(const StaticBatchKey& f_key, const void* f_vertices, unsigned int f_vertex_count,
+	const unsigned int* f_indices, unsigned int f_index_count)
+{
+	if (!f_vertices || !f_indices || f_vertex_count == 0 || f_index_count == 0 || f_key.vertex_stride == 0)
+	{
+		return ~0u;
+	}
+	for (unsigned int i = 0; i < f_index_count; ++i)
+	{
+		if (f_indices[i] >= f_vertex_count)
+		{
+			return ~0u;
+		}
+	}
+
+	unsigned int batch_index = 0;
+	while (batch_index < m_batches.size() && !(m_batches[batch_index].key == f_key))
+	{
+		batch_index++;
+	}
+	if (batch_index == m_batches.size())
+	{
+		m_batches.push_back(Batch());
+		m_batches.back().key = f_key;
+	}
+	Batch& batch = m_batches[batch_index];
+
+	StaticMeshRange range;
+	range.batch = batch_index;
+	range.base_vertex = batch.getVertexCount();
+	range.vertex_count = f_vertex_count;
+	range.first_index = static_cast<unsigned int>(batch.indices.size());
+	range.index_count = f_index_count;
+
+	const unsigned char* vertices = static_cast<const unsigned char*>(f_vertices);
+	batch.vertices.insert(batch.vertices.end(), vertices, vertices + static_cast<std::size_t>(f_vertex_count) * f_key.vertex_stride);
+
+	// Rebase so every mesh of the batch draws with base vertex 0 and neighbours can merge
+	batch.indices.reserve(batch.indices.size() + f_index_count);
+	for (unsigned int i = 0; i < f_index_count; ++i)
+	{
+		batch.indices.push_back(f_indices[i] + range.base_vertex);
+	}
+
+	const unsigned int mesh = static_cast<unsigned int>(m_meshes.size());
+	m_meshes.push_back(range);
+	batch.meshes.push_back(mesh);
+	return mesh;
+}
+
+void StaticGeometryBuilder::buildDraws(const bool* f_visible, std::vector<StaticDraw>& f_draws) const
+{
+	f_draws.clear();
+	for (const Batch& batch : m_batches)
+	{
+		for (unsigned int mesh : batch.meshes)
+		{
+			if (f_visible && !f_visible[mesh])
+			{
+				continue;
+			}
+
+			appendDraw(m_meshes[mesh], f_draws);
+		}
+	}
+}
+
+void StaticGeometryBuilder::buildDraws(const std::vector<StaticMeshRange>& f_meshes, const std::vector<std::vector<unsigned int>>& f_batch_meshes,
+	const bool* f_visible, std::vector<StaticDraw>& f_draws)
+{
+	f_draws.clear();
+	for (const std::vector<unsigned int>& batch_meshes : f_batch_meshes)
+	{
+		for (unsigned int mesh : batch_meshes)
+		{
+			if (f_visible && !f_visible[mesh])
+			{
+				continue;
+			}
+
+			appendDraw(f_meshes[mesh], f_draws);
+		}
+	}
+}
+
+void StaticGeometryBuilder::clear()
+{
+	m_batches.clear();
+	m_meshes.clear();
+}
@@ -0,0 +1,144 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Texture with a streamed mip chain
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - D3D11 cannot free single mips of a texture, so every residency change
+//    recreates it and copies the mips both versions share on the GPU.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep only the mips the camera needs in video memory.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the StreamingTexture class.
+/// @par Revision History:
+///      $Source: StreamingTexture.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/01 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _STREAMING_TEXTURE_HPP_
+#define _STREAMING_TEXTURE_HPP_
+
+#include "TextureData.hpp"
+#include <d3d11.h>
+
+class IGraphicsEngine;
+class DeviceContext;
+
+/**
+ * @class StreamingTexture
+ * @brief A 2D texture holding only the mips from its first resident mip down to 1x1.
+ *
+ * The texture starts with the tail of its mip chain and follows the
+ * TextureResidencyChange records of a TextureStreamer through
+ * setFirstMip(). Shaders sample it like any texture; the resident mips are
+ * mip 0 of the view, so samples that ask for a finer mip get the finest one
+ * resident.
+ *
+ * Example usage:
+ * @code
+ * StreamingTexture* rock = GraphicsEngine::get()->createStreamingTexture(tail, 2048, 2048);
+ * // for every change returned by TextureStreamer::update()
+ * rock->setFirstMip(device_context, change.first_mip, change.mip_data.data());
+ * rock->bind(device_context, 0);
+ * @endcode
+ */
+class StreamingTexture
+{
+public:
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Makes mips f_first_mip to the last one resident, dropping the finer ones.
+	/// </summary>
+	/// <param name="f_mip_data">When mips are added, the data of mips f_first_mip to getFirstMip() - 1; ignored otherwise.</param>
+	/// <returns>False if the texture could not be recreated; the previous mips then stay resident.</returns>
+	bool setFirstMip(DeviceContext* f_device_context, UINT f_first_mip, const unsigned char* const* f_mip_data);
+
+	/// <summary>
+	/// Binds the view to t<f_slot> and the sampler to s<f_slot> of the pixel shader.
+	/// </summary>
+	void bind(DeviceContext* f_device_context, UINT f_slot);
+
+	UINT getWidth() const { return m_width; }
+	UINT getHeight() const { return m_height; }
+	UINT getMipCount() const { return m_mip_count; }
+	UINT getFirstMip() const { return m_first_mip; }
+	TextureFormat getFormat() const { return m_format; }
+	unsigned long long getGpuBytes() const { return m_gpu_bytes; }
+
+	/// <summary>
+	/// Releases the texture, its view and sampler and the object itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	StreamingTexture();
+	~StreamingTexture();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(const TextureData& f_tail, UINT f_width, UINT f_height, IGraphicsEngine* f_graphicsEngine);
+
+	/// <summary>
+	/// Creates a texture and view for mips f_first_mip to the last one.
+	/// </summary>
+	/// <param name="f_initial_data">One entry per mip, or nullptr for an empty texture.</param>
+	bool createResident(UINT f_first_mip, const D3D11_SUBRESOURCE_DATA* f_initial_data, ID3D11Texture2D** f_texture, ID3D11ShaderResourceView** f_srv) const;
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	IGraphicsEngine* m_graphics_engine;
+	ID3D11Texture2D* m_texture;
+	ID3D11ShaderResourceView* m_srv;
+	ID3D11SamplerState* m_sampler;
+	UINT m_width;
+	UINT m_height;
+	UINT m_mip_count;
+	UINT m_first_mip;
+	TextureFormat m_format;
+	unsigned long long m_gpu_bytes;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_STREAMING_TEXTURE_HPP_
@@ -0,0 +1,193 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Texture with a streamed mip chain
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep only the mips the camera needs in video memory.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the StreamingTexture class.
+/// @par Revision History:
+///      $Source: StreamingTexture.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/01 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "StreamingTexture.hpp"
+#include "GraphicsEngine.hpp"
+#include "DeviceContext.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include <vector>
+
+namespace
+{
+	unsigned long long getChainBytes(TextureFormat f_format, UINT f_width, UINT f_height, UINT f_first_mip, UINT f_mip_count)
+	{
+		unsigned long long bytes = 0;
+		for (UINT mip = f_first_mip; mip < f_mip_count; ++mip)
+		{
+			bytes += TextureData::getMipLayout(f_format, f_width, f_height, mip).size;
+		}
+		return bytes;
+	}
+}
+
+StreamingTexture::StreamingTexture()
+	: m_graphics_engine(nullptr), m_texture(nullptr), m_srv(nullptr), m_sampler(nullptr), m_width(0), m_height(0), m_mip_count(0),
+	m_first_mip(0), m_format(TextureFormat::RGBA8), m_gpu_bytes(0)
+{
+}
+
+bool StreamingTexture::init(const TextureData& f_tail, UINT f_width, UINT f_height, IGraphicsEngine* f_graphicsEngine)
+{
+	m_graphics_engine = f_graphicsEngine;
+	m_width = f_width;
+	m_height = f_height;
+	m_mip_count = TextureData::getFullMipCount(f_width, f_height);
+	m_format = f_tail.getFormat();
+
+	// The tail must be the end of the full chain: its first mip is mip m_first_mip of the texture
+	if (f_width == 0 || f_height == 0 || f_tail.getMipCount() == 0 || f_tail.getMipCount() > m_mip_count)
+	{
+		return false;
+	}
+	m_first_mip = m_mip_count - f_tail.getMipCount();
+	const TextureMip first = TextureData::getMipLayout(m_format, f_width, f_height, m_first_mip);
+	if (f_tail.getWidth() != first.width || f_tail.getHeight() != first.height)
+	{
+		return false;
+	}
+
+	std::vector<D3D11_SUBRESOURCE_DATA> mips(f_tail.getMipCount());
+	for (UINT mip = 0; mip < f_tail.getMipCount(); ++mip)
+	{
+		mips[mip].pSysMem = f_tail.getMipData(mip);
+		mips[mip].SysMemPitch = f_tail.getMip(mip).row_pitch;
+	}
+	if (!createResident(m_first_mip, mips.data(), &m_texture, &m_srv))
+	{
+		return false;
+	}
+	m_gpu_bytes = f_tail.getData().size();
+
+	D3D11_SAMPLER_DESC sampler_desc = {};
+	sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+	sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
+	sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
+	sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
+	sampler_desc.MaxLOD = D3D11_FLOAT32_MAX;
+	return SUCCEEDED(f_graphicsEngine->getDevice()->CreateSamplerState(&sampler_desc, &m_sampler));
+}
+
+bool StreamingTexture::createResident(UINT f_first_mip, const D3D11_SUBRESOURCE_DATA* f_initial_data, ID3D11Texture2D** f_texture, ID3D11ShaderResourceView** f_srv) const
+{
+	const TextureMip first = TextureData::getMipLayout(m_format, m_width, m_height, f_first_mip);
+
+	D3D11_TEXTURE2D_DESC texture_desc = {};
+	texture_desc.Width = first.width;
+	texture_desc.Height = first.height;
+	texture_desc.MipLevels = m_mip_count - f_first_mip;
+	texture_desc.ArraySize = 1;
+	texture_desc.Format = static_cast<DXGI_FORMAT>(TextureData::getDxgiFormat(m_format));
+	texture_desc.SampleDesc.Count = 1;
+	texture_desc.Usage = D3D11_USAGE_DEFAULT;
+	texture_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	ID3D11Device* device = m_graphics_engine->getDevice();
+	if (FAILED(device->CreateTexture2D(&texture_desc, f_initial_data, f_texture)))
+	{
+		return false;
+	}
+	if (FAILED(device->CreateShaderResourceView(*f_texture, nullptr, f_srv)))
+	{
+		(*f_texture)->Release();
+		*f_texture = nullptr;
+		return false;
+	}
+	return true;
+}
+
+bool StreamingTexture::setFirstMip(DeviceContext* f_device_context, UINT f_first_mip, const unsigned char* const* f_mip_data)
+{
+	if (f_first_mip == m_first_mip)
+	{
+		return true;
+	}
+	if (f_first_mip >= m_mip_count || (f_first_mip < m_first_mip && !f_mip_data))
+	{
+		return false;
+	}
+
+	ID3D11Texture2D* texture = nullptr;
+	ID3D11ShaderResourceView* srv = nullptr;
+	if (!createResident(f_first_mip, nullptr, &texture, &srv))
+	{
+		return false;
+	}
+
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	for (UINT mip = f_first_mip; mip < m_mip_count; ++mip)
+	{
+		if (mip < m_first_mip)
+		{
+			const TextureMip layout = TextureData::getMipLayout(m_format, m_width, m_height, mip);
+			context->UpdateSubresource(texture, mip - f_first_mip, nullptr, f_mip_data[mip - f_first_mip], layout.row_pitch, 0);
+		}
+		else
+		{
+			// Mips both versions hold never leave video memory
+			context->CopySubresourceRegion(texture, mip - f_first_mip, 0, 0, 0, m_texture, mip - m_first_mip, nullptr);
+		}
+	}
+
+	ResourceReleaseQueue::get()->deferRelease(m_srv, 0);
+	ResourceReleaseQueue::get()->deferRelease(m_texture, m_gpu_bytes);
+	m_texture = texture;
+	m_srv = srv;
+	m_first_mip = f_first_mip;
+	m_gpu_bytes = getChainBytes(m_format, m_width, m_height, m_first_mip, m_mip_count);
+	return true;
+}
+
+void StreamingTexture::bind(DeviceContext* f_device_context, UINT f_slot)
+{
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	context->PSSetShaderResources(f_slot, 1, &m_srv);
+	context->PSSetSamplers(f_slot, 1, &m_sampler);
+}
+
+void StreamingTexture::release()
+{
+	if (m_sampler) ResourceReleaseQueue::get()->deferRelease(m_sampler, 0);
+	if (m_srv) ResourceReleaseQueue::get()->deferRelease(m_srv, 0);
+	if (m_texture) ResourceReleaseQueue::get()->deferRelease(m_texture, m_gpu_bytes);
+	delete this;
+}
+
+StreamingTexture::~StreamingTexture()
+{
+}
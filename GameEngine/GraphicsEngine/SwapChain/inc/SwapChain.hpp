@@ -121,6 +121,7 @@ private:
 	ID3D11RenderTargetView* m_rtv;
 
 	friend class DeviceContext;
+	friend class FrameCapture;
 };
 
 #endif // !_SWAP_CHAIN_H_
@@ -44,6 +44,7 @@
 #include "IGraphicsEngine.hpp"
 #include "GraphicsEngine.hpp"
 #include "d3d11.h"
+#include "CommandRecorder.hpp"
 
 SwapChain::SwapChain()
 {
@@ -95,6 +96,7 @@ bool SwapChain::init(HWND f_hwnd, UINT f_width, UINT f_height, IGraphicsEngine*
 bool SwapChain::present(bool vsync)
 {
 	m_swapChain_p->Present(vsync, NULL);
+	CommandRecorder::get()->onPresent();
 	return true;
 }
 
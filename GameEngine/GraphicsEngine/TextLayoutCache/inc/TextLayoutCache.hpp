@@ -0,0 +1,233 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Shaped text layouts cached across frames
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Lay out a string once and draw it every frame from the cache.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the TextLayoutCache class and the text layout.
+/// @par Revision History:
+///      $Source: TextLayoutCache.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/04 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _TEXT_LAYOUT_CACHE_HPP_
+#define _TEXT_LAYOUT_CACHE_HPP_
+
+#include "Font.hpp"
+#include "GlyphAtlas.hpp"
+#include "QuadBatch.hpp"
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// A glyph of a laid out string and the quad it is drawn with, relative to the layout origin.
+/// </summary>
+struct TextLayoutGlyph
+{
+	unsigned int glyph = 0;
+	float pen_x = 0.0f;
+	float pen_y = 0.0f;
+	unsigned long long atlas_key = 0;
+	unsigned int atlas_handle = GlyphAtlas::invalid_handle;
+
+	/// <summary>
+	/// Zero sized for blank glyphs and for glyphs the atlas had no room for this frame.
+	/// </summary>
+	Quad quad;
+};
+
+/// <summary>
+/// A string shaped with one font and size; the origin is the top-left of the first line.
+/// </summary>
+struct TextLayout
+{
+	std::vector<TextLayoutGlyph> glyphs;
+	float width = 0.0f;
+	float height = 0.0f;
+};
+
+/**
+ * @class TextLayoutCache
+ * @brief Shapes UTF-8 strings into glyph quads once and keeps them across frames.
+ *
+ * getLayout() decodes the string, applies advances, kerning and line breaks,
+ * and caches the result keyed by the text, font, size and raster mode; the
+ * next frames only hash the string and confirm that its glyphs are still in
+ * the atlas. Missing glyphs are rasterized on demand and packed into the
+ * GlyphAtlas. Signed distance glyphs are rasterized once at the distance
+ * field height and scaled to every size. Layouts not used for a frame are
+ * evicted least recently used first once more than the limit are cached.
+ *
+ * Example usage:
+ * @code
+ * TextLayoutCache text;
+ * text.init(1024, 1024, 4096);
+ * const unsigned int ui_font = text.addFont(&font);
+ * text.beginFrame();
+ * const TextLayout* label = text.getLayout(ui_font, "Health", 6, 18.0f, GlyphRasterMode::Coverage);
+ * TextLayoutCache::submit(*label, 16.0f, 16.0f, white, text_material, quad_batch);
+ * @endcode
+ */
+class TextLayoutCache
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters of the current frame, reset by beginFrame().
+	/// </summary>
+	struct Statistics
+	{
+		size_t layout_hits = 0;
+		size_t layout_misses = 0;
+		size_t glyphs_rasterized = 0;
+		size_t cached_layouts = 0;
+	};
+
+	static constexpr unsigned int max_fonts = 256;
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	TextLayoutCache();
+	~TextLayoutCache();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Creates the glyph atlas and empties the cache.
+	/// </summary>
+	/// <param name="f_max_layouts">Layouts kept once unused; layouts used this frame are never evicted.</param>
+	bool init(unsigned int f_atlas_width, unsigned int f_atlas_height, size_t f_max_layouts);
+
+	/// <summary>
+	/// Registers a font; the font must outlive the cache.
+	/// </summary>
+	/// <returns>The font id used by getLayout(), or ~0u once max_fonts are registered.</returns>
+	unsigned int addFont(const Font* f_font);
+
+	/// <summary>
+	/// Pixel height signed distance glyphs are rasterized at. Larger keeps sharper corners when magnified.
+	/// </summary>
+	void setDistanceFieldHeight(float f_pixel_height) { m_distance_field_height = f_pixel_height; }
+
+	/// <summary>
+	/// Starts a frame for the layout and glyph eviction.
+	/// </summary>
+	void beginFrame();
+
+	/// <summary>
+	/// Lays out the text, or returns the cached layout, with its glyphs resident in the atlas.
+	/// </summary>
+	/// <param name="f_text">UTF-8 text; '\n' starts a new line.</param>
+	/// <returns>The layout, valid until the next beginFrame(); nullptr for an unknown font.</returns>
+	const TextLayout* getLayout(unsigned int f_font, const char* f_text, size_t f_length, float f_pixel_height, GlyphRasterMode f_mode);
+
+	/// <summary>
+	/// Submits the quads of a layout at a position. Works with QuadBatch and QuadBatcher alike.
+	/// </summary>
+	template <typename Batch>
+	static void submit(const TextLayout& f_layout, float f_x, float f_y, QuadColor f_color, unsigned int f_material, Batch& f_batch)
+	{
+		for (const TextLayoutGlyph& glyph : f_layout.glyphs)
+		{
+			if (glyph.quad.width == 0.0f)
+			{
+				continue;
+			}
+
+			Quad quad = glyph.quad;
+			quad.x += f_x;
+			quad.y += f_y;
+			quad.color = f_color;
+			f_batch.submit(f_material, quad);
+		}
+	}
+
+	GlyphAtlas& getAtlas() { return m_atlas; }
+	const GlyphAtlas& getAtlas() const { return m_atlas; }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct CachedLayout
+	{
+		unsigned long long hash = 0;
+		unsigned long long frame = 0;
+		std::string text;
+		unsigned int font = 0;
+		float pixel_height = 0.0f;
+		GlyphRasterMode mode = GlyphRasterMode::Coverage;
+		TextLayout layout;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void shape(CachedLayout& f_cached);
+
+	/// <summary>
+	/// Makes every glyph of the layout resident, rasterizing the missing ones, and refreshes their quads.
+	/// </summary>
+	void resolve(CachedLayout& f_cached);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	GlyphAtlas m_atlas;
+	std::vector<const Font*> m_fonts;
+	float m_distance_field_height;
+	size_t m_max_layouts;
+
+	// Most recently used first
+	std::list<CachedLayout> m_layouts;
+	std::unordered_map<unsigned long long, std::list<CachedLayout>::iterator> m_lookup;
+	unsigned long long m_frame;
+
+	GlyphBitmap m_bitmap;
+	Statistics m_statistics;
+};
+
+#endif // !_TEXT_LAYOUT_CACHE_HPP_
@@ -0,0 +1,298 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Shaped text layouts cached across frames
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Lay out a string once and draw it every frame from the cache.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the TextLayoutCache class.
+/// @par Revision History:
+///      $Source: TextLayoutCache.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/04 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TextLayoutCache.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	constexpr unsigned int replacement_character = 0xfffd;
+	constexpr unsigned int no_glyph = ~0u;
+
+	unsigned long long hashLayout(const char* f_text, size_t f_length, unsigned int f_font, float f_pixel_height, GlyphRasterMode f_mode)
+	{
+		// FNV-1a over the bytes, then the parameters
+		unsigned long long hash = 14695981039346656037ull;
+		for (size_t i = 0; i < f_length; ++i)
+		{
+			hash = (hash ^ static_cast<unsigned char>(f_text[i])) * 1099511628211ull;
+		}
+		unsigned int height_bits = 0;
+		std::memcpy(&height_bits, &f_pixel_height, sizeof(height_bits));
+		hash = (hash ^ height_bits) * 1099511628211ull;
+		hash = (hash ^ (f_font << 1 | static_cast<unsigned int>(f_mode))) * 1099511628211ull;
+		return hash;
+	}
+
+	unsigned long long makeGlyphKey(unsigned int f_font, GlyphRasterMode f_mode, float f_raster_height, unsigned int f_glyph)
+	{
+		const unsigned long long height = std::min(0x7fffffull, static_cast<unsigned long long>(f_raster_height * 4.0f + 0.5f));
+		return (static_cast<unsigned long long>(f_font) << 40) | (static_cast<unsigned long long>(f_mode) << 39) |
+			(height << 16) | (f_glyph & 0xffff);
+	}
+
+	unsigned int decodeUtf8(const char* f_text, size_t f_length, size_t& f_index)
+	{
+		const unsigned char lead = static_cast<unsigned char>(f_text[f_index++]);
+		unsigned int codepoint = 0;
+		int continuation = 0;
+		if (lead < 0x80) return lead;
+		else if ((lead >> 5) == 0x06) { codepoint = lead & 0x1f; continuation = 1; }
+		else if ((lead >> 4) == 0x0e) { codepoint = lead & 0x0f; continuation = 2; }
+		else if ((lead >> 3) == 0x1e) { codepoint = lead & 0x07; continuation = 3; }
+		else return replacement_character;
+
+		for (; continuation > 0; --continuation)
+		{
+			// A truncated sequence gives one replacement and decoding resumes at the offending byte
+			if (f_index >= f_length || (static_cast<unsigned char>(f_text[f_index]) & 0xc0) != 0x80)
+			{
+				return replacement_character;
+			}
+			codepoint = (codepoint << 6) | (static_cast<unsigned char>(f_text[f_index++]) & 0x3f);
+		}
+		return codepoint;
+	}
+}
+
+TextLayoutCache::TextLayoutCache() : m_distance_field_height(32.0f), m_max_layouts(0), m_frame(1)
+{
+}
+
+bool TextLayoutCache::init(unsigned int f_atlas_width, unsigned int f_atlas_height, size_t f_max_layouts)
+{
+	m_layouts.clear();
+	m_lookup.clear();
+	m_max_layouts = f_max_layouts;
+	m_statistics = Statistics();
+	return m_atlas.init(f_atlas_width, f_atlas_height);
+}
+
+unsigned int TextLayoutCache::addFont(const Font* f_font)
+{
+	if (!f_font || m_fonts.size() >= max_fonts)
+	{
+		return ~0u;
+	}
+
+	m_fonts.push_back(f_font);
+	return static_cast<unsigned int>(m_fonts.size() - 1);
+}
+
+void TextLayoutCache::beginFrame()
+{
+	m_frame++;
+	m_atlas.beginFrame();
+
+	const size_t cached_layouts = m_layouts.size();
+	m_statistics = Statistics();
+	m_statistics.cached_layouts = cached_layouts;
+}
+
+const TextLayout* TextLayoutCache::getLayout(unsigned int f_font, const char* f_text, size_t f_length, float f_pixel_height, GlyphRasterMode f_mode)
+{
+	if (f_font >= m_fonts.size() || (!f_text && f_length) || !(f_pixel_height > 0.0f))
+	{
+		return nullptr;
+	}
+
+	const unsigned long long hash = hashLayout(f_text, f_length, f_font, f_pixel_height, f_mode);
+	const auto found = m_lookup.find(hash);
+	if (found != m_lookup.end())
+	{
+		CachedLayout& cached = *found->second;
+		if (cached.frame != m_frame)
+		{
+			m_layouts.splice(m_layouts.begin(), m_layouts, found->second);
+		}
+
+		const bool same = cached.font == f_font && cached.pixel_height == f_pixel_height && cached.mode == f_mode &&
+			cached.text.size() == f_length && std::memcmp(cached.text.data(), f_text, f_length) == 0;
+		if (same)
+		{
+			m_statistics.layout_hits++;
+			if (cached.frame != m_frame)
+			{
+				// Glyphs touched this frame cannot be evicted before it ends, so one resolve per frame is enough
+				cached.frame = m_frame;
+				resolve(cached);
+			}
+			return &cached.layout;
+		}
+
+		// A hash collision: the entry is reshaped for the new text
+		cached.text.assign(f_text, f_length);
+		cached.font = f_font;
+		cached.pixel_height = f_pixel_height;
+		cached.mode = f_mode;
+	}
+	else
+	{
+		while (m_max_layouts && m_layouts.size() >= m_max_layouts && m_layouts.back().frame != m_frame)
+		{
+			m_lookup.erase(m_layouts.back().hash);
+			m_layouts.pop_back();
+		}
+
+		m_layouts.emplace_front();
+		CachedLayout& cached = m_layouts.front();
+		cached.hash = hash;
+		cached.text.assign(f_text ? f_text : "", f_length);
+		cached.font = f_font;
+		cached.pixel_height = f_pixel_height;
+		cached.mode = f_mode;
+		m_lookup.emplace(hash, m_layouts.begin());
+	}
+
+	CachedLayout& cached = m_layouts.front();
+	cached.frame = m_frame;
+	m_statistics.layout_misses++;
+	shape(cached);
+	resolve(cached);
+	return &cached.layout;
+}
+
+void TextLayoutCache::shape(CachedLayout& f_cached)
+{
+	const Font* font = m_fonts[f_cached.font];
+	const float pixel_height = f_cached.pixel_height;
+	const FontLineMetrics metrics = font->getLineMetrics(pixel_height);
+	const float line_height = metrics.ascent + metrics.descent + metrics.line_gap;
+
+	// Coverage glyphs are rasterized for whole pixel positions; keep them there so they stay crisp
+	const bool snap = f_cached.mode == GlyphRasterMode::Coverage;
+	const float raster_height = snap ? pixel_height : m_distance_field_height;
+
+	TextLayout& layout = f_cached.layout;
+	layout.glyphs.clear();
+	layout.width = 0.0f;
+
+	float pen_x = 0.0f;
+	float baseline = snap ? std::round(metrics.ascent) : metrics.ascent;
+	unsigned int line_count = 1;
+	unsigned int previous = no_glyph;
+	const char* text = f_cached.text.data();
+	const size_t length = f_cached.text.size();
+	for (size_t index = 0; index < length; )
+	{
+		const unsigned int codepoint = decodeUtf8(text, length, index);
+		if (codepoint == '\n')
+		{
+			layout.width = std::max(layout.width, pen_x);
+			pen_x = 0.0f;
+			baseline += snap ? std::round(line_height) : line_height;
+			line_count++;
+			previous = no_glyph;
+			continue;
+		}
+		if (codepoint == '\r')
+		{
+			continue;
+		}
+
+		const unsigned int glyph_index = font->getGlyphIndex(codepoint);
+		if (previous != no_glyph)
+		{
+			pen_x += font->getKerning(previous, glyph_index, pixel_height);
+		}
+
+		TextLayoutGlyph glyph;
+		glyph.glyph = glyph_index;
+		glyph.pen_x = snap ? std::round(pen_x) : pen_x;
+		glyph.pen_y = baseline;
+		glyph.atlas_key = makeGlyphKey(f_cached.font, f_cached.mode, raster_height, glyph_index);
+		layout.glyphs.push_back(glyph);
+
+		pen_x += font->getAdvance(glyph_index, pixel_height);
+		previous = glyph_index;
+	}
+
+	layout.width = std::max(layout.width, pen_x);
+	layout.height = line_count * line_height;
+}
+
+void TextLayoutCache::resolve(CachedLayout& f_cached)
+{
+	const Font* font = m_fonts[f_cached.font];
+	const bool distance_field = f_cached.mode == GlyphRasterMode::SignedDistance;
+	const float raster_height = distance_field ? m_distance_field_height : f_cached.pixel_height;
+	const float scale = f_cached.pixel_height / raster_height;
+	const float texel_width = 1.0f / m_atlas.getWidth();
+	const float texel_height = 1.0f / m_atlas.getHeight();
+
+	for (TextLayoutGlyph& glyph : f_cached.layout.glyphs)
+	{
+		if (!m_atlas.touch(glyph.atlas_handle, glyph.atlas_key))
+		{
+			glyph.atlas_handle = m_atlas.find(glyph.atlas_key);
+			if (glyph.atlas_handle == GlyphAtlas::invalid_handle)
+			{
+				// A glyph that fails to rasterize is kept as blank rather than retried every frame
+				font->rasterize(glyph.glyph, raster_height, f_cached.mode, m_bitmap);
+				glyph.atlas_handle = m_atlas.insert(glyph.atlas_key, m_bitmap.pixels.data(), m_bitmap.width, m_bitmap.height,
+					m_bitmap.width, static_cast<float>(m_bitmap.offset_x), static_cast<float>(m_bitmap.offset_y));
+				m_statistics.glyphs_rasterized++;
+			}
+		}
+
+		Quad& quad = glyph.quad;
+		if (glyph.atlas_handle == GlyphAtlas::invalid_handle)
+		{
+			quad.width = quad.height = 0.0f;
+			continue;
+		}
+
+		// The handle may have been recycled for the same glyph at another place, so the quad is always rebuilt
+		const GlyphAtlasRegion& region = m_atlas.getRegion(glyph.atlas_handle);
+		quad.x = glyph.pen_x + region.offset_x * scale;
+		quad.y = glyph.pen_y + region.offset_y * scale;
+		quad.width = region.width * scale;
+		quad.height = region.height * scale;
+		quad.u0 = region.x * texel_width;
+		quad.v0 = region.y * texel_height;
+		quad.u1 = (region.x + region.width) * texel_width;
+		quad.v1 = (region.y + region.height) * texel_height;
+	}
+}
+
+TextLayoutCache::~TextLayoutCache()
+{
+}
@@ -0,0 +1,168 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Text drawn from a glyph atlas texture
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Draw labels and overlays through the quad batcher.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the TextRenderer class.
+/// @par Revision History:
+///      $Source: TextRenderer.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/04 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _TEXT_RENDERER_HPP_
+#define _TEXT_RENDERER_HPP_
+
+#include "TextLayoutCache.hpp"
+#include <d3d11.h>
+
+class IGraphicsEngine;
+class DeviceContext;
+class QuadBatcher;
+
+/**
+ * @class TextRenderer
+ * @brief Lays out text with a TextLayoutCache and draws it from an R8 atlas texture.
+ *
+ * drawText() submits one quad per glyph to a QuadBatcher under the text
+ * material, so every label of a frame ends up in the same draw. upload()
+ * copies the atlas rectangles rasterized since the last upload into the
+ * texture and must run before the batcher is flushed; bindAtlas() binds the
+ * texture and a bilinear sampler for the text pixel shader, which reads the
+ * red channel as coverage, or as a distance with the edge at 0.5 for
+ * GlyphRasterMode::SignedDistance.
+ *
+ * Example usage:
+ * @code
+ * TextRenderer* text = GraphicsEngine::get()->createTextRenderer(1024, 4096);
+ * const unsigned int ui_font = text->addFont(&font);
+ * text->beginFrame();
+ * text->drawText(quads, text_material, ui_font, "16.7 ms", 8.0f, 8.0f, 16.0f, QuadColor());
+ * text->upload(device_context);
+ * quads->flush(device_context, [&](unsigned int f_material)
+ * {
+ *     device_context->setPipelineState(materials[f_material]);
+ *     if (f_material == text_material) text->bindAtlas(device_context, 0);
+ * });
+ * @endcode
+ */
+class TextRenderer
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters of the last upload() call.
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int upload_rects = 0;
+		size_t uploaded_texels = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Registers a font; the font must outlive the renderer.
+	/// </summary>
+	/// <returns>The font id, or ~0u when no more fonts can be added.</returns>
+	unsigned int addFont(const Font* f_font) { return m_layouts.addFont(f_font); }
+
+	/// <summary>
+	/// Starts a frame: layouts and glyphs unused since the previous one become evictable.
+	/// </summary>
+	void beginFrame() { m_layouts.beginFrame(); }
+
+	/// <summary>
+	/// Lays out the text, or reuses its cached layout, and queues its glyph quads.
+	/// </summary>
+	/// <param name="f_x">Left edge of the text in the batcher's coordinates.</param>
+	/// <param name="f_y">Top of the first line.</param>
+	/// <returns>The layout, for measuring; nullptr for an unknown font.</returns>
+	const TextLayout* drawText(QuadBatcher* f_quads, unsigned int f_material, unsigned int f_font, const char* f_text,
+		float f_x, float f_y, float f_pixel_height, QuadColor f_color, GlyphRasterMode f_mode = GlyphRasterMode::Coverage);
+
+	/// <summary>
+	/// Copies the newly rasterized glyphs into the atlas texture.
+	/// </summary>
+	void upload(DeviceContext* f_device_context);
+
+	/// <summary>
+	/// Binds the atlas texture and its sampler to a pixel shader slot.
+	/// </summary>
+	void bindAtlas(DeviceContext* f_device_context, UINT f_slot);
+
+	TextLayoutCache& getLayoutCache() { return m_layouts; }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Releases the atlas texture and the renderer itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	TextRenderer();
+	~TextRenderer();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(unsigned int f_atlas_size, size_t f_max_layouts, IGraphicsEngine* f_graphicsEngine);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	TextLayoutCache m_layouts;
+	ID3D11Texture2D* m_texture;
+	ID3D11ShaderResourceView* m_view;
+	ID3D11SamplerState* m_sampler;
+	Statistics m_statistics;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_TEXT_RENDERER_HPP_
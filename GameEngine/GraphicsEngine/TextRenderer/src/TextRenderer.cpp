@@ -0,0 +1,150 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Text drawn from a glyph atlas texture
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Draw labels and overlays through the quad batcher.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the TextRenderer class.
+/// @par Revision History:
+///      $Source: TextRenderer.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/04 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TextRenderer.hpp"
+#include "GraphicsEngine.hpp"
+#include "DeviceContext.hpp"
+#include "QuadBatcher.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include <cstring>
+
+TextRenderer::TextRenderer() : m_texture(nullptr), m_view(nullptr), m_sampler(nullptr)
+{
+}
+
+bool TextRenderer::init(unsigned int f_atlas_size, size_t f_max_layouts, IGraphicsEngine* f_graphicsEngine)
+{
+	if (!m_layouts.init(f_atlas_size, f_atlas_size, f_max_layouts))
+	{
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC texture_desc = {};
+	texture_desc.Width = f_atlas_size;
+	texture_desc.Height = f_atlas_size;
+	texture_desc.MipLevels = 1;
+	texture_desc.ArraySize = 1;
+	texture_desc.Format = DXGI_FORMAT_R8_UNORM;
+	texture_desc.SampleDesc.Count = 1;
+	texture_desc.Usage = D3D11_USAGE_DEFAULT;
+	texture_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	// Starts from the cleared CPU atlas, so the first upload only has glyphs to copy
+	const GlyphAtlas& atlas = m_layouts.getAtlas();
+	D3D11_SUBRESOURCE_DATA initial_data = {};
+	initial_data.pSysMem = atlas.getPixels();
+	initial_data.SysMemPitch = atlas.getWidth();
+
+	ID3D11Device* device = f_graphicsEngine->getDevice();
+	if (FAILED(device->CreateTexture2D(&texture_desc, &initial_data, &m_texture)))
+	{
+		return false;
+	}
+	m_layouts.getAtlas().clearDirtyRects();
+
+	if (FAILED(device->CreateShaderResourceView(m_texture, nullptr, &m_view)))
+	{
+		return false;
+	}
+
+	D3D11_SAMPLER_DESC sampler_desc = {};
+	sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+	sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampler_desc.MaxLOD = D3D11_FLOAT32_MAX;
+	if (FAILED(device->CreateSamplerState(&sampler_desc, &m_sampler)))
+	{
+		return false;
+	}
+	return true;
+}
+
+const TextLayout* TextRenderer::drawText(QuadBatcher* f_quads, unsigned int f_material, unsigned int f_font, const char* f_text,
+	float f_x, float f_y, float f_pixel_height, QuadColor f_color, GlyphRasterMode f_mode)
+{
+	const TextLayout* layout = m_layouts.getLayout(f_font, f_text, f_text ? std::strlen(f_text) : 0, f_pixel_height, f_mode);
+	if (layout)
+	{
+		TextLayoutCache::submit(*layout, f_x, f_y, f_color, f_material, *f_quads);
+	}
+	return layout;
+}
+
+void TextRenderer::upload(DeviceContext* f_device_context)
+{
+	m_statistics = Statistics();
+
+	GlyphAtlas& atlas = m_layouts.getAtlas();
+	for (const GlyphAtlasRect& rect : atlas.getDirtyRects())
+	{
+		D3D11_BOX box = {};
+		box.left = rect.x;
+		box.top = rect.y;
+		box.right = rect.x + rect.width;
+		box.bottom = rect.y + rect.height;
+		box.back = 1;
+
+		const unsigned char* source = atlas.getPixels() + static_cast<size_t>(rect.y) * atlas.getWidth() + rect.x;
+		f_device_context->getDeviceContext()->UpdateSubresource(m_texture, 0, &box, source, atlas.getWidth(), 0);
+
+		m_statistics.upload_rects++;
+		m_statistics.uploaded_texels += static_cast<size_t>(rect.width) * rect.height;
+	}
+	atlas.clearDirtyRects();
+}
+
+void TextRenderer::bindAtlas(DeviceContext* f_device_context, UINT f_slot)
+{
+	f_device_context->getDeviceContext()->PSSetShaderResources(f_slot, 1, &m_view);
+	f_device_context->getDeviceContext()->PSSetSamplers(f_slot, 1, &m_sampler);
+}
+
+void TextRenderer::release()
+{
+	const unsigned long long texture_bytes = static_cast<unsigned long long>(m_layouts.getAtlas().getWidth()) * m_layouts.getAtlas().getHeight();
+	if (m_sampler) ResourceReleaseQueue::get()->deferRelease(m_sampler, 0);
+	if (m_view) ResourceReleaseQueue::get()->deferRelease(m_view, 0);
+	if (m_texture) ResourceReleaseQueue::get()->deferRelease(m_texture, texture_bytes);
+	delete this;
+}
+
+TextRenderer::~TextRenderer()
+{
+}
@@ -0,0 +1,125 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Sampled 2D texture resource
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Give shaders sampled textures with their mip chain.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the Texture class.
+/// @par Revision History:
+///      $Source: Texture.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/29 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _TEXTURE_HPP_
+#define _TEXTURE_HPP_
+
+#include "TextureData.hpp"
+#include <d3d11.h>
+
+class IGraphicsEngine;
+class DeviceContext;
+
+/**
+ * @class Texture
+ * @brief An immutable 2D texture with its mip chain, uploaded once from a TextureData.
+ *
+ * Any TextureFormat is uploaded as is, so block compressed data, whether
+ * encoded by the TextureEncoder or read from a DDS file, stays compressed
+ * in video memory. The texture owns a trilinear wrapping sampler that
+ * bind() sets next to its view.
+ *
+ * Example usage:
+ * @code
+ * Texture* texture = GraphicsEngine::get()->createTexture(compressed);
+ * texture->bind(device_context, 0);
+ * // ...
+ * texture->release();
+ * @endcode
+ */
+class Texture
+{
+public:
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Binds the view to t<f_slot> and the sampler to s<f_slot> of the pixel shader.
+	/// </summary>
+	void bind(DeviceContext* f_device_context, UINT f_slot);
+
+	UINT getWidth() const { return m_width; }
+	UINT getHeight() const { return m_height; }
+	UINT getMipCount() const { return m_mip_count; }
+	TextureFormat getFormat() const { return m_format; }
+	unsigned long long getGpuBytes() const { return m_gpu_bytes; }
+
+	/// <summary>
+	/// Releases the texture, its view and sampler and the object itself.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	Texture();
+	~Texture();
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	bool init(const TextureData& f_data, IGraphicsEngine* f_graphicsEngine);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	ID3D11Texture2D* m_texture;
+	ID3D11ShaderResourceView* m_srv;
+	ID3D11SamplerState* m_sampler;
+	UINT m_width;
+	UINT m_height;
+	UINT m_mip_count;
+	TextureFormat m_format;
+	unsigned long long m_gpu_bytes;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class GraphicsEngine;
+};
+
+#endif // !_TEXTURE_HPP_
@@ -0,0 +1,118 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Sampled 2D texture resource
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Give shaders sampled textures with their mip chain.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the Texture class.
+/// @par Revision History:
+///      $Source: Texture.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/29 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "Texture.hpp"
+#include "GraphicsEngine.hpp"
+#include "DeviceContext.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include <vector>
+
+Texture::Texture()
+	: m_texture(nullptr), m_srv(nullptr), m_sampler(nullptr), m_width(0), m_height(0), m_mip_count(0), m_format(TextureFormat::RGBA8), m_gpu_bytes(0)
+{
+}
+
+bool Texture::init(const TextureData& f_data, IGraphicsEngine* f_graphicsEngine)
+{
+	if (f_data.getMipCount() == 0)
+	{
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC texture_desc = {};
+	texture_desc.Width = f_data.getWidth();
+	texture_desc.Height = f_data.getHeight();
+	texture_desc.MipLevels = f_data.getMipCount();
+	texture_desc.ArraySize = 1;
+	texture_desc.Format = static_cast<DXGI_FORMAT>(TextureData::getDxgiFormat(f_data.getFormat()));
+	texture_desc.SampleDesc.Count = 1;
+	texture_desc.Usage = D3D11_USAGE_IMMUTABLE;
+	texture_desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	std::vector<D3D11_SUBRESOURCE_DATA> mips(f_data.getMipCount());
+	for (UINT mip = 0; mip < f_data.getMipCount(); ++mip)
+	{
+		mips[mip].pSysMem = f_data.getMipData(mip);
+		mips[mip].SysMemPitch = f_data.getMip(mip).row_pitch;
+	}
+
+	ID3D11Device* device = f_graphicsEngine->getDevice();
+	if (FAILED(device->CreateTexture2D(&texture_desc, mips.data(), &m_texture)) ||
+		FAILED(device->CreateShaderResourceView(m_texture, nullptr, &m_srv)))
+	{
+		return false;
+	}
+
+	D3D11_SAMPLER_DESC sampler_desc = {};
+	sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+	sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
+	sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
+	sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
+	sampler_desc.MaxLOD = D3D11_FLOAT32_MAX;
+	if (FAILED(device->CreateSamplerState(&sampler_desc, &m_sampler)))
+	{
+		return false;
+	}
+
+	m_width = f_data.getWidth();
+	m_height = f_data.getHeight();
+	m_mip_count = f_data.getMipCount();
+	m_format = f_data.getFormat();
+	m_gpu_bytes = f_data.getData().size();
+	return true;
+}
+
+void Texture::bind(DeviceContext* f_device_context, UINT f_slot)
+{
+	ID3D11DeviceContext* context = f_device_context->getDeviceContext();
+	context->PSSetShaderResources(f_slot, 1, &m_srv);
+	context->PSSetSamplers(f_slot, 1, &m_sampler);
+}
+
+void Texture::release()
+{
+	if (m_sampler) ResourceReleaseQueue::get()->deferRelease(m_sampler, 0);
+	if (m_srv) ResourceReleaseQueue::get()->deferRelease(m_srv, 0);
+	if (m_texture) ResourceReleaseQueue::get()->deferRelease(m_texture, m_gpu_bytes);
+	delete this;
+}
+
+Texture::~Texture()
+{
+}
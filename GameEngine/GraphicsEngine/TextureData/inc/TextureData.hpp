@@ -0,0 +1,176 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: CPU side texture images and their DDS files
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Hold mip chains in GPU layout and read or write them as DDS files.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the TextureData class and the texture formats.
+/// @par Revision History:
+///      $Source: TextureData.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/29 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _TEXTURE_DATA_HPP_
+#define _TEXTURE_DATA_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// Pixel formats of a TextureData; the BC formats store 4x4 pixel blocks.
+/// </summary>
+enum class TextureFormat
+{
+	RGBA8,
+	RGBA8_SRGB,
+	BC1,         // RGB, 8 bytes per block
+	BC1_SRGB,
+	BC3,         // RGBA, 16 bytes per block
+	BC3_SRGB,
+	BC5,         // Two channels, e.g. normal map XY, 16 bytes per block
+	BC7,         // RGBA, 16 bytes per block
+	BC7_SRGB
+};
+
+/// <summary>
+/// Where one mip level lives inside TextureData::getData().
+/// </summary>
+struct TextureMip
+{
+	unsigned int width;
+	unsigned int height;
+	unsigned int row_pitch;    // Bytes per row of pixels, or per row of blocks
+	unsigned int row_count;    // Rows of pixels, or rows of blocks
+	size_t offset;
+	size_t size;
+};
+
+/**
+ * @class TextureData
+ * @brief A 2D texture with its mip chain in one allocation, laid out as D3D11 expects it.
+ *
+ * Mips follow each other from the largest, tightly packed: RGBA8 rows are
+ * width * 4 bytes and BC rows are one row of 4x4 blocks, rounded up for
+ * mips smaller than a block. The data can be uploaded as is by
+ * GraphicsEngine::createTexture(). load() and loadFile() read DDS files, the
+ * DX10 header and the legacy DXT1, DXT5 and ATI2 codes, so precompressed
+ * textures skip the encoder; save() writes the DX10 header.
+ *
+ * Example usage:
+ * @code
+ * TextureData data;
+ * if (data.loadFile("Textures/bricks_bc7.dds"))
+ * {
+ *     Texture* bricks = GraphicsEngine::get()->createTexture(data);
+ * }
+ * @endcode
+ */
+class TextureData
+{
+public:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	TextureData();
+	~TextureData();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Lays out and allocates a mip chain; the contents are zero.
+	/// </summary>
+	/// <param name="f_mip_count">Mips to allocate, 0 for the full chain down to 1x1.</param>
+	/// <returns>False if a size is 0.</returns>
+	bool allocate(TextureFormat f_format, unsigned int f_width, unsigned int f_height, unsigned int f_mip_count);
+
+	/// <summary>
+	/// Reads a DDS file image from memory.
+	/// </summary>
+	/// <returns>False if it is not a 2D texture in one of the TextureFormat formats.</returns>
+	bool load(const unsigned char* f_data, size_t f_size);
+	bool loadFile(const char* f_file_name);
+
+	/// <summary>
+	/// Writes the texture as a DDS file with a DX10 header.
+	/// </summary>
+	bool saveFile(const char* f_file_name) const;
+
+	TextureFormat getFormat() const { return m_format; }
+	unsigned int getWidth() const { return m_mips.empty() ? 0 : m_mips[0].width; }
+	unsigned int getHeight() const { return m_mips.empty() ? 0 : m_mips[0].height; }
+	unsigned int getMipCount() const { return static_cast<unsigned int>(m_mips.size()); }
+	const TextureMip& getMip(unsigned int f_mip) const { return m_mips[f_mip]; }
+	unsigned char* getMipData(unsigned int f_mip) { return m_data.data() + m_mips[f_mip].offset; }
+	const unsigned char* getMipData(unsigned int f_mip) const { return m_data.data() + m_mips[f_mip].offset; }
+	const std::vector<unsigned char>& getData() const { return m_data; }
+
+	/*--------------------------------------------------------------
+		Static Methods
+	--------------------------------------------------------------*/
+
+	static bool isCompressed(TextureFormat f_format) { return f_format != TextureFormat::RGBA8 && f_format != TextureFormat::RGBA8_SRGB; }
+	static bool isSrgb(TextureFormat f_format);
+
+	/// <summary>
+	/// Bytes of one 4x4 block, or of one pixel for RGBA8.
+	/// </summary>
+	static unsigned int getBlockBytes(TextureFormat f_format);
+
+	/// <summary>
+	/// Mips in the full chain of a texture, down to 1x1.
+	/// </summary>
+	static unsigned int getFullMipCount(unsigned int f_width, unsigned int f_height);
+
+	/// <summary>
+	/// Size and pitch of one mip of a texture, with an offset of 0.
+	/// </summary>
+	static TextureMip getMipLayout(TextureFormat f_format, unsigned int f_width, unsigned int f_height, unsigned int f_mip);
+
+	/// <summary>
+	/// The DXGI_FORMAT value of the format.
+	/// </summary>
+	static unsigned int getDxgiFormat(TextureFormat f_format);
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	TextureFormat m_format;
+	std::vector<TextureMip> m_mips;
+	std::vector<unsigned char> m_data;
+};
+
+#endif // !_TEXTURE_DATA_HPP_
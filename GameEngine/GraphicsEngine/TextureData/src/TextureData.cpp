@@ -0,0 +1,307 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: CPU side texture images and their DDS files
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Hold mip chains in GPU layout and read or write them as DDS files.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the TextureData class.
+/// @par Revision History:
+///      $Source: TextureData.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/29 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TextureData.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+	constexpr unsigned int dds_magic = 0x20534444;   // "DDS "
+	constexpr size_t dds_header_size = 124;
+	constexpr size_t dx10_header_size = 20;
+
+	constexpr unsigned int ddsd_caps = 0x1, ddsd_height = 0x2, ddsd_width = 0x4, ddsd_pitch = 0x8;
+	constexpr unsigned int ddsd_pixel_format = 0x1000, ddsd_mip_count = 0x20000, ddsd_linear_size = 0x80000;
+	constexpr unsigned int ddpf_four_cc = 0x4, ddpf_rgb = 0x40;
+	constexpr unsigned int ddscaps_complex = 0x8, ddscaps_texture = 0x1000, ddscaps_mipmap = 0x400000;
+	constexpr unsigned int ddscaps2_cubemap = 0x200, ddscaps2_volume = 0x200000;
+	constexpr unsigned int d3d10_resource_dimension_texture2d = 3;
+
+	constexpr unsigned int makeFourCC(const char f_code[5])
+	{
+		return static_cast<unsigned int>(f_code[0]) | static_cast<unsigned int>(f_code[1]) << 8 |
+			static_cast<unsigned int>(f_code[2]) << 16 | static_cast<unsigned int>(f_code[3]) << 24;
+	}
+
+	struct DxgiMapping
+	{
+		TextureFormat format;
+		unsigned int dxgi_format;
+	};
+
+	const DxgiMapping dxgi_mappings[] =
+	{
+		{ TextureFormat::RGBA8, 28 }, { TextureFormat::RGBA8_SRGB, 29 },
+		{ TextureFormat::BC1, 71 }, { TextureFormat::BC1_SRGB, 72 },
+		{ TextureFormat::BC3, 77 }, { TextureFormat::BC3_SRGB, 78 },
+		{ TextureFormat::BC5, 83 },
+		{ TextureFormat::BC7, 98 }, { TextureFormat::BC7_SRGB, 99 },
+	};
+
+	unsigned int readU32(const unsigned char* f_data)
+	{
+		return static_cast<unsigned int>(f_data[0]) | static_cast<unsigned int>(f_data[1]) << 8 |
+			static_cast<unsigned int>(f_data[2]) << 16 | static_cast<unsigned int>(f_data[3]) << 24;
+	}
+
+	void writeU32(unsigned char* f_data, unsigned int f_value)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			f_data[i] = static_cast<unsigned char>(f_value >> (i * 8));
+		}
+	}
+}
+
+TextureData::TextureData() : m_format(TextureFormat::RGBA8)
+{
+}
+
+bool TextureData::isSrgb(TextureFormat f_format)
+{
+	return f_format == TextureFormat::RGBA8_SRGB || f_format == TextureFormat::BC1_SRGB ||
+		f_format == TextureFormat::BC3_SRGB || f_format == TextureFormat::BC7_SRGB;
+}
+
+unsigned int TextureData::getBlockBytes(TextureFormat f_format)
+{
+	switch (f_format)
+	{
+	case TextureFormat::BC1:
+	case TextureFormat::BC1_SRGB:
+		return 8;
+	case TextureFormat::RGBA8:
+	case TextureFormat::RGBA8_SRGB:
+		return 4;
+	default:
+		return 16;
+	}
+}
+
+unsigned int TextureData::getFullMipCount(unsigned int f_width, unsigned int f_height)
+{
+	unsigned int count = 1;
+	for (unsigned int size = std::max(f_width, f_height); size > 1; size >>= 1)
+	{
+		count++;
+	}
+	return count;
+}
+
+unsigned int TextureData::getDxgiFormat(TextureFormat f_format)
+{
+	for (const DxgiMapping& mapping : dxgi_mappings)
+	{
+		if (mapping.format == f_format)
+		{
+			return mapping.dxgi_format;
+		}
+	}
+	return 0;
+}
+
+bool TextureData::allocate(TextureFormat f_format, unsigned int f_width, unsigned int f_height, unsigned int f_mip_count)
+{
+	m_mips.clear();
+	m_data.clear();
+	if (f_width == 0 || f_height == 0)
+	{
+		return false;
+	}
+
+	const unsigned int full_count = getFullMipCount(f_width, f_height);
+	const unsigned int mip_count = f_mip_count == 0 ? full_count : std::min(f_mip_count, full_count);
+	size_t offset = 0;
+	for (unsigned int mip = 0; mip < mip_count; ++mip)
+	{
+		TextureMip level = getMipLayout(f_format, f_width, f_height, mip);
+		level.offset = offset;
+		offset += level.size;
+		m_mips.push_back(level);
+	}
+
+	m_format = f_format;
+	m_data.assign(offset, 0);
+	return true;
+}
+
+TextureMip TextureData::getMipLayout(TextureFormat f_format, unsigned int f_width, unsigned int f_height, unsigned int f_mip)
+{
+	TextureMip level;
+	level.width = std::max(1u, f_width >> f_mip);
+	level.height = std::max(1u, f_height >> f_mip);
+	if (isCompressed(f_format))
+	{
+		level.row_pitch = (level.width + 3) / 4 * getBlockBytes(f_format);
+		level.row_count = (level.height + 3) / 4;
+	}
+	else
+	{
+		level.row_pitch = level.width * getBlockBytes(f_format);
+		level.row_count = level.height;
+	}
+	level.offset = 0;
+	level.size = static_cast<size_t>(level.row_pitch) * level.row_count;
+	return level;
+}
+
+bool TextureData::load(const unsigned char* f_data, size_t f_size)
+{
+	if (!f_data || f_size < 4 + dds_header_size || readU32(f_data) != dds_magic || readU32(f_data + 4) != dds_header_size)
+	{
+		return false;
+	}
+
+	const unsigned char* header = f_data + 4;
+	const unsigned int height = readU32(header + 8);
+	const unsigned int width = readU32(header + 12);
+	const unsigned int mip_count = (readU32(header + 4) & ddsd_mip_count) ? std::max(1u, readU32(header + 24)) : 1;
+	const unsigned char* pixel_format = header + 72;
+	const unsigned int pixel_flags = readU32(pixel_format + 4);
+	const unsigned int four_cc = readU32(pixel_format + 8);
+	if (readU32(header + 108) & (ddscaps2_cubemap | ddscaps2_volume))
+	{
+		return false;
+	}
+
+	size_t data_offset = 4 + dds_header_size;
+	bool found = false;
+	TextureFormat format = TextureFormat::RGBA8;
+	if ((pixel_flags & ddpf_four_cc) && four_cc == makeFourCC("DX10"))
+	{
+		if (f_size < data_offset + dx10_header_size)
+		{
+			return false;
+		}
+		const unsigned char* dx10 = f_data + data_offset;
+		const unsigned int array_size = readU32(dx10 + 12);
+		if (readU32(dx10 + 4) != d3d10_resource_dimension_texture2d || array_size > 1)
+		{
+			return false;
+		}
+		for (const DxgiMapping& mapping : dxgi_mappings)
+		{
+			if (mapping.dxgi_format == readU32(dx10))
+			{
+				format = mapping.format;
+				found = true;
+			}
+		}
+		data_offset += dx10_header_size;
+	}
+	else if (pixel_flags & ddpf_four_cc)
+	{
+		found = true;
+		if (four_cc == makeFourCC("DXT1")) format = TextureFormat::BC1;
+		else if (four_cc == makeFourCC("DXT5")) format = TextureFormat::BC3;
+		else if (four_cc == makeFourCC("ATI2") || four_cc == makeFourCC("BC5U")) format = TextureFormat::BC5;
+		else found = false;
+	}
+	else if ((pixel_flags & ddpf_rgb) && readU32(pixel_format + 12) == 32 && readU32(pixel_format + 16) == 0xff &&
+		readU32(pixel_format + 20) == 0xff00 && readU32(pixel_format + 24) == 0xff0000)
+	{
+		found = true;
+	}
+
+	if (!found || !allocate(format, width, height, mip_count) || getMipCount() != mip_count || f_size - data_offset < m_data.size())
+	{
+		m_mips.clear();
+		m_data.clear();
+		return false;
+	}
+	std::memcpy(m_data.data(), f_data + data_offset, m_data.size());
+	return true;
+}
+
+bool TextureData::loadFile(const char* f_file_name)
+{
+	std::ifstream file(f_file_name, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		return false;
+	}
+
+	const std::streamsize size = file.tellg();
+	file.seekg(0, std::ios::beg);
+	std::vector<unsigned char> contents(static_cast<size_t>(size));
+	if (!file.read(reinterpret_cast<char*>(contents.data()), size))
+	{
+		return false;
+	}
+	return load(contents.data(), contents.size());
+}
+
+bool TextureData::saveFile(const char* f_file_name) const
+{
+	if (m_mips.empty())
+	{
+		return false;
+	}
+
+	unsigned char header[4 + dds_header_size + dx10_header_size] = {};
+	unsigned char* dds = header + 4;
+	writeU32(header, dds_magic);
+	writeU32(dds, dds_header_size);
+	writeU32(dds + 4, ddsd_caps | ddsd_height | ddsd_width | ddsd_pixel_format | ddsd_mip_count |
+		(isCompressed(m_format) ? ddsd_linear_size : ddsd_pitch));
+	writeU32(dds + 8, getHeight());
+	writeU32(dds + 12, getWidth());
+	writeU32(dds + 16, isCompressed(m_format) ? static_cast<unsigned int>(m_mips[0].size) : m_mips[0].row_pitch);
+	writeU32(dds + 24, getMipCount());
+	writeU32(dds + 72, 32);
+	writeU32(dds + 76, ddpf_four_cc);
+	writeU32(dds + 80, makeFourCC("DX10"));
+	writeU32(dds + 104, ddscaps_texture | (getMipCount() > 1 ? ddscaps_complex | ddscaps_mipmap : 0));
+
+	unsigned char* dx10 = dds + dds_header_size;
+	writeU32(dx10, getDxgiFormat(m_format));
+	writeU32(dx10 + 4, d3d10_resource_dimension_texture2d);
+	writeU32(dx10 + 12, 1);
+
+	std::ofstream file(f_file_name, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(m_data.data()), static_cast<std::streamsize>(m_data.size()));
+	return static_cast<bool>(file);
+}
+
+TextureData::~TextureData()
+{
+}
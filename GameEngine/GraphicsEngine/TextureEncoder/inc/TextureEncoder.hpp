@@ -0,0 +1,166 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Mip chain generation and block compression
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Turn source images into GPU ready, block compressed mip chains.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the TextureEncoder class.
+/// @par Revision History:
+///      $Source: TextureEncoder.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/29 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _TEXTURE_ENCODER_HPP_
+#define _TEXTURE_ENCODER_HPP_
+
+#include "TextureData.hpp"
+#include <functional>
+
+/**
+ * @class TextureEncoder
+ * @brief Builds gamma-correct mip chains and encodes them to BC1, BC3, BC5 or BC7 on several threads.
+ *
+ * buildMipChain() filters every level from the previous one with a 2x2 box
+ * in linear space: sRGB colors are linearized through a table, averaged
+ * four channels at a time with SSE2 and converted back, so dark and bright
+ * texels mix as they do on screen; alpha is always linear. encode() splits
+ * every mip into rows of 4x4 blocks that the threads take in turn.
+ *
+ * The block encoders fit endpoints along the principal axis of the block
+ * colors and refine them once by least squares:
+ * - BC1: 4 color mode, alpha is ignored.
+ * - BC3: the BC1 colors plus a BC4 alpha block.
+ * - BC5: two BC4 blocks with red and green, for normal maps.
+ * - BC7: mode 6 only, one RGBA line with 16 levels, which is fast and
+ *   handles alpha; it is not the best BC7 can do on blocks with several
+ *   distinct colors.
+ * decodeBlock() reads what encodeBlock() writes, to measure the error; BC7
+ * blocks in other modes decode to zero.
+ *
+ * Example usage:
+ * @code
+ * TextureEncoder encoder(4);
+ * TextureData chain, compressed;
+ * encoder.buildMipChain(rgba_pixels, width, height, true, 0, chain);
+ * encoder.encode(chain, TextureFormat::BC7_SRGB, compressed);
+ * Texture* texture = GraphicsEngine::get()->createTexture(compressed);
+ * @endcode
+ */
+class TextureEncoder
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Timings of the last calls.
+	/// </summary>
+	struct Statistics
+	{
+		float mip_ms = 0.0f;
+		float encode_ms = 0.0f;
+		unsigned long long encoded_blocks = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	explicit TextureEncoder(unsigned int f_thread_count = 1);
+	~TextureEncoder();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Threads used by the calls, the caller included.
+	/// </summary>
+	void setThreadCount(unsigned int f_thread_count) { m_thread_count = f_thread_count ? f_thread_count : 1; }
+	unsigned int getThreadCount() const { return m_thread_count; }
+
+	/// <summary>
+	/// Copies an image into the first mip and filters the others from it.
+	/// </summary>
+	/// <param name="f_rgba">Tightly packed 8 bit RGBA rows.</param>
+	/// <param name="f_srgb">The colors are sRGB: filter them in linear space and mark the result RGBA8_SRGB.</param>
+	/// <param name="f_mip_count">Mips to build, 0 for the full chain.</param>
+	bool buildMipChain(const unsigned char* f_rgba, unsigned int f_width, unsigned int f_height, bool f_srgb, unsigned int f_mip_count,
+		TextureData& f_out);
+
+	/// <summary>
+	/// Compresses every mip of an RGBA8 or RGBA8_SRGB texture.
+	/// </summary>
+	/// <param name="f_format">A BC format; its sRGB flag replaces the source's.</param>
+	bool encode(const TextureData& f_source, TextureFormat f_format, TextureData& f_out);
+
+	/// <summary>
+	/// Expands a BC texture back to RGBA8, keeping the sRGB flag.
+	/// </summary>
+	bool decode(const TextureData& f_source, TextureData& f_out);
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/*--------------------------------------------------------------
+		Static Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Encodes 4x4 RGBA8 pixels, row by row, into one block of the format.
+	/// </summary>
+	static void encodeBlock(TextureFormat f_format, const unsigned char f_rgba[64], unsigned char* f_block);
+
+	/// <summary>
+	/// Decodes one block of the format into 4x4 RGBA8 pixels.
+	/// </summary>
+	static void decodeBlock(TextureFormat f_format, const unsigned char* f_block, unsigned char f_rgba[64]);
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Calls f_work(0) to f_work(f_count - 1) on the threads, each index once.
+	/// </summary>
+	void parallelFor(unsigned int f_count, const std::function<void(unsigned int)>& f_work) const;
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	unsigned int m_thread_count;
+	Statistics m_statistics;
+};
+
+#endif // !_TEXTURE_ENCODER_HPP_
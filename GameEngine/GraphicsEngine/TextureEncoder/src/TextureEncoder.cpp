@@ -0,0 +1,915 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Mip chain generation and block compression
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Turn source images into GPU ready, block compressed mip chains.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the TextureEncoder class.
+/// @par Revision History:
+///      $Source: TextureEncoder.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/05/29 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TextureEncoder.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TEXTURE_ENCODER_SSE2 1
+#endif
+
+namespace
+{
+	constexpr unsigned int linear_table_size = 16384;
+	const int bc7_weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	/// <summary>
+	/// sRGB to linear for every 8 bit value, and linear to sRGB finely enough to round like the exact curve.
+	/// </summary>
+	struct SrgbTables
+	{
+		float to_linear[256];
+		unsigned char from_linear[linear_table_size];
+
+		SrgbTables()
+		{
+			for (int i = 0; i < 256; ++i)
+			{
+				const float value = i / 255.0f;
+				to_linear[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+			}
+			for (unsigned int i = 0; i < linear_table_size; ++i)
+			{
+				const float value = static_cast<float>(i) / (linear_table_size - 1);
+				const float srgb = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+				from_linear[i] = static_cast<unsigned char>(std::min(255.0f, srgb * 255.0f + 0.5f));
+			}
+		}
+	};
+
+	const SrgbTables& getSrgbTables()
+	{
+		static const SrgbTables tables;
+		return tables;
+	}
+
+	double elapsedMs(std::chrono::steady_clock::time_point f_start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - f_start).count();
+	}
+
+	/*--------------------------------------------------------------
+		Endpoint fitting
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Ends of the segment along the principal axis of the pixels that covers them all.
+	/// </summary>
+	void fitLine(const float f_pixels[16][4], int f_channels, float f_start[4], float f_end[4])
+	{
+		float mean[4] = {};
+		for (int i = 0; i < 16; ++i)
+		{
+			for (int c = 0; c < f_channels; ++c)
+			{
+				mean[c] += f_pixels[i][c] / 16.0f;
+			}
+		}
+
+		float covariance[4][4] = {};
+		float low[4] = { 255, 255, 255, 255 }, high[4] = {};
+		for (int i = 0; i < 16; ++i)
+		{
+			for (int c = 0; c < f_channels; ++c)
+			{
+				low[c] = std::min(low[c], f_pixels[i][c]);
+				high[c] = std::max(high[c], f_pixels[i][c]);
+				for (int d = 0; d < f_channels; ++d)
+				{
+					covariance[c][d] += (f_pixels[i][c] - mean[c]) * (f_pixels[i][d] - mean[d]);
+				}
+			}
+		}
+
+		// Power iteration from the diagonal of the bounding box
+		float axis[4] = {};
+		for (int c = 0; c < f_channels; ++c)
+		{
+			axis[c] = high[c] - low[c];
+		}
+		for (int iteration = 0; iteration < 6; ++iteration)
+		{
+			float next[4] = {};
+			float length = 0.0f;
+			for (int c = 0; c < f_channels; ++c)
+			{
+				for (int d = 0; d < f_channels; ++d)
+				{
+					next[c] += covariance[c][d] * axis[d];
+				}
+				length = std::max(length, std::fabs(next[c]));
+			}
+			if (length <= 0.0f)
+			{
+				break;
+			}
+			for (int c = 0; c < f_channels; ++c)
+			{
+				axis[c] = next[c] / length;
+			}
+		}
+
+		float min_t = 0.0f, max_t = 0.0f, axis_length = 0.0f;
+		for (int c = 0; c < f_channels; ++c)
+		{
+			axis_length += axis[c] * axis[c];
+		}
+		if (axis_length > 0.0f)
+		{
+			min_t = 1e30f;
+			max_t = -1e30f;
+			for (int i = 0; i < 16; ++i)
+			{
+				float t = 0.0f;
+				for (int c = 0; c < f_channels; ++c)
+				{
+					t += (f_pixels[i][c] - mean[c]) * axis[c];
+				}
+				min_t = std::min(min_t, t / axis_length);
+				max_t = std::max(max_t, t / axis_length);
+			}
+		}
+		for (int c = 0; c < f_channels; ++c)
+		{
+			f_start[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * max_t));
+			f_end[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * min_t));
+		}
+	}
+
+	/// <summary>
+	/// Least squares endpoints for fixed indices; f_weights[i] is how much of the start pixel i takes.
+	/// </summary>
+	bool refineLine(const float f_pixels[16][4], int f_channels, const float f_weights[16], float f_start[4], float f_end[4])
+	{
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f, ax[4] = {}, bx[4] = {};
+		for (int i = 0; i < 16; ++i)
+		{
+			const float a = f_weights[i], b = 1.0f - a;
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (int c = 0; c < f_channels; ++c)
+			{
+				ax[c] += a * f_pixels[i][c];
+				bx[c] += b * f_pixels[i][c];
+			}
+		}
+		const float determinant = aa * bb - ab * ab;
+		if (std::fabs(determinant) < 1e-6f)
+		{
+			return false;
+		}
+		for (int c = 0; c < f_channels; ++c)
+		{
+			f_start[c] = std::min(255.0f, std::max(0.0f, (ax[c] * bb - bx[c] * ab) / determinant));
+			f_end[c] = std::min(255.0f, std::max(0.0f, (bx[c] * aa - ax[c] * ab) / determinant));
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Nearest entry of a palette stored channel by channel, f_count a multiple of 4.
+	/// </summary>
+	int findNearest(const float f_palette[4][16], int f_channels, int f_count, const float f_pixel[4], float& f_error)
+	{
+		float distances[16];
+#if TEXTURE_ENCODER_SSE2
+		for (int entry = 0; entry < f_count; entry += 4)
+		{
+			__m128 distance = _mm_setzero_ps();
+			for (int c = 0; c < f_channels; ++c)
+			{
+				const __m128 difference = _mm_sub_ps(_mm_loadu_ps(&f_palette[c][entry]), _mm_set1_ps(f_pixel[c]));
+				distance = _mm_add_ps(distance, _mm_mul_ps(difference, difference));
+			}
+			_mm_storeu_ps(distances + entry, distance);
+		}
+#else
+		for (int entry = 0; entry < f_count; ++entry)
+		{
+			distances[entry] = 0.0f;
+			for (int c = 0; c < f_channels; ++c)
+			{
+				const float difference = f_palette[c][entry] - f_pixel[c];
+				distances[entry] += difference * difference;
+			}
+		}
+#endif
+		int best = 0;
+		for (int entry = 1; entry < f_count; ++entry)
+		{
+			best = distances[entry] < distances[best] ? entry : best;
+		}
+		f_error += distances[best];
+		return best;
+	}
+
+	/*--------------------------------------------------------------
+		BC1 colors
+	--------------------------------------------------------------*/
+
+	unsigned int packColor565(const float f_color[4])
+	{
+		const unsigned int r = static_cast<unsigned int>(f_color[0] * 31.0f / 255.0f + 0.5f);
+		const unsigned int g = static_cast<unsigned int>(f_color[1] * 63.0f / 255.0f + 0.5f);
+		const unsigned int b = static_cast<unsigned int>(f_color[2] * 31.0f / 255.0f + 0.5f);
+		return r << 11 | g << 5 | b;
+	}
+
+	void unpackColor565(unsigned int f_color, int f_rgb[3])
+	{
+		const int r = (f_color >> 11) & 31, g = (f_color >> 5) & 63, b = f_color & 31;
+		f_rgb[0] = (r << 3) | (r >> 2);
+		f_rgb[1] = (g << 2) | (g >> 4);
+		f_rgb[2] = (b << 3) | (b >> 2);
+	}
+
+	/// <summary>
+	/// The four colors of a block; the 3 color mode when f_four_color is false and c0 <= c1.
+	/// </summary>
+	void getColorPalette(unsigned int f_c0, unsigned int f_c1, bool f_four_color, int f_palette[4][4])
+	{
+		int c0[3], c1[3];
+		unpackColor565(f_c0, c0);
+		unpackColor565(f_c1, c1);
+		for (int c = 0; c < 3; ++c)
+		{
+			f_palette[0][c] = c0[c];
+			f_palette[1][c] = c1[c];
+			if (f_four_color || f_c0 > f_c1)
+			{
+				f_palette[2][c] = (2 * c0[c] + c1[c]) / 3;
+				f_palette[3][c] = (c0[c] + 2 * c1[c]) / 3;
+			}
+			else
+			{
+				f_palette[2][c] = (c0[c] + c1[c]) / 2;
+				f_palette[3][c] = 0;
+			}
+		}
+		f_palette[0][3] = f_palette[1][3] = f_palette[2][3] = 255;
+		f_palette[3][3] = (f_four_color || f_c0 > f_c1) ? 255 : 0;
+	}
+
+	/// <summary>
+	/// Indices of the pixels for quantized endpoints, returns the squared error.
+	/// </summary>
+	float findColorIndices(const float f_pixels[16][4], unsigned int f_c0, unsigned int f_c1, int f_indices[16])
+	{
+		int palette[4][4];
+		getColorPalette(f_c0, f_c1, true, palette);
+		float channels[4][16] = {};
+		for (int entry = 0; entry < 4; ++entry)
+		{
+			for (int c = 0; c < 3; ++c)
+			{
+				channels[c][entry] = static_cast<float>(palette[entry][c]);
+			}
+		}
+		float error = 0.0f;
+		for (int i = 0; i < 16; ++i)
+		{
+			f_indices[i] = findNearest(channels, 3, 4, f_pixels[i], error);
+		}
+		return error;
+	}
+
+	/// <summary>
+	/// An 8 byte BC1 color block in 4 color mode.
+	/// </summary>
+	void encodeColorBlock(const unsigned char f_rgba[64], unsigned char* f_block)
+	{
+		float pixels[16][4];
+		for (int i = 0; i < 16; ++i)
+		{
+			for (int c = 0; c < 4; ++c)
+			{
+				pixels[i][c] = f_rgba[i * 4 + c];
+			}
+		}
+
+		float start[4], end[4];
+		fitLine(pixels, 3, start, end);
+		unsigned int c0 = packColor565(start), c1 = packColor565(end);
+		int indices[16];
+		float error = findColorIndices(pixels, c0, c1, indices);
+
+		static const float start_weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+		float weights[16];
+		for (int i = 0; i < 16; ++i)
+		{
+			weights[i] = start_weights[indices[i]];
+		}
+		if (refineLine(pixels, 3, weights, start, end))
+		{
+			const unsigned int refined_c0 = packColor565(start), refined_c1 = packColor565(end);
+			int refined_indices[16];
+			const float refined_error = findColorIndices(pixels, refined_c0, refined_c1, refined_indices);
+			if (refined_error < error)
+			{
+				c0 = refined_c0;
+				c1 = refined_c1;
+				std::memcpy(indices, refined_indices, sizeof(indices));
+			}
+		}
+
+		// The 4 color mode needs c0 > c1; equal endpoints give one color whatever the mode
+		if (c0 < c1)
+		{
+			std::swap(c0, c1);
+			static const int swapped[4] = { 1, 0, 3, 2 };
+			for (int& index : indices)
+			{
+				index = swapped[index];
+			}
+		}
+		unsigned int bits = 0;
+		for (int i = 0; i < 16; ++i)
+		{
+			bits |= static_cast<unsigned int>(c0 == c1 ? 0 : indices[i]) << (i * 2);
+		}
+		f_block[0] = static_cast<unsigned char>(c0);
+		f_block[1] = static_cast<unsigned char>(c0 >> 8);
+		f_block[2] = static_cast<unsigned char>(c1);
+		f_block[3] = static_cast<unsigned char>(c1 >> 8);
+		for (int i = 0; i < 4; ++i)
+		{
+			f_block[4 + i] = static_cast<unsigned char>(bits >> (i * 8));
+		}
+	}
+
+	void decodeColorBlock(const unsigned char* f_block, bool f_four_color, unsigned char f_rgba[64])
+	{
+		const unsigned int c0 = f_block[0] | f_block[1] << 8, c1 = f_block[2] | f_block[3] << 8;
+		const unsigned int bits = f_block[4] | f_block[5] << 8 | f_block[6] << 16 | static_cast<unsigned int>(f_block[7]) << 24;
+		int palette[4][4];
+		getColorPalette(c0, c1, f_four_color, palette);
+		for (int i = 0; i < 16; ++i)
+		{
+			const int index = (bits >> (i * 2)) & 3;
+			for (int c = 0; c < 4; ++c)
+			{
+				f_rgba[i * 4 + c] = static_cast<unsigned char>(palette[index][c]);
+			}
+		}
+	}
+
+	/*--------------------------------------------------------------
+		BC4 single channel
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// An 8 byte BC4 block of one channel, taken every 4 bytes from f_values.
+	/// </summary>
+	void encodeChannelBlock(const unsigned char* f_values, unsigned char* f_block)
+	{
+		int low = 255, high = 0;
+		for (int i = 0; i < 16; ++i)
+		{
+			low = std::min(low, static_cast<int>(f_values[i * 4]));
+			high = std::max(high, static_cast<int>(f_values[i * 4]));
+		}
+
+		// 8 value mode: index 0 is high, 1 is low, 2 to 7 step from high to low
+		unsigned long long bits = 0;
+		if (high > low)
+		{
+			int palette[8] = { high, low };
+			for (int k = 2; k < 8; ++k)
+			{
+				palette[k] = ((8 - k) * high + (k - 1) * low) / 7;
+			}
+			for (int i = 0; i < 16; ++i)
+			{
+				int best = 0;
+				for (int k = 1; k < 8; ++k)
+				{
+					best = std::abs(palette[k] - f_values[i * 4]) < std::abs(palette[best] - f_values[i * 4]) ? k : best;
+				}
+				bits |= static_cast<unsigned long long>(best) << (i * 3);
+			}
+		}
+		f_block[0] = static_cast<unsigned char>(high);
+		f_block[1] = static_cast<unsigned char>(low);
+		for (int i = 0; i < 6; ++i)
+		{
+			f_block[2 + i] = static_cast<unsigned char>(bits >> (i * 8));
+		}
+	}
+
+	void decodeChannelBlock(const unsigned char* f_block, unsigned char* f_values)
+	{
+		const int e0 = f_block[0], e1 = f_block[1];
+		int palette[8] = { e0, e1 };
+		for (int k = 2; k < 8; ++k)
+		{
+			if (e0 > e1)
+			{
+				palette[k] = ((8 - k) * e0 + (k - 1) * e1) / 7;
+			}
+			else
+			{
+				palette[k] = k < 6 ? ((6 - k) * e0 + (k - 1) * e1) / 5 : (k == 6 ? 0 : 255);
+			}
+		}
+		unsigned long long bits = 0;
+		for (int i = 0; i < 6; ++i)
+		{
+			bits |= static_cast<unsigned long long>(f_block[2 + i]) << (i * 8);
+		}
+		for (int i = 0; i < 16; ++i)
+		{
+			f_values[i * 4] = static_cast<unsigned char>(palette[(bits >> (i * 3)) & 7]);
+		}
+	}
+
+	/*--------------------------------------------------------------
+		BC7 mode 6
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// 7 bit endpoint and shared low bit closest to the color.
+	/// </summary>
+	void quantizeEndpoint(const float f_color[4], int f_quantized[4], int& f_p_bit)
+	{
+		float best_error = 1e30f;
+		for (int p = 0; p < 2; ++p)
+		{
+			int candidate[4];
+			float error = 0.0f;
+			for (int c = 0; c < 4; ++c)
+			{
+				candidate[c] = std::min(127, std::max(0, static_cast<int>((f_color[c] - p) * 0.5f + 0.5f)));
+				const float difference = static_cast<float>(candidate[c] << 1 | p) - f_color[c];
+				error += difference * difference;
+			}
+			if (error < best_error)
+			{
+				best_error = error;
+				f_p_bit = p;
+				std::memcpy(f_quantized, candidate, sizeof(candidate));
+			}
+		}
+	}
+
+	struct Bc7Endpoints
+	{
+		int start[4];
+		int end[4];
+		int start_p;
+		int end_p;
+	};
+
+	float findBc7Indices(const float f_pixels[16][4], const Bc7Endpoints& f_endpoints, int f_indices[16])
+	{
+		float palette[4][16];
+		for (int c = 0; c < 4; ++c)
+		{
+			const int start = f_endpoints.start[c] << 1 | f_endpoints.start_p;
+			const int end = f_endpoints.end[c] << 1 | f_endpoints.end_p;
+			for (int k = 0; k < 16; ++k)
+			{
+				palette[c][k] = static_cast<float>(((64 - bc7_weights[k]) * start + bc7_weights[k] * end + 32) >> 6);
+			}
+		}
+		float error = 0.0f;
+		for (int i = 0; i < 16; ++i)
+		{
+			f_indices[i] = findNearest(palette, 4, 16, f_pixels[i], error);
+		}
+		return error;
+	}
+
+	void writeBits(unsigned char* f_block, unsigned int& f_position, unsigned int f_value, unsigned int f_count)
+	{
+		for (unsigned int i = 0; i < f_count; ++i, ++f_position)
+		{
+			f_block[f_position >> 3] |= static_cast<unsigned char>(((f_value >> i) & 1) << (f_position & 7));
+		}
+	}
+
+	unsigned int readBits(const unsigned char* f_block, unsigned int& f_position, unsigned int f_count)
+	{
+		unsigned int value = 0;
+		for (unsigned int i = 0; i < f_count; ++i, ++f_position)
+		{
+			value |= static_cast<unsigned int>((f_block[f_position >> 3] >> (f_position & 7)) & 1) << i;
+		}
+		return value;
+	}
+
+	void encodeBc7Block(const unsigned char f_rgba[64], unsigned char* f_block)
+	{
+		float pixels[16][4];
+		for (int i = 0; i < 16; ++i)
+		{
+			for (int c = 0; c < 4; ++c)
+			{
+				pixels[i][c] = f_rgba[i * 4 + c];
+			}
+		}
+
+		float start[4], end[4];
+		fitLine(pixels, 4, start, end);
+		Bc7Endpoints endpoints;
+		quantizeEndpoint(start, endpoints.start, endpoints.start_p);
+		quantizeEndpoint(end, endpoints.end, endpoints.end_p);
+		int indices[16];
+		float error = findBc7Indices(pixels, endpoints, indices);
+
+		float weights[16];
+		for (int i = 0; i < 16; ++i)
+		{
+			weights[i] = (64 - bc7_weights[indices[i]]) / 64.0f;
+		}
+		if (refineLine(pixels, 4, weights, start, end))
+		{
+			Bc7Endpoints refined;
+			quantizeEndpoint(start, refined.start, refined.start_p);
+			quantizeEndpoint(end, refined.end, refined.end_p);
+			int refined_indices[16];
+			const float refined_error = findBc7Indices(pixels, refined, refined_indices);
+			if (refined_error < error)
+			{
+				endpoints = refined;
+				std::memcpy(indices, refined_indices, sizeof(indices));
+			}
+		}
+
+		// The anchor index is stored without its top bit, so pixel 0 must use the first half of the palette
+		if (indices[0] >= 8)
+		{
+			std::swap(endpoints.start, endpoints.end);
+			std::swap(endpoints.start_p, endpoints.end_p);
+			for (int& index : indices)
+			{
+				index = 15 - index;
+			}
+		}
+
+		std::memset(f_block, 0, 16);
+		unsigned int position = 0;
+		writeBits(f_block, position, 1u << 6, 7);
+		for (int c = 0; c < 4; ++c)
+		{
+			writeBits(f_block, position, static_cast<unsigned int>(endpoints.start[c]), 7);
+			writeBits(f_block, position, static_cast<unsigned int>(endpoints.end[c]), 7);
+		}
+		writeBits(f_block, position, static_cast<unsigned int>(endpoints.start_p), 1);
+		writeBits(f_block, position, static_cast<unsigned int>(endpoints.end_p), 1);
+		for (int i = 0; i < 16; ++i)
+		{
+			writeBits(f_block, position, static_cast<unsigned int>(indices[i]), i == 0 ? 3 : 4);
+		}
+	}
+
+	void decodeBc7Block(const unsigned char* f_block, unsigned char f_rgba[64])
+	{
+		if ((f_block[0] & 0x7f) != 0x40)
+		{
+			std::memset(f_rgba, 0, 64);
+			return;
+		}
+
+		unsigned int position = 7;
+		int start[4], end[4];
+		for (int c = 0; c < 4; ++c)
+		{
+			start[c] = static_cast<int>(readBits(f_block, position, 7)) << 1;
+			end[c] = static_cast<int>(readBits(f_block, position, 7)) << 1;
+		}
+		const int start_p = static_cast<int>(readBits(f_block, position, 1));
+		const int end_p = static_cast<int>(readBits(f_block, position, 1));
+		for (int i = 0; i < 16; ++i)
+		{
+			const int weight = bc7_weights[readBits(f_block, position, i == 0 ? 3 : 4)];
+			for (int c = 0; c < 4; ++c)
+			{
+				f_rgba[i * 4 + c] = static_cast<unsigned char>(((64 - weight) * (start[c] | start_p) + weight * (end[c] | end_p) + 32) >> 6);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Copies the 4x4 pixels of a block, repeating the last row and column past the edges.
+	/// </summary>
+	void readBlock(const unsigned char* f_pixels, const TextureMip& f_mip, unsigned int f_block_x, unsigned int f_block_y, unsigned char f_rgba[64])
+	{
+		for (unsigned int y = 0; y < 4; ++y)
+		{
+			const unsigned int source_y = std::min(f_block_y * 4 + y, f_mip.height - 1);
+			for (unsigned int x = 0; x < 4; ++x)
+			{
+				const unsigned int source_x = std::min(f_block_x * 4 + x, f_mip.width - 1);
+				std::memcpy(f_rgba + (y * 4 + x) * 4, f_pixels + static_cast<size_t>(source_y) * f_mip.row_pitch + source_x * 4, 4);
+			}
+		}
+	}
+
+	TextureFormat withSrgb(TextureFormat f_format, bool f_srgb)
+	{
+		switch (f_format)
+		{
+		case TextureFormat::RGBA8:
+		case TextureFormat::RGBA8_SRGB:
+			return f_srgb ? TextureFormat::RGBA8_SRGB : TextureFormat::RGBA8;
+		case TextureFormat::BC1:
+		case TextureFormat::BC1_SRGB:
+			return f_srgb ? TextureFormat::BC1_SRGB : TextureFormat::BC1;
+		case TextureFormat::BC3:
+		case TextureFormat::BC3_SRGB:
+			return f_srgb ? TextureFormat::BC3_SRGB : TextureFormat::BC3;
+		case TextureFormat::BC7:
+		case TextureFormat::BC7_SRGB:
+			return f_srgb ? TextureFormat::BC7_SRGB : TextureFormat::BC7;
+		default:
+			return f_format;
+		}
+	}
+}
+
+TextureEncoder::TextureEncoder(unsigned int f_thread_count) : m_thread_count(f_thread_count ? f_thread_count : 1)
+{
+}
+
+void TextureEncoder::parallelFor(unsigned int f_count, const std::function<void(unsigned int)>& f_work) const
+{
+	std::atomic<unsigned int> next(0);
+	auto work = [&next, &f_work, f_count]()
+	{
+		for (unsigned int index = next++; index < f_count; index = next++)
+		{
+			f_work(index);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (unsigned int i = 1; i < std::min(m_thread_count, f_count); ++i)
+	{
+		threads.emplace_back(work);
+	}
+	work();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
+
+bool TextureEncoder::buildMipChain(const unsigned char* f_rgba, unsigned int f_width, unsigned int f_height, bool f_srgb, unsigned int f_mip_count,
+	TextureData& f_out)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if (!f_rgba || !f_out.allocate(f_srgb ? TextureFormat::RGBA8_SRGB : TextureFormat::RGBA8, f_width, f_height, f_mip_count))
+	{
+		return false;
+	}
+	std::memcpy(f_out.getMipData(0), f_rgba, f_out.getMip(0).size);
+
+	const SrgbTables& tables = getSrgbTables();
+	float to_linear[256];
+	for (int i = 0; i < 256; ++i)
+	{
+		to_linear[i] = f_srgb ? tables.to_linear[i] : i / 255.0f;
+	}
+
+	for (unsigned int mip = 1; mip < f_out.getMipCount(); ++mip)
+	{
+		const TextureMip& source_mip = f_out.getMip(mip - 1);
+		const TextureMip& mip_info = f_out.getMip(mip);
+		const unsigned char* source = f_out.getMipData(mip - 1);
+		unsigned char* destination = f_out.getMipData(mip);
+
+		parallelFor(mip_info.height, [&](unsigned int f_y)
+		{
+			const unsigned char* rows[2] =
+			{
+				source + static_cast<size_t>(std::min(f_y * 2, source_mip.height - 1)) * source_mip.row_pitch,
+				source + static_cast<size_t>(std::min(f_y * 2 + 1, source_mip.height - 1)) * source_mip.row_pitch
+			};
+			unsigned char* out = destination + static_cast<size_t>(f_y) * mip_info.row_pitch;
+
+			for (unsigned int x = 0; x < mip_info.width; ++x)
+			{
+				const unsigned int columns[2] = { std::min(x * 2, source_mip.width - 1) * 4, std::min(x * 2 + 1, source_mip.width - 1) * 4 };
+#if TEXTURE_ENCODER_SSE2
+				__m128 sum = _mm_setzero_ps();
+				for (const unsigned char* row : rows)
+				{
+					for (unsigned int column : columns)
+					{
+						const unsigned char* pixel = row + column;
+						sum = _mm_add_ps(sum, _mm_setr_ps(to_linear[pixel[0]], to_linear[pixel[1]], to_linear[pixel[2]], pixel[3] / 255.0f));
+					}
+				}
+				const __m128 average = _mm_min_ps(_mm_max_ps(_mm_mul_ps(sum, _mm_set1_ps(0.25f)), _mm_setzero_ps()), _mm_set1_ps(1.0f));
+				alignas(16) int linear_index[4], rounded[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(linear_index), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(average,
+					_mm_set1_ps(static_cast<float>(linear_table_size - 1))), _mm_set1_ps(0.5f))));
+				_mm_store_si128(reinterpret_cast<__m128i*>(rounded), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(average, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f))));
+				for (int c = 0; c < 4; ++c)
+				{
+					out[x * 4 + c] = static_cast<unsigned char>(f_srgb && c < 3 ? tables.from_linear[linear_index[c]] : rounded[c]);
+				}
+#else
+				for (int c = 0; c < 4; ++c)
+				{
+					float sum = 0.0f;
+					for (const unsigned char* row : rows)
+					{
+						for (unsigned int column : columns)
+						{
+							sum += c < 3 ? to_linear[row[column + c]] : row[column + c] / 255.0f;
+						}
+					}
+					const float average = std::min(std::max(sum * 0.25f, 0.0f), 1.0f);
+					out[x * 4 + c] = static_cast<unsigned char>(f_srgb && c < 3 ?
+						tables.from_linear[static_cast<int>(average * (linear_table_size - 1) + 0.5f)] : static_cast<int>(average * 255.0f + 0.5f));
+				}
+#endif
+			}
+		});
+	}
+
+	m_statistics.mip_ms = static_cast<float>(elapsedMs(start));
+	return true;
+}
+
+bool TextureEncoder::encode(const TextureData& f_source, TextureFormat f_format, TextureData& f_out)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if (TextureData::isCompressed(f_source.getFormat()) || !TextureData::isCompressed(f_format) ||
+		!f_out.allocate(f_format, f_source.getWidth(), f_source.getHeight(), f_source.getMipCount()))
+	{
+		return false;
+	}
+
+	// One work item per row of blocks of every mip
+	std::vector<std::pair<unsigned int, unsigned int>> rows;
+	unsigned long long block_count = 0;
+	for (unsigned int mip = 0; mip < f_out.getMipCount(); ++mip)
+	{
+		for (unsigned int row = 0; row < f_out.getMip(mip).row_count; ++row)
+		{
+			rows.emplace_back(mip, row);
+		}
+		block_count += static_cast<unsigned long long>(f_out.getMip(mip).row_count) * (f_out.getMip(mip).row_pitch / TextureData::getBlockBytes(f_format));
+	}
+
+	const unsigned int block_bytes = TextureData::getBlockBytes(f_format);
+	parallelFor(static_cast<unsigned int>(rows.size()), [&](unsigned int f_item)
+	{
+		const unsigned int mip = rows[f_item].first, block_y = rows[f_item].second;
+		const TextureMip& source_mip = f_source.getMip(mip);
+		unsigned char* out = f_out.getMipData(mip) + static_cast<size_t>(block_y) * f_out.getMip(mip).row_pitch;
+		unsigned char rgba[64];
+		for (unsigned int block_x = 0; block_x < (source_mip.width + 3) / 4; ++block_x)
+		{
+			readBlock(f_source.getMipData(mip), source_mip, block_x, block_y, rgba);
+			encodeBlock(f_format, rgba, out + block_x * block_bytes);
+		}
+	});
+
+	m_statistics.encoded_blocks = block_count;
+	m_statistics.encode_ms = static_cast<float>(elapsedMs(start));
+	return true;
+}
+
+bool TextureEncoder::decode(const TextureData& f_source, TextureData& f_out)
+{
+	const TextureFormat format = f_source.getFormat();
+	if (!TextureData::isCompressed(format) ||
+		!f_out.allocate(withSrgb(TextureFormat::RGBA8, TextureData::isSrgb(format)), f_source.getWidth(), f_source.getHeight(), f_source.getMipCount()))
+	{
+		return false;
+	}
+
+	const unsigned int block_bytes = TextureData::getBlockBytes(format);
+	for (unsigned int mip = 0; mip < f_out.getMipCount(); ++mip)
+	{
+		const TextureMip& mip_info = f_out.getMip(mip);
+		const TextureMip& source_mip = f_source.getMip(mip);
+		parallelFor(source_mip.row_count, [&](unsigned int f_block_y)
+		{
+			unsigned char rgba[64];
+			for (unsigned int block_x = 0; block_x < (mip_info.width + 3) / 4; ++block_x)
+			{
+				decodeBlock(format, f_source.getMipData(mip) + static_cast<size_t>(f_block_y) * source_mip.row_pitch + block_x * block_bytes, rgba);
+				for (unsigned int y = 0; y < 4 && f_block_y * 4 + y < mip_info.height; ++y)
+				{
+					const unsigned int width = std::min(4u, mip_info.width - block_x * 4);
+					std::memcpy(f_out.getMipData(mip) + static_cast<size_t>(f_block_y * 4 + y) * mip_info.row_pitch + block_x * 16, rgba + y * 16, width * 4);
+				}
+			}
+		});
+	}
+	return true;
+}
+
+void TextureEncoder::encodeBlock(TextureFormat f_format, const unsigned char f_rgba[64], unsigned char* f_block)
+{
+	switch (f_format)
+	{
+	case TextureFormat::BC1:
+	case TextureFormat::BC1_SRGB:
+		encodeColorBlock(f_rgba, f_block);
+		break;
+	case TextureFormat::BC3:
+	case TextureFormat::BC3_SRGB:
+		encodeChannelBlock(f_rgba + 3, f_block);
+		encodeColorBlock(f_rgba, f_block + 8);
+		break;
+	case TextureFormat::BC5:
+		encodeChannelBlock(f_rgba, f_block);
+		encodeChannelBlock(f_rgba + 1, f_block + 8);
+		break;
+	case TextureFormat::BC7:
+	case TextureFormat::BC7_SRGB:
+		encodeBc7Block(f_rgba, f_block);
+		break;
+	default:
+		std::memcpy(f_block, f_rgba, 4);
+		break;
+	}
+}
+
+void TextureEncoder::decodeBlock(TextureFormat f_format, const unsigned char* f_block, unsigned char f_rgba[64])
+{
+	switch (f_format)
+	{
+	case TextureFormat::BC1:
+	case TextureFormat::BC1_SRGB:
+		decodeColorBlock(f_block, false, f_rgba);
+		break;
+	case TextureFormat::BC3:
+	case TextureFormat::BC3_SRGB:
+		decodeColorBlock(f_block + 8, true, f_rgba);
+		decodeChannelBlock(f_block, f_rgba + 3);
+		break;
+	case TextureFormat::BC5:
+		std::memset(f_rgba, 0, 64);
+		decodeChannelBlock(f_block, f_rgba);
+		decodeChannelBlock(f_block + 8, f_rgba + 1);
+		for (int i = 0; i < 16; ++i)
+		{
+			f_rgba[i * 4 + 3] = 255;
+		}
+		break;
+	case TextureFormat::BC7:
+	case TextureFormat::BC7_SRGB:
+		decodeBc7Block(f_block, f_rgba);
+		break;
+	default:
+		for (int i = 0; i < 16; ++i)
+		{
+			std::memcpy(f_rgba + i * 4, f_block, 4);
+		}
+		break;
+	}
+}
+
+TextureEncoder::~TextureEncoder()
+{
+}
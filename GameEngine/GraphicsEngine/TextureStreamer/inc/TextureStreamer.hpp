@@ -0,0 +1,355 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Budgeted mip streaming of textures
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Only update() and the public methods touch the texture states, on the
+//    calling thread; the I/O threads only see requests and completions.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep only the mips the camera needs in video memory.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the TextureStreamer class.
+/// @par Revision History:
+///      $Source: TextureStreamer.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/01 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _TEXTURE_STREAMER_HPP_
+#define _TEXTURE_STREAMER_HPP_
+
+#include "TextureData.hpp"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Configuration of a TextureStreamer.
+/// </summary>
+struct TextureStreamerSettings
+{
+	unsigned long long budget_bytes = 256ull << 20;   // Resident mips plus the loads in flight
+	unsigned int tail_size = 64;                      // Mips of at most this size per side are never streamed
+	unsigned int io_threads = 2;                      // 0 runs the loads inside update(), for tools and tests
+	unsigned int max_inflight_loads = 64;             // Loads handed to the I/O threads at once
+	unsigned long long max_inflight_bytes = 32ull << 20; // Bytes of those loads; one larger mip may still go alone
+	float mip_bias = 0.0f;                            // Positive values stream coarser mips
+};
+
+/// <summary>
+/// A texture whose first resident mip changed during update().
+/// </summary>
+struct TextureResidencyChange
+{
+	unsigned int texture = 0;
+	unsigned int first_mip = 0;
+	unsigned int previous_first_mip = 0;
+
+	/// <summary>
+	/// When mips were loaded, the data of mips first_mip to previous_first_mip - 1
+	/// laid out as TextureData::getMipLayout() describes; empty for evictions.
+	/// Valid until the next update().
+	/// </summary>
+	std::vector<const unsigned char*> mip_data;
+};
+
+/**
+ * @class TextureStreamer
+ * @brief Decides which mips of each texture are resident under a memory budget and loads them asynchronously.
+ *
+ * Each frame the caller reports how large every visible texture appears on
+ * screen. update() turns that into the mip each texture needs and solves the
+ * residency under the budget greedily: the mip steps of all textures are
+ * taken in order of how undersampled they would leave their texture, so a
+ * tight budget sharpens the closest textures first and degrades everything
+ * evenly instead of dropping whole textures. Mips nobody needs right now
+ * stay resident while the budget has room and are evicted first.
+ *
+ * Missing mips are loaded coarse to fine, most undersampled first, by the
+ * load function on the I/O threads. Only max_inflight_loads, and at most
+ * max_inflight_bytes, are handed out at once so later updates can still
+ * reorder and drop the rest, and a load only starts
+ * when the resident bytes plus every load in flight fit the budget. The
+ * streamer never touches the GPU: update() returns the residency changes and
+ * the caller applies them, e.g. with StreamingTexture::setFirstMip().
+ *
+ * Example usage:
+ * @code
+ * streamer.start(settings, [&](unsigned int f_texture, unsigned int f_mip, std::vector<unsigned char>& f_data)
+ * {
+ *     return package.readMip(files[f_texture], f_mip, f_data);   // on an I/O thread
+ * });
+ * unsigned int rock = streamer.registerTexture(TextureFormat::BC7_SRGB, 2048, 2048);
+ * // every frame
+ * streamer.reportUsage(rock, TextureStreamer::getProjectedSize(4.0f, distance, projection[1][1], viewport_height));
+ * for (const TextureResidencyChange& change : streamer.update())
+ * {
+ *     textures[change.texture]->setFirstMip(device_context, change.first_mip, change.mip_data.data());
+ * }
+ * @endcode
+ */
+class TextureStreamer
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Fills f_data with one mip of a texture; called on the I/O threads, so it must be thread safe.
+	/// </summary>
+	/// <returns>False if the mip cannot be read; the texture then stays at coarser mips.</returns>
+	using LoadFunction = std::function<bool(unsigned int f_texture, unsigned int f_mip, std::vector<unsigned char>& f_data)>;
+
+	/// <summary>
+	/// State after the last update(); the load counters are totals since start().
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int texture_count = 0;
+		unsigned int visible_textures = 0;      // Textures reported since the previous update()
+		unsigned int missing_mips = 0;          // Mip levels the visible textures lack to be sharp
+		unsigned int inflight_loads = 0;
+		unsigned long long resident_bytes = 0;
+		unsigned long long pending_bytes = 0;   // Loads in flight or waiting for their coarser mip
+		unsigned long long wanted_bytes = 0;    // What the visible textures would need without a budget
+		unsigned long long loads_started = 0;
+		unsigned long long loads_completed = 0;
+		unsigned long long loads_discarded = 0; // Finished after the mip was no longer wanted
+		unsigned long long loads_failed = 0;
+		unsigned long long evicted_mips = 0;
+		double update_ms = 0.0;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	TextureStreamer();
+	TextureStreamer(const TextureStreamer&) = delete;
+	TextureStreamer& operator=(const TextureStreamer&) = delete;
+	~TextureStreamer();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Starts the I/O threads; stops a previous run and forgets its textures first.
+	/// </summary>
+	/// <returns>False if there is no load function or the budget is 0.</returns>
+	bool start(const TextureStreamerSettings& f_settings, const LoadFunction& f_load);
+
+	/// <summary>
+	/// Waits for the loads in flight, stops the I/O threads and forgets the textures.
+	/// </summary>
+	void stop();
+
+	/// <summary>
+	/// Adds a texture whose tail, the mips from getTailMip() on, the caller made resident.
+	/// </summary>
+	/// <returns>The texture id used by every other method, counting up from 0.</returns>
+	unsigned int registerTexture(TextureFormat f_format, unsigned int f_width, unsigned int f_height);
+
+	/// <summary>
+	/// Reports a use of the texture this frame; the largest one of the frame counts.
+	/// </summary>
+	/// <param name="f_screen_size">Pixels the whole texture spans on screen along its larger side.</param>
+	void reportUsage(unsigned int f_texture, float f_screen_size)
+	{
+		TextureState& texture = m_textures[f_texture];
+		if (f_screen_size > texture.screen_size) texture.screen_size = f_screen_size;
+	}
+
+	/// <summary>
+	/// Completes the finished loads, solves the residency, evicts and starts new loads.
+	/// </summary>
+	/// <returns>The textures whose resident mips changed, valid until the next update().</returns>
+	const std::vector<TextureResidencyChange>& update();
+
+	/// <summary>
+	/// Changes the budget; the next update() evicts down to it.
+	/// </summary>
+	void setBudget(unsigned long long f_budget_bytes) { m_settings.budget_bytes = f_budget_bytes; }
+
+	unsigned int getTextureCount() const { return static_cast<unsigned int>(m_textures.size()); }
+	unsigned int getMipCount(unsigned int f_texture) const { return m_textures[f_texture].mip_count; }
+	unsigned int getTailMip(unsigned int f_texture) const { return m_textures[f_texture].tail_mip; }
+	unsigned int getFirstResidentMip(unsigned int f_texture) const { return m_textures[f_texture].resident_mip; }
+
+	/// <summary>
+	/// The mip the last reported usage asked for, or the tail mip if the texture was not used.
+	/// </summary>
+	unsigned int getWantedMip(unsigned int f_texture) const { return m_textures[f_texture].wanted_mip; }
+
+	/// <summary>
+	/// The first mip the last update() decided to keep resident under the budget.
+	/// </summary>
+	unsigned int getTargetMip(unsigned int f_texture) const { return m_textures[f_texture].target_mip; }
+
+	unsigned long long getMipBytes(unsigned int f_texture, unsigned int f_mip) const { return m_textures[f_texture].mip_bytes[f_mip]; }
+
+	const TextureStreamerSettings& getSettings() const { return m_settings; }
+
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/*--------------------------------------------------------------
+		Static Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Pixels an object of f_world_size spans at f_distance from a perspective camera.
+	/// </summary>
+	/// <param name="f_projection_scale">Element [1][1] of the projection matrix, 1 / tan(fov_y / 2).</param>
+	static float getProjectedSize(float f_world_size, float f_distance, float f_projection_scale, float f_viewport_height);
+
+	/// <summary>
+	/// The coarsest mip that still has a texel per screen pixel when the texture spans f_screen_size pixels.
+	/// </summary>
+	static unsigned int getRequiredMip(unsigned int f_width, unsigned int f_height, float f_screen_size, float f_mip_bias);
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	static constexpr unsigned int max_mips = 16;
+
+	struct TextureState
+	{
+		unsigned int width = 0;
+		unsigned int height = 0;
+		unsigned int mip_count = 0;
+		unsigned int tail_mip = 0;
+		unsigned int resident_mip = 0;
+		unsigned int wanted_mip = 0;
+		unsigned int target_mip = 0;
+		unsigned int finest_mip = 0;       // Raised past mips that failed to load
+		unsigned int pending_mask = 0;     // Mips in flight or loaded, one bit per mip
+		float screen_size = 0.0f;
+		unsigned long long last_use = 0;   // update() count when the texture was last reported
+		unsigned long long mip_bytes[max_mips] = {};
+		std::vector<std::vector<unsigned char>> loaded;
+	};
+
+	struct LoadRequest
+	{
+		unsigned int texture = 0;
+		unsigned int mip = 0;
+		float priority = 0.0f;
+	};
+
+	struct LoadResult
+	{
+		unsigned int texture = 0;
+		unsigned int mip = 0;
+		bool loaded = false;
+		std::vector<unsigned char> data;
+	};
+
+	/// <summary>
+	/// One mip step of the residency solver: making f_mip resident for the texture.
+	/// </summary>
+	struct Step
+	{
+		float priority = 0.0f;
+		unsigned int texture = 0;
+		unsigned int mip = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Takes the finished loads and commits every texture whose next mip arrived.
+	/// </summary>
+	void completeLoads();
+
+	/// <summary>
+	/// Sets the wanted and target mip of every texture.
+	/// </summary>
+	void solveResidency();
+
+	/// <summary>
+	/// Priority of making f_mip resident; positive when a reported use needs it.
+	/// </summary>
+	float getStepPriority(const TextureState& f_texture, unsigned int f_mip) const;
+
+	void evict();
+	void scheduleLoads();
+
+	/// <summary>
+	/// Runs the loads handed out by scheduleLoads() when there are no I/O threads.
+	/// </summary>
+	void runLoadsInline();
+
+	LoadResult load(const LoadRequest& f_request) const;
+
+	/// <summary>
+	/// Body of the I/O threads.
+	/// </summary>
+	void run();
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	TextureStreamerSettings m_settings;
+	LoadFunction m_load;
+	std::vector<TextureState> m_textures;
+	unsigned long long m_update_count;
+	unsigned long long m_tail_bytes;
+	unsigned long long m_resident_bytes;
+	unsigned long long m_pending_bytes;
+	unsigned long long m_inflight_bytes;
+	unsigned int m_inflight_loads;
+
+	// Reused every update() so steady frames do not allocate
+	std::vector<Step> m_steps;
+	std::vector<LoadRequest> m_candidates;
+	std::vector<LoadResult> m_finished;
+	std::vector<TextureResidencyChange> m_changes;
+	std::vector<std::vector<unsigned char>> m_committed;
+
+	// Shared with the I/O threads
+	std::deque<LoadRequest> m_requests;
+	std::vector<LoadResult> m_results;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::vector<std::thread> m_workers;
+	bool m_stopping;
+
+	Statistics m_statistics;
+};
+
+#endif // !_TEXTURE_STREAMER_HPP_
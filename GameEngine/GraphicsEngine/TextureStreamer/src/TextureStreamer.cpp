@@ -0,0 +1,483 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Budgeted mip streaming of textures
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep only the mips the camera needs in video memory.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the TextureStreamer class.
+/// @par Revision History:
+///      $Source: TextureStreamer.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/01 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TextureStreamer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+TextureStreamer::TextureStreamer()
+	: m_update_count(0), m_tail_bytes(0), m_resident_bytes(0), m_pending_bytes(0), m_inflight_bytes(0), m_inflight_loads(0), m_stopping(false)
+{
+}
+
+bool TextureStreamer::start(const TextureStreamerSettings& f_settings, const LoadFunction& f_load)
+{
+	stop();
+	if (!f_load || f_settings.budget_bytes == 0)
+	{
+		return false;
+	}
+
+	m_settings = f_settings;
+	m_settings.max_inflight_loads = std::max(1u, m_settings.max_inflight_loads);
+	m_load = f_load;
+	m_statistics = Statistics();
+	m_stopping = false;
+	for (unsigned int i = 0; i < m_settings.io_threads; ++i)
+	{
+		m_workers.emplace_back(&TextureStreamer::run, this);
+	}
+	return true;
+}
+
+void TextureStreamer::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+		m_requests.clear();
+	}
+	m_condition.notify_all();
+	for (std::thread& worker : m_workers)
+	{
+		worker.join();
+	}
+	m_workers.clear();
+
+	m_results.clear();
+	m_textures.clear();
+	m_changes.clear();
+	m_committed.clear();
+	m_update_count = 0;
+	m_tail_bytes = 0;
+	m_resident_bytes = 0;
+	m_pending_bytes = 0;
+	m_inflight_bytes = 0;
+	m_inflight_loads = 0;
+}
+
+unsigned int TextureStreamer::registerTexture(TextureFormat f_format, unsigned int f_width, unsigned int f_height)
+{
+	TextureState texture;
+	texture.width = std::max(1u, f_width);
+	texture.height = std::max(1u, f_height);
+	texture.mip_count = std::min(TextureData::getFullMipCount(texture.width, texture.height), max_mips);
+	while (texture.tail_mip + 1 < texture.mip_count &&
+		std::max(texture.width >> texture.tail_mip, texture.height >> texture.tail_mip) > m_settings.tail_size)
+	{
+		texture.tail_mip++;
+	}
+	texture.resident_mip = texture.tail_mip;
+	texture.wanted_mip = texture.tail_mip;
+	texture.target_mip = texture.tail_mip;
+	texture.loaded.resize(texture.tail_mip);
+
+	for (unsigned int mip = 0; mip < texture.mip_count; ++mip)
+	{
+		texture.mip_bytes[mip] = TextureData::getMipLayout(f_format, texture.width, texture.height, mip).size;
+		if (mip >= texture.tail_mip)
+		{
+			m_tail_bytes += texture.mip_bytes[mip];
+			m_resident_bytes += texture.mip_bytes[mip];
+		}
+	}
+
+	m_textures.push_back(std::move(texture));
+	return static_cast<unsigned int>(m_textures.size() - 1);
+}
+
+const std::vector<TextureResidencyChange>& TextureStreamer::update()
+{
+	const auto start = std::chrono::steady_clock::now();
+	m_changes.clear();
+	m_committed.clear();
+
+	completeLoads();
+	solveResidency();
+	evict();
+	scheduleLoads();
+
+	m_statistics.texture_count = static_cast<unsigned int>(m_textures.size());
+	m_statistics.visible_textures = 0;
+	m_statistics.missing_mips = 0;
+	m_statistics.wanted_bytes = m_tail_bytes;
+	for (TextureState& texture : m_textures)
+	{
+		if (texture.last_use == m_update_count)
+		{
+			m_statistics.visible_textures++;
+			if (texture.resident_mip > texture.wanted_mip)
+			{
+				m_statistics.missing_mips += texture.resident_mip - texture.wanted_mip;
+			}
+			for (unsigned int mip = texture.wanted_mip; mip < texture.tail_mip; ++mip)
+			{
+				m_statistics.wanted_bytes += texture.mip_bytes[mip];
+			}
+		}
+		texture.screen_size = 0.0f;
+	}
+	m_statistics.inflight_loads = m_inflight_loads;
+	m_statistics.resident_bytes = m_resident_bytes;
+	m_statistics.pending_bytes = m_pending_bytes;
+
+	m_update_count++;
+	m_statistics.update_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	if (m_workers.empty())
+	{
+		runLoadsInline();
+	}
+	return m_changes;
+}
+
+void TextureStreamer::completeLoads()
+{
+	m_finished.clear();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_finished.swap(m_results);
+	}
+
+	for (LoadResult& result : m_finished)
+	{
+		TextureState& texture = m_textures[result.texture];
+		const unsigned long long bytes = texture.mip_bytes[result.mip];
+		m_inflight_loads--;
+		m_inflight_bytes -= bytes;
+
+		if (!result.loaded || result.data.size() != bytes)
+		{
+			// Stop asking for this mip and everything finer; evict() drops the finer mips already loaded
+			texture.finest_mip = std::max(texture.finest_mip, result.mip + 1);
+			m_statistics.loads_failed++;
+		}
+		else if (result.mip < texture.target_mip || result.mip >= texture.resident_mip)
+		{
+			m_statistics.loads_discarded++;
+		}
+		else
+		{
+			texture.loaded[result.mip] = std::move(result.data);
+			m_statistics.loads_completed++;
+			continue;
+		}
+		texture.pending_mask &= ~(1u << result.mip);
+		m_pending_bytes -= bytes;
+	}
+
+	// A mip becomes resident once every coarser one is, which may take several loads
+	for (const LoadResult& result : m_finished)
+	{
+		TextureState& texture = m_textures[result.texture];
+		unsigned int first_mip = texture.resident_mip;
+		while (first_mip > 0 && !texture.loaded[first_mip - 1].empty())
+		{
+			first_mip--;
+		}
+		if (first_mip == texture.resident_mip)
+		{
+			continue;
+		}
+
+		TextureResidencyChange change;
+		change.texture = result.texture;
+		change.first_mip = first_mip;
+		change.previous_first_mip = texture.resident_mip;
+		for (unsigned int mip = first_mip; mip < texture.resident_mip; ++mip)
+		{
+			// Moving a vector keeps its buffer, so the pointer survives m_committed growing
+			m_committed.push_back(std::move(texture.loaded[mip]));
+			texture.loaded[mip].clear();
+			change.mip_data.push_back(m_committed.back().data());
+			texture.pending_mask &= ~(1u << mip);
+			m_pending_bytes -= texture.mip_bytes[mip];
+			m_resident_bytes += texture.mip_bytes[mip];
+		}
+		texture.resident_mip = first_mip;
+		m_changes.push_back(std::move(change));
+	}
+}
+
+float TextureStreamer::getStepPriority(const TextureState& f_texture, unsigned int f_mip) const
+{
+	if (f_mip < f_texture.finest_mip)
+	{
+		return 0.0f;
+	}
+	if (f_mip >= f_texture.wanted_mip && f_texture.last_use == m_update_count)
+	{
+		// Screen pixels per texel the texture would have without this mip
+		const unsigned int size = std::max(1u, std::max(f_texture.width >> f_mip, f_texture.height >> f_mip));
+		return f_texture.screen_size / static_cast<float>(size);
+	}
+	if (f_mip >= f_texture.resident_mip)
+	{
+		// Not needed, only kept while the budget has room; the longest unused goes first
+		return -1.0f - static_cast<float>(m_update_count - f_texture.last_use);
+	}
+	return 0.0f;
+}
+
+void TextureStreamer::solveResidency()
+{
+	const auto lower_priority = [](const Step& f_a, const Step& f_b) { return f_a.priority < f_b.priority; };
+
+	m_steps.clear();
+	for (unsigned int i = 0; i < m_textures.size(); ++i)
+	{
+		TextureState& texture = m_textures[i];
+		if (texture.screen_size > 0.0f)
+		{
+			texture.last_use = m_update_count;
+			texture.wanted_mip = std::min(std::max(getRequiredMip(texture.width, texture.height, texture.screen_size, m_settings.mip_bias),
+				texture.finest_mip), texture.tail_mip);
+		}
+		else
+		{
+			texture.wanted_mip = texture.tail_mip;
+		}
+		texture.target_mip = texture.tail_mip;
+
+		if (texture.tail_mip > 0)
+		{
+			const float priority = getStepPriority(texture, texture.tail_mip - 1);
+			if (priority != 0.0f)
+			{
+				m_steps.push_back({ priority, i, texture.tail_mip - 1 });
+			}
+		}
+	}
+	std::make_heap(m_steps.begin(), m_steps.end(), lower_priority);
+
+	// Priorities only fall towards the finer mips of a texture, so taking the best step
+	// of any texture and then offering its next one fills the budget in priority order
+	unsigned long long budget_left = m_settings.budget_bytes > m_tail_bytes ? m_settings.budget_bytes - m_tail_bytes : 0;
+	while (!m_steps.empty())
+	{
+		std::pop_heap(m_steps.begin(), m_steps.end(), lower_priority);
+		const Step step = m_steps.back();
+		m_steps.pop_back();
+
+		TextureState& texture = m_textures[step.texture];
+		if (texture.mip_bytes[step.mip] > budget_left)
+		{
+			continue;
+		}
+		budget_left -= texture.mip_bytes[step.mip];
+		texture.target_mip = step.mip;
+
+		if (step.mip > 0)
+		{
+			const float priority = getStepPriority(texture, step.mip - 1);
+			if (priority != 0.0f)
+			{
+				m_steps.push_back({ priority, step.texture, step.mip - 1 });
+				std::push_heap(m_steps.begin(), m_steps.end(), lower_priority);
+			}
+		}
+	}
+}
+
+void TextureStreamer::evict()
+{
+	for (unsigned int i = 0; i < m_textures.size(); ++i)
+	{
+		TextureState& texture = m_textures[i];
+
+		// Loaded mips finer than the target will not be needed before they are loaded again
+		for (unsigned int mip = 0; mip < texture.target_mip; ++mip)
+		{
+			if (!texture.loaded[mip].empty())
+			{
+				std::vector<unsigned char>().swap(texture.loaded[mip]);
+				texture.pending_mask &= ~(1u << mip);
+				m_pending_bytes -= texture.mip_bytes[mip];
+				m_statistics.loads_discarded++;
+			}
+		}
+
+		if (texture.resident_mip >= texture.target_mip)
+		{
+			continue;
+		}
+
+		TextureResidencyChange change;
+		change.texture = i;
+		change.first_mip = texture.target_mip;
+		change.previous_first_mip = texture.resident_mip;
+		for (unsigned int mip = texture.resident_mip; mip < texture.target_mip; ++mip)
+		{
+			m_resident_bytes -= texture.mip_bytes[mip];
+		}
+		m_statistics.evicted_mips += texture.target_mip - texture.resident_mip;
+		texture.resident_mip = texture.target_mip;
+		m_changes.push_back(std::move(change));
+	}
+}
+
+void TextureStreamer::scheduleLoads()
+{
+	if (m_inflight_loads >= m_settings.max_inflight_loads)
+	{
+		return;
+	}
+
+	m_candidates.clear();
+	for (unsigned int i = 0; i < m_textures.size(); ++i)
+	{
+		const TextureState& texture = m_textures[i];
+		for (unsigned int mip = texture.target_mip; mip < texture.resident_mip; ++mip)
+		{
+			if (!(texture.pending_mask & (1u << mip)))
+			{
+				m_candidates.push_back({ i, mip, getStepPriority(texture, mip) });
+			}
+		}
+	}
+	std::sort(m_candidates.begin(), m_candidates.end(), [](const LoadRequest& f_a, const LoadRequest& f_b)
+	{
+		return f_a.priority > f_b.priority;
+	});
+
+	size_t dispatched = 0;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const LoadRequest& request : m_candidates)
+		{
+			if (m_inflight_loads == m_settings.max_inflight_loads)
+			{
+				break;
+			}
+
+			// The budget covers the loads in flight too, so it holds whatever order they finish in
+			TextureState& texture = m_textures[request.texture];
+			const unsigned long long bytes = texture.mip_bytes[request.mip];
+			if (m_resident_bytes + m_pending_bytes + bytes > m_settings.budget_bytes)
+			{
+				continue;
+			}
+			if (m_inflight_loads > 0 && m_inflight_bytes + bytes > m_settings.max_inflight_bytes)
+			{
+				continue;
+			}
+
+			texture.pending_mask |= 1u << request.mip;
+			m_pending_bytes += bytes;
+			m_inflight_bytes += bytes;
+			m_inflight_loads++;
+			m_statistics.loads_started++;
+			m_requests.push_back(request);
+			dispatched++;
+		}
+	}
+	if (dispatched)
+	{
+		m_condition.notify_all();
+	}
+}
+
+TextureStreamer::LoadResult TextureStreamer::load(const LoadRequest& f_request) const
+{
+	LoadResult result;
+	result.texture = f_request.texture;
+	result.mip = f_request.mip;
+	result.loaded = m_load(f_request.texture, f_request.mip, result.data);
+	return result;
+}
+
+void TextureStreamer::runLoadsInline()
+{
+	while (!m_requests.empty())
+	{
+		const LoadRequest request = m_requests.front();
+		m_requests.pop_front();
+		m_results.push_back(load(request));
+	}
+}
+
+void TextureStreamer::run()
+{
+	for (;;)
+	{
+		LoadRequest request;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this] { return !m_requests.empty() || m_stopping; });
+			if (m_stopping)
+			{
+				return;
+			}
+			request = m_requests.front();
+			m_requests.pop_front();
+		}
+
+		LoadResult result = load(request);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_results.push_back(std::move(result));
+	}
+}
+
+float TextureStreamer::getProjectedSize(float f_world_size, float f_distance, float f_projection_scale, float f_viewport_height)
+{
+	return f_world_size * f_projection_scale * 0.5f * f_viewport_height / std::max(f_distance, 1e-4f);
+}
+
+unsigned int TextureStreamer::getRequiredMip(unsigned int f_width, unsigned int f_height, float f_screen_size, float f_mip_bias)
+{
+	const unsigned int last_mip = TextureData::getFullMipCount(f_width, f_height) - 1;
+	if (!(f_screen_size > 0.0f))
+	{
+		return last_mip;
+	}
+
+	const float level = std::log2(static_cast<float>(std::max(f_width, f_height)) / f_screen_size) + f_mip_bias;
+	if (level <= 0.0f)
+	{
+		return 0;
+	}
+	return std::min(static_cast<unsigned int>(level), last_mip);
+}
+
+TextureStreamer::~TextureStreamer()
+{
+	stop();
+}
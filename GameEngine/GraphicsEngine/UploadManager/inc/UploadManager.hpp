@@ -0,0 +1,146 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Batched, budgeted buffer uploads
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - upload() may be called from any thread; submit(), flush() and release()
+//    only from the thread that owns the immediate context.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Spread buffer uploads over frames instead of stalling one.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the UploadManager class.
+/// @par Revision History:
+///      $Source: UploadManager.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/06 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _UPLOAD_MANAGER_HPP_
+#define _UPLOAD_MANAGER_HPP_
+
+#include "UploadQueue.hpp"
+#include <d3d11.h>
+
+/**
+ * @class UploadManager
+ * @brief Stages buffer data from any thread and copies it to the GPU in per-frame batches.
+ *
+ * Data is copied into a 32 MiB staging ring when upload() is called, so the
+ * caller may free its memory right away. Once per frame the GraphicsEngine
+ * calls submit(), which issues the staged copies in order with
+ * UpdateSubresource until the frame budget (4 MiB by default) is spent.
+ * Draw with a buffer only once isComplete() returns true for its token.
+ *
+ * Destinations must be D3D11_USAGE_DEFAULT vertex or index buffers; the
+ * manager keeps a reference on them until their copy was issued.
+ *
+ * Example usage:
+ * @code
+ * UploadToken token;
+ * vertex_buffer->loadAsync(vertices, sizeof(vertex), count, GraphicsEngine::get(), &token);
+ * // ... later frames
+ * if (UploadManager::get()->isComplete(token)) { ... draw ... }
+ * @endcode
+ */
+class UploadManager
+{
+public:
+
+	/*--------------------------------------------------------------
+		Factory Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Retrieves the upload manager shared by every buffer.
+	/// </summary>
+	static UploadManager* get();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Stages f_size bytes to be copied at f_destination_offset of the buffer. Thread-safe.
+	/// </summary>
+	/// <returns>The completion token, or invalid_upload_token on invalid arguments.</returns>
+	UploadToken upload(ID3D11Buffer* f_destination, UINT f_destination_offset, const void* f_data, UINT f_size);
+
+	/// <summary>
+	/// Issues the staged copies that fit in the frame budget.
+	/// </summary>
+	/// <returns>The number of copies issued.</returns>
+	size_t submit(ID3D11DeviceContext* f_context);
+
+	/// <summary>
+	/// Issues every staged copy regardless of the budget (loading screens, shutdown).
+	/// </summary>
+	/// <returns>The number of copies issued.</returns>
+	size_t flush(ID3D11DeviceContext* f_context);
+
+	/// <summary>
+	/// Sets how many bytes submit() may copy per frame, 0 for no limit.
+	/// </summary>
+	void setFrameBudget(unsigned long long f_bytes) { m_frame_budget.store(f_bytes, std::memory_order_relaxed); }
+
+	unsigned long long getFrameBudget() const { return m_frame_budget.load(std::memory_order_relaxed); }
+
+	/// <summary>
+	/// Returns true once the copy of the token was issued. Thread-safe.
+	/// </summary>
+	bool isComplete(UploadToken f_token) const { return m_queue.isComplete(f_token); }
+
+	/// <summary>
+	/// Retrieves the staging and batching metrics. Thread-safe.
+	/// </summary>
+	UploadQueue::Statistics getStatistics() const { return m_queue.getStatistics(); }
+
+	/// <summary>
+	/// Drops every staged upload without copying it and releases the destinations.
+	/// </summary>
+	void release();
+
+private:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	UploadManager();
+	~UploadManager();
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	static constexpr size_t staging_ring_size = 32 * 1024 * 1024;
+	static constexpr unsigned long long default_frame_budget = 4 * 1024 * 1024;
+
+	UploadQueue m_queue;
+	std::atomic<unsigned long long> m_frame_budget;
+};
+
+#endif // !_UPLOAD_MANAGER_HPP_
@@ -0,0 +1,112 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Batched, budgeted buffer uploads
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - D3D11 has no persistently mapped upload heap; UpdateSubresource copies
+//    the staged bytes into driver memory when it is called, so the ring
+//    space is reusable as soon as the batch was issued.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Spread buffer uploads over frames instead of stalling one.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the UploadManager class.
+/// @par Revision History:
+///      $Source: UploadManager.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/06 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "UploadManager.hpp"
+
+namespace
+{
+	void copyUpload(ID3D11DeviceContext* f_context, const UploadQueue::Upload& f_upload)
+	{
+		ID3D11Buffer* destination = static_cast<ID3D11Buffer*>(f_upload.destination);
+
+		D3D11_BOX box = {};
+		box.left = static_cast<UINT>(f_upload.destination_offset);
+		box.right = static_cast<UINT>(f_upload.destination_offset + f_upload.size);
+		box.top = 0;
+		box.bottom = 1;
+		box.front = 0;
+		box.back = 1;
+
+		f_context->UpdateSubresource(destination, 0, &box, f_upload.data, 0, 0);
+		destination->Release();
+	}
+}
+
+UploadManager* UploadManager::get()
+{
+	static UploadManager manager;
+	return &manager;
+}
+
+UploadManager::UploadManager() : m_queue(staging_ring_size), m_frame_budget(default_frame_budget)
+{
+}
+
+UploadToken UploadManager::upload(ID3D11Buffer* f_destination, UINT f_destination_offset, const void* f_data, UINT f_size)
+{
+	if (!f_destination || !f_data || f_size == 0)
+	{
+		return invalid_upload_token;
+	}
+
+	// Keep the buffer alive until its copy was issued, even if its owner releases it
+	f_destination->AddRef();
+	return m_queue.enqueue(f_destination, f_destination_offset, f_data, f_size);
+}
+
+size_t UploadManager::submit(ID3D11DeviceContext* f_context)
+{
+	return m_queue.process(getFrameBudget(), [f_context](const UploadQueue::Upload& f_upload)
+	{
+		copyUpload(f_context, f_upload);
+	});
+}
+
+size_t UploadManager::flush(ID3D11DeviceContext* f_context)
+{
+	return m_queue.process(0, [f_context](const UploadQueue::Upload& f_upload)
+	{
+		copyUpload(f_context, f_upload);
+	});
+}
+
+void UploadManager::release()
+{
+	m_queue.process(0, [](const UploadQueue::Upload& f_upload)
+	{
+		static_cast<ID3D11Buffer*>(f_upload.destination)->Release();
+	});
+}
+
+UploadManager::~UploadManager()
+{
+}
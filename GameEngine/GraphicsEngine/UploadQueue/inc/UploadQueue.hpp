@@ -0,0 +1,220 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Staged, budgeted upload requests
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - This library has no DirectX dependency; the copy into the destination
+//    resource is a callback supplied by the caller of process().
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Stage data from any thread, copy it in batches once per frame.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the UploadQueue class.
+/// @par Revision History:
+///      $Source: UploadQueue.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/06 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _UPLOAD_QUEUE_HPP_
+#define _UPLOAD_QUEUE_HPP_
+
+#include "UploadRing.hpp"
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// <summary>
+/// Identifies an upload; tokens increase in submission order.
+/// </summary>
+using UploadToken = unsigned long long;
+
+/// <summary>
+/// Token that refers to no upload.
+/// </summary>
+constexpr UploadToken invalid_upload_token = 0;
+
+/**
+ * @class UploadQueue
+ * @brief Copies upload data into a staging ring and hands it out in per-frame batches.
+ *
+ * enqueue() may be called from any thread: it reserves staging space under
+ * a short lock, copies the data outside of it and returns a token. The
+ * owning thread calls process() once per frame; uploads are handed to the
+ * copy callback in submission order until the frame byte budget is spent
+ * (at least one upload always goes through, so an upload larger than the
+ * budget still progresses). Uploads complete in order, so a token is
+ * complete as soon as it is not greater than getCompletedToken().
+ * Data larger than the whole ring, or arriving while the ring is full,
+ * goes to a dedicated heap block instead of stalling the producer.
+ *
+ * Example usage:
+ * @code
+ * UploadQueue queue(32 * 1024 * 1024);
+ * UploadToken token = queue.enqueue(buffer, 0, vertices, size);   // any thread
+ * queue.process(4 * 1024 * 1024, [&](const UploadQueue::Upload& f_upload) { ... });
+ * if (queue.isComplete(token)) { ... }
+ * @endcode
+ */
+class UploadQueue
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// An upload handed to the copy callback.
+	/// </summary>
+	struct Upload
+	{
+		void* destination;
+		unsigned long long destination_offset;
+		const void* data;
+		size_t size;
+		UploadToken token;
+	};
+
+	using CopyFunction = std::function<void(const Upload&)>;
+
+	/// <summary>
+	/// Snapshot of the queue metrics.
+	/// </summary>
+	struct Statistics
+	{
+		size_t pending_count = 0;
+		unsigned long long pending_bytes = 0;
+		size_t ring_used = 0;
+		size_t ring_capacity = 0;
+
+		/// <summary>
+		/// Uploads that did not fit in the ring and used a dedicated block.
+		/// </summary>
+		unsigned long long overflow_count = 0;
+
+		size_t last_batch_count = 0;
+		unsigned long long last_batch_bytes = 0;
+		unsigned long long uploaded_bytes = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	explicit UploadQueue(size_t f_ring_capacity);
+	~UploadQueue();
+
+	UploadQueue(const UploadQueue&) = delete;
+	UploadQueue& operator=(const UploadQueue&) = delete;
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Stages a copy of f_data for f_destination. Thread-safe.
+	/// </summary>
+	/// <returns>The token of the upload, or invalid_upload_token if there is nothing to upload.</returns>
+	UploadToken enqueue(void* f_destination, unsigned long long f_destination_offset, const void* f_data, size_t f_size);
+
+	/// <summary>
+	/// Hands uploads to f_copy in order until f_budget bytes were copied.
+	/// </summary>
+	/// <param name="f_budget">Bytes allowed this call, 0 for no limit.</param>
+	/// <returns>The number of uploads processed.</returns>
+	size_t process(unsigned long long f_budget, const CopyFunction& f_copy);
+
+	/// <summary>
+	/// Returns true once the upload of the token was handed to the copy callback. Thread-safe.
+	/// </summary>
+	bool isComplete(UploadToken f_token) const { return f_token <= getCompletedToken(); }
+
+	/// <summary>
+	/// Token of the last upload processed. Thread-safe.
+	/// </summary>
+	UploadToken getCompletedToken() const { return m_completed_token.load(std::memory_order_acquire); }
+
+	/// <summary>
+	/// Retrieves the queue metrics. Thread-safe.
+	/// </summary>
+	Statistics getStatistics() const;
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Request
+	{
+		void* destination = nullptr;
+		unsigned long long destination_offset = 0;
+		size_t size = 0;
+		UploadToken token = invalid_upload_token;
+		UploadRing::Allocation allocation;
+		std::unique_ptr<unsigned char[]> overflow;
+
+		/// <summary>
+		/// Set once the producer finished copying its data into the staging memory.
+		/// </summary>
+		std::atomic<bool> ready{ false };
+
+		const unsigned char* getData(const unsigned char* f_ring) const
+		{
+			return overflow ? overflow.get() : f_ring + allocation.offset;
+		}
+	};
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	static constexpr size_t staging_alignment = 16;
+
+	std::vector<unsigned char> m_ring_memory;
+	UploadRing m_ring;
+
+	/// <summary>
+	/// Requests in submission order; std::deque keeps references valid on push_back.
+	/// </summary>
+	std::deque<Request> m_requests;
+
+	mutable std::mutex m_mutex;
+	UploadToken m_next_token;
+	std::atomic<UploadToken> m_completed_token;
+
+	unsigned long long m_pending_bytes;
+	unsigned long long m_overflow_count;
+	size_t m_last_batch_count;
+	unsigned long long m_last_batch_bytes;
+	unsigned long long m_uploaded_bytes;
+};
+
+#endif // !_UPLOAD_QUEUE_HPP_
@@ -0,0 +1,123 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: FIFO ring allocator for staging memory
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Not thread-safe; the owner serializes allocate() and release().
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Sub-allocate staging memory that is freed in allocation order.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the UploadRing class.
+/// @par Revision History:
+///      $Source: UploadRing.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/06 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _UPLOAD_RING_HPP_
+#define _UPLOAD_RING_HPP_
+
+#include <cstddef>
+
+/**
+ * @class UploadRing
+ * @brief Ring allocator handing out contiguous ranges of a fixed size buffer.
+ *
+ * Ranges must be released in the order they were allocated, which is how
+ * uploads retire. An allocation that does not fit before the end of the
+ * buffer skips the remainder and starts again at offset 0; the skipped
+ * bytes are charged to that allocation so release() stays a single
+ * subtraction.
+ *
+ * Example usage:
+ * @code
+ * UploadRing ring(1024);
+ * UploadRing::Allocation a;
+ * if (ring.allocate(300, 16, &a)) { ... use [a.offset, a.offset + 300) ... }
+ * ring.release(a);
+ * @endcode
+ */
+class UploadRing
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// A range handed out by allocate().
+	/// </summary>
+	struct Allocation
+	{
+		/// <summary>
+		/// Start of the usable range.
+		/// </summary>
+		size_t offset = 0;
+
+		/// <summary>
+		/// Bytes taken from the ring, alignment and wrap padding included.
+		/// </summary>
+		size_t consumed = 0;
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	explicit UploadRing(size_t f_capacity);
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Allocates f_size bytes aligned to f_alignment (a power of two).
+	/// </summary>
+	/// <returns>False if the ring has no contiguous range large enough.</returns>
+	bool allocate(size_t f_size, size_t f_alignment, Allocation* f_allocation);
+
+	/// <summary>
+	/// Releases the oldest live allocation.
+	/// </summary>
+	void release(const Allocation& f_allocation);
+
+	size_t getCapacity() const { return m_capacity; }
+	size_t getUsed() const { return m_used; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	size_t m_capacity;
+	size_t m_head;
+	size_t m_used;
+};
+
+#endif // !_UPLOAD_RING_HPP_
@@ -0,0 +1,165 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Staged, budgeted upload requests
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Stage data from any thread, copy it in batches once per frame.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the UploadQueue class.
+/// @par Revision History:
+///      $Source: UploadQueue.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/06 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "UploadQueue.hpp"
+#include <cstring>
+
+UploadQueue::UploadQueue(size_t f_ring_capacity)
+	: m_ring_memory(f_ring_capacity), m_ring(f_ring_capacity), m_next_token(invalid_upload_token),
+	m_completed_token(invalid_upload_token), m_pending_bytes(0), m_overflow_count(0),
+	m_last_batch_count(0), m_last_batch_bytes(0), m_uploaded_bytes(0)
+{
+}
+
+UploadToken UploadQueue::enqueue(void* f_destination, unsigned long long f_destination_offset, const void* f_data, size_t f_size)
+{
+	if (!f_destination || !f_data || f_size == 0)
+	{
+		return invalid_upload_token;
+	}
+
+	Request* request = nullptr;
+	UploadToken token = invalid_upload_token;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_requests.emplace_back();
+		request = &m_requests.back();
+		request->destination = f_destination;
+		request->destination_offset = f_destination_offset;
+		request->size = f_size;
+		request->token = token = ++m_next_token;
+
+		if (!m_ring.allocate(f_size, staging_alignment, &request->allocation))
+		{
+			request->overflow.reset(new unsigned char[f_size]);
+			m_overflow_count++;
+		}
+		m_pending_bytes += f_size;
+	}
+
+	// The copy runs outside the lock so producers never wait on each other's memcpy
+	unsigned char* staging = request->overflow ? request->overflow.get() : m_ring_memory.data() + request->allocation.offset;
+	::memcpy(staging, f_data, f_size);
+	request->ready.store(true, std::memory_order_release);
+
+	return token;
+}
+
+size_t UploadQueue::process(unsigned long long f_budget, const CopyFunction& f_copy)
+{
+	std::vector<Request*> batch;
+	unsigned long long batch_bytes = 0;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (Request& request : m_requests)
+		{
+			if (!request.ready.load(std::memory_order_acquire))
+			{
+				break;
+			}
+			if (f_budget && !batch.empty() && batch_bytes + request.size > f_budget)
+			{
+				break;
+			}
+			batch.push_back(&request);
+			batch_bytes += request.size;
+		}
+	}
+
+	// Only this thread pops requests, so the batch stays valid without the lock
+	for (Request* request : batch)
+	{
+		Upload upload;
+		upload.destination = request->destination;
+		upload.destination_offset = request->destination_offset;
+		upload.data = request->getData(m_ring_memory.data());
+		upload.size = request->size;
+		upload.token = request->token;
+		f_copy(upload);
+	}
+
+	if (batch.empty())
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_last_batch_count = 0;
+		m_last_batch_bytes = 0;
+		return 0;
+	}
+
+	const UploadToken last_token = batch.back()->token;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (size_t i = 0; i < batch.size(); ++i)
+		{
+			Request& request = m_requests.front();
+			if (!request.overflow)
+			{
+				m_ring.release(request.allocation);
+			}
+			m_pending_bytes -= request.size;
+			m_requests.pop_front();
+		}
+		m_last_batch_count = batch.size();
+		m_last_batch_bytes = batch_bytes;
+		m_uploaded_bytes += batch_bytes;
+	}
+	m_completed_token.store(last_token, std::memory_order_release);
+
+	return batch.size();
+}
+
+UploadQueue::Statistics UploadQueue::getStatistics() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Statistics statistics;
+	statistics.pending_count = m_requests.size();
+	statistics.pending_bytes = m_pending_bytes;
+	statistics.ring_used = m_ring.getUsed();
+	statistics.ring_capacity = m_ring.getCapacity();
+	statistics.overflow_count = m_overflow_count;
+	statistics.last_batch_count = m_last_batch_count;
+	statistics.last_batch_bytes = m_last_batch_bytes;
+	statistics.uploaded_bytes = m_uploaded_bytes;
+	return statistics;
+}
+
+UploadQueue::~UploadQueue()
+{
+}
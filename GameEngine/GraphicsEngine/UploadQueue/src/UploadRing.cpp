@@ -0,0 +1,91 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: FIFO ring allocator for staging memory
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Sub-allocate staging memory that is freed in allocation order.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the UploadRing class.
+/// @par Revision History:
+///      $Source: UploadRing.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/04/06 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "UploadRing.hpp"
+
+UploadRing::UploadRing(size_t f_capacity) : m_capacity(f_capacity), m_head(0), m_used(0)
+{
+}
+
+bool UploadRing::allocate(size_t f_size, size_t f_alignment, Allocation* f_allocation)
+{
+	if (f_size == 0 || f_size > m_capacity)
+	{
+		return false;
+	}
+	if (f_alignment == 0)
+	{
+		f_alignment = 1;
+	}
+
+	size_t offset = (m_head + f_alignment - 1) & ~(f_alignment - 1);
+	size_t consumed = offset - m_head + f_size;
+	if (offset + f_size > m_capacity)
+	{
+		// Skip the tail of the buffer and start again at 0
+		offset = 0;
+		consumed = m_capacity - m_head + f_size;
+	}
+
+	if (m_used + consumed > m_capacity)
+	{
+		return false;
+	}
+
+	m_head = offset + f_size;
+	if (m_head == m_capacity)
+	{
+		m_head = 0;
+	}
+	m_used += consumed;
+
+	f_allocation->offset = offset;
+	f_allocation->consumed = consumed;
+	return true;
+}
+
+void UploadRing::release(const Allocation& f_allocation)
+{
+	m_used -= f_allocation.consumed <= m_used ? f_allocation.consumed : m_used;
+	if (m_used == 0)
+	{
+		// Empty ring: restart at 0 to keep allocations contiguous
+		m_head = 0;
+	}
+}
@@ -2,6 +2,7 @@
 #define _VERTEX_BUFFER_HPP_
 
 #include <d3d11.h>
+#include "UploadQueue.hpp"
 
 class DeviceContext;
 class IGraphicsEngine; // Forward declaration for IGraphicsEngine
@@ -10,16 +11,35 @@ class VertexBuffer
 {
 public:
     VertexBuffer();
-    bool load(void* list_vertices, UINT size_vertex, UINT size_list, void* shader_byte_code, UINT size_byte_shader, IGraphicsEngine* graphics_engine);
+    bool load(void* list_vertices, UINT size_vertex, UINT size_list, IGraphicsEngine* graphics_engine);
+
+	/// <summary>
+	/// Loads vertices described by a VertexFormat; the stride comes from the format.
+	/// The input layout is not part of the buffer, get it from the InputLayoutCache.
+	/// </summary>
+	template <typename Format>
+	bool load(const typename Format::vertex_type* list_vertices, UINT size_list, IGraphicsEngine* graphics_engine)
+	{
+		return load(const_cast<typename Format::vertex_type*>(list_vertices), Format::stride, size_list, graphics_engine);
+	}
+
+	/// <summary>
+	/// Creates the buffer and stages the vertices in the UploadManager instead of
+	/// copying them inline; the data may be freed when the call returns.
+	/// Callable from any thread. Draw only once the token is complete.
+	/// </summary>
+	bool loadAsync(const void* list_vertices, UINT size_vertex, UINT size_list, IGraphicsEngine* graphics_engine, UploadToken* token);
+
 	UINT getSizeVertexList();
 	bool release();
     ~VertexBuffer();
 private:
+	bool createBuffer(const void* list_vertices, UINT size_vertex, UINT size_list, IGraphicsEngine* graphics_engine);
+
 	UINT m_size_vertex;
 	UINT m_size_list;
 	ID3D11Buffer* m_buffer;
-	ID3D11InputLayout* m_layout;
 	friend class DeviceContext;
 };
 
-#endif // _VERTEX_BUFFER_HPP_
\ No newline at end of file
+#endif // _VERTEX_BUFFER_HPP_
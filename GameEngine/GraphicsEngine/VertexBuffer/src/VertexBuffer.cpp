@@ -1,14 +1,36 @@
 #include "VertexBuffer.hpp"
 #include "GraphicsEngine.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include "UploadManager.hpp"
+#include "CommandRecorder.hpp"
 
-VertexBuffer::VertexBuffer() : m_layout(0), m_buffer(0), m_size_vertex(0), m_size_list(0)
+VertexBuffer::VertexBuffer() : m_buffer(0), m_size_vertex(0), m_size_list(0)
 {
 }
 
-bool VertexBuffer::load(void* list_vertices, UINT size_vertex, UINT size_list, void* shader_byte_code, UINT size_byte_shader, IGraphicsEngine* graphics_engine)
+bool VertexBuffer::load(void* list_vertices, UINT size_vertex, UINT size_list, IGraphicsEngine* graphics_engine)
 {
-	if (m_buffer)m_buffer->Release();
-	if (m_layout)m_layout->Release();
+	return createBuffer(list_vertices, size_vertex, size_list, graphics_engine);
+}
+
+bool VertexBuffer::loadAsync(const void* list_vertices, UINT size_vertex, UINT size_list, IGraphicsEngine* graphics_engine, UploadToken* token)
+{
+	if (!createBuffer(nullptr, size_vertex, size_list, graphics_engine))
+	{
+		return false;
+	}
+
+	UploadToken upload_token = UploadManager::get()->upload(m_buffer, 0, list_vertices, size_vertex * size_list);
+	CommandRecorder::get()->onUpdateBuffer(this, 0, list_vertices, size_vertex * size_list);
+	if (token) *token = upload_token;
+	return upload_token != invalid_upload_token;
+}
+
+bool VertexBuffer::createBuffer(const void* list_vertices, UINT size_vertex, UINT size_list, IGraphicsEngine* graphics_engine)
+{
+	// The GPU may still read the old buffer in a frame in flight
+	if (m_buffer) ResourceReleaseQueue::get()->deferRelease(m_buffer, m_size_vertex * m_size_list);
+	m_buffer = nullptr;
 
 	D3D11_BUFFER_DESC buff_desc = {};
 	buff_desc.Usage = D3D11_USAGE_DEFAULT;
@@ -23,26 +45,12 @@ bool VertexBuffer::load(void* list_vertices, UINT size_vertex, UINT size_list, v
 	m_size_vertex = size_vertex;
 	m_size_list = size_list;
 
-	if (FAILED(graphics_engine->getDevice()->CreateBuffer(&buff_desc, &init_data, &m_buffer)))
-	{
-		return false;
-	}
-
-	D3D11_INPUT_ELEMENT_DESC layout[] =
-	{
-		//SEMANTIC NAME - SEMANTIC INDEX - FORMAT - INPUT SLOT - ALIGNED BYTE OFFSET - INPUT SLOT CLASS - INSTANCE DATA STEP RATE
-		{"POSITION", 0,  DXGI_FORMAT_R32G32B32_FLOAT, 0, 0,D3D11_INPUT_PER_VERTEX_DATA ,0},
-		{ "COLOR", 0,  DXGI_FORMAT_R32G32B32_FLOAT, 0, 12,D3D11_INPUT_PER_VERTEX_DATA ,0 },
-		{ "COLOR", 1,  DXGI_FORMAT_R32G32B32_FLOAT, 0, 24,D3D11_INPUT_PER_VERTEX_DATA ,0 }
-	};
-
-	UINT size_layout = ARRAYSIZE(layout);
-
-	if (FAILED(graphics_engine->getDevice()->CreateInputLayout(layout, size_layout, shader_byte_code, size_byte_shader, &m_layout)))
+	if (FAILED(graphics_engine->getDevice()->CreateBuffer(&buff_desc, list_vertices ? &init_data : nullptr, &m_buffer)))
 	{
 		return false;
 	}
 
+	CommandRecorder::get()->onCreateBuffer(this, CommandBufferKind::Vertex, size_vertex, buff_desc.ByteWidth, list_vertices);
 	return true;
 }
 
@@ -53,8 +61,8 @@ UINT VertexBuffer::getSizeVertexList()
 
 bool VertexBuffer::release()
 {
-	m_layout->Release();
-	m_buffer->Release();
+	CommandRecorder::get()->onRelease(this);
+	ResourceReleaseQueue::get()->deferRelease(m_buffer, m_size_vertex * m_size_list);
 	delete this;
 	return true;
 }
@@ -0,0 +1,164 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Cache of input layouts shared by all vertex buffers
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Layouts are keyed by vertex format hash and shader input signature hash.
+//  - The cache owns the layouts; they are released with the GraphicsEngine.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Create every distinct input layout exactly once.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the InputLayoutCache class.
+/// @par Revision History:
+///      $Source: InputLayoutCache.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/09 10:05:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _INPUT_LAYOUT_CACHE_HPP_
+#define _INPUT_LAYOUT_CACHE_HPP_
+
+#include <d3d11.h>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+class IGraphicsEngine; // Forward declaration for IGraphicsEngine
+
+/**
+ * @class InputLayoutCache
+ * @brief Creates each (vertex format, shader input signature) input layout only once.
+ *
+ * Hundreds of meshes usually share one vertex format and a handful of vertex
+ * shaders. Instead of calling CreateInputLayout per buffer, the layouts are
+ * looked up by the compile-time hash of the VertexFormat combined with a hash
+ * of the input signature chunk of the shader byte code. Shaders with the same
+ * input signature therefore share their layouts as well.
+ *
+ * Example usage:
+ * @code
+ * ID3D11InputLayout* layout = InputLayoutCache::get()->getInputLayout<VertexPCC>(
+ *     shader_byte_code, shader_size, GraphicsEngine::get());
+ * @endcode
+ */
+class InputLayoutCache
+{
+public:
+
+	/*--------------------------------------------------------------
+		Factory Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Retrieves the singleton instance of the InputLayoutCache.
+	/// </summary>
+	static InputLayoutCache* get();
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	InputLayoutCache() = default;
+	InputLayoutCache(const InputLayoutCache&) = delete;
+	InputLayoutCache& operator=(const InputLayoutCache&) = delete;
+	~InputLayoutCache();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Returns the input layout of the vertex format for the given vertex shader byte code.
+	/// </summary>
+	/// <typeparam name="Format">A VertexFormat instantiation.</typeparam>
+	/// <returns>The shared input layout, or nullptr if creation failed.</returns>
+	template <typename Format>
+	ID3D11InputLayout* getInputLayout(const void* f_shader_byte_code, size_t f_byte_code_size, IGraphicsEngine* f_graphicsEngine)
+	{
+		return getInputLayout(Format::getElements(), Format::element_count, Format::getHash(),
+			f_shader_byte_code, f_byte_code_size, f_graphicsEngine);
+	}
+
+	/// <summary>
+	/// Returns the input layout described by the element list for the given vertex shader byte code.
+	/// </summary>
+	/// <param name="f_elements">Input element descriptions.</param>
+	/// <param name="f_element_count">Number of input element descriptions.</param>
+	/// <param name="f_format_hash">Hash identifying the element list.</param>
+	/// <param name="f_shader_byte_code">Byte code of the vertex shader the layout is validated against.</param>
+	/// <param name="f_byte_code_size">Size of the byte code.</param>
+	/// <param name="f_graphicsEngine">Engine used to create the layout on a cache miss.</param>
+	/// <returns>The shared input layout, or nullptr if creation failed.</returns>
+	ID3D11InputLayout* getInputLayout(const D3D11_INPUT_ELEMENT_DESC* f_elements, UINT f_element_count,
+		unsigned long long f_format_hash, const void* f_shader_byte_code, size_t f_byte_code_size,
+		IGraphicsEngine* f_graphicsEngine);
+
+	/// <summary>
+	/// Number of distinct input layouts created so far.
+	/// </summary>
+	size_t getSize();
+
+	/// <summary>
+	/// Releases every input layout owned by the cache.
+	/// </summary>
+	void release();
+
+	/// <summary>
+	/// Hashes the input signature of a vertex shader.
+	/// Falls back to hashing the whole byte code when no signature chunk is found.
+	/// </summary>
+	static unsigned long long hashInputSignature(const void* f_shader_byte_code, size_t f_byte_code_size);
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	struct Key
+	{
+		unsigned long long format_hash;
+		unsigned long long signature_hash;
+		bool operator==(const Key& rhs) const
+		{
+			return format_hash == rhs.format_hash && signature_hash == rhs.signature_hash;
+		}
+	};
+
+	struct KeyHasher
+	{
+		size_t operator()(const Key& f_key) const
+		{
+			return static_cast<size_t>(f_key.format_hash ^ (f_key.signature_hash * 0x9E3779B97F4A7C15ull));
+		}
+	};
+
+	std::unordered_map<Key, ID3D11InputLayout*, KeyHasher> m_layouts;
+	std::mutex m_mutex;
+};
+
+#endif // !_INPUT_LAYOUT_CACHE_HPP_
@@ -0,0 +1,392 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Compile-time description of vertex formats
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Everything in this header but copyVertexStream() is evaluated at compile time.
+//  - The element list must describe the vertex struct member by member, in order.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Generate input element lists, offsets and strides from C++ types.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the VertexElement and VertexFormat templates.
+/// @par Revision History:
+///      $Source: VertexFormat.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/09 10:05:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _VERTEX_FORMAT_HPP_
+#define _VERTEX_FORMAT_HPP_
+
+#include "Vector3D.hpp"
+#include <d3d11.h>
+#include <array>
+#include <cstring>
+
+/// <summary>
+/// Semantics understood by the shaders of the engine.
+/// </summary>
+enum class VertexSemantic : UINT
+{
+	Position,
+	Normal,
+	Color,
+	TexCoord,
+	Tangent
+};
+
+/// <summary>
+/// Returns the HLSL semantic name of a VertexSemantic.
+/// </summary>
+constexpr const char* getSemanticName(VertexSemantic f_semantic)
+{
+	switch (f_semantic)
+	{
+	case VertexSemantic::Position: return "POSITION";
+	case VertexSemantic::Normal:   return "NORMAL";
+	case VertexSemantic::Color:    return "COLOR";
+	case VertexSemantic::TexCoord: return "TEXCOORD";
+	case VertexSemantic::Tangent:  return "TANGENT";
+	}
+	return "";
+}
+
+/// <summary>
+/// Maps the C++ type of a vertex attribute to its DXGI format.
+/// Specialize it to allow new attribute types inside vertex formats.
+/// </summary>
+template <typename T>
+struct VertexAttributeFormat;
+
+template <> struct VertexAttributeFormat<float>        { static constexpr DXGI_FORMAT value = DXGI_FORMAT_R32_FLOAT; };
+template <> struct VertexAttributeFormat<float[2]>     { static constexpr DXGI_FORMAT value = DXGI_FORMAT_R32G32_FLOAT; };
+template <> struct VertexAttributeFormat<float[3]>     { static constexpr DXGI_FORMAT value = DXGI_FORMAT_R32G32B32_FLOAT; };
+template <> struct VertexAttributeFormat<Vector3D>     { static constexpr DXGI_FORMAT value = DXGI_FORMAT_R32G32B32_FLOAT; };
+template <> struct VertexAttributeFormat<float[4]>     { static constexpr DXGI_FORMAT value = DXGI_FORMAT_R32G32B32A32_FLOAT; };
+template <> struct VertexAttributeFormat<unsigned int> { static constexpr DXGI_FORMAT value = DXGI_FORMAT_R32_UINT; };
+
+/**
+ * @struct VertexElement
+ * @brief One attribute of a vertex format: semantic, semantic index and C++ type.
+ */
+template <VertexSemantic Semantic, UINT SemanticIndex, typename T>
+struct VertexElement
+{
+	using type = T;
+	static constexpr VertexSemantic semantic = Semantic;
+	static constexpr UINT semantic_index = SemanticIndex;
+	static constexpr DXGI_FORMAT format = VertexAttributeFormat<T>::value;
+	static constexpr UINT size = sizeof(T);
+};
+
+/**
+ * @class VertexFormat
+ * @brief Compile-time vertex layout generated from a vertex struct and its element list.
+ *
+ * The element descriptions, their byte offsets, the stride and a hash of the
+ * layout are all computed by the compiler. The stride is static-asserted
+ * against sizeof(Vertex), so a member added to the struct without updating
+ * the format (or padding introduced by the compiler) fails the build.
+ *
+ * Example usage:
+ * @code
+ * struct vertex { Vector3D position; Vector3D color; };
+ * using VertexPC = VertexFormat<vertex,
+ *     VertexElement<VertexSemantic::Position, 0, Vector3D>,
+ *     VertexElement<VertexSemantic::Color, 0, Vector3D>>;
+ * static_assert(VertexPC::offsetOf(1) == offsetof(vertex, color), "color offset mismatch");
+ * @endcode
+ */
+template <typename Vertex, typename... Elements>
+class VertexFormat
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	using vertex_type = Vertex;
+
+	/*--------------------------------------------------------------
+		Static Constants
+	--------------------------------------------------------------*/
+
+	static constexpr UINT element_count = sizeof...(Elements);
+	static constexpr UINT stride = (Elements::size + ... + 0);
+
+	static_assert(element_count > 0, "A vertex format needs at least one element");
+	static_assert(stride == sizeof(Vertex), "Vertex format elements do not match the size of the vertex struct");
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Byte offset of the element at the given position in the element list.
+	/// </summary>
+	static constexpr UINT offsetOf(UINT f_index) { return s_offsets[f_index]; }
+
+	/// <summary>
+	/// Input element descriptions ready to be passed to CreateInputLayout.
+	/// </summary>
+	static const D3D11_INPUT_ELEMENT_DESC* getElements() { return s_elements.data(); }
+
+	/// <summary>
+	/// Input element description of the element at the given position, usable in constant expressions.
+	/// </summary>
+	static constexpr D3D11_INPUT_ELEMENT_DESC getElement(UINT f_index) { return s_elements[f_index]; }
+
+	static constexpr VertexSemantic semanticOf(UINT f_index) { return s_semantics[f_index]; }
+	static constexpr UINT sizeOf(UINT f_index) { return s_sizes[f_index]; }
+
+	/// <summary>
+	/// Hash of the layout (semantics, formats and offsets), used as the input layout cache key.
+	/// </summary>
+	static constexpr unsigned long long getHash() { return s_hash; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Helpers
+	--------------------------------------------------------------*/
+
+	static constexpr std::array<UINT, element_count> computeOffsets()
+	{
+		std::array<UINT, element_count> offsets = {};
+		const UINT sizes[] = { Elements::size... };
+		UINT offset = 0;
+		for (UINT i = 0; i < element_count; ++i)
+		{
+			offsets[i] = offset;
+			offset += sizes[i];
+		}
+		return offsets;
+	}
+
+	static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, element_count> computeElements()
+	{
+		std::array<D3D11_INPUT_ELEMENT_DESC, element_count> elements = {};
+		const VertexSemantic semantics[] = { Elements::semantic... };
+		const UINT indices[] = { Elements::semantic_index... };
+		const DXGI_FORMAT formats[] = { Elements::format... };
+		const std::array<UINT, element_count> offsets = computeOffsets();
+		for (UINT i = 0; i < element_count; ++i)
+		{
+			elements[i] = { getSemanticName(semantics[i]), indices[i], formats[i], 0, offsets[i], D3D11_INPUT_PER_VERTEX_DATA, 0 };
+		}
+		return elements;
+	}
+
+	static constexpr unsigned long long computeHash()
+	{
+		// FNV-1a over the values that make two layouts interchangeable
+		unsigned long long hash = 14695981039346656037ull;
+		const std::array<D3D11_INPUT_ELEMENT_DESC, element_count> elements = computeElements();
+		const VertexSemantic semantics[] = { Elements::semantic... };
+		for (UINT i = 0; i < element_count; ++i)
+		{
+			const UINT values[] = { static_cast<UINT>(semantics[i]), elements[i].SemanticIndex,
+				static_cast<UINT>(elements[i].Format), elements[i].InputSlot, elements[i].AlignedByteOffset };
+			for (UINT value : values)
+			{
+				hash = (hash ^ value) * 1099511628211ull;
+			}
+		}
+		return hash;
+	}
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	static constexpr std::array<UINT, element_count> s_offsets = computeOffsets();
+	static constexpr std::array<VertexSemantic, element_count> s_semantics = { Elements::semantic... };
+	static constexpr std::array<UINT, element_count> s_sizes = { Elements::size... };
+	static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, element_count> s_elements = computeElements();
+	static constexpr unsigned long long s_hash = computeHash();
+};
+
+/**
+ * @class VertexStreamFormat
+ * @brief Input layout over several vertex buffers, one VertexFormat per input slot.
+ *
+ * Stream i is fetched from input slot i. Keeping the position alone in the
+ * first stream lets depth, shadow and occlusion passes bind only that buffer
+ * with the layout of the first VertexFormat, and fetch 12 bytes per vertex
+ * instead of the whole interleaved vertex. Fill the streams from interleaved
+ * vertices with copyVertexStream().
+ *
+ * Example usage:
+ * @code
+ * using PositionStream = VertexFormat<Vector3D, VertexElement<VertexSemantic::Position, 0, Vector3D>>;
+ * using ColorStream = VertexFormat<vertex_colors,
+ *     VertexElement<VertexSemantic::Color, 0, Vector3D>,
+ *     VertexElement<VertexSemantic::Color, 1, Vector3D>>;
+ * using VertexPCCStreams = VertexStreamFormat<PositionStream, ColorStream>;
+ * ID3D11InputLayout* layout = InputLayoutCache::get()->getInputLayout<VertexPCCStreams>(byte_code, size, engine);
+ * @endcode
+ */
+template <typename... Streams>
+class VertexStreamFormat
+{
+public:
+
+	/*--------------------------------------------------------------
+		Static Constants
+	--------------------------------------------------------------*/
+
+	static constexpr UINT stream_count = sizeof...(Streams);
+	static constexpr UINT element_count = (Streams::element_count + ... + 0);
+
+	static_assert(stream_count > 0 && stream_count <= D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT, "Invalid number of vertex streams");
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Stride of the vertex buffer bound to the given input slot.
+	/// </summary>
+	static constexpr UINT strideOf(UINT f_stream) { return s_strides[f_stream]; }
+
+	/// <summary>
+	/// Input element descriptions of every stream, each with its input slot.
+	/// </summary>
+	static const D3D11_INPUT_ELEMENT_DESC* getElements() { return s_elements.data(); }
+
+	/// <summary>
+	/// Hash of the layout, distinct from the hash of the same elements interleaved in one stream.
+	/// </summary>
+	static constexpr unsigned long long getHash() { return s_hash; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Helpers
+	--------------------------------------------------------------*/
+
+	template <typename Stream>
+	static constexpr void appendStream(std::array<D3D11_INPUT_ELEMENT_DESC, element_count>& f_elements, UINT& f_next, UINT f_slot)
+	{
+		for (UINT i = 0; i < Stream::element_count; ++i)
+		{
+			D3D11_INPUT_ELEMENT_DESC element = Stream::getElement(i);
+			element.InputSlot = f_slot;
+			f_elements[f_next++] = element;
+		}
+	}
+
+	static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, element_count> computeElements()
+	{
+		std::array<D3D11_INPUT_ELEMENT_DESC, element_count> elements = {};
+		UINT next = 0;
+		UINT slot = 0;
+		(appendStream<Streams>(elements, next, slot++), ...);
+		return elements;
+	}
+
+	static constexpr unsigned long long computeHash()
+	{
+		// The per stream hashes already cover semantics, formats and offsets; add the slot of each
+		unsigned long long hash = 14695981039346656037ull;
+		const unsigned long long stream_hashes[] = { Streams::getHash()... };
+		for (UINT i = 0; i < stream_count; ++i)
+		{
+			hash = (hash ^ stream_hashes[i]) * 1099511628211ull;
+			hash = (hash ^ i) * 1099511628211ull;
+		}
+		return hash;
+	}
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	static constexpr std::array<UINT, stream_count> s_strides = { Streams::stride... };
+	static constexpr std::array<D3D11_INPUT_ELEMENT_DESC, element_count> s_elements = computeElements();
+	static constexpr unsigned long long s_hash = computeHash();
+};
+
+/// <summary>
+/// Byte offset in the Source vertex of every element of the Destination format,
+/// matched by semantic and semantic index; ~0u where Source has no such element.
+/// </summary>
+template <typename Source, typename Destination>
+constexpr std::array<UINT, Destination::element_count> findSourceOffsets()
+{
+	std::array<UINT, Destination::element_count> offsets = {};
+	for (UINT i = 0; i < Destination::element_count; ++i)
+	{
+		offsets[i] = ~0u;
+		for (UINT j = 0; j < Source::element_count; ++j)
+		{
+			if (Source::semanticOf(j) == Destination::semanticOf(i) &&
+				Source::getElement(j).SemanticIndex == Destination::getElement(i).SemanticIndex &&
+				Source::getElement(j).Format == Destination::getElement(i).Format)
+			{
+				offsets[i] = Source::offsetOf(j);
+				break;
+			}
+		}
+	}
+	return offsets;
+}
+
+template <size_t Count>
+constexpr bool hasAllElements(const std::array<UINT, Count>& f_source_offsets)
+{
+	for (UINT offset : f_source_offsets)
+	{
+		if (offset == ~0u) return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// Copies the elements of the Destination format out of interleaved Source vertices into one tightly packed stream.
+/// </summary>
+/// <param name="f_vertices">f_count vertices of the Source format.</param>
+/// <param name="f_stream">Receives f_count vertices of the Destination format.</param>
+template <typename Source, typename Destination>
+void copyVertexStream(const typename Source::vertex_type* f_vertices, UINT f_count, typename Destination::vertex_type* f_stream)
+{
+	static constexpr std::array<UINT, Destination::element_count> source_offsets = findSourceOffsets<Source, Destination>();
+	static_assert(hasAllElements(source_offsets), "Every element of the stream must exist in the source vertex format");
+
+	const unsigned char* source = reinterpret_cast<const unsigned char*>(f_vertices);
+	unsigned char* destination = reinterpret_cast<unsigned char*>(f_stream);
+	for (UINT vertex = 0; vertex < f_count; ++vertex, source += Source::stride, destination += Destination::stride)
+	{
+		for (UINT i = 0; i < Destination::element_count; ++i)
+		{
+			::memcpy(destination + Destination::offsetOf(i), source + source_offsets[i], Destination::sizeOf(i));
+		}
+	}
+}
+
+#endif // !_VERTEX_FORMAT_HPP_
@@ -0,0 +1,147 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Cache of input layouts shared by all vertex buffers
+//   Target system(s):
+//        Compiler(s): VS16
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Layouts are keyed by vertex format hash and shader input signature hash.
+//  - The cache owns the layouts; they are released with the GraphicsEngine.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Create every distinct input layout exactly once.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the InputLayoutCache class.
+/// @par Revision History:
+///      $Source: InputLayoutCache.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/09 10:05:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "InputLayoutCache.hpp"
+#include "IGraphicsEngine.hpp"
+#include "CommandRecorder.hpp"
+#include <cstring>
+
+namespace
+{
+	unsigned long long hashBytes(const unsigned char* f_bytes, size_t f_size)
+	{
+		unsigned long long hash = 14695981039346656037ull;
+		for (size_t i = 0; i < f_size; ++i)
+		{
+			hash = (hash ^ f_bytes[i]) * 1099511628211ull;
+		}
+		return hash;
+	}
+
+	UINT readUInt(const unsigned char* f_bytes)
+	{
+		UINT value = 0;
+		::memcpy(&value, f_bytes, sizeof(value));
+		return value;
+	}
+}
+
+InputLayoutCache* InputLayoutCache::get()
+{
+	static InputLayoutCache cache;
+	return &cache;
+}
+
+ID3D11InputLayout* InputLayoutCache::getInputLayout(const D3D11_INPUT_ELEMENT_DESC* f_elements, UINT f_element_count,
+	unsigned long long f_format_hash, const void* f_shader_byte_code, size_t f_byte_code_size,
+	IGraphicsEngine* f_graphicsEngine)
+{
+	const Key key = { f_format_hash, hashInputSignature(f_shader_byte_code, f_byte_code_size) };
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto it = m_layouts.find(key);
+	if (it != m_layouts.end())
+	{
+		return it->second;
+	}
+
+	ID3D11InputLayout* layout = nullptr;
+	if (FAILED(f_graphicsEngine->getDevice()->CreateInputLayout(f_elements, f_element_count,
+		f_shader_byte_code, f_byte_code_size, &layout)))
+	{
+		return nullptr;
+	}
+
+	m_layouts.emplace(key, layout);
+	CommandRecorder::get()->onCreateInputLayout(layout, f_elements, f_element_count, f_shader_byte_code, f_byte_code_size);
+	return layout;
+}
+
+size_t InputLayoutCache::getSize()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_layouts.size();
+}
+
+void InputLayoutCache::release()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto& entry : m_layouts)
+	{
+		CommandRecorder::get()->onRelease(entry.second);
+		entry.second->Release();
+	}
+	m_layouts.clear();
+}
+
+unsigned long long InputLayoutCache::hashInputSignature(const void* f_shader_byte_code, size_t f_byte_code_size)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(f_shader_byte_code);
+
+	// DXBC container: magic, 16 byte checksum, version, total size, chunk count, chunk offsets
+	const size_t header_size = 32;
+	if (f_byte_code_size >= header_size && ::memcmp(bytes, "DXBC", 4) == 0)
+	{
+		const UINT chunk_count = readUInt(bytes + 28);
+		// Offsets and sizes come from the byte code: compare against what is left, never add to them
+		for (size_t i = 0; i < chunk_count && (f_byte_code_size - header_size) / 4 > i; ++i)
+		{
+			const size_t offset = readUInt(bytes + header_size + i * 4);
+			if (offset > f_byte_code_size || f_byte_code_size - offset < 8)
+			{
+				break;
+			}
+			const size_t chunk_size = readUInt(bytes + offset + 4);
+			const bool is_signature = ::memcmp(bytes + offset, "ISGN", 4) == 0 || ::memcmp(bytes + offset, "ISG1", 4) == 0;
+			if (is_signature && chunk_size <= f_byte_code_size - offset - 8)
+			{
+				return hashBytes(bytes + offset, 8 + chunk_size);
+			}
+		}
+	}
+
+	return hashBytes(bytes, f_byte_code_size);
+}
+
+InputLayoutCache::~InputLayoutCache()
+{
+}
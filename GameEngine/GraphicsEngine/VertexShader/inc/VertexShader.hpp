@@ -2,6 +2,7 @@
 #define _VERTEX_SHADER_HPP_
 
 #include <d3d11.h>
+#include <atomic>
 
 class IGraphicsEngine; // Forward declaration for IGraphicsEngine
 class DeviceContext;
@@ -10,11 +11,17 @@ class VertexShader
 {
 public:
 	VertexShader();
+
+	// Pipeline states take a reference so a shader released elsewhere never leaves them dangling
+	void addReference();
+
+	// Drops a reference; the last one destroys the shader
 	void release();
 	~VertexShader();
 private:
 	bool init(const void* f_shader_byte_code, size_t f_byte_code_size, IGraphicsEngine* f_graphicsEngine);
 	ID3D11VertexShader* m_vs;
+	std::atomic<unsigned int> m_references;
 	friend class GraphicsEngine;
 	friend class DeviceContext;
 };
@@ -1,17 +1,29 @@
 #include "VertexShader.hpp"
 #include "GraphicsEngine.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include "CommandRecorder.hpp"
 
-VertexShader::VertexShader()
+VertexShader::VertexShader() : m_vs(nullptr), m_references(1)
 {
 }
 
+void VertexShader::addReference()
+{
+	m_references.fetch_add(1, std::memory_order_relaxed);
+}
+
 void VertexShader::release()
 {
+	if (m_references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
 	if (m_vs)
 	{
-		m_vs->Release();
-		delete this;
+		CommandRecorder::get()->onRelease(this);
+		ResourceReleaseQueue::get()->deferRelease(m_vs, 0);
 	}
+	delete this;
 }
 
 bool VertexShader::init(const void* f_shader_byte_code, size_t f_byte_code_size, IGraphicsEngine* f_graphicsEngine)
@@ -20,6 +32,7 @@ bool VertexShader::init(const void* f_shader_byte_code, size_t f_byte_code_size,
 	{
 		return false;
 	}
+	CommandRecorder::get()->onCreateShader(this, CommandShaderStage::Vertex, f_shader_byte_code, f_byte_code_size);
 	return true;
 }
 
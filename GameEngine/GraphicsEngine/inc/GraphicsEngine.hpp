@@ -52,6 +52,22 @@ class IndexBuffer;
 class VertexShader;
 class PixelShader;
 class ConstantBuffer;
+class PipelineState;
+class ShaderProgram;
+class StaticGeometry;
+class StaticGeometryBuilder;
+class QuadBatcher;
+class DebugDrawRenderer;
+class GpuFrameTimer;
+class DynamicResolutionTarget;
+class FrameCapture;
+class LightClusterBuffer;
+class Texture;
+class StreamingTexture;
+class TextureData;
+class TextRenderer;
+class PipelineStateCache;
+struct PipelineStateDesc;
 
 /**
  * @class GraphicsEngine
@@ -187,7 +203,7 @@ public:
 	/// <param name="f_shader_byte_code"></param>
 	/// <param name="f_byte_code_size"></param>
 	/// <returns></returns>
-	VertexShader* createVertexShader(const void* f_shader_byte_code, size_t f_byte_code_size);
+	VertexShader* createVertexShader(const void* f_shader_byte_code, size_t f_byte_code_size) override;
 
 	/// <summary>
 	/// Creates a PixelShader instance associated with the GraphicsEngine.
@@ -196,34 +212,163 @@ public:
 	/// <param name="f_byte_code_size"></param>
 	/// <param name="f_graphicsEngine"></param>
 	/// <returns></returns>
-	PixelShader* createPixelShader(const void* f_shader_byte_code, size_t f_byte_code_size);
+	PixelShader* createPixelShader(const void* f_shader_byte_code, size_t f_byte_code_size) override;
+
+	/// <summary>
+	/// Returns the immutable pipeline state matching the description.
+	/// Identical descriptions are deduplicated, so the same pointer is returned for each of them.
+	/// The engine owns the returned object; it is released together with the engine.
+	/// </summary>
+	/// <param name="f_desc"></param>
+	/// <returns>The shared pipeline state, or nullptr if creation failed.</returns>
+	PipelineState* createPipelineState(const PipelineStateDesc& f_desc);
 
 	/// <summary>
 	/// Compiles a vertex shader from a file.
 	/// </summary>
 	/// <param name="f_file_name"></param>
 	/// <param name="f_entry_point_name"></param>
-	/// <param name="f_shader_byte_code"></param>
-	/// <param name="f_byte_code_size"></param>
+	/// <param name="f_byte_code">Receives the byte code; the caller releases it with Release().</param>
+	/// <returns></returns>
+	bool compileVertexShader(const wchar_t* f_file_name, const char* f_entry_point_name,
+        ID3DBlob** f_byte_code);
+
+	/// <summary>
+	/// Compiles a vertex shader from a file with the given preprocessor defines.
+	/// </summary>
+	/// <param name="f_file_name"></param>
+	/// <param name="f_entry_point_name"></param>
+	/// <param name="f_defines">Null terminated define list, or nullptr for none.</param>
+	/// <param name="f_byte_code">Receives the byte code; the caller releases it with Release().</param>
 	/// <returns></returns>
 	bool compileVertexShader(const wchar_t* f_file_name, const char* f_entry_point_name,
-        void** f_shader_byte_code, size_t* f_byte_code_size);
+		const D3D_SHADER_MACRO* f_defines, ID3DBlob** f_byte_code) override;
 
 	/// <summary>
 	/// Compiles a pixel shader from a file.
 	/// </summary>
 	/// <param name="f_file_name"></param>
 	/// <param name="f_entry_point_name"></param>
-	/// <param name="f_shader_byte_code"></param>
-	/// <param name="f_byte_code_size"></param>
+	/// <param name="f_byte_code">Receives the byte code; the caller releases it with Release().</param>
 	/// <returns></returns>
 	bool compilePixelShader(const wchar_t* f_file_name, const char* f_entry_point_name,
-		void** f_shader_byte_code, size_t* f_byte_code_size);
+		ID3DBlob** f_byte_code);
+
+	/// <summary>
+	/// Compiles a pixel shader from a file with the given preprocessor defines.
+	/// </summary>
+	/// <param name="f_file_name"></param>
+	/// <param name="f_entry_point_name"></param>
+	/// <param name="f_defines">Null terminated define list, or nullptr for none.</param>
+	/// <param name="f_byte_code">Receives the byte code; the caller releases it with Release().</param>
+	/// <returns></returns>
+	bool compilePixelShader(const wchar_t* f_file_name, const char* f_entry_point_name,
+		const D3D_SHADER_MACRO* f_defines, ID3DBlob** f_byte_code) override;
+
+	/// <summary>
+	/// Creates a ShaderProgram whose keyword permutations are compiled on demand.
+	/// </summary>
+	/// <param name="f_vs_file_name">Vertex shader source file.</param>
+	/// <param name="f_vs_entry_point">Vertex shader entry point.</param>
+	/// <param name="f_ps_file_name">Pixel shader source file.</param>
+	/// <param name="f_ps_entry_point">Pixel shader entry point.</param>
+	/// <returns>A pointer to the new ShaderProgram, or nullptr on invalid arguments.</returns>
+	ShaderProgram* createShaderProgram(const wchar_t* f_vs_file_name, const char* f_vs_entry_point,
+		const wchar_t* f_ps_file_name, const char* f_ps_entry_point);
+
+	/// <summary>
+	/// Uploads the merged batches of the builder into shared vertex and index buffers.
+	/// The builder may be cleared or destroyed afterwards.
+	/// </summary>
+	/// <param name="f_builder">Builder holding the packed static meshes.</param>
+	/// <returns>A pointer to the new StaticGeometry, or nullptr if a buffer could not be created.</returns>
+	StaticGeometry* createStaticGeometry(const StaticGeometryBuilder& f_builder);
+
+	/// <summary>
+	/// Creates a QuadBatcher whose vertex ring holds f_capacity quads per map.
+	/// </summary>
+	/// <param name="f_capacity">Quads streamed per map; larger batches are split.</param>
+	/// <returns>A pointer to the new QuadBatcher, or nullptr if a buffer could not be created.</returns>
+	QuadBatcher* createQuadBatcher(unsigned int f_capacity);
+
+	/// <summary>
+	/// Creates the renderer of the DebugDraw lines with a vertex ring of f_capacity vertices.
+	/// </summary>
+	/// <param name="f_capacity">Vertices streamed per map; larger layers are split.</param>
+	/// <returns>A pointer to the new DebugDrawRenderer, or nullptr if the vertex ring could not be created.</returns>
+	DebugDrawRenderer* createDebugDrawRenderer(unsigned int f_capacity);
+
+	/// <summary>
+	/// Creates a text renderer with a square glyph atlas texture.
+	/// </summary>
+	/// <param name="f_atlas_size">Width and height of the R8 atlas in texels.</param>
+	/// <param name="f_max_layouts">Shaped strings kept in the layout cache once unused.</param>
+	/// <returns>A pointer to the new TextRenderer, or nullptr if the atlas could not be created.</returns>
+	TextRenderer* createTextRenderer(unsigned int f_atlas_size, size_t f_max_layouts);
+
+	/// <summary>
+	/// Creates a GPU timer measuring the frame time with timestamp queries.
+	/// </summary>
+	/// <returns>A pointer to the new GpuFrameTimer, or nullptr if the queries could not be created.</returns>
+	GpuFrameTimer* createGpuFrameTimer();
 
 	/// <summary>
-	/// Releases the compiled shader.
+	/// Creates an output sized scene color target for rendering at a dynamic resolution.
 	/// </summary>
-	void releaseCompiledShader();
+	/// <param name="f_width">Output width, normally the swap chain width.</param>
+	/// <param name="f_height">Output height, normally the swap chain height.</param>
+	/// <returns>A pointer to the new DynamicResolutionTarget, or nullptr if the target or the upscale shaders could not be created.</returns>
+	DynamicResolutionTarget* createDynamicResolutionTarget(UINT f_width, UINT f_height);
+
+	/// <summary>
+	/// Creates a back buffer capture reading frames back through a ring of staging textures.
+	/// </summary>
+	/// <param name="f_readback_frames">Copies in flight before frames are dropped; 2 to 3 hides the GPU latency.</param>
+	/// <returns>A pointer to the new FrameCapture.</returns>
+	FrameCapture* createFrameCapture(UINT f_readback_frames);
+
+	/// <summary>
+	/// Creates the GPU buffers of a LightClusterGrid; they grow when a frame needs more.
+	/// </summary>
+	/// <param name="f_max_lights">Lights the buffers hold before growing.</param>
+	/// <param name="f_cluster_count">Clusters of the grid, LightClusterGrid::getClusterCount().</param>
+	/// <param name="f_max_light_indices">Light and cluster pairs the buffers hold before growing.</param>
+	/// <returns>A pointer to the new LightClusterBuffer, or nullptr if a buffer could not be created.</returns>
+	LightClusterBuffer* createLightClusterBuffer(UINT f_max_lights, UINT f_cluster_count, UINT f_max_light_indices);
+
+	/// <summary>
+	/// Creates an immutable texture from a mip chain, keeping block compressed formats compressed.
+	/// </summary>
+	/// <param name="f_data">Built by the TextureEncoder or read from a DDS file with TextureData::loadFile().</param>
+	/// <returns>A pointer to the new Texture, or nullptr if the texture could not be created.</returns>
+	Texture* createTexture(const TextureData& f_data);
+
+	/// <summary>
+	/// Creates a texture whose finer mips are streamed in later, see TextureStreamer.
+	/// </summary>
+	/// <param name="f_tail">The last mips of the chain, starting at TextureStreamer::getTailMip().</param>
+	/// <param name="f_width">Width of mip 0 of the full texture.</param>
+	/// <param name="f_height">Height of mip 0 of the full texture.</param>
+	/// <returns>A pointer to the new StreamingTexture, or nullptr if the tail does not match the size or the texture could not be created.</returns>
+	StreamingTexture* createStreamingTexture(const TextureData& f_tail, UINT f_width, UINT f_height);
+
+	/// <summary>
+	/// Marks the end of the frame: issues the budgeted batch of staged uploads,
+	/// signals the frame GPU fence, polls the fences of older frames and
+	/// releases the resources whose last frame completed.
+	/// Call it once per frame, right after SwapChain::present().
+	/// </summary>
+	void endFrame();
+
+	/// <summary>
+	/// Index of the frame currently being recorded.
+	/// </summary>
+	unsigned long long getFrameIndex() const { return m_frame_index; }
+
+	/// <summary>
+	/// Number of frames the GPU has finished executing.
+	/// </summary>
+	unsigned long long getCompletedFrameCount() const { return m_completed_frame_count; }
 
     /// <summary>
     /// Retrieves the DirectX 11 device associated with the GraphicsEngine.
@@ -283,11 +428,6 @@ private:
     /// </summary>
     IDXGIFactory* m_dxgi_factory_p;
     
-	/// <summary>
-	/// A pointer to the shader blob.
-	/// </summary>
-	ID3DBlob* m_blob = nullptr;
-
     /// <summary>
 	/// A pointer to the vertex shader blob.
     /// </summary>
@@ -308,6 +448,31 @@ private:
     /// </summary>
     ID3D11PixelShader* m_ps = nullptr;
 
+    /// <summary>
+	/// Global cache that hashes and deduplicates the pipeline states.
+    /// </summary>
+    PipelineStateCache* m_pipeline_state_cache_p = nullptr;
+
+    /// <summary>
+	/// Maximum number of frames recorded ahead of the GPU.
+    /// </summary>
+    static constexpr UINT max_frames_in_flight = 3;
+
+    /// <summary>
+	/// One event query per frame in flight, signaled when the GPU finished the frame.
+    /// </summary>
+    ID3D11Query* m_frame_fences[max_frames_in_flight] = {};
+
+    /// <summary>
+	/// Index of the frame currently being recorded.
+    /// </summary>
+    unsigned long long m_frame_index = 0;
+
+    /// <summary>
+	/// Number of frames the GPU has finished executing.
+    /// </summary>
+    unsigned long long m_completed_frame_count = 0;
+
     /*--------------------------------------------------------------
         Friends
     --------------------------------------------------------------*/
@@ -37,6 +37,9 @@
 
 #include <d3d11.h>
 
+class VertexShader;
+class PixelShader;
+
 /**
  * @interface IGraphicsEngine
  * @brief Interface for graphics engine functionality.
@@ -77,6 +80,34 @@ public:
     /// </summary>
     /// <returns>A pointer to the IDXGIFactory instance.</returns>
     virtual IDXGIFactory* getDXGIFactory() = 0;
+
+    /// <summary>
+    /// Compiles a vertex shader from a file with the given preprocessor defines.
+    /// Each call returns its own byte code, so shaders may be compiled from several threads.
+    /// </summary>
+    /// <param name="f_byte_code">Receives the byte code; the caller releases it with Release().</param>
+    virtual bool compileVertexShader(const wchar_t* f_file_name, const char* f_entry_point_name,
+        const D3D_SHADER_MACRO* f_defines, ID3DBlob** f_byte_code) = 0;
+
+    /// <summary>
+    /// Compiles a pixel shader from a file with the given preprocessor defines.
+    /// Each call returns its own byte code, so shaders may be compiled from several threads.
+    /// </summary>
+    /// <param name="f_byte_code">Receives the byte code; the caller releases it with Release().</param>
+    virtual bool compilePixelShader(const wchar_t* f_file_name, const char* f_entry_point_name,
+        const D3D_SHADER_MACRO* f_defines, ID3DBlob** f_byte_code) = 0;
+
+    /// <summary>
+    /// Creates a vertex shader from compiled byte code.
+    /// </summary>
+    /// <returns>The new VertexShader, or nullptr on failure.</returns>
+    virtual VertexShader* createVertexShader(const void* f_shader_byte_code, size_t f_byte_code_size) = 0;
+
+    /// <summary>
+    /// Creates a pixel shader from compiled byte code.
+    /// </summary>
+    /// <returns>The new PixelShader, or nullptr on failure.</returns>
+    virtual PixelShader* createPixelShader(const void* f_shader_byte_code, size_t f_byte_code_size) = 0;
 };
 
 #endif // IGRAPHICSENGINE_H
@@ -47,6 +47,22 @@
 #include "PixelShader.hpp"
 #include "DeviceContext.hpp"
 #include "ConstantBuffer.hpp"
+#include "PipelineState.hpp"
+#include "InputLayoutCache.hpp"
+#include "ShaderProgram.hpp"
+#include "StaticGeometry.hpp"
+#include "QuadBatcher.hpp"
+#include "DebugDrawRenderer.hpp"
+#include "TextRenderer.hpp"
+#include "GpuFrameTimer.hpp"
+#include "DynamicResolutionTarget.hpp"
+#include "FrameCapture.hpp"
+#include "LightClusterBuffer.hpp"
+#include "Texture.hpp"
+#include "StreamingTexture.hpp"
+#include "ResourceReleaseQueue.hpp"
+#include "UploadManager.hpp"
+#include "StartupTrace.hpp"
 #include <d3dcompiler.h>
 
 SwapChain* GraphicsEngine::createSwapChain()
@@ -96,39 +112,202 @@ PixelShader* GraphicsEngine::createPixelShader(const void* f_shader_byte_code, s
 	return ps;
 }
 
-bool GraphicsEngine::compileVertexShader(const wchar_t* f_file_name, const char* f_entry_point_name, void** f_shader_byte_code, size_t* f_byte_code_size)
+PipelineState* GraphicsEngine::createPipelineState(const PipelineStateDesc& f_desc)
+{
+	return m_pipeline_state_cache_p->getOrCreate(f_desc, this);
+}
+
+bool GraphicsEngine::compileVertexShader(const wchar_t* f_file_name, const char* f_entry_point_name, ID3DBlob** f_byte_code)
+{
+	return compileVertexShader(f_file_name, f_entry_point_name, nullptr, f_byte_code);
+}
+
+bool GraphicsEngine::compileVertexShader(const wchar_t* f_file_name, const char* f_entry_point_name, const D3D_SHADER_MACRO* f_defines, ID3DBlob** f_byte_code)
 {
 	ID3DBlob* errorblob = nullptr;
-    if (!SUCCEEDED(::D3DCompileFromFile(f_file_name, nullptr, nullptr, f_entry_point_name, "vs_5_0", 0, 0, &m_blob, &errorblob)))
+    if (!SUCCEEDED(::D3DCompileFromFile(f_file_name, f_defines, D3D_COMPILE_STANDARD_FILE_INCLUDE, f_entry_point_name, "vs_5_0", 0, 0, f_byte_code, &errorblob)))
     {
         if (errorblob) errorblob->Release();
 		return false;
     }
 
-	*f_shader_byte_code = m_blob->GetBufferPointer();
-	*f_byte_code_size = m_blob->GetBufferSize();
-
 	return true;
 }
 
-bool GraphicsEngine::compilePixelShader(const wchar_t* f_file_name, const char* f_entry_point_name, void** f_shader_byte_code, size_t* f_byte_code_size)
+bool GraphicsEngine::compilePixelShader(const wchar_t* f_file_name, const char* f_entry_point_name, ID3DBlob** f_byte_code)
+{
+	return compilePixelShader(f_file_name, f_entry_point_name, nullptr, f_byte_code);
+}
+
+bool GraphicsEngine::compilePixelShader(const wchar_t* f_file_name, const char* f_entry_point_name, const D3D_SHADER_MACRO* f_defines, ID3DBlob** f_byte_code)
 {
 	ID3DBlob* errorblob = nullptr;
-	if (!SUCCEEDED(::D3DCompileFromFile(f_file_name, nullptr, nullptr, f_entry_point_name, "ps_5_0", 0, 0, &m_blob, &errorblob)))
+	if (!SUCCEEDED(::D3DCompileFromFile(f_file_name, f_defines, D3D_COMPILE_STANDARD_FILE_INCLUDE, f_entry_point_name, "ps_5_0", 0, 0, f_byte_code, &errorblob)))
 	{
 		if (errorblob) errorblob->Release();
 		return false;
 	}
 
-	*f_shader_byte_code = m_blob->GetBufferPointer();
-	*f_byte_code_size = m_blob->GetBufferSize();
-
 	return true;
 }
 
-void GraphicsEngine::releaseCompiledShader()
+ShaderProgram* GraphicsEngine::createShaderProgram(const wchar_t* f_vs_file_name, const char* f_vs_entry_point,
+	const wchar_t* f_ps_file_name, const char* f_ps_entry_point)
 {
-	if (m_blob) m_blob->Release();
+	ShaderProgram* program = new ShaderProgram();
+	if (!program->init(f_vs_file_name, f_vs_entry_point, f_ps_file_name, f_ps_entry_point, this))
+	{
+		program->release();
+		return nullptr;
+	}
+	return program;
+}
+
+StaticGeometry* GraphicsEngine::createStaticGeometry(const StaticGeometryBuilder& f_builder)
+{
+	StaticGeometry* geometry = new StaticGeometry();
+	if (!geometry->init(f_builder, this))
+	{
+		geometry->release();
+		return nullptr;
+	}
+	return geometry;
+}
+
+QuadBatcher* GraphicsEngine::createQuadBatcher(unsigned int f_capacity)
+{
+	QuadBatcher* batcher = new QuadBatcher();
+	if (!batcher->init(f_capacity, this))
+	{
+		batcher->release();
+		return nullptr;
+	}
+	return batcher;
+}
+
+DebugDrawRenderer* GraphicsEngine::createDebugDrawRenderer(unsigned int f_capacity)
+{
+	DebugDrawRenderer* renderer = new DebugDrawRenderer();
+	if (!renderer->init(f_capacity, this))
+	{
+		renderer->release();
+		return nullptr;
+	}
+	return renderer;
+}
+
+TextRenderer* GraphicsEngine::createTextRenderer(unsigned int f_atlas_size, size_t f_max_layouts)
+{
+	TextRenderer* renderer = new TextRenderer();
+	if (!renderer->init(f_atlas_size, f_max_layouts, this))
+	{
+		renderer->release();
+		return nullptr;
+	}
+	return renderer;
+}
+
+GpuFrameTimer* GraphicsEngine::createGpuFrameTimer()
+{
+	GpuFrameTimer* timer = new GpuFrameTimer();
+	if (!timer->init(this))
+	{
+		timer->release();
+		return nullptr;
+	}
+	return timer;
+}
+
+DynamicResolutionTarget* GraphicsEngine::createDynamicResolutionTarget(UINT f_width, UINT f_height)
+{
+	DynamicResolutionTarget* target = new DynamicResolutionTarget();
+	if (!target->init(f_width, f_height, this))
+	{
+		target->release();
+		return nullptr;
+	}
+	return target;
+}
+
+FrameCapture* GraphicsEngine::createFrameCapture(UINT f_readback_frames)
+{
+	FrameCapture* capture = new FrameCapture();
+	if (!capture->init(f_readback_frames, this))
+	{
+		capture->release();
+		return nullptr;
+	}
+	return capture;
+}
+
+LightClusterBuffer* GraphicsEngine::createLightClusterBuffer(UINT f_max_lights, UINT f_cluster_count, UINT f_max_light_indices)
+{
+	LightClusterBuffer* buffer = new LightClusterBuffer();
+	if (!buffer->init(f_max_lights, f_cluster_count, f_max_light_indices, this))
+	{
+		buffer->release();
+		return nullptr;
+	}
+	return buffer;
+}
+
+Texture* GraphicsEngine::createTexture(const TextureData& f_data)
+{
+	Texture* texture = new Texture();
+	if (!texture->init(f_data, this))
+	{
+		texture->release();
+		return nullptr;
+	}
+	return texture;
+}
+
+StreamingTexture* GraphicsEngine::createStreamingTexture(const TextureData& f_tail, UINT f_width, UINT f_height)
+{
+	StreamingTexture* texture = new StreamingTexture();
+	if (!texture->init(f_tail, f_width, f_height, this))
+	{
+		texture->release();
+		return nullptr;
+	}
+	return texture;
+}
+
+void GraphicsEngine::endFrame()
+{
+	// Copies issued now are visible to every draw of the next frame
+	UploadManager::get()->submit(m_imm_context);
+
+	ID3D11Query* fence = m_frame_fences[m_frame_index % max_frames_in_flight];
+	if (fence) m_imm_context->End(fence);
+
+	m_frame_index++;
+	ResourceReleaseQueue::get()->advanceFrame(m_frame_index);
+
+	while (m_completed_frame_count < m_frame_index)
+	{
+		ID3D11Query* pending = m_frame_fences[m_completed_frame_count % max_frames_in_flight];
+		// The oldest fence must be free before its slot is reused next frame
+		const bool must_wait = m_frame_index - m_completed_frame_count >= max_frames_in_flight;
+		if (!pending)
+		{
+			// No query available: assume the frame is done max_frames_in_flight frames later
+			if (!must_wait) break;
+		}
+		else
+		{
+			HRESULT res = S_FALSE;
+			do
+			{
+				res = m_imm_context->GetData(pending, nullptr, 0, must_wait ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH);
+			} while (res == S_FALSE && must_wait);
+
+			if (res == S_FALSE) break;
+		}
+		m_completed_frame_count++;
+	}
+
+	ResourceReleaseQueue::get()->retire(m_completed_frame_count);
 }
 
 GraphicsEngine* GraphicsEngine::get()
@@ -149,6 +328,12 @@ bool GraphicsEngine::init()
         D3D_DRIVER_TYPE_WARP,
         D3D_DRIVER_TYPE_REFERENCE
     };
+    const char* driver_type_names[] =
+    {
+        "D3D11CreateDevice hardware",
+        "D3D11CreateDevice warp",
+        "D3D11CreateDevice reference"
+    };
     UINT num_driver_types = ARRAYSIZE(driver_types);
     
     D3D_FEATURE_LEVEL feature_levels[] =
@@ -161,6 +346,8 @@ bool GraphicsEngine::init()
     
     for (UINT idx = 0; idx < num_driver_types; idx++)
     {
+         // A failing hardware attempt can dominate startup, so each attempt is its own span
+         StartupTrace::Scope trace(driver_type_names[idx]);
          res = D3D11CreateDevice(NULL, driver_types[idx], NULL, NULL,
             feature_levels, num_feature_levels, D3D11_SDK_VERSION,
             &m_d3d_device, &m_feature_level_p, &m_imm_context);
@@ -173,6 +360,17 @@ bool GraphicsEngine::init()
     }
 
     m_imm_device_context_p = new DeviceContext(m_imm_context);
+    m_pipeline_state_cache_p = new PipelineStateCache();
+
+    D3D11_QUERY_DESC fence_desc = {};
+    fence_desc.Query = D3D11_QUERY_EVENT;
+    for (UINT idx = 0; idx < max_frames_in_flight; idx++)
+    {
+        if (FAILED(m_d3d_device->CreateQuery(&fence_desc, &m_frame_fences[idx])))
+        {
+            m_frame_fences[idx] = nullptr;
+        }
+    }
 
     m_d3d_device->QueryInterface(__uuidof(IDXGIDevice), (void**)&m_dxgi_device_p);
     m_dxgi_device_p->GetParent(__uuidof(IDXGIAdapter), (void**)&m_dxgi_adapter_p);
@@ -183,6 +381,28 @@ bool GraphicsEngine::init()
 
 bool GraphicsEngine::release()
 {
+    // Nothing is in flight once the queued work is finished
+    if (m_imm_context)
+    {
+        m_imm_context->ClearState();
+        m_imm_context->Flush();
+    }
+    UploadManager::get()->release();
+
+    // Before the flush: the states drop the last references on the shaders they use
+    if (m_pipeline_state_cache_p)
+    {
+        delete m_pipeline_state_cache_p;
+        m_pipeline_state_cache_p = nullptr;
+    }
+    ResourceReleaseQueue::get()->flush();
+    for (UINT idx = 0; idx < max_frames_in_flight; idx++)
+    {
+        if (m_frame_fences[idx]) m_frame_fences[idx]->Release();
+        m_frame_fences[idx] = nullptr;
+    }
+
+    InputLayoutCache::get()->release();
     if (m_dxgi_device_p) m_dxgi_device_p->Release();
     if (m_dxgi_adapter_p) m_dxgi_adapter_p->Release();
     if (m_dxgi_factory_p) m_dxgi_factory_p->Release();
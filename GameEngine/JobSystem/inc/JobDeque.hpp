@@ -0,0 +1,192 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Work-stealing deque of jobs
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Memory orders follow Le, Pop, Cohen, Zappa Nardelli: "Correct and
+//    Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Let engine subsystems spread their work over every core.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the JobDeque class.
+/// @par Revision History:
+///      $Source: JobDeque.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/17 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _JOB_DEQUE_HPP_
+#define _JOB_DEQUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+struct Job;
+
+/**
+ * @class JobDeque
+ * @brief Chase-Lev deque: the owning thread pushes and pops at the bottom, other threads steal from the top.
+ *
+ * The owner works depth first on the jobs it pushed last, which are still hot
+ * in its cache, while thieves take the oldest jobs, which for recursively
+ * split work are the largest. push() and pop() only touch the owner's end and
+ * need no atomic read-modify-write except when taking the last job; steal()
+ * is one compare-exchange. The capacity is fixed: push() fails when full and
+ * the caller runs the job itself.
+ *
+ * Example usage:
+ * @code
+ * // Owner                     // Any other thread
+ * deque.push(job);             if (Job* job = deque.steal())
+ * if (Job* job = deque.pop())  {
+ * {                                execute(job);
+ *     execute(job);            }
+ * }
+ * @endcode
+ */
+class JobDeque
+{
+public:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	/// <param name="f_capacity">Rounded up to a power of two.</param>
+	explicit JobDeque(size_t f_capacity = 4096) : m_top(0), m_bottom(0)
+	{
+		size_t capacity = 1;
+		while (capacity < f_capacity)
+		{
+			capacity <<= 1;
+		}
+		m_mask = capacity - 1;
+		m_jobs.reset(new std::atomic<Job*>[capacity]);
+	}
+
+	JobDeque(const JobDeque&) = delete;
+	JobDeque& operator=(const JobDeque&) = delete;
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Owner only: adds a job at the bottom.
+	/// </summary>
+	/// <returns>false when the deque is full.</returns>
+	bool push(Job* f_job)
+	{
+		const long long bottom = m_bottom.load(std::memory_order_relaxed);
+		const long long top = m_top.load(std::memory_order_acquire);
+		if (bottom - top > static_cast<long long>(m_mask))
+		{
+			return false;
+		}
+		m_jobs[bottom & m_mask].store(f_job, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/// <summary>
+	/// Owner only: takes the job pushed last.
+	/// </summary>
+	Job* pop()
+	{
+		const long long bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		m_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		long long top = m_top.load(std::memory_order_relaxed);
+
+		if (top > bottom)
+		{
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		Job* job = m_jobs[bottom & m_mask].load(std::memory_order_relaxed);
+		if (top == bottom)
+		{
+			// The last job: race the thieves for it
+			if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				job = nullptr;
+			}
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+
+	/// <summary>
+	/// Any thread: takes the oldest job. nullptr when empty or when another thread won the race for it.
+	/// </summary>
+	Job* steal()
+	{
+		long long top = m_top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const long long bottom = m_bottom.load(std::memory_order_acquire);
+		if (top >= bottom)
+		{
+			return nullptr;
+		}
+
+		Job* job = m_jobs[top & m_mask].load(std::memory_order_relaxed);
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+		return job;
+	}
+
+	/// <summary>
+	/// Jobs in the deque; exact for the owner, a snapshot for other threads.
+	/// </summary>
+	size_t size() const
+	{
+		const long long bottom = m_bottom.load(std::memory_order_relaxed);
+		const long long top = m_top.load(std::memory_order_relaxed);
+		return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+	}
+
+	bool empty() const { return size() == 0; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	// On separate cache lines: thieves write the top, the owner the bottom
+	alignas(64) std::atomic<long long> m_top;
+	alignas(64) std::atomic<long long> m_bottom;
+	alignas(64) std::unique_ptr<std::atomic<Job*>[]> m_jobs;
+	size_t m_mask;
+};
+
+#endif // !_JOB_DEQUE_HPP_
@@ -0,0 +1,382 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Work-stealing job system
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Jobs are taken from a ring of 4096 per thread and never allocated;
+//    when the ring or the deque is full the job runs on the spot instead.
+//  - A waiting thread runs other jobs on its own stack, so a job that waits
+//    must not hold a lock another job needs.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Let engine subsystems spread their work over every core.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the JobSystem and JobCounter classes.
+/// @par Revision History:
+///      $Source: JobSystem.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/17 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _JOB_SYSTEM_HPP_
+#define _JOB_SYSTEM_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class JobCounter;
+
+/// <summary>
+/// A unit of work with its closure stored inline; one or two cache lines.
+/// </summary>
+struct Job
+{
+	static constexpr size_t storage_size = 88;
+
+	void (*invoke)(Job& f_job) = nullptr;    // Calls and destroys the closure
+	JobCounter* counter = nullptr;           // Decremented once the job ran
+	Job* next = nullptr;                     // In the continuation list of a counter
+	std::atomic<bool> busy{ false };         // Taken from the ring and not finished yet
+	alignas(16) unsigned char storage[storage_size];
+};
+
+/**
+ * @class JobCounter
+ * @brief Counts the unfinished jobs of a group; waiting on it or starting jobs after it expresses dependencies.
+ *
+ * Every job run with a counter increments it and decrements it once done.
+ * JobSystem::wait() runs other jobs until it is zero; JobSystem::runAfter()
+ * starts a job once it is zero, without blocking a thread. A counter must
+ * outlive its jobs and continuations, which wait() guarantees.
+ */
+class JobCounter
+{
+public:
+
+	JobCounter() : m_pending(0), m_locked(false), m_continuations(nullptr) {}
+	JobCounter(const JobCounter&) = delete;
+	JobCounter& operator=(const JobCounter&) = delete;
+
+	/// <summary>
+	/// True once every job counted was finished and no thread touches the counter any more.
+	/// </summary>
+	bool isDone() const
+	{
+		return m_pending.load(std::memory_order_acquire) == 0 && !m_locked.load(std::memory_order_acquire);
+	}
+
+	unsigned int getPending() const { return m_pending.load(std::memory_order_relaxed); }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void lock()
+	{
+		while (m_locked.exchange(true, std::memory_order_acquire))
+		{
+		}
+	}
+
+	void unlock() { m_locked.store(false, std::memory_order_release); }
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::atomic<unsigned int> m_pending;
+	std::atomic<bool> m_locked;              // Guards the continuations and the decrement to zero
+	Job* m_continuations;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class JobSystem;
+};
+
+/**
+ * @class JobSystem
+ * @brief Runs jobs on one worker thread per core with work stealing; the thread that calls init() is worker 0.
+ *
+ * Every worker owns a JobDeque. Jobs are pushed to the deque of the thread
+ * that creates them and popped by it last in, first out; idle workers steal
+ * the oldest jobs from the others and sleep when there is nothing to steal.
+ * Threads that are not workers can submit jobs too, through a shared queue.
+ *
+ * wait() does not block: the waiting thread runs jobs until the counter is
+ * zero, so the main thread works alongside the workers instead of idling.
+ * parallelFor() splits a range lazily: a range job hands out half of what is
+ * left only when its own deque is empty, i.e. when thieves could use work,
+ * so the number of jobs adapts to how many threads are actually free.
+ *
+ * Example usage:
+ * @code
+ * JobSystem::get()->init();
+ * JobSystem::get()->parallelFor(object_count, [&](unsigned int f_begin, unsigned int f_end)
+ * {
+ *     for (unsigned int i = f_begin; i < f_end; ++i) updateTransform(i);
+ * });
+ *
+ * JobCounter culled;
+ * JobCounter drawn;
+ * JobSystem::get()->run(culled, [&]() { cullScene(); });
+ * JobSystem::get()->runAfter(culled, drawn, [&]() { buildDrawLists(); });
+ * JobSystem::get()->wait(drawn);
+ * @endcode
+ */
+class JobSystem
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since init() or resetStatistics().
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long executed_jobs = 0;
+		unsigned long long stolen_jobs = 0;
+		unsigned long long inline_jobs = 0;        // Ran on the spot because a ring or deque was full
+		unsigned long long sleeps = 0;             // Times a worker went to sleep
+		std::vector<unsigned long long> executed_per_thread;   // Worker 0 first, then the other threads
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	JobSystem();
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+	~JobSystem();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Starts the worker threads; the calling thread becomes worker 0.
+	/// </summary>
+	/// <param name="f_thread_count">Workers including the caller; 0 uses one per hardware thread.</param>
+	bool init(unsigned int f_thread_count = 0);
+
+	/// <summary>
+	/// Stops and joins the workers; every counter must have been waited for.
+	/// </summary>
+	void shutdown();
+
+	unsigned int getThreadCount() const { return static_cast<unsigned int>(m_workers.size()); }
+
+	/// <summary>
+	/// Index of the calling worker, or getThreadCount() for other threads.
+	/// </summary>
+	unsigned int getWorkerIndex() const;
+
+	/// <summary>
+	/// Starts f_function() as a job counted by f_counter.
+	/// </summary>
+	template<typename Function>
+	void run(JobCounter& f_counter, Function&& f_function)
+	{
+		Job* job = createJob(f_counter, std::forward<Function>(f_function));
+		if (!job)
+		{
+			f_function();
+			return;
+		}
+		submit(job);
+	}
+
+	/// <summary>
+	/// Starts f_function() as a job counted by f_counter once f_dependency is zero.
+	/// </summary>
+	template<typename Function>
+	void runAfter(JobCounter& f_dependency, JobCounter& f_counter, Function&& f_function)
+	{
+		Job* job = createJob(f_counter, std::forward<Function>(f_function));
+		if (!job)
+		{
+			wait(f_dependency);
+			f_function();
+			return;
+		}
+		submitAfter(f_dependency, job);
+	}
+
+	/// <summary>
+	/// Runs jobs until f_counter is zero.
+	/// </summary>
+	void wait(JobCounter& f_counter);
+
+	/// <summary>
+	/// Calls f_function(begin, end) over [0, f_count) in chunks of at most f_grain indices, on every worker, and waits.
+	/// </summary>
+	/// <param name="f_grain">Smallest chunk worth a job; 0 picks one from f_count and the thread count.</param>
+	template<typename Function>
+	void parallelFor(unsigned int f_count, const Function& f_function, unsigned int f_grain = 0)
+	{
+		if (f_count == 0)
+		{
+			return;
+		}
+		const unsigned int grain = f_grain ? f_grain : getDefaultGrain(f_count);
+		if (m_workers.size() <= 1 || f_count <= grain)
+		{
+			f_function(0u, f_count);
+			return;
+		}
+
+		JobCounter counter;
+		runRange(counter, &f_function, 0, f_count, grain);
+		wait(counter);
+	}
+
+	Statistics getStatistics() const;
+
+	void resetStatistics();
+
+	/// <summary>
+	/// The engine-wide job system.
+	/// </summary>
+	static JobSystem* get();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Worker;
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	template<typename Function>
+	Job* createJob(JobCounter& f_counter, Function&& f_function)
+	{
+		using Closure = typename std::decay<Function>::type;
+		static_assert(sizeof(Closure) <= Job::storage_size, "Job closure too large, capture by reference or through a pointer");
+		static_assert(alignof(Closure) <= 16, "Job closure over-aligned");
+
+		Job* job = allocateJob();
+		if (!job)
+		{
+			return nullptr;
+		}
+		new (job->storage) Closure(std::forward<Function>(f_function));
+		job->invoke = [](Job& f_job)
+		{
+			Closure* closure = std::launder(reinterpret_cast<Closure*>(f_job.storage));
+			(*closure)();
+			closure->~Closure();
+		};
+		job->counter = &f_counter;
+		job->next = nullptr;
+		f_counter.m_pending.fetch_add(1, std::memory_order_relaxed);
+		return job;
+	}
+
+	template<typename Function>
+	void runRange(JobCounter& f_counter, const Function* f_function, unsigned int f_begin, unsigned int f_end, unsigned int f_grain)
+	{
+		run(f_counter, [this, &f_counter, f_function, f_begin, f_end, f_grain]()
+		{
+			unsigned int begin = f_begin;
+			unsigned int end = f_end;
+			while (begin < end)
+			{
+				// Split only when this thread has nothing left that a thief could take
+				if (end - begin > 2 * f_grain && isLocalQueueEmpty())
+				{
+					const unsigned int middle = begin + (end - begin) / 2;
+					runRange(f_counter, f_function, middle, end, f_grain);
+					end = middle;
+				}
+				const unsigned int chunk_end = begin + std::min(f_grain, end - begin);
+				(*f_function)(begin, chunk_end);
+				begin = chunk_end;
+			}
+		});
+	}
+
+	/// <summary>
+	/// A job from the ring of the calling thread, nullptr when the ring is full.
+	/// </summary>
+	Job* allocateJob();
+
+	void submit(Job* f_job);
+
+	void submitAfter(JobCounter& f_dependency, Job* f_job);
+
+	/// <summary>
+	/// Runs the job and finishes it: frees its ring slot, decrements its counter, starts continuations.
+	/// </summary>
+	void execute(Job* f_job);
+
+	/// <summary>
+	/// Runs one job from the calling thread's deque, another worker's or the shared queue.
+	/// </summary>
+	bool executeNext();
+
+	bool isLocalQueueEmpty() const;
+
+	unsigned int getDefaultGrain(unsigned int f_count) const;
+
+	void wakeWorkers();
+
+	void workerLoop(unsigned int f_index);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<std::unique_ptr<Worker>> m_workers;
+	std::unique_ptr<Worker> m_external;      // Ring and queue of threads that are not workers
+	std::atomic<bool> m_stopping;
+	std::atomic<unsigned long long> m_work_epoch;    // Bumped on every submit, wakes sleepers
+	std::atomic<unsigned int> m_sleeping;
+	std::mutex m_sleep_mutex;
+	std::condition_variable m_sleep_condition;
+	std::atomic<unsigned long long> m_inline_jobs;
+	std::atomic<unsigned long long> m_sleeps;
+	unsigned long long m_generation;         // Tells a stale thread index from an earlier init() apart
+};
+
+#endif // !_JOB_SYSTEM_HPP_
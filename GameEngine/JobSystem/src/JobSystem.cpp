@@ -0,0 +1,427 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Work-stealing job system
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Let engine subsystems spread their work over every core.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the JobSystem and JobCounter classes.
+/// @par Revision History:
+///      $Source: JobSystem.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/17 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "JobSystem.hpp"
+#include "JobDeque.hpp"
+#include <deque>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JOB_SYSTEM_SSE2 1
+#endif
+
+namespace
+{
+	constexpr size_t ring_size = 4096;
+	constexpr unsigned int spin_rounds = 256;
+	constexpr unsigned int grains_per_thread = 16;
+
+	/// <summary>
+	/// Which job system and worker the thread belongs to.
+	/// </summary>
+	struct ThreadSlot
+	{
+		const JobSystem* system = nullptr;
+		unsigned long long generation = 0;
+		unsigned int index = 0;
+	};
+
+	thread_local ThreadSlot t_thread;
+
+	std::atomic<unsigned long long> s_next_generation(0);
+
+	void spinPause()
+	{
+#if JOB_SYSTEM_SSE2
+		_mm_pause();
+#else
+		std::this_thread::yield();
+#endif
+	}
+}
+
+struct JobSystem::Worker
+{
+	JobDeque deque{ ring_size };
+	std::unique_ptr<Job[]> ring{ new Job[ring_size] };
+	size_t next_job = 0;
+	std::thread thread;
+	std::atomic<unsigned long long> executed{ 0 };
+	std::atomic<unsigned long long> stolen{ 0 };
+
+	// Only used by the shared queue of threads that are not workers
+	std::mutex mutex;
+	std::deque<Job*> queue;
+	std::atomic<size_t> queued{ 0 };
+};
+
+JobSystem::JobSystem()
+	: m_stopping(false), m_work_epoch(0), m_sleeping(0), m_inline_jobs(0), m_sleeps(0), m_generation(0)
+{
+}
+
+bool JobSystem::init(unsigned int f_thread_count)
+{
+	shutdown();
+
+	unsigned int thread_count = f_thread_count ? f_thread_count : std::thread::hardware_concurrency();
+	thread_count = std::max(1u, thread_count);
+
+	m_generation = ++s_next_generation;
+	m_stopping.store(false);
+	m_inline_jobs.store(0);
+	m_sleeps.store(0);
+	m_external.reset(new Worker());
+	for (unsigned int i = 0; i < thread_count; ++i)
+	{
+		m_workers.emplace_back(new Worker());
+	}
+
+	t_thread.system = this;
+	t_thread.generation = m_generation;
+	t_thread.index = 0;
+	for (unsigned int i = 1; i < thread_count; ++i)
+	{
+		m_workers[i]->thread = std::thread(&JobSystem::workerLoop, this, i);
+	}
+	return true;
+}
+
+void JobSystem::shutdown()
+{
+	if (m_workers.empty())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_sleep_mutex);
+		m_stopping.store(true);
+	}
+	m_sleep_condition.notify_all();
+	for (std::unique_ptr<Worker>& worker : m_workers)
+	{
+		if (worker->thread.joinable())
+		{
+			worker->thread.join();
+		}
+	}
+	m_workers.clear();
+	m_external.reset();
+}
+
+unsigned int JobSystem::getWorkerIndex() const
+{
+	if (t_thread.system == this && t_thread.generation == m_generation)
+	{
+		return t_thread.index;
+	}
+	return static_cast<unsigned int>(m_workers.size());
+}
+
+Job* JobSystem::allocateJob()
+{
+	if (m_workers.empty())
+	{
+		return nullptr;
+	}
+
+	const unsigned int index = getWorkerIndex();
+	Worker& worker = index < m_workers.size() ? *m_workers[index] : *m_external;
+	std::unique_lock<std::mutex> lock(worker.mutex, std::defer_lock);
+	if (&worker == m_external.get())
+	{
+		lock.lock();
+	}
+
+	// The ring is only reused once the job that had the slot has finished
+	Job& job = worker.ring[worker.next_job & (ring_size - 1)];
+	if (job.busy.load(std::memory_order_acquire))
+	{
+		m_inline_jobs.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+	job.busy.store(true, std::memory_order_relaxed);
+	worker.next_job++;
+	return &job;
+}
+
+void JobSystem::submit(Job* f_job)
+{
+	const unsigned int index = getWorkerIndex();
+	if (index < m_workers.size())
+	{
+		if (!m_workers[index]->deque.push(f_job))
+		{
+			m_inline_jobs.fetch_add(1, std::memory_order_relaxed);
+			execute(f_job);
+			return;
+		}
+	}
+	else
+	{
+		std::lock_guard<std::mutex> lock(m_external->mutex);
+		m_external->queue.push_back(f_job);
+		m_external->queued.fetch_add(1);
+	}
+	wakeWorkers();
+}
+
+void JobSystem::submitAfter(JobCounter& f_dependency, Job* f_job)
+{
+	f_dependency.lock();
+	if (f_dependency.m_pending.load(std::memory_order_acquire) == 0)
+	{
+		f_dependency.unlock();
+		submit(f_job);
+		return;
+	}
+	f_job->next = f_dependency.m_continuations;
+	f_dependency.m_continuations = f_job;
+	f_dependency.unlock();
+}
+
+void JobSystem::execute(Job* f_job)
+{
+	f_job->invoke(*f_job);
+
+	JobCounter* counter = f_job->counter;
+	f_job->busy.store(false, std::memory_order_release);
+
+	// The decrement to zero and taking the continuations happen under the lock, so a waiter
+	// that sees the counter done knows this thread is no longer touching it
+	counter->lock();
+	Job* continuation = nullptr;
+	if (counter->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		continuation = counter->m_continuations;
+		counter->m_continuations = nullptr;
+	}
+	counter->unlock();
+
+	while (continuation)
+	{
+		Job* next = continuation->next;
+		continuation->next = nullptr;
+		submit(continuation);
+		continuation = next;
+	}
+}
+
+bool JobSystem::executeNext()
+{
+	const unsigned int worker_count = static_cast<unsigned int>(m_workers.size());
+	if (worker_count == 0)
+	{
+		return false;
+	}
+
+	const unsigned int index = getWorkerIndex();
+	if (index < worker_count)
+	{
+		if (Job* job = m_workers[index]->deque.pop())
+		{
+			m_workers[index]->executed.fetch_add(1, std::memory_order_relaxed);
+			execute(job);
+			return true;
+		}
+	}
+
+	for (unsigned int i = 1; i <= worker_count; ++i)
+	{
+		const unsigned int victim = (index + i) % worker_count;
+		if (victim == index)
+		{
+			continue;
+		}
+		if (Job* job = m_workers[victim]->deque.steal())
+		{
+			Worker& thief = index < worker_count ? *m_workers[index] : *m_external;
+			thief.executed.fetch_add(1, std::memory_order_relaxed);
+			thief.stolen.fetch_add(1, std::memory_order_relaxed);
+			execute(job);
+			return true;
+		}
+	}
+
+	if (m_external->queued.load() > 0)
+	{
+		Job* job = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(m_external->mutex);
+			if (!m_external->queue.empty())
+			{
+				job = m_external->queue.front();
+				m_external->queue.pop_front();
+				m_external->queued.fetch_sub(1);
+			}
+		}
+		if (job)
+		{
+			(index < worker_count ? *m_workers[index] : *m_external).executed.fetch_add(1, std::memory_order_relaxed);
+			execute(job);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool JobSystem::isLocalQueueEmpty() const
+{
+	const unsigned int index = getWorkerIndex();
+	return index < m_workers.size() ? m_workers[index]->deque.empty() : m_external->queued.load() == 0;
+}
+
+unsigned int JobSystem::getDefaultGrain(unsigned int f_count) const
+{
+	const unsigned int chunks = std::max(1u, static_cast<unsigned int>(m_workers.size()) * grains_per_thread);
+	return std::max(1u, f_count / chunks);
+}
+
+void JobSystem::wait(JobCounter& f_counter)
+{
+	unsigned int idle_rounds = 0;
+	while (!f_counter.isDone())
+	{
+		if (executeNext())
+		{
+			idle_rounds = 0;
+		}
+		else if (++idle_rounds < spin_rounds)
+		{
+			spinPause();
+		}
+		else
+		{
+			// The last jobs run elsewhere; let them have this core
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::wakeWorkers()
+{
+	m_work_epoch.fetch_add(1);
+	if (m_sleeping.load() > 0)
+	{
+		// Taking the lock orders the wake-up after a sleeper's last look at the epoch
+		{
+			std::lock_guard<std::mutex> lock(m_sleep_mutex);
+		}
+		m_sleep_condition.notify_one();
+	}
+}
+
+void JobSystem::workerLoop(unsigned int f_index)
+{
+	t_thread.system = this;
+	t_thread.generation = m_generation;
+	t_thread.index = f_index;
+
+	while (!m_stopping.load(std::memory_order_acquire))
+	{
+		const unsigned long long epoch = m_work_epoch.load();
+		bool found = executeNext();
+		for (unsigned int round = 0; !found && round < spin_rounds; ++round)
+		{
+			spinPause();
+			found = executeNext();
+		}
+		if (found)
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_sleep_mutex);
+		m_sleeping.fetch_add(1);
+		m_sleeps.fetch_add(1, std::memory_order_relaxed);
+		m_sleep_condition.wait(lock, [this, epoch] { return m_stopping.load() || m_work_epoch.load() != epoch; });
+		m_sleeping.fetch_sub(1);
+	}
+}
+
+JobSystem::Statistics JobSystem::getStatistics() const
+{
+	Statistics statistics;
+	statistics.inline_jobs = m_inline_jobs.load(std::memory_order_relaxed);
+	statistics.sleeps = m_sleeps.load(std::memory_order_relaxed);
+	for (const std::unique_ptr<Worker>& worker : m_workers)
+	{
+		statistics.executed_per_thread.push_back(worker->executed.load(std::memory_order_relaxed));
+		statistics.stolen_jobs += worker->stolen.load(std::memory_order_relaxed);
+	}
+	if (m_external)
+	{
+		statistics.executed_per_thread.push_back(m_external->executed.load(std::memory_order_relaxed));
+		statistics.stolen_jobs += m_external->stolen.load(std::memory_order_relaxed);
+	}
+	for (unsigned long long executed : statistics.executed_per_thread)
+	{
+		statistics.executed_jobs += executed;
+	}
+	return statistics;
+}
+
+void JobSystem::resetStatistics()
+{
+	for (std::unique_ptr<Worker>& worker : m_workers)
+	{
+		worker->executed.store(0);
+		worker->stolen.store(0);
+	}
+	if (m_external)
+	{
+		m_external->executed.store(0);
+		m_external->stolen.store(0);
+	}
+	m_inline_jobs.store(0);
+	m_sleeps.store(0);
+}
+
+JobSystem* JobSystem::get()
+{
+	static JobSystem instance;
+	return &instance;
+}
+
+JobSystem::~JobSystem()
+{
+	shutdown();
+}
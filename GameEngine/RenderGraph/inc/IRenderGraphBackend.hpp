@@ -0,0 +1,149 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Resource backend used by the render graph
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - The render graph only talks to GPU memory through this interface.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Decouple render graph compilation from the graphics API.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the RenderGraphTextureDesc struct and IRenderGraphBackend interface.
+/// @par Revision History:
+///      $Source: IRenderGraphBackend.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/23 10:15:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _I_RENDER_GRAPH_BACKEND_HPP_
+#define _I_RENDER_GRAPH_BACKEND_HPP_
+
+/// <summary>
+/// Pixel formats a render graph texture can use.
+/// </summary>
+enum class RenderGraphFormat
+{
+	RGBA8,
+	RGBA16F,
+	RGBA32F,
+	RG16F,
+	R32F,
+	D24S8,
+	D32F
+};
+
+/// <summary>
+/// Returns the size of one pixel of the format, in bytes.
+/// </summary>
+inline unsigned int getFormatBytesPerPixel(RenderGraphFormat f_format)
+{
+	switch (f_format)
+	{
+	case RenderGraphFormat::RGBA8:   return 4;
+	case RenderGraphFormat::RGBA16F: return 8;
+	case RenderGraphFormat::RGBA32F: return 16;
+	case RenderGraphFormat::RG16F:   return 4;
+	case RenderGraphFormat::R32F:    return 4;
+	case RenderGraphFormat::D24S8:   return 4;
+	case RenderGraphFormat::D32F:    return 4;
+	}
+	return 0;
+}
+
+/// <summary>
+/// Describes a 2D texture used by render graph passes.
+/// </summary>
+struct RenderGraphTextureDesc
+{
+	unsigned int width = 0;
+	unsigned int height = 0;
+	RenderGraphFormat format = RenderGraphFormat::RGBA8;
+	unsigned int sample_count = 1;
+
+	bool operator==(const RenderGraphTextureDesc& f_other) const
+	{
+		return width == f_other.width && height == f_other.height &&
+			format == f_other.format && sample_count == f_other.sample_count;
+	}
+};
+
+/**
+ * @interface IRenderGraphBackend
+ * @brief Creates the memory and textures that back the transient resources of a render graph.
+ *
+ * The graph asks the backend how large each texture is and whether two
+ * textures may share memory. At execution it creates one allocation per
+ * aliasing group and places every texture of the group inside it.
+ */
+class IRenderGraphBackend
+{
+public:
+
+	/*--------------------------------------------------------------
+		Destructor
+	--------------------------------------------------------------*/
+
+	virtual ~IRenderGraphBackend() = default;
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Returns the number of bytes of memory the texture occupies, alignment included.
+	/// </summary>
+	virtual unsigned long long getTextureSize(const RenderGraphTextureDesc& f_desc) const = 0;
+
+	/// <summary>
+	/// Tells whether two textures with disjoint lifetimes may occupy the same memory.
+	/// APIs without placed resources only allow it for identical descriptions.
+	/// </summary>
+	virtual bool canAlias(const RenderGraphTextureDesc& f_first, const RenderGraphTextureDesc& f_second) const = 0;
+
+	/// <summary>
+	/// Creates a block of memory shared by one aliasing group.
+	/// </summary>
+	/// <returns>A backend handle to the allocation, or nullptr on failure.</returns>
+	virtual void* createAllocation(unsigned long long f_size) = 0;
+
+	/// <summary>
+	/// Creates a texture inside an allocation returned by createAllocation().
+	/// </summary>
+	/// <returns>A backend handle to the texture, or nullptr on failure.</returns>
+	virtual void* createTexture(const RenderGraphTextureDesc& f_desc, void* f_allocation) = 0;
+
+	/// <summary>
+	/// Releases a texture returned by createTexture().
+	/// </summary>
+	virtual void releaseTexture(void* f_texture) = 0;
+
+	/// <summary>
+	/// Releases an allocation returned by createAllocation().
+	/// </summary>
+	virtual void releaseAllocation(void* f_allocation) = 0;
+};
+
+#endif // !_I_RENDER_GRAPH_BACKEND_HPP_
@@ -0,0 +1,118 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Render graph backend that allocates nothing
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Used to compile and execute render graphs headless (tools, CI, Linux).
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Account for render graph memory without a GPU.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the NullRenderGraphBackend class.
+/// @par Revision History:
+///      $Source: NullRenderGraphBackend.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/23 10:15:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _NULL_RENDER_GRAPH_BACKEND_HPP_
+#define _NULL_RENDER_GRAPH_BACKEND_HPP_
+
+#include "IRenderGraphBackend.hpp"
+
+/**
+ * @class NullRenderGraphBackend
+ * @brief Backend that sizes textures like a GPU would but never touches a device.
+ *
+ * Texture sizes are rounded up to the placement alignment (64 KiB by
+ * default, the D3D12 default resource alignment) and every texture may
+ * alias every other one, as with placed resources. Handles returned by
+ * the create methods are opaque non-null tokens.
+ *
+ * Example usage:
+ * @code
+ * NullRenderGraphBackend backend;
+ * graph.compile(&backend);
+ * graph.execute(&backend);
+ * @endcode
+ */
+class NullRenderGraphBackend : public IRenderGraphBackend
+{
+public:
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Constructs the backend.
+	/// </summary>
+	/// <param name="f_alignment">Placement alignment of textures, in bytes (power of two).</param>
+	explicit NullRenderGraphBackend(unsigned long long f_alignment = 64 * 1024);
+
+	/*--------------------------------------------------------------
+		Inherited Methods
+	--------------------------------------------------------------*/
+
+	unsigned long long getTextureSize(const RenderGraphTextureDesc& f_desc) const override;
+	bool canAlias(const RenderGraphTextureDesc& f_first, const RenderGraphTextureDesc& f_second) const override;
+	void* createAllocation(unsigned long long f_size) override;
+	void* createTexture(const RenderGraphTextureDesc& f_desc, void* f_allocation) override;
+	void releaseTexture(void* f_texture) override;
+	void releaseAllocation(void* f_allocation) override;
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Bytes currently held by live allocations.
+	/// </summary>
+	unsigned long long getAllocatedBytes() const { return m_allocated_bytes; }
+
+	/// <summary>
+	/// Highest value getAllocatedBytes() reached.
+	/// </summary>
+	unsigned long long getPeakAllocatedBytes() const { return m_peak_allocated_bytes; }
+
+	/// <summary>
+	/// Number of textures currently alive.
+	/// </summary>
+	unsigned int getLiveTextureCount() const { return m_live_textures; }
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	unsigned long long m_alignment;
+	unsigned long long m_allocated_bytes;
+	unsigned long long m_peak_allocated_bytes;
+	unsigned int m_live_textures;
+};
+
+#endif // !_NULL_RENDER_GRAPH_BACKEND_HPP_
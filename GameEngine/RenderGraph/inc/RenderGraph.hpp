@@ -0,0 +1,319 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Declarative frame description with transient aliasing
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - No graphics API dependency; resources go through IRenderGraphBackend.
+//  - The graph is meant to be rebuilt every frame: reset(), addPass()...,
+//    compile(), execute().
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Describe a frame as passes with declared reads and writes.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the RenderGraph, RenderGraphBuilder and RenderGraphContext classes.
+/// @par Revision History:
+///      $Source: RenderGraph.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/23 10:15:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _RENDER_GRAPH_HPP_
+#define _RENDER_GRAPH_HPP_
+
+#include "IRenderGraphBackend.hpp"
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class RenderGraph;
+
+/// <summary>
+/// Identifies a texture inside one RenderGraph.
+/// </summary>
+using RenderGraphHandle = unsigned int;
+
+/// <summary>
+/// Value of a RenderGraphHandle that refers to no texture.
+/// </summary>
+constexpr RenderGraphHandle invalid_render_graph_handle = ~0u;
+
+/**
+ * @class RenderGraphBuilder
+ * @brief Passed to the setup function of a pass to declare what the pass uses.
+ */
+class RenderGraphBuilder
+{
+public:
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Creates a transient texture written by this pass. Its contents are
+	/// undefined when the pass starts since the memory may be aliased.
+	/// </summary>
+	RenderGraphHandle create(const char* f_name, const RenderGraphTextureDesc& f_desc);
+
+	/// <summary>
+	/// Declares that the pass reads the texture.
+	/// </summary>
+	RenderGraphHandle read(RenderGraphHandle f_handle);
+
+	/// <summary>
+	/// Declares that the pass writes the texture.
+	/// </summary>
+	RenderGraphHandle write(RenderGraphHandle f_handle);
+
+	/// <summary>
+	/// Keeps the pass even when nothing reads what it writes.
+	/// </summary>
+	void setSideEffect();
+
+private:
+
+	RenderGraphBuilder(RenderGraph& f_graph, unsigned int f_pass);
+
+	RenderGraph& m_graph;
+	unsigned int m_pass;
+
+	friend class RenderGraph;
+};
+
+/**
+ * @class RenderGraphContext
+ * @brief Passed to the execute function of a pass to resolve handles into backend textures.
+ */
+class RenderGraphContext
+{
+public:
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Returns the backend texture of the handle (the native pointer for imported textures).
+	/// </summary>
+	void* getTexture(RenderGraphHandle f_handle) const;
+
+	/// <summary>
+	/// Returns the description of the texture.
+	/// </summary>
+	const RenderGraphTextureDesc& getDesc(RenderGraphHandle f_handle) const;
+
+private:
+
+	explicit RenderGraphContext(const RenderGraph& f_graph);
+
+	const RenderGraph& m_graph;
+
+	friend class RenderGraph;
+};
+
+/**
+ * @class RenderGraph
+ * @brief Frame made of passes that declare the textures they read and write.
+ *
+ * compile() culls every pass whose outputs are never consumed (a pass is
+ * kept when it writes an imported texture, is flagged with setSideEffect()
+ * or writes something a kept pass reads), keeps the remaining passes in
+ * declaration order - which always satisfies their dependencies since a
+ * handle must exist before it can be read - and computes the lifetime of
+ * each transient texture as the range of passes that use it. Transients
+ * whose lifetimes do not overlap are packed into the same allocation,
+ * largest first, so a multi-pass frame needs far less render target memory
+ * than one allocation per texture.
+ *
+ * Example usage:
+ * @code
+ * RenderGraph graph;
+ * RenderGraphHandle back_buffer = graph.importTexture("BackBuffer", desc, rtv);
+ * RenderGraphHandle scene;
+ * graph.addPass("Scene",
+ *     [&](RenderGraphBuilder& builder) { scene = builder.create("Scene", desc); },
+ *     [&](RenderGraphContext& context) { ... });
+ * graph.addPass("Tonemap",
+ *     [&](RenderGraphBuilder& builder) { builder.read(scene); builder.write(back_buffer); },
+ *     [&](RenderGraphContext& context) { ... });
+ * graph.compile(&backend);
+ * graph.execute(&backend);
+ * @endcode
+ */
+class RenderGraph
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	using SetupFunction = std::function<void(RenderGraphBuilder&)>;
+	using ExecuteFunction = std::function<void(RenderGraphContext&)>;
+
+	/// <summary>
+	/// Result of the last compile().
+	/// </summary>
+	struct Statistics
+	{
+		unsigned int passes = 0;
+		unsigned int culled_passes = 0;
+		unsigned int transient_textures = 0;
+		unsigned int allocations = 0;
+
+		/// <summary>
+		/// Memory the transients would need with one allocation each.
+		/// </summary>
+		unsigned long long unaliased_bytes = 0;
+
+		/// <summary>
+		/// Memory the transients need after aliasing.
+		/// </summary>
+		unsigned long long aliased_bytes = 0;
+
+		unsigned long long getSavedBytes() const { return unaliased_bytes - aliased_bytes; }
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	RenderGraph();
+	~RenderGraph();
+
+	RenderGraph(const RenderGraph&) = delete;
+	RenderGraph& operator=(const RenderGraph&) = delete;
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Registers a texture owned outside the graph (e.g. the back buffer).
+	/// Passes writing imported textures are never culled.
+	/// </summary>
+	/// <param name="f_native">Pointer returned by RenderGraphContext::getTexture().</param>
+	RenderGraphHandle importTexture(const char* f_name, const RenderGraphTextureDesc& f_desc, void* f_native);
+
+	/// <summary>
+	/// Adds a pass. f_setup runs immediately to declare the pass resources;
+	/// f_execute runs from execute() if the pass survives compilation.
+	/// </summary>
+	void addPass(const char* f_name, const SetupFunction& f_setup, const ExecuteFunction& f_execute);
+
+	/// <summary>
+	/// Culls, orders and assigns memory to the passes added so far.
+	/// </summary>
+	/// <param name="f_backend">Sizes the transients; may be nullptr when there are none.</param>
+	/// <returns>False if the graph has transients but no backend.</returns>
+	bool compile(const IRenderGraphBackend* f_backend);
+
+	/// <summary>
+	/// Creates the transient memory, runs the surviving passes in order and releases the memory.
+	/// </summary>
+	/// <returns>False if the graph is not compiled or the backend failed to allocate.</returns>
+	bool execute(IRenderGraphBackend* f_backend);
+
+	/// <summary>
+	/// Removes every pass and texture so the graph can be rebuilt for the next frame.
+	/// </summary>
+	void reset();
+
+	/// <summary>
+	/// Retrieves the statistics of the last compile().
+	/// </summary>
+	const Statistics& getStatistics() const { return m_statistics; }
+
+	/// <summary>
+	/// Writes the execution order, culled passes, aliasing groups and memory saved.
+	/// </summary>
+	void printReport(std::ostream& f_stream) const;
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct Texture
+	{
+		std::string name;
+		RenderGraphTextureDesc desc;
+		void* native = nullptr;
+		bool imported = false;
+		unsigned int first_use = ~0u;
+		unsigned int last_use = 0;
+		unsigned long long size = 0;
+		unsigned int allocation = ~0u;
+	};
+
+	struct Pass
+	{
+		std::string name;
+		ExecuteFunction execute;
+		std::vector<RenderGraphHandle> reads;
+		std::vector<RenderGraphHandle> writes;
+		bool side_effect = false;
+		bool culled = false;
+	};
+
+	struct Allocation
+	{
+		unsigned long long size = 0;
+		std::vector<RenderGraphHandle> textures;
+		void* native = nullptr;
+	};
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void cullPasses();
+	void computeLifetimes();
+	void assignAllocations(const IRenderGraphBackend* f_backend);
+	bool isValid(RenderGraphHandle f_handle) const { return f_handle < m_textures.size(); }
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::vector<Texture> m_textures;
+	std::vector<Pass> m_passes;
+	std::vector<unsigned int> m_execution_order;
+	std::vector<Allocation> m_allocations;
+	Statistics m_statistics;
+	bool m_compiled;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend class RenderGraphBuilder;
+	friend class RenderGraphContext;
+};
+
+#endif // !_RENDER_GRAPH_HPP_
@@ -0,0 +1,102 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Render graph backend that allocates nothing
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Account for render graph memory without a GPU.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the NullRenderGraphBackend class.
+/// @par Revision History:
+///      $Source: NullRenderGraphBackend.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/23 10:15:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "NullRenderGraphBackend.hpp"
+
+namespace
+{
+	struct NullAllocation
+	{
+		unsigned long long size;
+	};
+
+	struct NullTexture
+	{
+		RenderGraphTextureDesc desc;
+		NullAllocation* allocation;
+	};
+}
+
+NullRenderGraphBackend::NullRenderGraphBackend(unsigned long long f_alignment)
+	: m_alignment(f_alignment ? f_alignment : 1), m_allocated_bytes(0), m_peak_allocated_bytes(0), m_live_textures(0)
+{
+}
+
+unsigned long long NullRenderGraphBackend::getTextureSize(const RenderGraphTextureDesc& f_desc) const
+{
+	const unsigned long long size = static_cast<unsigned long long>(f_desc.width) * f_desc.height *
+		getFormatBytesPerPixel(f_desc.format) * (f_desc.sample_count ? f_desc.sample_count : 1);
+	return (size + m_alignment - 1) / m_alignment * m_alignment;
+}
+
+bool NullRenderGraphBackend::canAlias(const RenderGraphTextureDesc&, const RenderGraphTextureDesc&) const
+{
+	return true;
+}
+
+void* NullRenderGraphBackend::createAllocation(unsigned long long f_size)
+{
+	m_allocated_bytes += f_size;
+	if (m_allocated_bytes > m_peak_allocated_bytes)
+	{
+		m_peak_allocated_bytes = m_allocated_bytes;
+	}
+	return new NullAllocation{ f_size };
+}
+
+void* NullRenderGraphBackend::createTexture(const RenderGraphTextureDesc& f_desc, void* f_allocation)
+{
+	m_live_textures++;
+	return new NullTexture{ f_desc, static_cast<NullAllocation*>(f_allocation) };
+}
+
+void NullRenderGraphBackend::releaseTexture(void* f_texture)
+{
+	if (!f_texture) return;
+	m_live_textures--;
+	delete static_cast<NullTexture*>(f_texture);
+}
+
+void NullRenderGraphBackend::releaseAllocation(void* f_allocation)
+{
+	if (!f_allocation) return;
+	NullAllocation* allocation = static_cast<NullAllocation*>(f_allocation);
+	m_allocated_bytes -= allocation->size;
+	delete allocation;
+}
@@ -0,0 +1,412 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Declarative frame description with transient aliasing
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Describe a frame as passes with declared reads and writes.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the RenderGraph, RenderGraphBuilder and RenderGraphContext classes.
+/// @par Revision History:
+///      $Source: RenderGraph.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/03/23 10:15:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "RenderGraph.hpp"
+#include <algorithm>
+#include <iomanip>
+
+namespace
+{
+	double toMiB(unsigned long long f_bytes)
+	{
+		return static_cast<double>(f_bytes) / (1024.0 * 1024.0);
+	}
+}
+
+/*--------------------------------------------------------------
+	RenderGraphBuilder
+--------------------------------------------------------------*/
+
+RenderGraphBuilder::RenderGraphBuilder(RenderGraph& f_graph, unsigned int f_pass)
+	: m_graph(f_graph), m_pass(f_pass)
+{
+}
+
+RenderGraphHandle RenderGraphBuilder::create(const char* f_name, const RenderGraphTextureDesc& f_desc)
+{
+	RenderGraph::Texture texture;
+	texture.name = f_name ? f_name : "";
+	texture.desc = f_desc;
+	m_graph.m_textures.push_back(texture);
+	return write(static_cast<RenderGraphHandle>(m_graph.m_textures.size() - 1));
+}
+
+RenderGraphHandle RenderGraphBuilder::read(RenderGraphHandle f_handle)
+{
+	if (m_graph.isValid(f_handle))
+	{
+		m_graph.m_passes[m_pass].reads.push_back(f_handle);
+	}
+	return f_handle;
+}
+
+RenderGraphHandle RenderGraphBuilder::write(RenderGraphHandle f_handle)
+{
+	if (m_graph.isValid(f_handle))
+	{
+		m_graph.m_passes[m_pass].writes.push_back(f_handle);
+	}
+	return f_handle;
+}
+
+void RenderGraphBuilder::setSideEffect()
+{
+	m_graph.m_passes[m_pass].side_effect = true;
+}
+
+/*--------------------------------------------------------------
+	RenderGraphContext
+--------------------------------------------------------------*/
+
+RenderGraphContext::RenderGraphContext(const RenderGraph& f_graph)
+	: m_graph(f_graph)
+{
+}
+
+void* RenderGraphContext::getTexture(RenderGraphHandle f_handle) const
+{
+	return m_graph.isValid(f_handle) ? m_graph.m_textures[f_handle].native : nullptr;
+}
+
+const RenderGraphTextureDesc& RenderGraphContext::getDesc(RenderGraphHandle f_handle) const
+{
+	static const RenderGraphTextureDesc empty;
+	return m_graph.isValid(f_handle) ? m_graph.m_textures[f_handle].desc : empty;
+}
+
+/*--------------------------------------------------------------
+	RenderGraph
+--------------------------------------------------------------*/
+
+RenderGraph::RenderGraph() : m_compiled(false)
+{
+}
+
+RenderGraphHandle RenderGraph::importTexture(const char* f_name, const RenderGraphTextureDesc& f_desc, void* f_native)
+{
+	Texture texture;
+	texture.name = f_name ? f_name : "";
+	texture.desc = f_desc;
+	texture.native = f_native;
+	texture.imported = true;
+	m_textures.push_back(texture);
+	m_compiled = false;
+	return static_cast<RenderGraphHandle>(m_textures.size() - 1);
+}
+
+void RenderGraph::addPass(const char* f_name, const SetupFunction& f_setup, const ExecuteFunction& f_execute)
+{
+	Pass pass;
+	pass.name = f_name ? f_name : "";
+	pass.execute = f_execute;
+	m_passes.push_back(pass);
+	m_compiled = false;
+
+	if (f_setup)
+	{
+		RenderGraphBuilder builder(*this, static_cast<unsigned int>(m_passes.size() - 1));
+		f_setup(builder);
+	}
+}
+
+bool RenderGraph::compile(const IRenderGraphBackend* f_backend)
+{
+	m_statistics = Statistics();
+	m_execution_order.clear();
+	m_allocations.clear();
+	m_compiled = false;
+
+	cullPasses();
+	computeLifetimes();
+
+	for (const Texture& texture : m_textures)
+	{
+		if (!texture.imported && texture.first_use != ~0u && !f_backend)
+		{
+			return false;
+		}
+	}
+
+	assignAllocations(f_backend);
+
+	m_statistics.passes = static_cast<unsigned int>(m_passes.size());
+	m_statistics.culled_passes = static_cast<unsigned int>(m_passes.size() - m_execution_order.size());
+	m_statistics.allocations = static_cast<unsigned int>(m_allocations.size());
+
+	m_compiled = true;
+	return true;
+}
+
+bool RenderGraph::execute(IRenderGraphBackend* f_backend)
+{
+	if (!m_compiled || (!m_allocations.empty() && !f_backend))
+	{
+		return false;
+	}
+
+	// A backend that keeps memory across frames should pool these; the graph
+	// only asks for what the current frame needs.
+	bool succeeded = true;
+	for (Allocation& allocation : m_allocations)
+	{
+		allocation.native = f_backend->createAllocation(allocation.size);
+		if (!allocation.native)
+		{
+			succeeded = false;
+			break;
+		}
+		for (RenderGraphHandle handle : allocation.textures)
+		{
+			m_textures[handle].native = f_backend->createTexture(m_textures[handle].desc, allocation.native);
+			if (!m_textures[handle].native)
+			{
+				succeeded = false;
+			}
+		}
+	}
+
+	if (succeeded)
+	{
+		RenderGraphContext context(*this);
+		for (unsigned int pass_index : m_execution_order)
+		{
+			const Pass& pass = m_passes[pass_index];
+			if (pass.execute)
+			{
+				pass.execute(context);
+			}
+		}
+	}
+
+	for (auto it = m_allocations.rbegin(); it != m_allocations.rend(); ++it)
+	{
+		for (RenderGraphHandle handle : it->textures)
+		{
+			if (m_textures[handle].native)
+			{
+				f_backend->releaseTexture(m_textures[handle].native);
+				m_textures[handle].native = nullptr;
+			}
+		}
+		if (it->native)
+		{
+			f_backend->releaseAllocation(it->native);
+			it->native = nullptr;
+		}
+	}
+
+	return succeeded;
+}
+
+void RenderGraph::reset()
+{
+	m_textures.clear();
+	m_passes.clear();
+	m_execution_order.clear();
+	m_allocations.clear();
+	m_statistics = Statistics();
+	m_compiled = false;
+}
+
+void RenderGraph::printReport(std::ostream& f_stream) const
+{
+	f_stream << "Render graph: " << m_statistics.passes << " passes, "
+		<< m_statistics.culled_passes << " culled" << std::endl;
+
+	std::vector<unsigned int> position(m_passes.size(), ~0u);
+	for (unsigned int i = 0; i < m_execution_order.size(); ++i)
+	{
+		position[m_execution_order[i]] = i;
+	}
+	for (unsigned int i = 0; i < m_passes.size(); ++i)
+	{
+		if (position[i] == ~0u)
+		{
+			f_stream << "  [-] " << m_passes[i].name << " (culled)" << std::endl;
+		}
+		else
+		{
+			f_stream << "  [" << position[i] << "] " << m_passes[i].name << std::endl;
+		}
+	}
+
+	f_stream << std::fixed << std::setprecision(2);
+	f_stream << "Transient textures: " << m_statistics.transient_textures << " in "
+		<< m_statistics.allocations << " allocations" << std::endl;
+	for (unsigned int i = 0; i < m_allocations.size(); ++i)
+	{
+		f_stream << "  Allocation " << i << " (" << toMiB(m_allocations[i].size) << " MiB):";
+		for (RenderGraphHandle handle : m_allocations[i].textures)
+		{
+			const Texture& texture = m_textures[handle];
+			f_stream << " " << texture.name << " [" << texture.first_use << "-" << texture.last_use << "]";
+		}
+		f_stream << std::endl;
+	}
+
+	const double saved_percent = m_statistics.unaliased_bytes
+		? 100.0 * m_statistics.getSavedBytes() / m_statistics.unaliased_bytes : 0.0;
+	f_stream << "Memory: " << toMiB(m_statistics.unaliased_bytes) << " MiB unaliased, "
+		<< toMiB(m_statistics.aliased_bytes) << " MiB aliased, "
+		<< toMiB(m_statistics.getSavedBytes()) << " MiB saved (" << std::setprecision(1) << saved_percent << "%)" << std::endl;
+	f_stream.unsetf(std::ios_base::floatfield);
+}
+
+void RenderGraph::cullPasses()
+{
+	// Walk backwards: a pass lives if it has a side effect, writes an imported
+	// texture, or writes a texture that a later living pass reads.
+	std::vector<bool> needed(m_textures.size(), false);
+	for (size_t i = m_passes.size(); i-- > 0;)
+	{
+		Pass& pass = m_passes[i];
+		bool live = pass.side_effect;
+		for (RenderGraphHandle handle : pass.writes)
+		{
+			live = live || m_textures[handle].imported || needed[handle];
+		}
+
+		pass.culled = !live;
+		if (live)
+		{
+			for (RenderGraphHandle handle : pass.reads)
+			{
+				needed[handle] = true;
+			}
+		}
+	}
+
+	for (unsigned int i = 0; i < m_passes.size(); ++i)
+	{
+		if (!m_passes[i].culled)
+		{
+			m_execution_order.push_back(i);
+		}
+	}
+}
+
+void RenderGraph::computeLifetimes()
+{
+	for (Texture& texture : m_textures)
+	{
+		texture.first_use = ~0u;
+		texture.last_use = 0;
+		texture.allocation = ~0u;
+	}
+
+	for (unsigned int position = 0; position < m_execution_order.size(); ++position)
+	{
+		const Pass& pass = m_passes[m_execution_order[position]];
+		auto use = [this, position](RenderGraphHandle f_handle)
+		{
+			Texture& texture = m_textures[f_handle];
+			texture.first_use = std::min(texture.first_use, position);
+			texture.last_use = std::max(texture.last_use, position);
+		};
+		std::for_each(pass.reads.begin(), pass.reads.end(), use);
+		std::for_each(pass.writes.begin(), pass.writes.end(), use);
+	}
+}
+
+void RenderGraph::assignAllocations(const IRenderGraphBackend* f_backend)
+{
+	std::vector<RenderGraphHandle> transients;
+	for (RenderGraphHandle handle = 0; handle < m_textures.size(); ++handle)
+	{
+		Texture& texture = m_textures[handle];
+		if (!texture.imported && texture.first_use != ~0u)
+		{
+			texture.size = f_backend->getTextureSize(texture.desc);
+			m_statistics.unaliased_bytes += texture.size;
+			transients.push_back(handle);
+		}
+	}
+	m_statistics.transient_textures = static_cast<unsigned int>(transients.size());
+
+	// Largest first so small textures fill the gaps left in big allocations
+	std::stable_sort(transients.begin(), transients.end(), [this](RenderGraphHandle f_a, RenderGraphHandle f_b)
+	{
+		return m_textures[f_a].size > m_textures[f_b].size;
+	});
+
+	for (RenderGraphHandle handle : transients)
+	{
+		Texture& texture = m_textures[handle];
+
+		unsigned int chosen = ~0u;
+		for (unsigned int i = 0; i < m_allocations.size() && chosen == ~0u; ++i)
+		{
+			bool fits = true;
+			for (RenderGraphHandle other_handle : m_allocations[i].textures)
+			{
+				const Texture& other = m_textures[other_handle];
+				const bool overlaps = texture.first_use <= other.last_use && other.first_use <= texture.last_use;
+				if (overlaps || !f_backend->canAlias(texture.desc, other.desc))
+				{
+					fits = false;
+					break;
+				}
+			}
+			if (fits)
+			{
+				chosen = i;
+			}
+		}
+
+		if (chosen == ~0u)
+		{
+			m_allocations.push_back(Allocation());
+			chosen = static_cast<unsigned int>(m_allocations.size() - 1);
+		}
+
+		Allocation& allocation = m_allocations[chosen];
+		allocation.size = std::max(allocation.size, texture.size);
+		allocation.textures.push_back(handle);
+		texture.allocation = chosen;
+	}
+
+	for (const Allocation& allocation : m_allocations)
+	{
+		m_statistics.aliased_bytes += allocation.size;
+	}
+}
+
+RenderGraph::~RenderGraph()
+{
+}
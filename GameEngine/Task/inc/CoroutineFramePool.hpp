@@ -0,0 +1,150 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Pooled coroutine frames
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep coroutines from hitting the heap on every call.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the CoroutineFramePool class.
+/// @par Revision History:
+///      $Source: CoroutineFramePool.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _COROUTINE_FRAME_POOL_HPP_
+#define _COROUTINE_FRAME_POOL_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+/**
+ * @class CoroutineFramePool
+ * @brief Recycles coroutine frames in power of two size classes from 64 bytes to 16 KiB.
+ *
+ * Every call of a coroutine allocates its frame, which holds the parameters,
+ * the locals that live across suspensions and the promise. Task promises
+ * allocate from here: a freed frame goes onto the free list of its class and
+ * the next coroutine of a similar size takes it back, so a loading loop that
+ * runs the same coroutines over and over stops allocating after the first
+ * round. Frames above 16 KiB go to the heap. Frames may be freed on another
+ * thread than the one that allocated them.
+ *
+ * Example usage:
+ * @code
+ * static void* operator new(size_t f_size) { return CoroutineFramePool::get()->allocate(f_size); }
+ * static void operator delete(void* f_frame, size_t f_size) { CoroutineFramePool::get()->deallocate(f_frame, f_size); }
+ * @endcode
+ */
+class CoroutineFramePool
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	struct Statistics
+	{
+		unsigned long long allocations = 0;
+		unsigned long long pooled_allocations = 0;     // Served from a free list
+		unsigned long long heap_allocations = 0;
+		unsigned long long live_frames = 0;
+		size_t cached_bytes = 0;                       // Held in the free lists
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	CoroutineFramePool();
+	CoroutineFramePool(const CoroutineFramePool&) = delete;
+	CoroutineFramePool& operator=(const CoroutineFramePool&) = delete;
+	~CoroutineFramePool();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	void* allocate(size_t f_size);
+
+	/// <param name="f_size">The size passed to allocate().</param>
+	void deallocate(void* f_frame, size_t f_size);
+
+	/// <summary>
+	/// Gives the cached frames back to the heap, e.g. after loading.
+	/// </summary>
+	void trim();
+
+	Statistics getStatistics() const;
+
+	static CoroutineFramePool* get();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Types
+	--------------------------------------------------------------*/
+
+	struct FreeFrame
+	{
+		FreeFrame* next;
+	};
+
+	struct SizeClass
+	{
+		std::mutex mutex;
+		FreeFrame* free = nullptr;
+	};
+
+	static constexpr size_t min_frame_size = 64;
+	static constexpr unsigned int class_count = 9;     // 64 B to 16 KiB
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Class of a frame size, class_count for frames too large to pool.
+	/// </summary>
+	static unsigned int getClass(size_t f_size);
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	SizeClass m_classes[class_count];
+
+	std::atomic<unsigned long long> m_allocations;
+	std::atomic<unsigned long long> m_pooled_allocations;
+	std::atomic<unsigned long long> m_live_frames;
+	std::atomic<size_t> m_cached_bytes;
+};
+
+#endif // !_COROUTINE_FRAME_POOL_HPP_
@@ -0,0 +1,270 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Coroutine task
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Needs C++20 (VS16 16.8 or later, GCC 11 or later); the Task target
+//    requests it for everything that links it.
+//  - The engine builds without exceptions in its interfaces; an exception
+//    escaping a task terminates.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Write asynchronous engine work as sequential code.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the Task class template.
+/// @par Revision History:
+///      $Source: Task.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _TASK_HPP_
+#define _TASK_HPP_
+
+#include "CoroutineFramePool.hpp"
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+template<typename T>
+class Task;
+
+namespace task_detail
+{
+	/// <summary>
+	/// What every Task promise shares: pooled frames, lazy start and resuming the awaiting coroutine at the end.
+	/// </summary>
+	struct PromiseBase
+	{
+		std::coroutine_handle<> continuation;
+
+		// Set by whichever comes second of the awaiter suspending and the task finishing; that side
+		// resumes the awaiting coroutine. A task finishing synchronously thus adds no stack depth
+		std::atomic<bool> rendezvous{ false };
+
+		static void* operator new(size_t f_size) { return CoroutineFramePool::get()->allocate(f_size); }
+		static void operator delete(void* f_frame, size_t f_size) { CoroutineFramePool::get()->deallocate(f_frame, f_size); }
+
+		struct FinalAwaiter
+		{
+			bool await_ready() const noexcept { return false; }
+
+			template<typename Promise>
+			void await_suspend(std::coroutine_handle<Promise> f_handle) const noexcept
+			{
+				PromiseBase& promise = f_handle.promise();
+				if (promise.rendezvous.exchange(true, std::memory_order_acq_rel))
+				{
+					// The awaiter suspended before the task finished, e.g. on another thread
+					promise.continuation.resume();
+				}
+			}
+
+			void await_resume() const noexcept {}
+		};
+
+		std::suspend_always initial_suspend() const noexcept { return {}; }
+		FinalAwaiter final_suspend() const noexcept { return {}; }
+		void unhandled_exception() const noexcept { std::terminate(); }
+	};
+
+	template<typename T>
+	struct Promise : PromiseBase
+	{
+		std::optional<T> value;
+
+		Task<T> get_return_object() noexcept;
+
+		template<typename Value>
+		void return_value(Value&& f_value) { value.emplace(std::forward<Value>(f_value)); }
+
+		/// <summary>
+		/// Moves the result out; a second call has nothing left to take and terminates.
+		/// </summary>
+		T takeResult()
+		{
+			if (!value)
+			{
+				std::terminate();
+			}
+			T result = std::move(*value);
+			value.reset();
+			return result;
+		}
+	};
+
+	template<>
+	struct Promise<void> : PromiseBase
+	{
+		Task<void> get_return_object() noexcept;
+
+		void return_void() const noexcept {}
+
+		void takeResult() const noexcept {}
+	};
+}
+
+/**
+ * @class Task
+ * @brief A coroutine that produces a T; starts when it is first awaited.
+ *
+ * A function returning Task<T> may use co_await and co_return. Calling it
+ * only creates the coroutine; co_await on the task runs it until it suspends
+ * or finishes, and the awaiting coroutine continues once the task has
+ * finished, with its result. Awaiting the TaskScheduler awaitables moves the
+ * coroutine to the next frame, a job system worker or the I/O thread, so
+ * loading code reads top to bottom without blocking the frame thread. Frames
+ * come from the CoroutineFramePool. Top level tasks are started with
+ * TaskScheduler::spawn().
+ *
+ * Example usage:
+ * @code
+ * Task<Mesh*> loadMesh(TaskScheduler& f_scheduler, std::string f_path)
+ * {
+ *     std::vector<unsigned char> bytes;
+ *     if (!co_await f_scheduler.readFile(f_path, bytes)) co_return nullptr;
+ *     co_await f_scheduler.resumeOnWorker();
+ *     MeshData data = parseMesh(bytes);
+ *     co_await f_scheduler.nextFrame();
+ *     co_return createMesh(data);      // Back on the frame thread
+ * }
+ * @endcode
+ */
+template<typename T = void>
+class Task
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	using promise_type = task_detail::Promise<T>;
+	using Handle = std::coroutine_handle<promise_type>;
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	Task() : m_handle(nullptr) {}
+	explicit Task(Handle f_handle) : m_handle(f_handle) {}
+	Task(Task&& f_other) noexcept : m_handle(std::exchange(f_other.m_handle, nullptr)) {}
+	Task(const Task&) = delete;
+	Task& operator=(const Task&) = delete;
+
+	Task& operator=(Task&& f_other) noexcept
+	{
+		if (this != &f_other)
+		{
+			destroy();
+			m_handle = std::exchange(f_other.m_handle, nullptr);
+		}
+		return *this;
+	}
+
+	~Task() { destroy(); }
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	bool isValid() const { return m_handle != nullptr; }
+
+	bool isDone() const { return !m_handle || m_handle.done(); }
+
+	/// <summary>
+	/// Runs the task and resumes the awaiting coroutine with the result once it has finished.
+	/// A task is awaited once; awaiting an invalid task, or a task whose result was taken, terminates.
+	/// </summary>
+	auto operator co_await() noexcept
+	{
+		struct Awaiter
+		{
+			Handle handle;
+
+			bool await_ready() const noexcept
+			{
+				// Default constructed or moved from: there is no coroutine to run nor a result to return
+				if (!handle)
+				{
+					std::terminate();
+				}
+				return handle.done();
+			}
+
+			bool await_suspend(std::coroutine_handle<> f_awaiting) noexcept
+			{
+				handle.promise().continuation = f_awaiting;
+				handle.resume();
+
+				// false continues the awaiting coroutine at once: the task finished without suspending
+				return !handle.promise().rendezvous.exchange(true, std::memory_order_acq_rel);
+			}
+
+			T await_resume() { return handle.promise().takeResult(); }
+		};
+		return Awaiter{ m_handle };
+	}
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void destroy()
+	{
+		if (m_handle)
+		{
+			m_handle.destroy();
+			m_handle = nullptr;
+		}
+	}
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	Handle m_handle;
+};
+
+namespace task_detail
+{
+	template<typename T>
+	Task<T> Promise<T>::get_return_object() noexcept
+	{
+		return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+	}
+
+	inline Task<void> Promise<void>::get_return_object() noexcept
+	{
+		return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+	}
+}
+
+#endif // !_TASK_HPP_
@@ -0,0 +1,249 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Resumption of coroutine tasks
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//  - Coroutines still suspended at shutdown() are never resumed or freed;
+//    run frames until getLiveTaskCount() is 0 first.
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Write asynchronous engine work as sequential code.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Defines the TaskScheduler class and its awaitables.
+/// @par Revision History:
+///      $Source: TaskScheduler.hpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#ifndef _TASK_SCHEDULER_HPP_
+#define _TASK_SCHEDULER_HPP_
+
+#include "Task.hpp"
+#include "JobSystem.hpp"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class TaskScheduler
+ * @brief Decides where suspended tasks continue: on the frame thread, a job system worker or after I/O.
+ *
+ * The thread that calls init() is the frame thread; it calls runFrame() once
+ * per frame, which resumes the coroutines that awaited nextFrame(). Awaiting
+ * resumeOnWorker() continues the coroutine as a job on the JobSystem.
+ * Awaiting readFile() or runOnIoThread() hands the blocking work to the I/O
+ * thread; the coroutine continues on a worker once it completed, or on the
+ * frame thread when the job system has no workers. Awaiting never blocks a
+ * thread and costs no allocation beyond the std::function of I/O work.
+ *
+ * Example usage:
+ * @code
+ * TaskScheduler::get()->init();
+ * TaskScheduler::get()->spawn(loadLevel(*TaskScheduler::get(), "level.bin"));
+ * while (running)
+ * {
+ *     TaskScheduler::get()->runFrame();
+ *     renderFrame();
+ * }
+ * @endcode
+ */
+class TaskScheduler
+{
+public:
+
+	/*--------------------------------------------------------------
+		Types and Type Aliases
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Counters since init().
+	/// </summary>
+	struct Statistics
+	{
+		unsigned long long spawned_tasks = 0;
+		unsigned long long finished_tasks = 0;
+		unsigned long long frames = 0;
+		unsigned long long frame_resumes = 0;
+		unsigned long long worker_resumes = 0;
+		unsigned long long io_requests = 0;
+	};
+
+	/// <summary>
+	/// Continues the coroutine in the next runFrame().
+	/// </summary>
+	struct NextFrameAwaiter
+	{
+		TaskScheduler* scheduler;
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> f_handle) const { scheduler->queueFrame(f_handle); }
+		void await_resume() const noexcept {}
+	};
+
+	/// <summary>
+	/// Continues the coroutine as a job; at once when the job system has no other thread.
+	/// </summary>
+	struct WorkerAwaiter
+	{
+		TaskScheduler* scheduler;
+
+		bool await_ready() const noexcept { return JobSystem::get()->getThreadCount() <= 1; }
+		void await_suspend(std::coroutine_handle<> f_handle) const { scheduler->queueWorker(f_handle); }
+		void await_resume() const noexcept {}
+	};
+
+	/// <summary>
+	/// Runs blocking work on the I/O thread; the coroutine continues with its result.
+	/// </summary>
+	struct IoAwaiter
+	{
+		TaskScheduler* scheduler;
+		std::function<bool()> work;
+		bool result = false;
+		std::coroutine_handle<> handle;
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> f_handle) { handle = f_handle; scheduler->queueIo(this); }
+		bool await_resume() const noexcept { return result; }
+	};
+
+	/*--------------------------------------------------------------
+		Constructors and Destructor
+	--------------------------------------------------------------*/
+
+	TaskScheduler();
+	TaskScheduler(const TaskScheduler&) = delete;
+	TaskScheduler& operator=(const TaskScheduler&) = delete;
+	~TaskScheduler();
+
+	/*--------------------------------------------------------------
+		Public Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// Starts the I/O thread; the calling thread becomes the frame thread.
+	/// </summary>
+	bool init();
+
+	/// <summary>
+	/// Finishes the queued I/O and the coroutines queued on workers, then joins the I/O thread.
+	/// </summary>
+	void shutdown();
+
+	/// <summary>
+	/// Starts a top level task on the calling thread; it runs until its first suspension and frees itself when done.
+	/// </summary>
+	void spawn(Task<void>&& f_task);
+
+	/// <summary>
+	/// Frame thread: resumes the coroutines that awaited nextFrame() before this call.
+	/// </summary>
+	void runFrame();
+
+	/// <summary>
+	/// Spawned tasks that have not finished.
+	/// </summary>
+	unsigned long long getLiveTaskCount() const;
+
+	NextFrameAwaiter nextFrame() { return NextFrameAwaiter{ this }; }
+
+	WorkerAwaiter resumeOnWorker() { return WorkerAwaiter{ this }; }
+
+	/// <summary>
+	/// Awaitable running f_work on the I/O thread; co_await yields what f_work returned.
+	/// </summary>
+	IoAwaiter runOnIoThread(std::function<bool()> f_work) { return IoAwaiter{ this, std::move(f_work), false, nullptr }; }
+
+	/// <summary>
+	/// Awaitable reading a whole file into f_data on the I/O thread; co_await yields false when it cannot be read.
+	/// </summary>
+	/// <param name="f_data">Must stay alive until the coroutine continues, e.g. a local of the coroutine.</param>
+	IoAwaiter readFile(const std::string& f_path, std::vector<unsigned char>& f_data);
+
+	Statistics getStatistics() const;
+
+	static TaskScheduler* get();
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	void queueFrame(std::coroutine_handle<> f_handle);
+
+	void queueWorker(std::coroutine_handle<> f_handle);
+
+	void queueIo(IoAwaiter* f_request);
+
+	/// <summary>
+	/// Continues a coroutine after I/O: on a worker, or on the frame thread without workers.
+	/// </summary>
+	void resumeAfterIo(std::coroutine_handle<> f_handle);
+
+	void runIo();
+
+	/// <summary>
+	/// Called by the wrapper of a spawned task as it finishes.
+	/// </summary>
+	void finishTask();
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	std::mutex m_frame_mutex;
+	std::vector<std::coroutine_handle<>> m_frame_queue;
+	std::vector<std::coroutine_handle<>> m_resuming;     // Swapped with the queue so runFrame() does not allocate
+
+	JobCounter m_worker_jobs;
+
+	std::mutex m_io_mutex;
+	std::condition_variable m_io_condition;
+	std::deque<IoAwaiter*> m_io_queue;
+	std::thread m_io_thread;
+	bool m_stopping;
+
+	std::atomic<unsigned long long> m_spawned_tasks;
+	std::atomic<unsigned long long> m_finished_tasks;
+	std::atomic<unsigned long long> m_frames;
+	std::atomic<unsigned long long> m_frame_resumes;
+	std::atomic<unsigned long long> m_worker_resumes;
+	std::atomic<unsigned long long> m_io_requests;
+
+	/*--------------------------------------------------------------
+		Friends
+	--------------------------------------------------------------*/
+
+	friend struct SpawnedTask;
+};
+
+#endif // !_TASK_SCHEDULER_HPP_
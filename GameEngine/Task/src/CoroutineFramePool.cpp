@@ -0,0 +1,151 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Pooled coroutine frames
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Keep coroutines from hitting the heap on every call.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the CoroutineFramePool class.
+/// @par Revision History:
+///      $Source: CoroutineFramePool.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "CoroutineFramePool.hpp"
+#include <new>
+
+CoroutineFramePool::CoroutineFramePool() : m_allocations(0), m_pooled_allocations(0), m_live_frames(0), m_cached_bytes(0)
+{
+}
+
+unsigned int CoroutineFramePool::getClass(size_t f_size)
+{
+	unsigned int size_class = 0;
+	size_t class_size = min_frame_size;
+	while (class_size < f_size && size_class < class_count)
+	{
+		class_size <<= 1;
+		size_class++;
+	}
+	return size_class;
+}
+
+void* CoroutineFramePool::allocate(size_t f_size)
+{
+	const unsigned int size_class = getClass(f_size);
+	void* frame = nullptr;
+	if (size_class < class_count)
+	{
+		SizeClass& pool = m_classes[size_class];
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		if (pool.free)
+		{
+			frame = pool.free;
+			pool.free = pool.free->next;
+		}
+	}
+
+	m_allocations.fetch_add(1, std::memory_order_relaxed);
+	m_live_frames.fetch_add(1, std::memory_order_relaxed);
+	if (frame)
+	{
+		m_pooled_allocations.fetch_add(1, std::memory_order_relaxed);
+		m_cached_bytes.fetch_sub(min_frame_size << size_class, std::memory_order_relaxed);
+		return frame;
+	}
+
+	// Pooled classes allocate the whole class size so the frame can be reused by any coroutine of the class
+	return ::operator new(size_class < class_count ? min_frame_size << size_class : f_size);
+}
+
+void CoroutineFramePool::deallocate(void* f_frame, size_t f_size)
+{
+	if (!f_frame)
+	{
+		return;
+	}
+
+	const unsigned int size_class = getClass(f_size);
+	if (size_class < class_count)
+	{
+		SizeClass& pool = m_classes[size_class];
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		FreeFrame* free_frame = static_cast<FreeFrame*>(f_frame);
+		free_frame->next = pool.free;
+		pool.free = free_frame;
+		m_cached_bytes.fetch_add(min_frame_size << size_class, std::memory_order_relaxed);
+	}
+	else
+	{
+		::operator delete(f_frame);
+	}
+	m_live_frames.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void CoroutineFramePool::trim()
+{
+	for (unsigned int size_class = 0; size_class < class_count; ++size_class)
+	{
+		FreeFrame* frame = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(m_classes[size_class].mutex);
+			frame = m_classes[size_class].free;
+			m_classes[size_class].free = nullptr;
+		}
+		while (frame)
+		{
+			FreeFrame* next = frame->next;
+			::operator delete(frame);
+			m_cached_bytes.fetch_sub(min_frame_size << size_class, std::memory_order_relaxed);
+			frame = next;
+		}
+	}
+}
+
+CoroutineFramePool::Statistics CoroutineFramePool::getStatistics() const
+{
+	Statistics statistics;
+	statistics.allocations = m_allocations.load(std::memory_order_relaxed);
+	statistics.pooled_allocations = m_pooled_allocations.load(std::memory_order_relaxed);
+	statistics.heap_allocations = statistics.allocations - statistics.pooled_allocations;
+	statistics.live_frames = m_live_frames.load(std::memory_order_relaxed);
+	statistics.cached_bytes = m_cached_bytes.load(std::memory_order_relaxed);
+	return statistics;
+}
+
+CoroutineFramePool* CoroutineFramePool::get()
+{
+	static CoroutineFramePool instance;
+	return &instance;
+}
+
+CoroutineFramePool::~CoroutineFramePool()
+{
+	trim();
+}
@@ -0,0 +1,232 @@
+//=============================================================================
+//  C O P Y R I G H T
+//-----------------------------------------------------------------------------
+// Copyright (c) 2025 by Hoka David-Stelian. All rights reserved.
+//
+//  This file is property of Hoka David-Stelian. Any unauthorized copy, use or
+//  distribution is an offensive act against international law and may be
+//  prosecuted under federal law. Its content is personal confidential.
+//=============================================================================
+// P R O J E C T   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+//       Project name: Dino3D
+//           Synopsis: Resumption of coroutine tasks
+//   Target system(s): Windows, Linux
+//        Compiler(s): VS16, GCC
+//=============================================================================
+//  N O T E S
+//-----------------------------------------------------------------------------
+//  Notes:
+//=============================================================================
+//  I N I T I A L   A U T H O R   I D E N T I T Y
+//-----------------------------------------------------------------------------
+//        Name: Hoka David-Stelian
+//  Department: Project Owner (CEO)
+//     Purpose: Write asynchronous engine work as sequential code.
+//=============================================================================
+//  R E V I S I O N   I N F O R M A T I O N
+//-----------------------------------------------------------------------------
+/// @file
+/// @brief Implements the TaskScheduler class.
+/// @par Revision History:
+///      $Source: TaskScheduler.cpp $
+///      $Revision: 1.1 $
+///      $Author: Hoka David-Stelian (CEO) (Dino3D) $
+///      $Date: 2025/06/20 10:00:00 AM $
+///      $Name:  $
+///      $State: in_work $
+//=============================================================================
+
+#include "TaskScheduler.hpp"
+#include <fstream>
+
+/// <summary>
+/// Eager, self-destroying wrapper that owns a spawned task until it finishes.
+/// </summary>
+struct SpawnedTask
+{
+	struct promise_type
+	{
+		static void* operator new(size_t f_size) { return CoroutineFramePool::get()->allocate(f_size); }
+		static void operator delete(void* f_frame, size_t f_size) { CoroutineFramePool::get()->deallocate(f_frame, f_size); }
+
+		SpawnedTask get_return_object() const noexcept { return SpawnedTask(); }
+		std::suspend_never initial_suspend() const noexcept { return {}; }
+		std::suspend_never final_suspend() const noexcept { return {}; }
+		void return_void() const noexcept {}
+		void unhandled_exception() const noexcept { std::terminate(); }
+	};
+
+	static SpawnedTask run(TaskScheduler* f_scheduler, Task<void> f_task)
+	{
+		co_await f_task;
+		f_scheduler->finishTask();
+	}
+};
+
+TaskScheduler::TaskScheduler()
+	: m_stopping(false), m_spawned_tasks(0), m_finished_tasks(0), m_frames(0), m_frame_resumes(0), m_worker_resumes(0), m_io_requests(0)
+{
+	// Constructed first so it is destroyed after the scheduler, whose shutdown waits on it
+	JobSystem::get();
+}
+
+bool TaskScheduler::init()
+{
+	shutdown();
+
+	m_stopping = false;
+	m_spawned_tasks.store(0);
+	m_finished_tasks.store(0);
+	m_frames.store(0);
+	m_frame_resumes.store(0);
+	m_worker_resumes.store(0);
+	m_io_requests.store(0);
+	m_io_thread = std::thread(&TaskScheduler::runIo, this);
+	return true;
+}
+
+void TaskScheduler::shutdown()
+{
+	if (!m_io_thread.joinable())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_io_mutex);
+		m_stopping = true;
+	}
+	m_io_condition.notify_all();
+	m_io_thread.join();
+	JobSystem::get()->wait(m_worker_jobs);
+}
+
+void TaskScheduler::spawn(Task<void>&& f_task)
+{
+	m_spawned_tasks.fetch_add(1);
+	SpawnedTask::run(this, std::move(f_task));
+}
+
+void TaskScheduler::finishTask()
+{
+	m_finished_tasks.fetch_add(1);
+}
+
+unsigned long long TaskScheduler::getLiveTaskCount() const
+{
+	return m_spawned_tasks.load() - m_finished_tasks.load();
+}
+
+void TaskScheduler::runFrame()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_frame_mutex);
+		m_resuming.swap(m_frame_queue);
+	}
+
+	// Coroutines that await nextFrame() again while resumed here go into the emptied queue for the next frame
+	for (std::coroutine_handle<> handle : m_resuming)
+	{
+		handle.resume();
+	}
+	m_frame_resumes.fetch_add(m_resuming.size(), std::memory_order_relaxed);
+	m_frames.fetch_add(1, std::memory_order_relaxed);
+	m_resuming.clear();
+}
+
+void TaskScheduler::queueFrame(std::coroutine_handle<> f_handle)
+{
+	std::lock_guard<std::mutex> lock(m_frame_mutex);
+	m_frame_queue.push_back(f_handle);
+}
+
+void TaskScheduler::queueWorker(std::coroutine_handle<> f_handle)
+{
+	m_worker_resumes.fetch_add(1, std::memory_order_relaxed);
+	JobSystem::get()->run(m_worker_jobs, [f_handle]() { f_handle.resume(); });
+}
+
+void TaskScheduler::queueIo(IoAwaiter* f_request)
+{
+	m_io_requests.fetch_add(1, std::memory_order_relaxed);
+	{
+		std::lock_guard<std::mutex> lock(m_io_mutex);
+		m_io_queue.push_back(f_request);
+	}
+	m_io_condition.notify_one();
+}
+
+void TaskScheduler::resumeAfterIo(std::coroutine_handle<> f_handle)
+{
+	if (JobSystem::get()->getThreadCount() > 1)
+	{
+		queueWorker(f_handle);
+	}
+	else
+	{
+		queueFrame(f_handle);
+	}
+}
+
+void TaskScheduler::runIo()
+{
+	while (true)
+	{
+		IoAwaiter* request = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(m_io_mutex);
+			m_io_condition.wait(lock, [this] { return !m_io_queue.empty() || m_stopping; });
+			if (m_io_queue.empty())
+			{
+				return;
+			}
+			request = m_io_queue.front();
+			m_io_queue.pop_front();
+		}
+
+		// The request lives in the suspended coroutine's frame, which may be freed as soon as it is resumed
+		request->result = request->work ? request->work() : false;
+		resumeAfterIo(request->handle);
+	}
+}
+
+TaskScheduler::IoAwaiter TaskScheduler::readFile(const std::string& f_path, std::vector<unsigned char>& f_data)
+{
+	return runOnIoThread([f_path, &f_data]()
+	{
+		std::ifstream file(f_path, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			return false;
+		}
+
+		const std::streamsize size = file.tellg();
+		file.seekg(0, std::ios::beg);
+		f_data.resize(static_cast<size_t>(size));
+		return static_cast<bool>(file.read(reinterpret_cast<char*>(f_data.data()), size));
+	});
+}
+
+TaskScheduler::Statistics TaskScheduler::getStatistics() const
+{
+	Statistics statistics;
+	statistics.spawned_tasks = m_spawned_tasks.load();
+	statistics.finished_tasks = m_finished_tasks.load();
+	statistics.frames = m_frames.load();
+	statistics.frame_resumes = m_frame_resumes.load();
+	statistics.worker_resumes = m_worker_resumes.load();
+	statistics.io_requests = m_io_requests.load();
+	return statistics;
+}
+
+TaskScheduler* TaskScheduler::get()
+{
+	static TaskScheduler instance;
+	return &instance;
+}
+
+TaskScheduler::~TaskScheduler()
+{
+	shutdown();
+}
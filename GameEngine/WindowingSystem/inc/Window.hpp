@@ -17,6 +17,10 @@
 //  N O T E S
 //-----------------------------------------------------------------------------
 //  Notes:
+//  - In WindowRenderMode::OnDemand broadcast() blocks in the message wait
+//    until something dirties the frame, so an idle window uses no CPU.
+//  - A frame rate limit is kept by sleeping on a high resolution timer and
+//    spinning only the last part of the wait, see FramePacer.
 //=============================================================================
 //  I N I T I A L   A U T H O R   I D E N T I T Y
 //-----------------------------------------------------------------------------
@@ -40,6 +44,23 @@
 #define _WINDOW_H_
 
 #include <Windows.h>
+#include "FramePacer.hpp"
+
+/// <summary>
+/// When broadcast() calls onUpdate().
+/// </summary>
+enum class WindowRenderMode
+{
+	/// <summary>
+	/// Every broadcast() renders a frame.
+	/// </summary>
+	Continuous,
+
+	/// <summary>
+	/// A frame is rendered only after input, an invalidate() or while animating.
+	/// </summary>
+	OnDemand
+};
 
 /**
  * @class Window
@@ -135,6 +156,46 @@ public:
 	RECT getClientWindowRect();
 	void setHWND(HWND f_hwnd);
 
+	/// <summary>
+	/// Selects when frames are rendered; Continuous by default.
+	/// </summary>
+	void setRenderMode(WindowRenderMode f_mode);
+
+	WindowRenderMode getRenderMode() const { return m_render_mode; }
+
+	/// <summary>
+	/// Requests a frame; in OnDemand mode the next broadcast() renders one.
+	/// </summary>
+	void invalidate();
+
+	/// <summary>
+	/// Keeps rendering every frame in OnDemand mode while something on screen moves.
+	/// </summary>
+	void setAnimating(bool f_animating);
+
+	bool isAnimating() const { return m_animating; }
+
+	/// <summary>
+	/// Highest frame rate while the window has no focus, in any render mode; 10 by default.
+	/// </summary>
+	/// <param name="f_frames_per_second">Clamped to at least 1.</param>
+	void setBackgroundFrameRate(unsigned int f_frames_per_second);
+
+	/// <summary>
+	/// Caps the frame rate of the focused window with the FramePacer; 0, the default, leaves it to vsync.
+	/// </summary>
+	void setFrameRateLimit(double f_frames_per_second);
+
+	/// <summary>
+	/// The pacer run after every frame; its statistics measure the frame intervals even without a limit.
+	/// </summary>
+	const FramePacer& getFramePacer() const { return m_frame_pacer; }
+
+	/// <summary>
+	/// Tracks the focus for the background throttling; called by the window procedure.
+	/// </summary>
+	void setFocused(bool f_focused);
+
 	/*--------------------------------------------------------------
 		Virtual Methods
 	--------------------------------------------------------------*/
@@ -182,6 +243,30 @@ protected:
 	/// Boolean flag indicating whether the window is still running and processing events.
 	/// </summary>
 	bool m_isRunning;
+
+private:
+
+	/*--------------------------------------------------------------
+		Private Methods
+	--------------------------------------------------------------*/
+
+	/// <summary>
+	/// How long broadcast() may block before the next frame is due.
+	/// </summary>
+	/// <returns>0 to render now, INFINITE when only a message can cause a frame.</returns>
+	DWORD getFrameWaitTime() const;
+
+	/*--------------------------------------------------------------
+		Private Data Members
+	--------------------------------------------------------------*/
+
+	WindowRenderMode m_render_mode;
+	bool m_frame_dirty;
+	bool m_animating;
+	bool m_focused;
+	DWORD m_background_frame_ms;
+	ULONGLONG m_last_frame_tick;
+	FramePacer m_frame_pacer;
 };
 
 #endif // !_WINDOW_H_
\ No newline at end of file
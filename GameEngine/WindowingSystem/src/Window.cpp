@@ -40,11 +40,28 @@
 
 
 Window::Window()
+	: m_hwnd(NULL), m_isRunning(false), m_render_mode(WindowRenderMode::Continuous), m_frame_dirty(true),
+	m_animating(false), m_focused(true), m_background_frame_ms(100), m_last_frame_tick(0)
 {
+	// Unlimited until asked, vsync already paces the swap chain
+	setFrameRateLimit(0.0);
+}
+
+static bool isFrameEvent(UINT msg)
+{
+	return (msg >= WM_KEYFIRST && msg <= WM_KEYLAST) || (msg >= WM_MOUSEFIRST && msg <= WM_MOUSELAST) ||
+		msg == WM_SIZE || msg == WM_SETFOCUS || msg == WM_KILLFOCUS;
 }
 
 static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
 {
+	if (isFrameEvent(msg))
+	{
+		// Input and layout changes dirty the frame for the on demand mode
+		Window* window = (Window*)GetWindowLongPtr(hwnd, GWLP_USERDATA);
+		if (window) window->invalidate();
+	}
+
 	switch (msg)
 	{
 	case WM_CREATE:
@@ -59,6 +76,7 @@ static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lpara
 	{
 		// Event when the window gets focus
 		Window* window = (Window*)GetWindowLongPtr(hwnd, GWLP_USERDATA);
+		window->setFocused(true);
 		window->onFocus();
 		break;
 	}
@@ -66,9 +84,18 @@ static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lpara
 	{
 		// Event when the window lost focus
 		Window* window = (Window*)GetWindowLongPtr(hwnd, GWLP_USERDATA);
+		window->setFocused(false);
 		window->onLostFocus();
 		break;
 	}
+	case WM_PAINT:
+	{
+		// Uncovered or restored: the frame is drawn by the next broadcast(), not here
+		Window* window = (Window*)GetWindowLongPtr(hwnd, GWLP_USERDATA);
+		::ValidateRect(hwnd, NULL);
+		if (window) window->invalidate();
+		break;
+	}
 	case WM_DESTROY:
 	{
 		Window* window = (Window*)GetWindowLongPtr(hwnd, GWLP_USERDATA);
@@ -123,7 +150,14 @@ bool Window::broadcast()
 {
 	MSG msg;
 
-	this->onUpdate();
+	const DWORD wait_ms = getFrameWaitTime();
+	if (wait_ms != 0)
+	{
+		// Sleep until a message arrives or the next throttled frame is due
+		::MsgWaitForMultipleObjectsEx(0, NULL, wait_ms, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+		// The pause is not a late frame, pacing restarts from the next one
+		m_frame_pacer.reset();
+	}
 
 	while (::PeekMessage(&msg, NULL, 0, 0, PM_REMOVE) > 0)
 	{
@@ -131,11 +165,34 @@ bool Window::broadcast()
 		DispatchMessage(&msg);
 	}
 
-	Sleep(0);
-	
+	// The messages may have destroyed the window, or woken it up without dirtying the frame
+	if (m_isRunning && getFrameWaitTime() == 0)
+	{
+		m_frame_dirty = false;
+		m_last_frame_tick = ::GetTickCount64();
+		this->onUpdate();
+		m_frame_pacer.wait();
+	}
+
 	return true;
 }
 
+DWORD Window::getFrameWaitTime() const
+{
+	const bool wants_frame = m_render_mode == WindowRenderMode::Continuous || m_frame_dirty || m_animating;
+	if (!wants_frame)
+	{
+		return INFINITE;
+	}
+	if (m_focused)
+	{
+		return 0;
+	}
+
+	const ULONGLONG elapsed = ::GetTickCount64() - m_last_frame_tick;
+	return elapsed >= m_background_frame_ms ? 0 : static_cast<DWORD>(m_background_frame_ms - elapsed);
+}
+
 bool Window::release() const
 {
 	return ::DestroyWindow(m_hwnd);
@@ -158,6 +215,40 @@ void Window::setHWND(HWND f_hwnd)
 	this->m_hwnd = f_hwnd;
 }
 
+void Window::setRenderMode(WindowRenderMode f_mode)
+{
+	m_render_mode = f_mode;
+	m_frame_dirty = true;
+}
+
+void Window::invalidate()
+{
+	m_frame_dirty = true;
+}
+
+void Window::setAnimating(bool f_animating)
+{
+	m_animating = f_animating;
+	m_frame_dirty = true;
+}
+
+void Window::setBackgroundFrameRate(unsigned int f_frames_per_second)
+{
+	m_background_frame_ms = 1000 / (f_frames_per_second ? f_frames_per_second : 1);
+}
+
+void Window::setFrameRateLimit(double f_frames_per_second)
+{
+	FramePacerSettings settings = m_frame_pacer.getSettings();
+	settings.target_fps = f_frames_per_second;
+	m_frame_pacer.setSettings(settings);
+}
+
+void Window::setFocused(bool f_focused)
+{
+	m_focused = f_focused;
+}
+
 void Window::onDestroy()
 {
 	m_isRunning = false;
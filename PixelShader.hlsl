@@ -15,5 +15,9 @@ cbuffer constants : register(b0)
 
 float4 psmain(PS_INPUT input) : SV_TARGET
 {
+#if ANIMATED_COLOR
     return float4(lerp(input.color, input.color1, (sin(m_time / 500.0f) + 1.0f) / 2.0f), 1.0f);
+#else
+    return float4(input.color, 1.0f);
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+struct VS_OUTPUT
+{
+    float4 position : SV_POSITION;
+    float2 uv : TEXCOORD0;
+};
+
+cbuffer constants : register(b0)
+{
+    float2 m_uv_scale;
+    float2 m_uv_max;
+};
+
+Texture2D scene_color : register(t0);
+SamplerState linear_clamp : register(s0);
+
+// One triangle covering the screen, no vertex buffer needed
+VS_OUTPUT vsmain(uint vertex_id : SV_VertexID)
+{
+    VS_OUTPUT output = (VS_OUTPUT)0;
+    output.uv = float2((vertex_id << 1) & 2, vertex_id & 2);
+    output.position = float4(output.uv * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 0.0f, 1.0f);
+    return output;
+}
+
+float4 psmain(VS_OUTPUT input) : SV_TARGET
+{
+    // Only the top-left render size of the texture holds this frame
+    return scene_color.Sample(linear_clamp, min(input.uv * m_uv_scale, m_uv_max));
+}